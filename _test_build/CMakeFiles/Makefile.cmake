@@ -0,0 +1,496 @@
+# CMAKE generated file: DO NOT EDIT!
+# Generated by "Unix Makefiles" Generator, CMake Version 3.25
+
+# The generator used is:
+set(CMAKE_DEPENDS_GENERATOR "Unix Makefiles")
+
+# The top level Makefile was generated from the following files:
+set(CMAKE_MAKEFILE_DEPENDS
+  "CMakeCache.txt"
+  "/root/repo/CMakeLists.txt"
+  "CMakeFiles/3.25.1/CMakeCCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeCXXCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeSystem.cmake"
+  "/root/repo/binfmt/CMakeLists.txt"
+  "/root/repo/cmake/FindFilesystem.cmake"
+  "/root/repo/include/CMakeLists.txt"
+  "/root/repo/include/common/version.h.in"
+  "/root/repo/lib/CMakeLists.txt"
+  "/root/repo/lib/ast/CMakeLists.txt"
+  "/root/repo/lib/common/CMakeLists.txt"
+  "/root/repo/lib/host/CMakeLists.txt"
+  "/root/repo/lib/host/ssvm_process/CMakeLists.txt"
+  "/root/repo/lib/host/wasi/CMakeLists.txt"
+  "/root/repo/lib/host/wasi_threads/CMakeLists.txt"
+  "/root/repo/lib/interpreter/CMakeLists.txt"
+  "/root/repo/lib/loader/CMakeLists.txt"
+  "/root/repo/lib/validator/CMakeLists.txt"
+  "/root/repo/lib/vm/CMakeLists.txt"
+  "/root/repo/test/CMakeLists.txt"
+  "/root/repo/test/ast/CMakeLists.txt"
+  "/root/repo/test/expected/CMakeLists.txt"
+  "/root/repo/test/externref/CMakeLists.txt"
+  "/root/repo/test/externref/externrefTestData/funcs.wasm"
+  "/root/repo/test/externref/externrefTestData/funcs.wat"
+  "/root/repo/test/externref/externrefTestData/stl.wasm"
+  "/root/repo/test/externref/externrefTestData/stl.wat"
+  "/root/repo/test/host/ssvm_process/CMakeLists.txt"
+  "/root/repo/test/host/wasi/CMakeLists.txt"
+  "/root/repo/test/host/wasi_threads/CMakeLists.txt"
+  "/root/repo/test/interpreter/CMakeLists.txt"
+  "/root/repo/test/loader/CMakeLists.txt"
+  "/root/repo/test/loader/ethereumTestData/token.wasm"
+  "/root/repo/test/loader/filemgrTestData/readByteTest.bin"
+  "/root/repo/test/loader/filemgrTestData/readF32Test.bin"
+  "/root/repo/test/loader/filemgrTestData/readF64Test.bin"
+  "/root/repo/test/loader/filemgrTestData/readNameTest.bin"
+  "/root/repo/test/loader/filemgrTestData/readS32Test.bin"
+  "/root/repo/test/loader/filemgrTestData/readS32TestTooLarge.bin"
+  "/root/repo/test/loader/filemgrTestData/readS32TestTooLong.bin"
+  "/root/repo/test/loader/filemgrTestData/readS64Test.bin"
+  "/root/repo/test/loader/filemgrTestData/readS64TestTooLarge.bin"
+  "/root/repo/test/loader/filemgrTestData/readS64TestTooLong.bin"
+  "/root/repo/test/loader/filemgrTestData/readU32Test.bin"
+  "/root/repo/test/loader/filemgrTestData/readU32TestTooLarge.bin"
+  "/root/repo/test/loader/filemgrTestData/readU32TestTooLong.bin"
+  "/root/repo/test/loader/filemgrTestData/readU64Test.bin"
+  "/root/repo/test/loader/filemgrTestData/readU64TestTooLarge.bin"
+  "/root/repo/test/loader/filemgrTestData/readU64TestTooLong.bin"
+  "/root/repo/test/loader/wagonTestData/add-ex-main.wasm"
+  "/root/repo/test/loader/wagonTestData/add-ex-main.wat"
+  "/root/repo/test/loader/wagonTestData/add-ex.wasm"
+  "/root/repo/test/loader/wagonTestData/add-ex.wat"
+  "/root/repo/test/loader/wagonTestData/address.wasm"
+  "/root/repo/test/loader/wagonTestData/address.wat"
+  "/root/repo/test/loader/wagonTestData/basic.wasm"
+  "/root/repo/test/loader/wagonTestData/basic.wat"
+  "/root/repo/test/loader/wagonTestData/binary.wasm"
+  "/root/repo/test/loader/wagonTestData/binary.wat"
+  "/root/repo/test/loader/wagonTestData/block.wasm"
+  "/root/repo/test/loader/wagonTestData/block.wat"
+  "/root/repo/test/loader/wagonTestData/br.wasm"
+  "/root/repo/test/loader/wagonTestData/br.wat"
+  "/root/repo/test/loader/wagonTestData/br_if.wasm"
+  "/root/repo/test/loader/wagonTestData/br_if.wat"
+  "/root/repo/test/loader/wagonTestData/br_table.wasm"
+  "/root/repo/test/loader/wagonTestData/br_table.wat"
+  "/root/repo/test/loader/wagonTestData/break-drop.wasm"
+  "/root/repo/test/loader/wagonTestData/break-drop.wat"
+  "/root/repo/test/loader/wagonTestData/brif-loop.wasm"
+  "/root/repo/test/loader/wagonTestData/brif-loop.wat"
+  "/root/repo/test/loader/wagonTestData/brif.wasm"
+  "/root/repo/test/loader/wagonTestData/brif.wat"
+  "/root/repo/test/loader/wagonTestData/brtable.wasm"
+  "/root/repo/test/loader/wagonTestData/brtable.wat"
+  "/root/repo/test/loader/wagonTestData/bug-49.wasm"
+  "/root/repo/test/loader/wagonTestData/bug-49.wat"
+  "/root/repo/test/loader/wagonTestData/call-zero-args.wasm"
+  "/root/repo/test/loader/wagonTestData/call-zero-args.wat"
+  "/root/repo/test/loader/wagonTestData/call.wasm"
+  "/root/repo/test/loader/wagonTestData/call.wat"
+  "/root/repo/test/loader/wagonTestData/call_indirect.wasm"
+  "/root/repo/test/loader/wagonTestData/call_indirect.wat"
+  "/root/repo/test/loader/wagonTestData/callindirect.wasm"
+  "/root/repo/test/loader/wagonTestData/callindirect.wat"
+  "/root/repo/test/loader/wagonTestData/cast.wasm"
+  "/root/repo/test/loader/wagonTestData/cast.wat"
+  "/root/repo/test/loader/wagonTestData/compare.wasm"
+  "/root/repo/test/loader/wagonTestData/compare.wat"
+  "/root/repo/test/loader/wagonTestData/convert.wasm"
+  "/root/repo/test/loader/wagonTestData/convert.wat"
+  "/root/repo/test/loader/wagonTestData/custom_section.wasm"
+  "/root/repo/test/loader/wagonTestData/empty.wasm"
+  "/root/repo/test/loader/wagonTestData/empty.wat"
+  "/root/repo/test/loader/wagonTestData/endianness.wasm"
+  "/root/repo/test/loader/wagonTestData/endianness.wat"
+  "/root/repo/test/loader/wagonTestData/expr-block.wasm"
+  "/root/repo/test/loader/wagonTestData/expr-block.wat"
+  "/root/repo/test/loader/wagonTestData/expr-br.wasm"
+  "/root/repo/test/loader/wagonTestData/expr-br.wat"
+  "/root/repo/test/loader/wagonTestData/expr-brif.wasm"
+  "/root/repo/test/loader/wagonTestData/expr-brif.wat"
+  "/root/repo/test/loader/wagonTestData/expr-if.wasm"
+  "/root/repo/test/loader/wagonTestData/expr-if.wat"
+  "/root/repo/test/loader/wagonTestData/f64.wasm"
+  "/root/repo/test/loader/wagonTestData/f64.wat"
+  "/root/repo/test/loader/wagonTestData/fac.wasm"
+  "/root/repo/test/loader/wagonTestData/fac.wat"
+  "/root/repo/test/loader/wagonTestData/forward.wasm"
+  "/root/repo/test/loader/wagonTestData/forward.wat"
+  "/root/repo/test/loader/wagonTestData/get_local.wasm"
+  "/root/repo/test/loader/wagonTestData/get_local.wat"
+  "/root/repo/test/loader/wagonTestData/globals.wasm"
+  "/root/repo/test/loader/wagonTestData/globals.wat"
+  "/root/repo/test/loader/wagonTestData/hello-world-tinygo.wasm"
+  "/root/repo/test/loader/wagonTestData/hello-world-tinygo.wat"
+  "/root/repo/test/loader/wagonTestData/i32.wasm"
+  "/root/repo/test/loader/wagonTestData/i32.wat"
+  "/root/repo/test/loader/wagonTestData/i64.wasm"
+  "/root/repo/test/loader/wagonTestData/i64.wat"
+  "/root/repo/test/loader/wagonTestData/if.wasm"
+  "/root/repo/test/loader/wagonTestData/if.wat"
+  "/root/repo/test/loader/wagonTestData/ifelse-stack-bug.wasm"
+  "/root/repo/test/loader/wagonTestData/ifelse-stack-bug.wat"
+  "/root/repo/test/loader/wagonTestData/int_exprs.wasm"
+  "/root/repo/test/loader/wagonTestData/int_exprs.wat"
+  "/root/repo/test/loader/wagonTestData/load.wasm"
+  "/root/repo/test/loader/wagonTestData/load.wat"
+  "/root/repo/test/loader/wagonTestData/loop.wasm"
+  "/root/repo/test/loader/wagonTestData/loop.wat"
+  "/root/repo/test/loader/wagonTestData/memory_redundancy.wasm"
+  "/root/repo/test/loader/wagonTestData/memory_redundancy.wat"
+  "/root/repo/test/loader/wagonTestData/names.wasm"
+  "/root/repo/test/loader/wagonTestData/names.wat"
+  "/root/repo/test/loader/wagonTestData/nested-if.wasm"
+  "/root/repo/test/loader/wagonTestData/nested-if.wat"
+  "/root/repo/test/loader/wagonTestData/nofuncs.wasm"
+  "/root/repo/test/loader/wagonTestData/nofuncs.wat"
+  "/root/repo/test/loader/wagonTestData/nop.wasm"
+  "/root/repo/test/loader/wagonTestData/nop.wat"
+  "/root/repo/test/loader/wagonTestData/resizing.wasm"
+  "/root/repo/test/loader/wagonTestData/resizing.wat"
+  "/root/repo/test/loader/wagonTestData/return-void.wasm"
+  "/root/repo/test/loader/wagonTestData/return-void.wat"
+  "/root/repo/test/loader/wagonTestData/return.wasm"
+  "/root/repo/test/loader/wagonTestData/return.wat"
+  "/root/repo/test/loader/wagonTestData/rust-basic.wasm"
+  "/root/repo/test/loader/wagonTestData/rust-basic.wat"
+  "/root/repo/test/loader/wagonTestData/select.wasm"
+  "/root/repo/test/loader/wagonTestData/select.wat"
+  "/root/repo/test/loader/wagonTestData/start.wasm"
+  "/root/repo/test/loader/wagonTestData/start.wat"
+  "/root/repo/test/loader/wagonTestData/store.wasm"
+  "/root/repo/test/loader/wagonTestData/store.wat"
+  "/root/repo/test/loader/wagonTestData/switch.wasm"
+  "/root/repo/test/loader/wagonTestData/switch.wat"
+  "/root/repo/test/loader/wagonTestData/tee_local.wasm"
+  "/root/repo/test/loader/wagonTestData/tee_local.wat"
+  "/root/repo/test/loader/wagonTestData/traps_int_div.wasm"
+  "/root/repo/test/loader/wagonTestData/traps_int_div.wat"
+  "/root/repo/test/loader/wagonTestData/traps_int_rem.wasm"
+  "/root/repo/test/loader/wagonTestData/traps_int_rem.wat"
+  "/root/repo/test/loader/wagonTestData/traps_mem.wasm"
+  "/root/repo/test/loader/wagonTestData/traps_mem.wat"
+  "/root/repo/test/loader/wagonTestData/unary.wasm"
+  "/root/repo/test/loader/wagonTestData/unary.wat"
+  "/root/repo/test/loader/wagonTestData/unreachable.wasm"
+  "/root/repo/test/loader/wagonTestData/unreachable.wat"
+  "/root/repo/test/loader/wagonTestData/unwind.wasm"
+  "/root/repo/test/loader/wagonTestData/unwind.wat"
+  "/root/repo/test/memlimit/CMakeLists.txt"
+  "/root/repo/test/po/CMakeLists.txt"
+  "/root/repo/test/runtime/CMakeLists.txt"
+  "/root/repo/test/span/CMakeLists.txt"
+  "/root/repo/test/spec/CMakeLists.txt"
+  "/root/repo/test/validator/CMakeLists.txt"
+  "/root/repo/thirdparty/CMakeLists.txt"
+  "/root/repo/thirdparty/easyloggingpp/CMakeLists.txt"
+  "/root/repo/thirdparty/googletest/CMakeLists.txt"
+  "/root/repo/tools/CMakeLists.txt"
+  "/root/repo/tools/ssvm/CMakeLists.txt"
+  "/root/repo/tools/ssvm/examples/factorial.wasm"
+  "/root/repo/tools/ssvm/examples/factorial.wat"
+  "/root/repo/tools/ssvm/examples/fibonacci.wasm"
+  "/root/repo/tools/ssvm/examples/fibonacci.wat"
+  "/usr/lib/x86_64-linux-gnu/cmake/Boost-1.74.0/BoostConfig.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/Boost-1.74.0/BoostConfigVersion.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/boost_headers-1.74.0/boost_headers-config-version.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/boost_headers-1.74.0/boost_headers-config.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCXXInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCommonLanguageInclude.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeGenericSystem.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeInitializeConfigs.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeLanguageInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakePushCheckState.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInitialize.cmake"
+  "/usr/share/cmake-3.25/Modules/CPack.cmake"
+  "/usr/share/cmake-3.25/Modules/CPackComponent.cmake"
+  "/usr/share/cmake-3.25/Modules/CTest.cmake"
+  "/usr/share/cmake-3.25/Modules/CTestTargets.cmake"
+  "/usr/share/cmake-3.25/Modules/CTestUseLaunchers.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCXXSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckIncludeFile.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckIncludeFileCXX.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckLibraryExists.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/CMakeCommonCompilerMacros.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/DartConfiguration.tcl.in"
+  "/usr/share/cmake-3.25/Modules/FetchContent.cmake"
+  "/usr/share/cmake-3.25/Modules/FindBoost.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageHandleStandardArgs.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageMessage.cmake"
+  "/usr/share/cmake-3.25/Modules/FindThreads.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/UnixPaths.cmake"
+  "/usr/share/cmake-3.25/Templates/CPackConfig.cmake.in"
+  )
+
+# The corresponding makefile is:
+set(CMAKE_MAKEFILE_OUTPUTS
+  "Makefile"
+  "CMakeFiles/cmake.check_cache"
+  )
+
+# Byproducts of CMake generate step:
+set(CMAKE_MAKEFILE_PRODUCTS
+  "DartConfiguration.tcl"
+  "CPackConfig.cmake"
+  "CPackSourceConfig.cmake"
+  "CMakeFiles/CMakeDirectoryInformation.cmake"
+  "test/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "test/spec/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "test/ast/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "test/loader/filemgrTestData/readByteTest.bin"
+  "test/loader/filemgrTestData/readF32Test.bin"
+  "test/loader/filemgrTestData/readF64Test.bin"
+  "test/loader/filemgrTestData/readNameTest.bin"
+  "test/loader/filemgrTestData/readS32Test.bin"
+  "test/loader/filemgrTestData/readS32TestTooLarge.bin"
+  "test/loader/filemgrTestData/readS32TestTooLong.bin"
+  "test/loader/filemgrTestData/readS64Test.bin"
+  "test/loader/filemgrTestData/readS64TestTooLarge.bin"
+  "test/loader/filemgrTestData/readS64TestTooLong.bin"
+  "test/loader/filemgrTestData/readU32Test.bin"
+  "test/loader/filemgrTestData/readU32TestTooLarge.bin"
+  "test/loader/filemgrTestData/readU32TestTooLong.bin"
+  "test/loader/filemgrTestData/readU64Test.bin"
+  "test/loader/filemgrTestData/readU64TestTooLarge.bin"
+  "test/loader/filemgrTestData/readU64TestTooLong.bin"
+  "test/loader/wagonTestData/add-ex-main.wasm"
+  "test/loader/wagonTestData/add-ex-main.wat"
+  "test/loader/wagonTestData/add-ex.wasm"
+  "test/loader/wagonTestData/add-ex.wat"
+  "test/loader/wagonTestData/address.wasm"
+  "test/loader/wagonTestData/address.wat"
+  "test/loader/wagonTestData/basic.wasm"
+  "test/loader/wagonTestData/basic.wat"
+  "test/loader/wagonTestData/binary.wasm"
+  "test/loader/wagonTestData/binary.wat"
+  "test/loader/wagonTestData/block.wasm"
+  "test/loader/wagonTestData/block.wat"
+  "test/loader/wagonTestData/br.wasm"
+  "test/loader/wagonTestData/br.wat"
+  "test/loader/wagonTestData/br_if.wasm"
+  "test/loader/wagonTestData/br_if.wat"
+  "test/loader/wagonTestData/br_table.wasm"
+  "test/loader/wagonTestData/br_table.wat"
+  "test/loader/wagonTestData/break-drop.wasm"
+  "test/loader/wagonTestData/break-drop.wat"
+  "test/loader/wagonTestData/brif-loop.wasm"
+  "test/loader/wagonTestData/brif-loop.wat"
+  "test/loader/wagonTestData/brif.wasm"
+  "test/loader/wagonTestData/brif.wat"
+  "test/loader/wagonTestData/brtable.wasm"
+  "test/loader/wagonTestData/brtable.wat"
+  "test/loader/wagonTestData/bug-49.wasm"
+  "test/loader/wagonTestData/bug-49.wat"
+  "test/loader/wagonTestData/call-zero-args.wasm"
+  "test/loader/wagonTestData/call-zero-args.wat"
+  "test/loader/wagonTestData/call.wasm"
+  "test/loader/wagonTestData/call.wat"
+  "test/loader/wagonTestData/call_indirect.wasm"
+  "test/loader/wagonTestData/call_indirect.wat"
+  "test/loader/wagonTestData/callindirect.wasm"
+  "test/loader/wagonTestData/callindirect.wat"
+  "test/loader/wagonTestData/cast.wasm"
+  "test/loader/wagonTestData/cast.wat"
+  "test/loader/wagonTestData/compare.wasm"
+  "test/loader/wagonTestData/compare.wat"
+  "test/loader/wagonTestData/convert.wasm"
+  "test/loader/wagonTestData/convert.wat"
+  "test/loader/wagonTestData/custom_section.wasm"
+  "test/loader/wagonTestData/empty.wasm"
+  "test/loader/wagonTestData/empty.wat"
+  "test/loader/wagonTestData/endianness.wasm"
+  "test/loader/wagonTestData/endianness.wat"
+  "test/loader/wagonTestData/expr-block.wasm"
+  "test/loader/wagonTestData/expr-block.wat"
+  "test/loader/wagonTestData/expr-br.wasm"
+  "test/loader/wagonTestData/expr-br.wat"
+  "test/loader/wagonTestData/expr-brif.wasm"
+  "test/loader/wagonTestData/expr-brif.wat"
+  "test/loader/wagonTestData/expr-if.wasm"
+  "test/loader/wagonTestData/expr-if.wat"
+  "test/loader/wagonTestData/f64.wasm"
+  "test/loader/wagonTestData/f64.wat"
+  "test/loader/wagonTestData/fac.wasm"
+  "test/loader/wagonTestData/fac.wat"
+  "test/loader/wagonTestData/forward.wasm"
+  "test/loader/wagonTestData/forward.wat"
+  "test/loader/wagonTestData/get_local.wasm"
+  "test/loader/wagonTestData/get_local.wat"
+  "test/loader/wagonTestData/globals.wasm"
+  "test/loader/wagonTestData/globals.wat"
+  "test/loader/wagonTestData/hello-world-tinygo.wasm"
+  "test/loader/wagonTestData/hello-world-tinygo.wat"
+  "test/loader/wagonTestData/i32.wasm"
+  "test/loader/wagonTestData/i32.wat"
+  "test/loader/wagonTestData/i64.wasm"
+  "test/loader/wagonTestData/i64.wat"
+  "test/loader/wagonTestData/if.wasm"
+  "test/loader/wagonTestData/if.wat"
+  "test/loader/wagonTestData/ifelse-stack-bug.wasm"
+  "test/loader/wagonTestData/ifelse-stack-bug.wat"
+  "test/loader/wagonTestData/int_exprs.wasm"
+  "test/loader/wagonTestData/int_exprs.wat"
+  "test/loader/wagonTestData/load.wasm"
+  "test/loader/wagonTestData/load.wat"
+  "test/loader/wagonTestData/loop.wasm"
+  "test/loader/wagonTestData/loop.wat"
+  "test/loader/wagonTestData/memory_redundancy.wasm"
+  "test/loader/wagonTestData/memory_redundancy.wat"
+  "test/loader/wagonTestData/names.wasm"
+  "test/loader/wagonTestData/names.wat"
+  "test/loader/wagonTestData/nested-if.wasm"
+  "test/loader/wagonTestData/nested-if.wat"
+  "test/loader/wagonTestData/nofuncs.wasm"
+  "test/loader/wagonTestData/nofuncs.wat"
+  "test/loader/wagonTestData/nop.wasm"
+  "test/loader/wagonTestData/nop.wat"
+  "test/loader/wagonTestData/resizing.wasm"
+  "test/loader/wagonTestData/resizing.wat"
+  "test/loader/wagonTestData/return-void.wasm"
+  "test/loader/wagonTestData/return-void.wat"
+  "test/loader/wagonTestData/return.wasm"
+  "test/loader/wagonTestData/return.wat"
+  "test/loader/wagonTestData/rust-basic.wasm"
+  "test/loader/wagonTestData/rust-basic.wat"
+  "test/loader/wagonTestData/select.wasm"
+  "test/loader/wagonTestData/select.wat"
+  "test/loader/wagonTestData/start.wasm"
+  "test/loader/wagonTestData/start.wat"
+  "test/loader/wagonTestData/store.wasm"
+  "test/loader/wagonTestData/store.wat"
+  "test/loader/wagonTestData/switch.wasm"
+  "test/loader/wagonTestData/switch.wat"
+  "test/loader/wagonTestData/tee_local.wasm"
+  "test/loader/wagonTestData/tee_local.wat"
+  "test/loader/wagonTestData/traps_int_div.wasm"
+  "test/loader/wagonTestData/traps_int_div.wat"
+  "test/loader/wagonTestData/traps_int_rem.wasm"
+  "test/loader/wagonTestData/traps_int_rem.wat"
+  "test/loader/wagonTestData/traps_mem.wasm"
+  "test/loader/wagonTestData/traps_mem.wat"
+  "test/loader/wagonTestData/unary.wasm"
+  "test/loader/wagonTestData/unary.wat"
+  "test/loader/wagonTestData/unreachable.wasm"
+  "test/loader/wagonTestData/unreachable.wat"
+  "test/loader/wagonTestData/unwind.wasm"
+  "test/loader/wagonTestData/unwind.wat"
+  "test/loader/ethereumTestData/token.wasm"
+  "test/loader/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "test/interpreter/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "test/host/ssvm_process/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "test/host/wasi/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "test/host/wasi_threads/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "test/externref/externrefTestData/funcs.wasm"
+  "test/externref/externrefTestData/funcs.wat"
+  "test/externref/externrefTestData/stl.wasm"
+  "test/externref/externrefTestData/stl.wat"
+  "test/externref/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "test/expected/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "test/span/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "test/po/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "test/memlimit/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "test/runtime/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "test/validator/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "include/common/version.h"
+  "include/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "lib/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "lib/ast/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "lib/common/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "lib/loader/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "lib/validator/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "lib/interpreter/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "lib/host/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "lib/host/wasi/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "lib/host/wasi_threads/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "lib/host/ssvm_process/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "lib/vm/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "thirdparty/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "thirdparty/easyloggingpp/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "thirdparty/googletest/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "binfmt/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tools/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tools/ssvm/examples/factorial.wasm"
+  "tools/ssvm/examples/factorial.wat"
+  "tools/ssvm/examples/fibonacci.wasm"
+  "tools/ssvm/examples/fibonacci.wat"
+  "tools/ssvm/CMakeFiles/CMakeDirectoryInformation.cmake"
+  )
+
+# Dependency information for all targets:
+set(CMAKE_DEPEND_INFO_FILES
+  "CMakeFiles/Experimental.dir/DependInfo.cmake"
+  "CMakeFiles/Nightly.dir/DependInfo.cmake"
+  "CMakeFiles/Continuous.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyMemoryCheck.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyStart.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyUpdate.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyConfigure.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyBuild.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyTest.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyCoverage.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyMemCheck.dir/DependInfo.cmake"
+  "CMakeFiles/NightlySubmit.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalStart.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalUpdate.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalConfigure.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalBuild.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalTest.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalCoverage.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalMemCheck.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalSubmit.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousStart.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousUpdate.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousConfigure.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousBuild.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousTest.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousCoverage.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousMemCheck.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousSubmit.dir/DependInfo.cmake"
+  "test/spec/CMakeFiles/ssvmTestSpec.dir/DependInfo.cmake"
+  "test/ast/CMakeFiles/ssvmASTTests.dir/DependInfo.cmake"
+  "test/loader/CMakeFiles/ssvmLoaderFileMgrTests.dir/DependInfo.cmake"
+  "test/loader/CMakeFiles/ssvmLoaderWagonTests.dir/DependInfo.cmake"
+  "test/loader/CMakeFiles/ssvmLoaderEthereumTests.dir/DependInfo.cmake"
+  "test/loader/CMakeFiles/ssvmLoaderSharedLibraryTestFixture.dir/DependInfo.cmake"
+  "test/loader/CMakeFiles/ssvmLoaderSharedLibraryTests.dir/DependInfo.cmake"
+  "test/loader/CMakeFiles/ssvmLoaderPerfMapTests.dir/DependInfo.cmake"
+  "test/interpreter/CMakeFiles/ssvmInterpreterCoreTests.dir/DependInfo.cmake"
+  "test/interpreter/CMakeFiles/ssvmInterpreterTemplateTests.dir/DependInfo.cmake"
+  "test/interpreter/CMakeFiles/ssvmInterpreterExecutionTests.dir/DependInfo.cmake"
+  "test/host/ssvm_process/CMakeFiles/ssvmProcessTests.dir/DependInfo.cmake"
+  "test/host/wasi/CMakeFiles/wasiTests.dir/DependInfo.cmake"
+  "test/host/wasi_threads/CMakeFiles/wasiThreadsTests.dir/DependInfo.cmake"
+  "test/externref/CMakeFiles/ssvmExternrefTests.dir/DependInfo.cmake"
+  "test/expected/CMakeFiles/expectedTests.dir/DependInfo.cmake"
+  "test/span/CMakeFiles/spanTests.dir/DependInfo.cmake"
+  "test/po/CMakeFiles/poTests.dir/DependInfo.cmake"
+  "test/memlimit/CMakeFiles/ssvmMemLimitTests.dir/DependInfo.cmake"
+  "test/runtime/CMakeFiles/ssvmRuntimeTests.dir/DependInfo.cmake"
+  "test/validator/CMakeFiles/ssvmValidatorTests.dir/DependInfo.cmake"
+  "lib/ast/CMakeFiles/ssvmAST.dir/DependInfo.cmake"
+  "lib/common/CMakeFiles/ssvmCommon.dir/DependInfo.cmake"
+  "lib/loader/CMakeFiles/ssvmLoaderFileMgr.dir/DependInfo.cmake"
+  "lib/loader/CMakeFiles/ssvmLoader.dir/DependInfo.cmake"
+  "lib/validator/CMakeFiles/ssvmValidator.dir/DependInfo.cmake"
+  "lib/interpreter/CMakeFiles/ssvmInterpreter.dir/DependInfo.cmake"
+  "lib/host/wasi/CMakeFiles/ssvmHostModuleWasi.dir/DependInfo.cmake"
+  "lib/host/wasi_threads/CMakeFiles/ssvmHostModuleWasiThreads.dir/DependInfo.cmake"
+  "lib/host/ssvm_process/CMakeFiles/ssvmHostModuleSSVMProcess.dir/DependInfo.cmake"
+  "lib/vm/CMakeFiles/ssvmVM.dir/DependInfo.cmake"
+  "thirdparty/easyloggingpp/CMakeFiles/utilLog.dir/DependInfo.cmake"
+  "thirdparty/googletest/CMakeFiles/utilGoogleTest.dir/DependInfo.cmake"
+  "tools/ssvm/CMakeFiles/ssvm.dir/DependInfo.cmake"
+  "tools/ssvm/CMakeFiles/ssvm-static.dir/DependInfo.cmake"
+  )
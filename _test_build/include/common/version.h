@@ -0,0 +1,25 @@
+// SPDX-License-Identifier: Apache-2.0
+//===-- ssvm/common/version.h - Version information -----------------------===//
+//
+// Part of the SSVM Project.
+//
+//===----------------------------------------------------------------------===//
+///
+/// \file
+/// This file contains version information that passed from configure stage.
+///
+//===----------------------------------------------------------------------===//
+#pragma once
+
+#include <string_view>
+
+namespace SSVM {
+
+using namespace std::literals::string_view_literals;
+
+#define CPACK_PACKAGE_VERSION "0.7.4-unreleased"sv
+static inline std::string_view kVersionString [[maybe_unused]] =
+    CPACK_PACKAGE_VERSION;
+#undef CPACK_PACKAGE_VERSION
+
+} // namespace SSVM
@@ -0,0 +1,13 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/lib
+# Build directory: /root/repo/_test_build/lib
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+subdirs("ast")
+subdirs("common")
+subdirs("loader")
+subdirs("validator")
+subdirs("interpreter")
+subdirs("host")
+subdirs("vm")
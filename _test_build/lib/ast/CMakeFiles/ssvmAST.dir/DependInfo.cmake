@@ -0,0 +1,28 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/lib/ast/description.cpp" "lib/ast/CMakeFiles/ssvmAST.dir/description.cpp.o" "gcc" "lib/ast/CMakeFiles/ssvmAST.dir/description.cpp.o.d"
+  "/root/repo/lib/ast/expression.cpp" "lib/ast/CMakeFiles/ssvmAST.dir/expression.cpp.o" "gcc" "lib/ast/CMakeFiles/ssvmAST.dir/expression.cpp.o.d"
+  "/root/repo/lib/ast/instruction.cpp" "lib/ast/CMakeFiles/ssvmAST.dir/instruction.cpp.o" "gcc" "lib/ast/CMakeFiles/ssvmAST.dir/instruction.cpp.o.d"
+  "/root/repo/lib/ast/module.cpp" "lib/ast/CMakeFiles/ssvmAST.dir/module.cpp.o" "gcc" "lib/ast/CMakeFiles/ssvmAST.dir/module.cpp.o.d"
+  "/root/repo/lib/ast/section.cpp" "lib/ast/CMakeFiles/ssvmAST.dir/section.cpp.o" "gcc" "lib/ast/CMakeFiles/ssvmAST.dir/section.cpp.o.d"
+  "/root/repo/lib/ast/segment.cpp" "lib/ast/CMakeFiles/ssvmAST.dir/segment.cpp.o" "gcc" "lib/ast/CMakeFiles/ssvmAST.dir/segment.cpp.o.d"
+  "/root/repo/lib/ast/type.cpp" "lib/ast/CMakeFiles/ssvmAST.dir/type.cpp.o" "gcc" "lib/ast/CMakeFiles/ssvmAST.dir/type.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_test_build/lib/loader/CMakeFiles/ssvmLoaderFileMgr.dir/DependInfo.cmake"
+  "/root/repo/_test_build/lib/common/CMakeFiles/ssvmCommon.dir/DependInfo.cmake"
+  "/root/repo/_test_build/thirdparty/easyloggingpp/CMakeFiles/utilLog.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
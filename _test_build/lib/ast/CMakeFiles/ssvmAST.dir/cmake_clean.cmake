@@ -0,0 +1,23 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ssvmAST.dir/description.cpp.o"
+  "CMakeFiles/ssvmAST.dir/description.cpp.o.d"
+  "CMakeFiles/ssvmAST.dir/expression.cpp.o"
+  "CMakeFiles/ssvmAST.dir/expression.cpp.o.d"
+  "CMakeFiles/ssvmAST.dir/instruction.cpp.o"
+  "CMakeFiles/ssvmAST.dir/instruction.cpp.o.d"
+  "CMakeFiles/ssvmAST.dir/module.cpp.o"
+  "CMakeFiles/ssvmAST.dir/module.cpp.o.d"
+  "CMakeFiles/ssvmAST.dir/section.cpp.o"
+  "CMakeFiles/ssvmAST.dir/section.cpp.o.d"
+  "CMakeFiles/ssvmAST.dir/segment.cpp.o"
+  "CMakeFiles/ssvmAST.dir/segment.cpp.o.d"
+  "CMakeFiles/ssvmAST.dir/type.cpp.o"
+  "CMakeFiles/ssvmAST.dir/type.cpp.o.d"
+  "libssvmAST.a"
+  "libssvmAST.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ssvmAST.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,23 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/lib/common/configure.cpp" "lib/common/CMakeFiles/ssvmCommon.dir/configure.cpp.o" "gcc" "lib/common/CMakeFiles/ssvmCommon.dir/configure.cpp.o.d"
+  "/root/repo/lib/common/functype.cpp" "lib/common/CMakeFiles/ssvmCommon.dir/functype.cpp.o" "gcc" "lib/common/CMakeFiles/ssvmCommon.dir/functype.cpp.o.d"
+  "/root/repo/lib/common/hexstr.cpp" "lib/common/CMakeFiles/ssvmCommon.dir/hexstr.cpp.o" "gcc" "lib/common/CMakeFiles/ssvmCommon.dir/hexstr.cpp.o.d"
+  "/root/repo/lib/common/log.cpp" "lib/common/CMakeFiles/ssvmCommon.dir/log.cpp.o" "gcc" "lib/common/CMakeFiles/ssvmCommon.dir/log.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_test_build/thirdparty/easyloggingpp/CMakeFiles/utilLog.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,17 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ssvmCommon.dir/configure.cpp.o"
+  "CMakeFiles/ssvmCommon.dir/configure.cpp.o.d"
+  "CMakeFiles/ssvmCommon.dir/functype.cpp.o"
+  "CMakeFiles/ssvmCommon.dir/functype.cpp.o.d"
+  "CMakeFiles/ssvmCommon.dir/hexstr.cpp.o"
+  "CMakeFiles/ssvmCommon.dir/hexstr.cpp.o.d"
+  "CMakeFiles/ssvmCommon.dir/log.cpp.o"
+  "CMakeFiles/ssvmCommon.dir/log.cpp.o.d"
+  "libssvmCommon.a"
+  "libssvmCommon.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ssvmCommon.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,9 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/lib/host
+# Build directory: /root/repo/_test_build/lib/host
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+subdirs("wasi")
+subdirs("wasi_threads")
+subdirs("ssvm_process")
@@ -0,0 +1,20 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/lib/host/ssvm_process/processfunc.cpp" "lib/host/ssvm_process/CMakeFiles/ssvmHostModuleSSVMProcess.dir/processfunc.cpp.o" "gcc" "lib/host/ssvm_process/CMakeFiles/ssvmHostModuleSSVMProcess.dir/processfunc.cpp.o.d"
+  "/root/repo/lib/host/ssvm_process/processmodule.cpp" "lib/host/ssvm_process/CMakeFiles/ssvmHostModuleSSVMProcess.dir/processmodule.cpp.o" "gcc" "lib/host/ssvm_process/CMakeFiles/ssvmHostModuleSSVMProcess.dir/processmodule.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
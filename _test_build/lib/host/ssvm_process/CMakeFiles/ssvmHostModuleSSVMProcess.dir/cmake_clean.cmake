@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ssvmHostModuleSSVMProcess.dir/processfunc.cpp.o"
+  "CMakeFiles/ssvmHostModuleSSVMProcess.dir/processfunc.cpp.o.d"
+  "CMakeFiles/ssvmHostModuleSSVMProcess.dir/processmodule.cpp.o"
+  "CMakeFiles/ssvmHostModuleSSVMProcess.dir/processmodule.cpp.o.d"
+  "libssvmHostModuleSSVMProcess.a"
+  "libssvmHostModuleSSVMProcess.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ssvmHostModuleSSVMProcess.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,21 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/lib/host/wasi/wasienv.cpp" "lib/host/wasi/CMakeFiles/ssvmHostModuleWasi.dir/wasienv.cpp.o" "gcc" "lib/host/wasi/CMakeFiles/ssvmHostModuleWasi.dir/wasienv.cpp.o.d"
+  "/root/repo/lib/host/wasi/wasifunc.cpp" "lib/host/wasi/CMakeFiles/ssvmHostModuleWasi.dir/wasifunc.cpp.o" "gcc" "lib/host/wasi/CMakeFiles/ssvmHostModuleWasi.dir/wasifunc.cpp.o.d"
+  "/root/repo/lib/host/wasi/wasimodule.cpp" "lib/host/wasi/CMakeFiles/ssvmHostModuleWasi.dir/wasimodule.cpp.o" "gcc" "lib/host/wasi/CMakeFiles/ssvmHostModuleWasi.dir/wasimodule.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
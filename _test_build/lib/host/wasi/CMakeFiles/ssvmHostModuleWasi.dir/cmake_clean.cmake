@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ssvmHostModuleWasi.dir/wasienv.cpp.o"
+  "CMakeFiles/ssvmHostModuleWasi.dir/wasienv.cpp.o.d"
+  "CMakeFiles/ssvmHostModuleWasi.dir/wasifunc.cpp.o"
+  "CMakeFiles/ssvmHostModuleWasi.dir/wasifunc.cpp.o.d"
+  "CMakeFiles/ssvmHostModuleWasi.dir/wasimodule.cpp.o"
+  "CMakeFiles/ssvmHostModuleWasi.dir/wasimodule.cpp.o.d"
+  "libssvmHostModuleWasi.a"
+  "libssvmHostModuleWasi.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ssvmHostModuleWasi.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,21 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/lib/host/wasi_threads/threadsenv.cpp" "lib/host/wasi_threads/CMakeFiles/ssvmHostModuleWasiThreads.dir/threadsenv.cpp.o" "gcc" "lib/host/wasi_threads/CMakeFiles/ssvmHostModuleWasiThreads.dir/threadsenv.cpp.o.d"
+  "/root/repo/lib/host/wasi_threads/threadsfunc.cpp" "lib/host/wasi_threads/CMakeFiles/ssvmHostModuleWasiThreads.dir/threadsfunc.cpp.o" "gcc" "lib/host/wasi_threads/CMakeFiles/ssvmHostModuleWasiThreads.dir/threadsfunc.cpp.o.d"
+  "/root/repo/lib/host/wasi_threads/threadsmodule.cpp" "lib/host/wasi_threads/CMakeFiles/ssvmHostModuleWasiThreads.dir/threadsmodule.cpp.o" "gcc" "lib/host/wasi_threads/CMakeFiles/ssvmHostModuleWasiThreads.dir/threadsmodule.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ssvmHostModuleWasiThreads.dir/threadsenv.cpp.o"
+  "CMakeFiles/ssvmHostModuleWasiThreads.dir/threadsenv.cpp.o.d"
+  "CMakeFiles/ssvmHostModuleWasiThreads.dir/threadsfunc.cpp.o"
+  "CMakeFiles/ssvmHostModuleWasiThreads.dir/threadsfunc.cpp.o.d"
+  "CMakeFiles/ssvmHostModuleWasiThreads.dir/threadsmodule.cpp.o"
+  "CMakeFiles/ssvmHostModuleWasiThreads.dir/threadsmodule.cpp.o.d"
+  "libssvmHostModuleWasiThreads.a"
+  "libssvmHostModuleWasiThreads.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ssvmHostModuleWasiThreads.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,39 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/lib/interpreter/engine/control.cpp" "lib/interpreter/CMakeFiles/ssvmInterpreter.dir/engine/control.cpp.o" "gcc" "lib/interpreter/CMakeFiles/ssvmInterpreter.dir/engine/control.cpp.o.d"
+  "/root/repo/lib/interpreter/engine/engine.cpp" "lib/interpreter/CMakeFiles/ssvmInterpreter.dir/engine/engine.cpp.o" "gcc" "lib/interpreter/CMakeFiles/ssvmInterpreter.dir/engine/engine.cpp.o.d"
+  "/root/repo/lib/interpreter/engine/memory.cpp" "lib/interpreter/CMakeFiles/ssvmInterpreter.dir/engine/memory.cpp.o" "gcc" "lib/interpreter/CMakeFiles/ssvmInterpreter.dir/engine/memory.cpp.o.d"
+  "/root/repo/lib/interpreter/engine/proxy.cpp" "lib/interpreter/CMakeFiles/ssvmInterpreter.dir/engine/proxy.cpp.o" "gcc" "lib/interpreter/CMakeFiles/ssvmInterpreter.dir/engine/proxy.cpp.o.d"
+  "/root/repo/lib/interpreter/engine/table.cpp" "lib/interpreter/CMakeFiles/ssvmInterpreter.dir/engine/table.cpp.o" "gcc" "lib/interpreter/CMakeFiles/ssvmInterpreter.dir/engine/table.cpp.o.d"
+  "/root/repo/lib/interpreter/engine/variable.cpp" "lib/interpreter/CMakeFiles/ssvmInterpreter.dir/engine/variable.cpp.o" "gcc" "lib/interpreter/CMakeFiles/ssvmInterpreter.dir/engine/variable.cpp.o.d"
+  "/root/repo/lib/interpreter/helper.cpp" "lib/interpreter/CMakeFiles/ssvmInterpreter.dir/helper.cpp.o" "gcc" "lib/interpreter/CMakeFiles/ssvmInterpreter.dir/helper.cpp.o.d"
+  "/root/repo/lib/interpreter/instantiate/data.cpp" "lib/interpreter/CMakeFiles/ssvmInterpreter.dir/instantiate/data.cpp.o" "gcc" "lib/interpreter/CMakeFiles/ssvmInterpreter.dir/instantiate/data.cpp.o.d"
+  "/root/repo/lib/interpreter/instantiate/elem.cpp" "lib/interpreter/CMakeFiles/ssvmInterpreter.dir/instantiate/elem.cpp.o" "gcc" "lib/interpreter/CMakeFiles/ssvmInterpreter.dir/instantiate/elem.cpp.o.d"
+  "/root/repo/lib/interpreter/instantiate/export.cpp" "lib/interpreter/CMakeFiles/ssvmInterpreter.dir/instantiate/export.cpp.o" "gcc" "lib/interpreter/CMakeFiles/ssvmInterpreter.dir/instantiate/export.cpp.o.d"
+  "/root/repo/lib/interpreter/instantiate/function.cpp" "lib/interpreter/CMakeFiles/ssvmInterpreter.dir/instantiate/function.cpp.o" "gcc" "lib/interpreter/CMakeFiles/ssvmInterpreter.dir/instantiate/function.cpp.o.d"
+  "/root/repo/lib/interpreter/instantiate/global.cpp" "lib/interpreter/CMakeFiles/ssvmInterpreter.dir/instantiate/global.cpp.o" "gcc" "lib/interpreter/CMakeFiles/ssvmInterpreter.dir/instantiate/global.cpp.o.d"
+  "/root/repo/lib/interpreter/instantiate/import.cpp" "lib/interpreter/CMakeFiles/ssvmInterpreter.dir/instantiate/import.cpp.o" "gcc" "lib/interpreter/CMakeFiles/ssvmInterpreter.dir/instantiate/import.cpp.o.d"
+  "/root/repo/lib/interpreter/instantiate/memory.cpp" "lib/interpreter/CMakeFiles/ssvmInterpreter.dir/instantiate/memory.cpp.o" "gcc" "lib/interpreter/CMakeFiles/ssvmInterpreter.dir/instantiate/memory.cpp.o.d"
+  "/root/repo/lib/interpreter/instantiate/module.cpp" "lib/interpreter/CMakeFiles/ssvmInterpreter.dir/instantiate/module.cpp.o" "gcc" "lib/interpreter/CMakeFiles/ssvmInterpreter.dir/instantiate/module.cpp.o.d"
+  "/root/repo/lib/interpreter/instantiate/table.cpp" "lib/interpreter/CMakeFiles/ssvmInterpreter.dir/instantiate/table.cpp.o" "gcc" "lib/interpreter/CMakeFiles/ssvmInterpreter.dir/instantiate/table.cpp.o.d"
+  "/root/repo/lib/interpreter/instantiate/tag.cpp" "lib/interpreter/CMakeFiles/ssvmInterpreter.dir/instantiate/tag.cpp.o" "gcc" "lib/interpreter/CMakeFiles/ssvmInterpreter.dir/instantiate/tag.cpp.o.d"
+  "/root/repo/lib/interpreter/instantiate/template.cpp" "lib/interpreter/CMakeFiles/ssvmInterpreter.dir/instantiate/template.cpp.o" "gcc" "lib/interpreter/CMakeFiles/ssvmInterpreter.dir/instantiate/template.cpp.o.d"
+  "/root/repo/lib/interpreter/interpreter.cpp" "lib/interpreter/CMakeFiles/ssvmInterpreter.dir/interpreter.cpp.o" "gcc" "lib/interpreter/CMakeFiles/ssvmInterpreter.dir/interpreter.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_test_build/lib/common/CMakeFiles/ssvmCommon.dir/DependInfo.cmake"
+  "/root/repo/_test_build/thirdparty/easyloggingpp/CMakeFiles/utilLog.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
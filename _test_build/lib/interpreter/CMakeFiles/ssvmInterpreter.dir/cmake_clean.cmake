@@ -0,0 +1,47 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ssvmInterpreter.dir/engine/control.cpp.o"
+  "CMakeFiles/ssvmInterpreter.dir/engine/control.cpp.o.d"
+  "CMakeFiles/ssvmInterpreter.dir/engine/engine.cpp.o"
+  "CMakeFiles/ssvmInterpreter.dir/engine/engine.cpp.o.d"
+  "CMakeFiles/ssvmInterpreter.dir/engine/memory.cpp.o"
+  "CMakeFiles/ssvmInterpreter.dir/engine/memory.cpp.o.d"
+  "CMakeFiles/ssvmInterpreter.dir/engine/proxy.cpp.o"
+  "CMakeFiles/ssvmInterpreter.dir/engine/proxy.cpp.o.d"
+  "CMakeFiles/ssvmInterpreter.dir/engine/table.cpp.o"
+  "CMakeFiles/ssvmInterpreter.dir/engine/table.cpp.o.d"
+  "CMakeFiles/ssvmInterpreter.dir/engine/variable.cpp.o"
+  "CMakeFiles/ssvmInterpreter.dir/engine/variable.cpp.o.d"
+  "CMakeFiles/ssvmInterpreter.dir/helper.cpp.o"
+  "CMakeFiles/ssvmInterpreter.dir/helper.cpp.o.d"
+  "CMakeFiles/ssvmInterpreter.dir/instantiate/data.cpp.o"
+  "CMakeFiles/ssvmInterpreter.dir/instantiate/data.cpp.o.d"
+  "CMakeFiles/ssvmInterpreter.dir/instantiate/elem.cpp.o"
+  "CMakeFiles/ssvmInterpreter.dir/instantiate/elem.cpp.o.d"
+  "CMakeFiles/ssvmInterpreter.dir/instantiate/export.cpp.o"
+  "CMakeFiles/ssvmInterpreter.dir/instantiate/export.cpp.o.d"
+  "CMakeFiles/ssvmInterpreter.dir/instantiate/function.cpp.o"
+  "CMakeFiles/ssvmInterpreter.dir/instantiate/function.cpp.o.d"
+  "CMakeFiles/ssvmInterpreter.dir/instantiate/global.cpp.o"
+  "CMakeFiles/ssvmInterpreter.dir/instantiate/global.cpp.o.d"
+  "CMakeFiles/ssvmInterpreter.dir/instantiate/import.cpp.o"
+  "CMakeFiles/ssvmInterpreter.dir/instantiate/import.cpp.o.d"
+  "CMakeFiles/ssvmInterpreter.dir/instantiate/memory.cpp.o"
+  "CMakeFiles/ssvmInterpreter.dir/instantiate/memory.cpp.o.d"
+  "CMakeFiles/ssvmInterpreter.dir/instantiate/module.cpp.o"
+  "CMakeFiles/ssvmInterpreter.dir/instantiate/module.cpp.o.d"
+  "CMakeFiles/ssvmInterpreter.dir/instantiate/table.cpp.o"
+  "CMakeFiles/ssvmInterpreter.dir/instantiate/table.cpp.o.d"
+  "CMakeFiles/ssvmInterpreter.dir/instantiate/tag.cpp.o"
+  "CMakeFiles/ssvmInterpreter.dir/instantiate/tag.cpp.o.d"
+  "CMakeFiles/ssvmInterpreter.dir/instantiate/template.cpp.o"
+  "CMakeFiles/ssvmInterpreter.dir/instantiate/template.cpp.o.d"
+  "CMakeFiles/ssvmInterpreter.dir/interpreter.cpp.o"
+  "CMakeFiles/ssvmInterpreter.dir/interpreter.cpp.o.d"
+  "libssvmInterpreter.a"
+  "libssvmInterpreter.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ssvmInterpreter.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,23 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/lib/loader/loader.cpp" "lib/loader/CMakeFiles/ssvmLoader.dir/loader.cpp.o" "gcc" "lib/loader/CMakeFiles/ssvmLoader.dir/loader.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_test_build/lib/ast/CMakeFiles/ssvmAST.dir/DependInfo.cmake"
+  "/root/repo/_test_build/lib/loader/CMakeFiles/ssvmLoaderFileMgr.dir/DependInfo.cmake"
+  "/root/repo/_test_build/lib/common/CMakeFiles/ssvmCommon.dir/DependInfo.cmake"
+  "/root/repo/_test_build/thirdparty/easyloggingpp/CMakeFiles/utilLog.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ssvmLoader.dir/loader.cpp.o"
+  "CMakeFiles/ssvmLoader.dir/loader.cpp.o.d"
+  "libssvmLoader.a"
+  "libssvmLoader.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ssvmLoader.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
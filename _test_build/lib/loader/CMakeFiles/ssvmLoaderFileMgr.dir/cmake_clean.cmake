@@ -0,0 +1,17 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ssvmLoaderFileMgr.dir/filemgr.cpp.o"
+  "CMakeFiles/ssvmLoaderFileMgr.dir/filemgr.cpp.o.d"
+  "CMakeFiles/ssvmLoaderFileMgr.dir/ldmgr.cpp.o"
+  "CMakeFiles/ssvmLoaderFileMgr.dir/ldmgr.cpp.o.d"
+  "CMakeFiles/ssvmLoaderFileMgr.dir/perfmap.cpp.o"
+  "CMakeFiles/ssvmLoaderFileMgr.dir/perfmap.cpp.o.d"
+  "CMakeFiles/ssvmLoaderFileMgr.dir/shared_library.cpp.o"
+  "CMakeFiles/ssvmLoaderFileMgr.dir/shared_library.cpp.o.d"
+  "libssvmLoaderFileMgr.a"
+  "libssvmLoaderFileMgr.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ssvmLoaderFileMgr.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,22 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/lib/validator/formchecker.cpp" "lib/validator/CMakeFiles/ssvmValidator.dir/formchecker.cpp.o" "gcc" "lib/validator/CMakeFiles/ssvmValidator.dir/formchecker.cpp.o.d"
+  "/root/repo/lib/validator/validator.cpp" "lib/validator/CMakeFiles/ssvmValidator.dir/validator.cpp.o" "gcc" "lib/validator/CMakeFiles/ssvmValidator.dir/validator.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_test_build/lib/common/CMakeFiles/ssvmCommon.dir/DependInfo.cmake"
+  "/root/repo/_test_build/thirdparty/easyloggingpp/CMakeFiles/utilLog.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ssvmValidator.dir/formchecker.cpp.o"
+  "CMakeFiles/ssvmValidator.dir/formchecker.cpp.o.d"
+  "CMakeFiles/ssvmValidator.dir/validator.cpp.o"
+  "CMakeFiles/ssvmValidator.dir/validator.cpp.o.d"
+  "libssvmValidator.a"
+  "libssvmValidator.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ssvmValidator.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ssvmVM.dir/vm.cpp.o"
+  "CMakeFiles/ssvmVM.dir/vm.cpp.o.d"
+  "libssvmVM.a"
+  "libssvmVM.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ssvmVM.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
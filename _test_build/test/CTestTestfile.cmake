@@ -0,0 +1,20 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/test
+# Build directory: /root/repo/_test_build/test
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+subdirs("spec")
+subdirs("ast")
+subdirs("loader")
+subdirs("interpreter")
+subdirs("host/ssvm_process")
+subdirs("host/wasi")
+subdirs("host/wasi_threads")
+subdirs("externref")
+subdirs("expected")
+subdirs("span")
+subdirs("po")
+subdirs("memlimit")
+subdirs("runtime")
+subdirs("validator")
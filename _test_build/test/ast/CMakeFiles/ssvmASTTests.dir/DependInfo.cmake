@@ -0,0 +1,30 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/test/ast/descriptionTest.cpp" "test/ast/CMakeFiles/ssvmASTTests.dir/descriptionTest.cpp.o" "gcc" "test/ast/CMakeFiles/ssvmASTTests.dir/descriptionTest.cpp.o.d"
+  "/root/repo/test/ast/expressionTest.cpp" "test/ast/CMakeFiles/ssvmASTTests.dir/expressionTest.cpp.o" "gcc" "test/ast/CMakeFiles/ssvmASTTests.dir/expressionTest.cpp.o.d"
+  "/root/repo/test/ast/instructionTest.cpp" "test/ast/CMakeFiles/ssvmASTTests.dir/instructionTest.cpp.o" "gcc" "test/ast/CMakeFiles/ssvmASTTests.dir/instructionTest.cpp.o.d"
+  "/root/repo/test/ast/moduleTest.cpp" "test/ast/CMakeFiles/ssvmASTTests.dir/moduleTest.cpp.o" "gcc" "test/ast/CMakeFiles/ssvmASTTests.dir/moduleTest.cpp.o.d"
+  "/root/repo/test/ast/sectionTest.cpp" "test/ast/CMakeFiles/ssvmASTTests.dir/sectionTest.cpp.o" "gcc" "test/ast/CMakeFiles/ssvmASTTests.dir/sectionTest.cpp.o.d"
+  "/root/repo/test/ast/segmentTest.cpp" "test/ast/CMakeFiles/ssvmASTTests.dir/segmentTest.cpp.o" "gcc" "test/ast/CMakeFiles/ssvmASTTests.dir/segmentTest.cpp.o.d"
+  "/root/repo/test/ast/typeTest.cpp" "test/ast/CMakeFiles/ssvmASTTests.dir/typeTest.cpp.o" "gcc" "test/ast/CMakeFiles/ssvmASTTests.dir/typeTest.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_test_build/thirdparty/googletest/CMakeFiles/utilGoogleTest.dir/DependInfo.cmake"
+  "/root/repo/_test_build/lib/loader/CMakeFiles/ssvmLoaderFileMgr.dir/DependInfo.cmake"
+  "/root/repo/_test_build/lib/ast/CMakeFiles/ssvmAST.dir/DependInfo.cmake"
+  "/root/repo/_test_build/lib/common/CMakeFiles/ssvmCommon.dir/DependInfo.cmake"
+  "/root/repo/_test_build/thirdparty/easyloggingpp/CMakeFiles/utilLog.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
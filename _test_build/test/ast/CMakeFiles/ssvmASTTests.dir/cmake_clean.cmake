@@ -0,0 +1,23 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ssvmASTTests.dir/descriptionTest.cpp.o"
+  "CMakeFiles/ssvmASTTests.dir/descriptionTest.cpp.o.d"
+  "CMakeFiles/ssvmASTTests.dir/expressionTest.cpp.o"
+  "CMakeFiles/ssvmASTTests.dir/expressionTest.cpp.o.d"
+  "CMakeFiles/ssvmASTTests.dir/instructionTest.cpp.o"
+  "CMakeFiles/ssvmASTTests.dir/instructionTest.cpp.o.d"
+  "CMakeFiles/ssvmASTTests.dir/moduleTest.cpp.o"
+  "CMakeFiles/ssvmASTTests.dir/moduleTest.cpp.o.d"
+  "CMakeFiles/ssvmASTTests.dir/sectionTest.cpp.o"
+  "CMakeFiles/ssvmASTTests.dir/sectionTest.cpp.o.d"
+  "CMakeFiles/ssvmASTTests.dir/segmentTest.cpp.o"
+  "CMakeFiles/ssvmASTTests.dir/segmentTest.cpp.o.d"
+  "CMakeFiles/ssvmASTTests.dir/typeTest.cpp.o"
+  "CMakeFiles/ssvmASTTests.dir/typeTest.cpp.o.d"
+  "ssvmASTTests"
+  "ssvmASTTests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ssvmASTTests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
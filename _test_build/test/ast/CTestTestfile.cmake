@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/test/ast
+# Build directory: /root/repo/_test_build/test/ast
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(ssvmASTTests "ssvmASTTests")
+set_tests_properties(ssvmASTTests PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/ast/CMakeLists.txt;13;add_test;/root/repo/test/ast/CMakeLists.txt;0;")
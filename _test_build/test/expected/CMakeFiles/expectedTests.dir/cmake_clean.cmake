@@ -0,0 +1,33 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/expectedTests.dir/assignment.cpp.o"
+  "CMakeFiles/expectedTests.dir/assignment.cpp.o.d"
+  "CMakeFiles/expectedTests.dir/bases.cpp.o"
+  "CMakeFiles/expectedTests.dir/bases.cpp.o.d"
+  "CMakeFiles/expectedTests.dir/constexpr.cpp.o"
+  "CMakeFiles/expectedTests.dir/constexpr.cpp.o.d"
+  "CMakeFiles/expectedTests.dir/constructors.cpp.o"
+  "CMakeFiles/expectedTests.dir/constructors.cpp.o.d"
+  "CMakeFiles/expectedTests.dir/emplace.cpp.o"
+  "CMakeFiles/expectedTests.dir/emplace.cpp.o.d"
+  "CMakeFiles/expectedTests.dir/extensions.cpp.o"
+  "CMakeFiles/expectedTests.dir/extensions.cpp.o.d"
+  "CMakeFiles/expectedTests.dir/gtest.cpp.o"
+  "CMakeFiles/expectedTests.dir/gtest.cpp.o.d"
+  "CMakeFiles/expectedTests.dir/issues.cpp.o"
+  "CMakeFiles/expectedTests.dir/issues.cpp.o.d"
+  "CMakeFiles/expectedTests.dir/noexcept.cpp.o"
+  "CMakeFiles/expectedTests.dir/noexcept.cpp.o.d"
+  "CMakeFiles/expectedTests.dir/observers.cpp.o"
+  "CMakeFiles/expectedTests.dir/observers.cpp.o.d"
+  "CMakeFiles/expectedTests.dir/relops.cpp.o"
+  "CMakeFiles/expectedTests.dir/relops.cpp.o.d"
+  "CMakeFiles/expectedTests.dir/swap.cpp.o"
+  "CMakeFiles/expectedTests.dir/swap.cpp.o.d"
+  "expectedTests"
+  "expectedTests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/expectedTests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/test/expected
+# Build directory: /root/repo/_test_build/test/expected
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(expectedTests "expectedTests")
+set_tests_properties(expectedTests PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/expected/CMakeLists.txt;18;add_test;/root/repo/test/expected/CMakeLists.txt;0;")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ssvmExternrefTests.dir/ExternrefTest.cpp.o"
+  "CMakeFiles/ssvmExternrefTests.dir/ExternrefTest.cpp.o.d"
+  "ssvmExternrefTests"
+  "ssvmExternrefTests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ssvmExternrefTests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
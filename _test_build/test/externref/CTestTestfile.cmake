@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/test/externref
+# Build directory: /root/repo/_test_build/test/externref
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(ssvmExternrefTests "ssvmExternrefTests")
+set_tests_properties(ssvmExternrefTests PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/externref/CMakeLists.txt;7;add_test;/root/repo/test/externref/CMakeLists.txt;0;")
@@ -0,0 +1,25 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/test/host/ssvm_process/ssvm_process.cpp" "test/host/ssvm_process/CMakeFiles/ssvmProcessTests.dir/ssvm_process.cpp.o" "gcc" "test/host/ssvm_process/CMakeFiles/ssvmProcessTests.dir/ssvm_process.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_test_build/lib/ast/CMakeFiles/ssvmAST.dir/DependInfo.cmake"
+  "/root/repo/_test_build/lib/host/ssvm_process/CMakeFiles/ssvmHostModuleSSVMProcess.dir/DependInfo.cmake"
+  "/root/repo/_test_build/thirdparty/googletest/CMakeFiles/utilGoogleTest.dir/DependInfo.cmake"
+  "/root/repo/_test_build/lib/loader/CMakeFiles/ssvmLoaderFileMgr.dir/DependInfo.cmake"
+  "/root/repo/_test_build/lib/common/CMakeFiles/ssvmCommon.dir/DependInfo.cmake"
+  "/root/repo/_test_build/thirdparty/easyloggingpp/CMakeFiles/utilLog.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
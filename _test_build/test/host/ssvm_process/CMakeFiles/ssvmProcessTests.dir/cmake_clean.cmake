@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ssvmProcessTests.dir/ssvm_process.cpp.o"
+  "CMakeFiles/ssvmProcessTests.dir/ssvm_process.cpp.o.d"
+  "ssvmProcessTests"
+  "ssvmProcessTests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ssvmProcessTests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
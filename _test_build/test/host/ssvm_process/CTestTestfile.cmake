@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/test/host/ssvm_process
+# Build directory: /root/repo/_test_build/test/host/ssvm_process
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(ssvmProcessTests "ssvmProcessTests")
+set_tests_properties(ssvmProcessTests PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/host/ssvm_process/CMakeLists.txt;7;add_test;/root/repo/test/host/ssvm_process/CMakeLists.txt;0;")
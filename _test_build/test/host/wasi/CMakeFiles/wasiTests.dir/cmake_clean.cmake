@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/wasiTests.dir/wasi.cpp.o"
+  "CMakeFiles/wasiTests.dir/wasi.cpp.o.d"
+  "wasiTests"
+  "wasiTests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/wasiTests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/test/host/wasi
+# Build directory: /root/repo/_test_build/test/host/wasi
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(wasiTests "wasiTests")
+set_tests_properties(wasiTests PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/host/wasi/CMakeLists.txt;7;add_test;/root/repo/test/host/wasi/CMakeLists.txt;0;")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/wasiThreadsTests.dir/wasi_threads.cpp.o"
+  "CMakeFiles/wasiThreadsTests.dir/wasi_threads.cpp.o.d"
+  "wasiThreadsTests"
+  "wasiThreadsTests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/wasiThreadsTests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
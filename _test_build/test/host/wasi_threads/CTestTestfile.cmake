@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/test/host/wasi_threads
+# Build directory: /root/repo/_test_build/test/host/wasi_threads
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(wasiThreadsTests "wasiThreadsTests")
+set_tests_properties(wasiThreadsTests PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/host/wasi_threads/CMakeLists.txt;7;add_test;/root/repo/test/host/wasi_threads/CMakeLists.txt;0;")
@@ -0,0 +1,32 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/test/interpreter/InterpreterTest.cpp" "test/interpreter/CMakeFiles/ssvmInterpreterCoreTests.dir/InterpreterTest.cpp.o" "gcc" "test/interpreter/CMakeFiles/ssvmInterpreterCoreTests.dir/InterpreterTest.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_test_build/thirdparty/googletest/CMakeFiles/utilGoogleTest.dir/DependInfo.cmake"
+  "/root/repo/_test_build/test/spec/CMakeFiles/ssvmTestSpec.dir/DependInfo.cmake"
+  "/root/repo/_test_build/lib/vm/CMakeFiles/ssvmVM.dir/DependInfo.cmake"
+  "/root/repo/_test_build/lib/loader/CMakeFiles/ssvmLoader.dir/DependInfo.cmake"
+  "/root/repo/_test_build/lib/ast/CMakeFiles/ssvmAST.dir/DependInfo.cmake"
+  "/root/repo/_test_build/lib/loader/CMakeFiles/ssvmLoaderFileMgr.dir/DependInfo.cmake"
+  "/root/repo/_test_build/lib/validator/CMakeFiles/ssvmValidator.dir/DependInfo.cmake"
+  "/root/repo/_test_build/lib/interpreter/CMakeFiles/ssvmInterpreter.dir/DependInfo.cmake"
+  "/root/repo/_test_build/lib/common/CMakeFiles/ssvmCommon.dir/DependInfo.cmake"
+  "/root/repo/_test_build/thirdparty/easyloggingpp/CMakeFiles/utilLog.dir/DependInfo.cmake"
+  "/root/repo/_test_build/lib/host/wasi/CMakeFiles/ssvmHostModuleWasi.dir/DependInfo.cmake"
+  "/root/repo/_test_build/lib/host/wasi_threads/CMakeFiles/ssvmHostModuleWasiThreads.dir/DependInfo.cmake"
+  "/root/repo/_test_build/lib/host/ssvm_process/CMakeFiles/ssvmHostModuleSSVMProcess.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ssvmInterpreterCoreTests.dir/InterpreterTest.cpp.o"
+  "CMakeFiles/ssvmInterpreterCoreTests.dir/InterpreterTest.cpp.o.d"
+  "ssvmInterpreterCoreTests"
+  "ssvmInterpreterCoreTests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ssvmInterpreterCoreTests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ssvmInterpreterExecutionTests.dir/ExecutionTest.cpp.o"
+  "CMakeFiles/ssvmInterpreterExecutionTests.dir/ExecutionTest.cpp.o.d"
+  "ssvmInterpreterExecutionTests"
+  "ssvmInterpreterExecutionTests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ssvmInterpreterExecutionTests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ssvmInterpreterTemplateTests.dir/TemplateTest.cpp.o"
+  "CMakeFiles/ssvmInterpreterTemplateTests.dir/TemplateTest.cpp.o.d"
+  "ssvmInterpreterTemplateTests"
+  "ssvmInterpreterTemplateTests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ssvmInterpreterTemplateTests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,12 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/test/interpreter
+# Build directory: /root/repo/_test_build/test/interpreter
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(ssvmInterpreterCoreTests "ssvmInterpreterCoreTests")
+set_tests_properties(ssvmInterpreterCoreTests PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/interpreter/CMakeLists.txt;7;add_test;/root/repo/test/interpreter/CMakeLists.txt;0;")
+add_test(ssvmInterpreterTemplateTests "ssvmInterpreterTemplateTests")
+set_tests_properties(ssvmInterpreterTemplateTests PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/interpreter/CMakeLists.txt;21;add_test;/root/repo/test/interpreter/CMakeLists.txt;0;")
+add_test(ssvmInterpreterExecutionTests "ssvmInterpreterExecutionTests")
+set_tests_properties(ssvmInterpreterExecutionTests PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/interpreter/CMakeLists.txt;33;add_test;/root/repo/test/interpreter/CMakeLists.txt;0;")
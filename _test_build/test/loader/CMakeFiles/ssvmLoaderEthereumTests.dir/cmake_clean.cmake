@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ssvmLoaderEthereumTests.dir/ethereumTest.cpp.o"
+  "CMakeFiles/ssvmLoaderEthereumTests.dir/ethereumTest.cpp.o.d"
+  "ssvmLoaderEthereumTests"
+  "ssvmLoaderEthereumTests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ssvmLoaderEthereumTests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ssvmLoaderFileMgrTests.dir/filemgrTest.cpp.o"
+  "CMakeFiles/ssvmLoaderFileMgrTests.dir/filemgrTest.cpp.o.d"
+  "ssvmLoaderFileMgrTests"
+  "ssvmLoaderFileMgrTests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ssvmLoaderFileMgrTests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
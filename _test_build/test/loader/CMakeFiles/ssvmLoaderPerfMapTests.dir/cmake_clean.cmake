@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ssvmLoaderPerfMapTests.dir/perfmapTest.cpp.o"
+  "CMakeFiles/ssvmLoaderPerfMapTests.dir/perfmapTest.cpp.o.d"
+  "ssvmLoaderPerfMapTests"
+  "ssvmLoaderPerfMapTests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ssvmLoaderPerfMapTests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ssvmLoaderSharedLibraryTestFixture.dir/sharedlibraryTestData/fixture.cpp.o"
+  "CMakeFiles/ssvmLoaderSharedLibraryTestFixture.dir/sharedlibraryTestData/fixture.cpp.o.d"
+  "libssvmLoaderSharedLibraryTestFixture.pdb"
+  "libssvmLoaderSharedLibraryTestFixture.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ssvmLoaderSharedLibraryTestFixture.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
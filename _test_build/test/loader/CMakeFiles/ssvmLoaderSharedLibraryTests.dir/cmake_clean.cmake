@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ssvmLoaderSharedLibraryTests.dir/sharedlibraryTest.cpp.o"
+  "CMakeFiles/ssvmLoaderSharedLibraryTests.dir/sharedlibraryTest.cpp.o.d"
+  "ssvmLoaderSharedLibraryTests"
+  "ssvmLoaderSharedLibraryTests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ssvmLoaderSharedLibraryTests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
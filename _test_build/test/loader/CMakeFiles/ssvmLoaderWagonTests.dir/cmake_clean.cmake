@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ssvmLoaderWagonTests.dir/wagonTest.cpp.o"
+  "CMakeFiles/ssvmLoaderWagonTests.dir/wagonTest.cpp.o.d"
+  "ssvmLoaderWagonTests"
+  "ssvmLoaderWagonTests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ssvmLoaderWagonTests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
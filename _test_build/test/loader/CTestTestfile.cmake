@@ -0,0 +1,16 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/test/loader
+# Build directory: /root/repo/_test_build/test/loader
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(ssvmLoaderFileMgrTests "ssvmLoaderFileMgrTests")
+set_tests_properties(ssvmLoaderFileMgrTests PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/loader/CMakeLists.txt;7;add_test;/root/repo/test/loader/CMakeLists.txt;0;")
+add_test(ssvmLoaderWagonTests "ssvmLoaderWagonTests")
+set_tests_properties(ssvmLoaderWagonTests PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/loader/CMakeLists.txt;13;add_test;/root/repo/test/loader/CMakeLists.txt;0;")
+add_test(ssvmLoaderEthereumTests "ssvmLoaderEthereumTests")
+set_tests_properties(ssvmLoaderEthereumTests PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/loader/CMakeLists.txt;19;add_test;/root/repo/test/loader/CMakeLists.txt;0;")
+add_test(ssvmLoaderSharedLibraryTests "ssvmLoaderSharedLibraryTests")
+set_tests_properties(ssvmLoaderSharedLibraryTests PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/loader/CMakeLists.txt;48;add_test;/root/repo/test/loader/CMakeLists.txt;0;")
+add_test(ssvmLoaderPerfMapTests "ssvmLoaderPerfMapTests")
+set_tests_properties(ssvmLoaderPerfMapTests PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/loader/CMakeLists.txt;54;add_test;/root/repo/test/loader/CMakeLists.txt;0;")
@@ -0,0 +1,5 @@
+(module
+  (type $t0 (func (result i32)))
+  (func $main (export "main") (type $t0) (result i32)
+    (return
+      (i32.const 42))))
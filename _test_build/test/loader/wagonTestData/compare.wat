@@ -0,0 +1,442 @@
+(module
+  (type (;0;) (func (result i32)))
+  (func (;0;) (type 0) (result i32)
+    (i32.eq
+      (i32.const -1)
+      (i32.const -1)))
+  (func (;1;) (type 0) (result i32)
+    (i32.eq
+      (i32.const 1)
+      (i32.const -1)))
+  (func (;2;) (type 0) (result i32)
+    (i32.ne
+      (i32.const 1)
+      (i32.const -1)))
+  (func (;3;) (type 0) (result i32)
+    (i32.ne
+      (i32.const -1)
+      (i32.const -1)))
+  (func (;4;) (type 0) (result i32)
+    (i32.lt_s
+      (i32.const -1)
+      (i32.const 1)))
+  (func (;5;) (type 0) (result i32)
+    (i32.lt_s
+      (i32.const -1)
+      (i32.const -1)))
+  (func (;6;) (type 0) (result i32)
+    (i32.lt_s
+      (i32.const 1)
+      (i32.const -1)))
+  (func (;7;) (type 0) (result i32)
+    (i32.lt_u
+      (i32.const 1)
+      (i32.const -1)))
+  (func (;8;) (type 0) (result i32)
+    (i32.lt_u
+      (i32.const 1)
+      (i32.const 1)))
+  (func (;9;) (type 0) (result i32)
+    (i32.lt_u
+      (i32.const -1)
+      (i32.const 1)))
+  (func (;10;) (type 0) (result i32)
+    (i32.le_s
+      (i32.const -1)
+      (i32.const 1)))
+  (func (;11;) (type 0) (result i32)
+    (i32.le_s
+      (i32.const -1)
+      (i32.const -1)))
+  (func (;12;) (type 0) (result i32)
+    (i32.le_s
+      (i32.const 1)
+      (i32.const -1)))
+  (func (;13;) (type 0) (result i32)
+    (i32.le_u
+      (i32.const 1)
+      (i32.const -1)))
+  (func (;14;) (type 0) (result i32)
+    (i32.le_u
+      (i32.const 1)
+      (i32.const 1)))
+  (func (;15;) (type 0) (result i32)
+    (i32.le_u
+      (i32.const -1)
+      (i32.const 1)))
+  (func (;16;) (type 0) (result i32)
+    (i32.gt_s
+      (i32.const -1)
+      (i32.const 1)))
+  (func (;17;) (type 0) (result i32)
+    (i32.gt_s
+      (i32.const -1)
+      (i32.const -1)))
+  (func (;18;) (type 0) (result i32)
+    (i32.gt_s
+      (i32.const 1)
+      (i32.const -1)))
+  (func (;19;) (type 0) (result i32)
+    (i32.gt_u
+      (i32.const 1)
+      (i32.const -1)))
+  (func (;20;) (type 0) (result i32)
+    (i32.gt_u
+      (i32.const 1)
+      (i32.const 1)))
+  (func (;21;) (type 0) (result i32)
+    (i32.gt_u
+      (i32.const -1)
+      (i32.const 1)))
+  (func (;22;) (type 0) (result i32)
+    (i32.ge_s
+      (i32.const -1)
+      (i32.const 1)))
+  (func (;23;) (type 0) (result i32)
+    (i32.ge_s
+      (i32.const -1)
+      (i32.const -1)))
+  (func (;24;) (type 0) (result i32)
+    (i32.ge_s
+      (i32.const 1)
+      (i32.const -1)))
+  (func (;25;) (type 0) (result i32)
+    (i32.ge_u
+      (i32.const 1)
+      (i32.const -1)))
+  (func (;26;) (type 0) (result i32)
+    (i32.ge_u
+      (i32.const 1)
+      (i32.const 1)))
+  (func (;27;) (type 0) (result i32)
+    (i32.ge_u
+      (i32.const -1)
+      (i32.const 1)))
+  (func (;28;) (type 0) (result i32)
+    (i64.eq
+      (i64.const -1)
+      (i64.const -1)))
+  (func (;29;) (type 0) (result i32)
+    (i64.eq
+      (i64.const 1)
+      (i64.const -1)))
+  (func (;30;) (type 0) (result i32)
+    (i64.ne
+      (i64.const 1)
+      (i64.const -1)))
+  (func (;31;) (type 0) (result i32)
+    (i64.ne
+      (i64.const -1)
+      (i64.const -1)))
+  (func (;32;) (type 0) (result i32)
+    (i64.lt_s
+      (i64.const -1)
+      (i64.const 1)))
+  (func (;33;) (type 0) (result i32)
+    (i64.lt_s
+      (i64.const -1)
+      (i64.const -1)))
+  (func (;34;) (type 0) (result i32)
+    (i64.lt_s
+      (i64.const 1)
+      (i64.const -1)))
+  (func (;35;) (type 0) (result i32)
+    (i64.lt_u
+      (i64.const 1)
+      (i64.const -1)))
+  (func (;36;) (type 0) (result i32)
+    (i64.lt_u
+      (i64.const 1)
+      (i64.const 1)))
+  (func (;37;) (type 0) (result i32)
+    (i64.lt_u
+      (i64.const -1)
+      (i64.const 1)))
+  (func (;38;) (type 0) (result i32)
+    (i64.le_s
+      (i64.const -1)
+      (i64.const 1)))
+  (func (;39;) (type 0) (result i32)
+    (i64.le_s
+      (i64.const -1)
+      (i64.const -1)))
+  (func (;40;) (type 0) (result i32)
+    (i64.le_s
+      (i64.const 1)
+      (i64.const -1)))
+  (func (;41;) (type 0) (result i32)
+    (i64.le_u
+      (i64.const 1)
+      (i64.const -1)))
+  (func (;42;) (type 0) (result i32)
+    (i64.le_u
+      (i64.const 1)
+      (i64.const 1)))
+  (func (;43;) (type 0) (result i32)
+    (i64.le_u
+      (i64.const -1)
+      (i64.const 1)))
+  (func (;44;) (type 0) (result i32)
+    (i64.gt_s
+      (i64.const -1)
+      (i64.const 1)))
+  (func (;45;) (type 0) (result i32)
+    (i64.gt_s
+      (i64.const -1)
+      (i64.const -1)))
+  (func (;46;) (type 0) (result i32)
+    (i64.gt_s
+      (i64.const 1)
+      (i64.const -1)))
+  (func (;47;) (type 0) (result i32)
+    (i64.gt_u
+      (i64.const 1)
+      (i64.const -1)))
+  (func (;48;) (type 0) (result i32)
+    (i64.gt_u
+      (i64.const 1)
+      (i64.const 1)))
+  (func (;49;) (type 0) (result i32)
+    (i64.gt_u
+      (i64.const -1)
+      (i64.const 1)))
+  (func (;50;) (type 0) (result i32)
+    (i64.ge_s
+      (i64.const -1)
+      (i64.const 1)))
+  (func (;51;) (type 0) (result i32)
+    (i64.ge_s
+      (i64.const -1)
+      (i64.const -1)))
+  (func (;52;) (type 0) (result i32)
+    (i64.ge_s
+      (i64.const 1)
+      (i64.const -1)))
+  (func (;53;) (type 0) (result i32)
+    (i64.ge_u
+      (i64.const 1)
+      (i64.const -1)))
+  (func (;54;) (type 0) (result i32)
+    (i64.ge_u
+      (i64.const 1)
+      (i64.const 1)))
+  (func (;55;) (type 0) (result i32)
+    (i64.ge_u
+      (i64.const -1)
+      (i64.const 1)))
+  (func (;56;) (type 0) (result i32)
+    (f32.eq
+      (f32.const -0x1p+0 (;=-1;))
+      (f32.const -0x1p+0 (;=-1;))))
+  (func (;57;) (type 0) (result i32)
+    (f32.eq
+      (f32.const 0x1p+0 (;=1;))
+      (f32.const -0x1p+0 (;=-1;))))
+  (func (;58;) (type 0) (result i32)
+    (f32.ne
+      (f32.const 0x1p+0 (;=1;))
+      (f32.const -0x1p+0 (;=-1;))))
+  (func (;59;) (type 0) (result i32)
+    (f32.ne
+      (f32.const -0x1p+0 (;=-1;))
+      (f32.const -0x1p+0 (;=-1;))))
+  (func (;60;) (type 0) (result i32)
+    (f32.lt
+      (f32.const -0x1p+0 (;=-1;))
+      (f32.const 0x1p+0 (;=1;))))
+  (func (;61;) (type 0) (result i32)
+    (f32.lt
+      (f32.const -0x1p+0 (;=-1;))
+      (f32.const -0x1p+0 (;=-1;))))
+  (func (;62;) (type 0) (result i32)
+    (f32.lt
+      (f32.const 0x1p+0 (;=1;))
+      (f32.const -0x1p+0 (;=-1;))))
+  (func (;63;) (type 0) (result i32)
+    (f32.le
+      (f32.const -0x1p+0 (;=-1;))
+      (f32.const 0x1p+0 (;=1;))))
+  (func (;64;) (type 0) (result i32)
+    (f32.le
+      (f32.const -0x1p+0 (;=-1;))
+      (f32.const -0x1p+0 (;=-1;))))
+  (func (;65;) (type 0) (result i32)
+    (f32.le
+      (f32.const 0x1p+0 (;=1;))
+      (f32.const -0x1p+0 (;=-1;))))
+  (func (;66;) (type 0) (result i32)
+    (f32.gt
+      (f32.const -0x1p+0 (;=-1;))
+      (f32.const 0x1p+0 (;=1;))))
+  (func (;67;) (type 0) (result i32)
+    (f32.gt
+      (f32.const -0x1p+0 (;=-1;))
+      (f32.const -0x1p+0 (;=-1;))))
+  (func (;68;) (type 0) (result i32)
+    (f32.gt
+      (f32.const 0x1p+0 (;=1;))
+      (f32.const -0x1p+0 (;=-1;))))
+  (func (;69;) (type 0) (result i32)
+    (f32.ge
+      (f32.const -0x1p+0 (;=-1;))
+      (f32.const 0x1p+0 (;=1;))))
+  (func (;70;) (type 0) (result i32)
+    (f32.ge
+      (f32.const -0x1p+0 (;=-1;))
+      (f32.const -0x1p+0 (;=-1;))))
+  (func (;71;) (type 0) (result i32)
+    (f32.ge
+      (f32.const 0x1p+0 (;=1;))
+      (f32.const -0x1p+0 (;=-1;))))
+  (func (;72;) (type 0) (result i32)
+    (f64.eq
+      (f64.const -0x1p+0 (;=-1;))
+      (f64.const -0x1p+0 (;=-1;))))
+  (func (;73;) (type 0) (result i32)
+    (f64.eq
+      (f64.const 0x1p+0 (;=1;))
+      (f64.const -0x1p+0 (;=-1;))))
+  (func (;74;) (type 0) (result i32)
+    (f64.ne
+      (f64.const 0x1p+0 (;=1;))
+      (f64.const -0x1p+0 (;=-1;))))
+  (func (;75;) (type 0) (result i32)
+    (f64.ne
+      (f64.const -0x1p+0 (;=-1;))
+      (f64.const -0x1p+0 (;=-1;))))
+  (func (;76;) (type 0) (result i32)
+    (f64.lt
+      (f64.const -0x1p+0 (;=-1;))
+      (f64.const 0x1p+0 (;=1;))))
+  (func (;77;) (type 0) (result i32)
+    (f64.lt
+      (f64.const -0x1p+0 (;=-1;))
+      (f64.const -0x1p+0 (;=-1;))))
+  (func (;78;) (type 0) (result i32)
+    (f64.lt
+      (f64.const 0x1p+0 (;=1;))
+      (f64.const -0x1p+0 (;=-1;))))
+  (func (;79;) (type 0) (result i32)
+    (f64.le
+      (f64.const -0x1p+0 (;=-1;))
+      (f64.const 0x1p+0 (;=1;))))
+  (func (;80;) (type 0) (result i32)
+    (f64.le
+      (f64.const -0x1p+0 (;=-1;))
+      (f64.const -0x1p+0 (;=-1;))))
+  (func (;81;) (type 0) (result i32)
+    (f64.le
+      (f64.const 0x1p+0 (;=1;))
+      (f64.const -0x1p+0 (;=-1;))))
+  (func (;82;) (type 0) (result i32)
+    (f64.gt
+      (f64.const -0x1p+0 (;=-1;))
+      (f64.const 0x1p+0 (;=1;))))
+  (func (;83;) (type 0) (result i32)
+    (f64.gt
+      (f64.const -0x1p+0 (;=-1;))
+      (f64.const -0x1p+0 (;=-1;))))
+  (func (;84;) (type 0) (result i32)
+    (f64.gt
+      (f64.const 0x1p+0 (;=1;))
+      (f64.const -0x1p+0 (;=-1;))))
+  (func (;85;) (type 0) (result i32)
+    (f64.ge
+      (f64.const -0x1p+0 (;=-1;))
+      (f64.const 0x1p+0 (;=1;))))
+  (func (;86;) (type 0) (result i32)
+    (f64.ge
+      (f64.const -0x1p+0 (;=-1;))
+      (f64.const -0x1p+0 (;=-1;))))
+  (func (;87;) (type 0) (result i32)
+    (f64.ge
+      (f64.const 0x1p+0 (;=1;))
+      (f64.const -0x1p+0 (;=-1;))))
+  (export "i32_eq_true" (func 0))
+  (export "i32_eq_false" (func 1))
+  (export "i32_ne_true" (func 2))
+  (export "i32_ne_false" (func 3))
+  (export "i32_lt_s_less" (func 4))
+  (export "i32_lt_s_equal" (func 5))
+  (export "i32_lt_s_greater" (func 6))
+  (export "i32_lt_u_less" (func 7))
+  (export "i32_lt_u_equal" (func 8))
+  (export "i32_lt_u_greater" (func 9))
+  (export "i32_le_s_less" (func 10))
+  (export "i32_le_s_equal" (func 11))
+  (export "i32_le_s_greater" (func 12))
+  (export "i32_le_u_less" (func 13))
+  (export "i32_le_u_equal" (func 14))
+  (export "i32_le_u_greater" (func 15))
+  (export "i32_gt_s_less" (func 16))
+  (export "i32_gt_s_equal" (func 17))
+  (export "i32_gt_s_greater" (func 18))
+  (export "i32_gt_u_less" (func 19))
+  (export "i32_gt_u_equal" (func 20))
+  (export "i32_gt_u_greater" (func 21))
+  (export "i32_ge_s_less" (func 22))
+  (export "i32_ge_s_equal" (func 23))
+  (export "i32_ge_s_greater" (func 24))
+  (export "i32_ge_u_less" (func 25))
+  (export "i32_ge_u_equal" (func 26))
+  (export "i32_ge_u_greater" (func 27))
+  (export "i64_eq_true" (func 28))
+  (export "i64_eq_false" (func 29))
+  (export "i64_ne_true" (func 30))
+  (export "i64_ne_false" (func 31))
+  (export "i64_lt_s_less" (func 32))
+  (export "i64_lt_s_equal" (func 33))
+  (export "i64_lt_s_greater" (func 34))
+  (export "i64_lt_u_less" (func 35))
+  (export "i64_lt_u_equal" (func 36))
+  (export "i64_lt_u_greater" (func 37))
+  (export "i64_le_s_less" (func 38))
+  (export "i64_le_s_equal" (func 39))
+  (export "i64_le_s_greater" (func 40))
+  (export "i64_le_u_less" (func 41))
+  (export "i64_le_u_equal" (func 42))
+  (export "i64_le_u_greater" (func 43))
+  (export "i64_gt_s_less" (func 44))
+  (export "i64_gt_s_equal" (func 45))
+  (export "i64_gt_s_greater" (func 46))
+  (export "i64_gt_u_less" (func 47))
+  (export "i64_gt_u_equal" (func 48))
+  (export "i64_gt_u_greater" (func 49))
+  (export "i64_ge_s_less" (func 50))
+  (export "i64_ge_s_equal" (func 51))
+  (export "i64_ge_s_greater" (func 52))
+  (export "i64_ge_u_less" (func 53))
+  (export "i64_ge_u_equal" (func 54))
+  (export "i64_ge_u_greater" (func 55))
+  (export "f32_eq_true" (func 56))
+  (export "f32_eq_false" (func 57))
+  (export "f32_ne_true" (func 58))
+  (export "f32_ne_false" (func 59))
+  (export "f32_lt_less" (func 60))
+  (export "f32_lt_equal" (func 61))
+  (export "f32_lt_greater" (func 62))
+  (export "f32_le_less" (func 63))
+  (export "f32_le_equal" (func 64))
+  (export "f32_le_greater" (func 65))
+  (export "f32_gt_less" (func 66))
+  (export "f32_gt_equal" (func 67))
+  (export "f32_gt_greater" (func 68))
+  (export "f32_ge_less" (func 69))
+  (export "f32_ge_equal" (func 70))
+  (export "f32_ge_greater" (func 71))
+  (export "f64_eq_true" (func 72))
+  (export "f64_eq_false" (func 73))
+  (export "f64_ne_true" (func 74))
+  (export "f64_ne_false" (func 75))
+  (export "f64_lt_less" (func 76))
+  (export "f64_lt_equal" (func 77))
+  (export "f64_lt_greater" (func 78))
+  (export "f64_le_less" (func 79))
+  (export "f64_le_equal" (func 80))
+  (export "f64_le_greater" (func 81))
+  (export "f64_gt_less" (func 82))
+  (export "f64_gt_equal" (func 83))
+  (export "f64_gt_greater" (func 84))
+  (export "f64_ge_less" (func 85))
+  (export "f64_ge_equal" (func 86))
+  (export "f64_ge_greater" (func 87)))
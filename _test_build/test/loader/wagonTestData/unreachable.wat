@@ -0,0 +1,9 @@
+(module
+  (type (;0;) (func))
+  (import "env" "memory" (memory (;0;) 256 256))
+  (import "env" "table" (table (;0;) 0 0 anyfunc))
+  (import "env" "memoryBase" (global (;0;) i32))
+  (import "env" "tableBase" (global (;1;) i32))
+  (func (;0;) (type 0)
+    (unreachable))
+  (export "main" (func 0)))
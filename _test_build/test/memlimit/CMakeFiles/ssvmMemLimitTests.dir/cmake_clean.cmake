@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ssvmMemLimitTests.dir/MemLimitTest.cpp.o"
+  "CMakeFiles/ssvmMemLimitTests.dir/MemLimitTest.cpp.o.d"
+  "ssvmMemLimitTests"
+  "ssvmMemLimitTests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ssvmMemLimitTests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
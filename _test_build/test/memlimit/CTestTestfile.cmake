@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/test/memlimit
+# Build directory: /root/repo/_test_build/test/memlimit
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(ssvmMemLimitTests "ssvmMemLimitTests")
+set_tests_properties(ssvmMemLimitTests PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/memlimit/CMakeLists.txt;7;add_test;/root/repo/test/memlimit/CMakeLists.txt;0;")
@@ -0,0 +1,17 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/poTests.dir/gtest.cpp.o"
+  "CMakeFiles/poTests.dir/gtest.cpp.o.d"
+  "CMakeFiles/poTests.dir/help.cpp.o"
+  "CMakeFiles/poTests.dir/help.cpp.o.d"
+  "CMakeFiles/poTests.dir/po.cpp.o"
+  "CMakeFiles/poTests.dir/po.cpp.o.d"
+  "CMakeFiles/poTests.dir/subcommand.cpp.o"
+  "CMakeFiles/poTests.dir/subcommand.cpp.o.d"
+  "poTests"
+  "poTests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/poTests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/test/po
+# Build directory: /root/repo/_test_build/test/po
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(poTests "poTests")
+set_tests_properties(poTests PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/po/CMakeLists.txt;10;add_test;/root/repo/test/po/CMakeLists.txt;0;")
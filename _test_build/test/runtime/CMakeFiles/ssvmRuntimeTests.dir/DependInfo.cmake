@@ -0,0 +1,34 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/test/runtime/globalTest.cpp" "test/runtime/CMakeFiles/ssvmRuntimeTests.dir/globalTest.cpp.o" "gcc" "test/runtime/CMakeFiles/ssvmRuntimeTests.dir/globalTest.cpp.o.d"
+  "/root/repo/test/runtime/hostfuncTest.cpp" "test/runtime/CMakeFiles/ssvmRuntimeTests.dir/hostfuncTest.cpp.o" "gcc" "test/runtime/CMakeFiles/ssvmRuntimeTests.dir/hostfuncTest.cpp.o.d"
+  "/root/repo/test/runtime/memoryTest.cpp" "test/runtime/CMakeFiles/ssvmRuntimeTests.dir/memoryTest.cpp.o" "gcc" "test/runtime/CMakeFiles/ssvmRuntimeTests.dir/memoryTest.cpp.o.d"
+  "/root/repo/test/runtime/storemgrTest.cpp" "test/runtime/CMakeFiles/ssvmRuntimeTests.dir/storemgrTest.cpp.o" "gcc" "test/runtime/CMakeFiles/ssvmRuntimeTests.dir/storemgrTest.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_test_build/thirdparty/googletest/CMakeFiles/utilGoogleTest.dir/DependInfo.cmake"
+  "/root/repo/_test_build/lib/vm/CMakeFiles/ssvmVM.dir/DependInfo.cmake"
+  "/root/repo/_test_build/lib/loader/CMakeFiles/ssvmLoader.dir/DependInfo.cmake"
+  "/root/repo/_test_build/lib/ast/CMakeFiles/ssvmAST.dir/DependInfo.cmake"
+  "/root/repo/_test_build/lib/loader/CMakeFiles/ssvmLoaderFileMgr.dir/DependInfo.cmake"
+  "/root/repo/_test_build/lib/validator/CMakeFiles/ssvmValidator.dir/DependInfo.cmake"
+  "/root/repo/_test_build/lib/interpreter/CMakeFiles/ssvmInterpreter.dir/DependInfo.cmake"
+  "/root/repo/_test_build/lib/common/CMakeFiles/ssvmCommon.dir/DependInfo.cmake"
+  "/root/repo/_test_build/thirdparty/easyloggingpp/CMakeFiles/utilLog.dir/DependInfo.cmake"
+  "/root/repo/_test_build/lib/host/wasi/CMakeFiles/ssvmHostModuleWasi.dir/DependInfo.cmake"
+  "/root/repo/_test_build/lib/host/wasi_threads/CMakeFiles/ssvmHostModuleWasiThreads.dir/DependInfo.cmake"
+  "/root/repo/_test_build/lib/host/ssvm_process/CMakeFiles/ssvmHostModuleSSVMProcess.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
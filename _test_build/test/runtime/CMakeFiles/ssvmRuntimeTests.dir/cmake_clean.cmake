@@ -0,0 +1,17 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ssvmRuntimeTests.dir/globalTest.cpp.o"
+  "CMakeFiles/ssvmRuntimeTests.dir/globalTest.cpp.o.d"
+  "CMakeFiles/ssvmRuntimeTests.dir/hostfuncTest.cpp.o"
+  "CMakeFiles/ssvmRuntimeTests.dir/hostfuncTest.cpp.o.d"
+  "CMakeFiles/ssvmRuntimeTests.dir/memoryTest.cpp.o"
+  "CMakeFiles/ssvmRuntimeTests.dir/memoryTest.cpp.o.d"
+  "CMakeFiles/ssvmRuntimeTests.dir/storemgrTest.cpp.o"
+  "CMakeFiles/ssvmRuntimeTests.dir/storemgrTest.cpp.o.d"
+  "ssvmRuntimeTests"
+  "ssvmRuntimeTests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ssvmRuntimeTests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/test/runtime
+# Build directory: /root/repo/_test_build/test/runtime
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(ssvmRuntimeTests "ssvmRuntimeTests")
+set_tests_properties(ssvmRuntimeTests PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/runtime/CMakeLists.txt;10;add_test;/root/repo/test/runtime/CMakeLists.txt;0;")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/spanTests.dir/span.cpp.o"
+  "CMakeFiles/spanTests.dir/span.cpp.o.d"
+  "spanTests"
+  "spanTests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/spanTests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/test/span
+# Build directory: /root/repo/_test_build/test/span
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(spanTests "spanTests")
+set_tests_properties(spanTests PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/span/CMakeLists.txt;7;add_test;/root/repo/test/span/CMakeLists.txt;0;")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ssvmTestSpec.dir/spectest.cpp.o"
+  "CMakeFiles/ssvmTestSpec.dir/spectest.cpp.o.d"
+  "libssvmTestSpec.a"
+  "libssvmTestSpec.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ssvmTestSpec.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
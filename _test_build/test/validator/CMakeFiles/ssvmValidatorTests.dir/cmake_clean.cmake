@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ssvmValidatorTests.dir/ValidatorTest.cpp.o"
+  "CMakeFiles/ssvmValidatorTests.dir/ValidatorTest.cpp.o.d"
+  "ssvmValidatorTests"
+  "ssvmValidatorTests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ssvmValidatorTests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/test/validator
+# Build directory: /root/repo/_test_build/test/validator
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(ssvmValidatorTests "ssvmValidatorTests")
+set_tests_properties(ssvmValidatorTests PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/validator/CMakeLists.txt;7;add_test;/root/repo/test/validator/CMakeLists.txt;0;")
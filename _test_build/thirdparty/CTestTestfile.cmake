@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/thirdparty
+# Build directory: /root/repo/_test_build/thirdparty
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+subdirs("easyloggingpp")
+subdirs("googletest")
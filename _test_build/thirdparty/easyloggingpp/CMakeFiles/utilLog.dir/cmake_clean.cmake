@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/utilLog.dir/easylogging++.cc.o"
+  "CMakeFiles/utilLog.dir/easylogging++.cc.o.d"
+  "libutilLog.a"
+  "libutilLog.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/utilLog.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
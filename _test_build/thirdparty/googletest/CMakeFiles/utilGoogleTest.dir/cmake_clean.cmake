@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/utilGoogleTest.dir/src/gtest-all.cc.o"
+  "CMakeFiles/utilGoogleTest.dir/src/gtest-all.cc.o.d"
+  "libutilGoogleTest.a"
+  "libutilGoogleTest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/utilGoogleTest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
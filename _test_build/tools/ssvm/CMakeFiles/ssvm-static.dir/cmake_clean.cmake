@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ssvm-static.dir/ssvmr-static.cpp.o"
+  "CMakeFiles/ssvm-static.dir/ssvmr-static.cpp.o.d"
+  "ssvm-static"
+  "ssvm-static.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ssvm-static.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ssvm.dir/ssvmr.cpp.o"
+  "CMakeFiles/ssvm.dir/ssvmr.cpp.o.d"
+  "ssvm"
+  "ssvm.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ssvm.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
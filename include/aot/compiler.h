@@ -15,7 +15,9 @@
 #include "common/errcode.h"
 #include "common/filesystem.h"
 #include <cstdint>
+#include <string>
 #include <string_view>
+#include <vector>
 
 namespace SSVM {
 namespace AOT {
@@ -53,6 +55,7 @@ public:
                const AST::DataSection &DataSection);
   void compile(const AST::TableSection &TableSection,
                const AST::ElementSection &ElementSection);
+  void compile(const AST::TagSection &TagSection);
   void compile(const AST::FunctionSection &FunctionSection,
                const AST::CodeSection &CodeSection);
 
@@ -63,6 +66,36 @@ public:
     InstructionCounting = Value;
   }
   void setGasMeasuring(bool Value = true) { GasMeasuring = Value; }
+  /// Emit ordinary floating-point instructions instead of constrained ones.
+  /// No fast-math flags are set, so multiplies and adds are not fused.
+  void setRelaxedFP(bool Value = true) { RelaxedFP = Value; }
+  /// Number of partitions which are optimized and emitted in parallel.
+  void setThreads(uint32_t Value) { Threads = Value; }
+  /// Directory of the object cache. Partitions whose code and compile options
+  /// are unchanged reuse the cached objects instead of being recompiled.
+  void setCacheDirectory(std::filesystem::path Value) {
+    CacheDir = std::move(Value);
+  }
+  /// Minimum number of partitions when the object cache is enabled. More
+  /// partitions make reuse finer grained, but every partition is a separate
+  /// object with its own copy of the declarations, and calls between
+  /// partitions can not be inlined, so the code gets slower and larger.
+  void setCachePartitions(uint32_t Value) { CachePartitions = Value; }
+  /// Emit a code variant for each CPU, from the baseline to the most capable.
+  /// The loader runs the last variant supported by the host.
+  void setTargetCPUs(std::vector<std::string> Value) {
+    TargetCPUs = std::move(Value);
+  }
+  /// Check memory accesses with compare-and-branch instead of relying on
+  /// guard pages, so memories only reserve the pages they can grow to.
+  void setBoundsChecks(bool Value = true) { BoundsChecks = Value; }
+  /// Write the optimization remarks in YAML to the file. Compiled functions
+  /// are named after their wasm function names and indices.
+  void setRemarksPath(std::filesystem::path Value) {
+    RemarksPath = std::move(Value);
+  }
+  /// Report the wall time of each compilation stage and optimization pass.
+  void setTimePasses(bool Value = true) { TimePasses = Value; }
 
 private:
   CompileContext *Context = nullptr;
@@ -70,6 +103,14 @@ private:
   OptimizationLevel Level = OptimizationLevel::O3;
   bool InstructionCounting = false;
   bool GasMeasuring = false;
+  bool RelaxedFP = false;
+  bool BoundsChecks = false;
+  uint32_t Threads = 1;
+  std::filesystem::path CacheDir;
+  uint32_t CachePartitions = 16;
+  std::vector<std::string> TargetCPUs;
+  std::filesystem::path RemarksPath;
+  bool TimePasses = false;
 };
 
 } // namespace AOT
@@ -60,6 +60,7 @@ public:
   const TableType &getExternalTableType() const { return TabType; }
   const MemoryType &getExternalMemoryType() const { return MemType; }
   const GlobalType &getExternalGlobalType() const { return GlobType; }
+  uint32_t getExternalTagTypeIdx() const { return TagTypeIdx; }
 
   /// The node type should be ASTNodeAttr::Desc_Import.
   const ASTNodeAttr NodeAttr = ASTNodeAttr::Desc_Import;
@@ -73,6 +74,7 @@ private:
   TableType TabType;
   MemoryType MemType;
   GlobalType GlobType;
+  uint32_t TagTypeIdx = 0;
   /// @}
 };
 
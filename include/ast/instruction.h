@@ -67,6 +67,9 @@ public:
   /// Getter of label list.
   Span<const uint32_t> getLabelList() const { return LabelList; }
 
+  /// Append the jump count to a Catch or Catch_all instruction of Try block.
+  void addJumpCatch(const uint32_t Cnt) { LabelList.push_back(Cnt); }
+
   /// Getter of selecting value types list.
   Span<const ValType> getValTypeList() const { return ValTypeList; }
 
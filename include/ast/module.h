@@ -47,6 +47,16 @@ public:
   /// Load compiled function from loadable manager.
   Expect<void> loadCompiled(LDMgr &Mgr);
 
+  /// Getter and setter of validated flag. Modules loaded from the metadata of
+  /// compiled artifacts were validated by the compiler.
+  bool isValidated() const noexcept { return Validated; }
+  void setValidated() noexcept { Validated = true; }
+
+  /// Getters of the bounds checking of compiled functions. Compiled functions
+  /// without explicit bounds checks rely on guard pages after the memories.
+  bool needsGuardPages() const noexcept { return GuardPages; }
+  bool hasExplicitBoundsChecks() const noexcept { return BoundsChecks; }
+
   /// Getters of references of sections.
   const CustomSection &getCustomSection() const { return CustomSec; }
   const TypeSection &getTypeSection() const { return TypeSec; }
@@ -59,8 +69,10 @@ public:
   const StartSection &getStartSection() const { return StartSec; }
   const ElementSection &getElementSection() const { return ElementSec; }
   const CodeSection &getCodeSection() const { return CodeSec; }
+  CodeSection &getCodeSection() { return CodeSec; }
   const DataSection &getDataSection() const { return DataSec; }
   const DataCountSection &getDataCountSection() const { return DataCountSec; }
+  const TagSection &getTagSection() const { return TagSec; }
 
   enum class Intrinsics : uint32_t {
     kTrap,
@@ -81,6 +93,11 @@ public:
     kTableInit,
     kElemDrop,
     kRefFunc,
+    kThrow,
+    kRethrow,
+    kCatch,
+    kMemAtomicNotify,
+    kMemAtomicWait,
     kIntrinsicMax,
   };
   using IntrinsicsTable = void * [uint32_t(Intrinsics::kIntrinsicMax)];
@@ -93,6 +110,9 @@ private:
   /// @{
   std::vector<Byte> Magic;
   std::vector<Byte> Version;
+  bool Validated = false;
+  bool GuardPages = false;
+  bool BoundsChecks = false;
   /// @}
 
   /// \name Section nodes of Module node.
@@ -110,6 +130,7 @@ private:
   CodeSection CodeSec;
   DataSection DataSec;
   DataCountSection DataCountSec;
+  TagSection TagSec;
   /// @}
 };
 
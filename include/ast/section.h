@@ -325,5 +325,23 @@ private:
   std::optional<uint32_t> Content = std::nullopt;
 };
 
+/// AST TagSection node.
+class TagSection : public Section {
+public:
+  /// Getter of content vector.
+  Span<const uint32_t> getContent() const { return Content; }
+
+  /// The node type should be ASTNodeAttr::Sec_Tag.
+  const ASTNodeAttr NodeAttr = ASTNodeAttr::Sec_Tag;
+
+protected:
+  /// Overrided content loading of tag section.
+  Expect<void> loadContent(FileMgr &Mgr, const Configure &Conf) override;
+
+private:
+  /// Vector of function type indices of tags.
+  std::vector<uint32_t> Content;
+};
+
 } // namespace AST
 } // namespace SSVM
@@ -118,6 +118,16 @@ private:
   /// @}
 };
 
+/// Immutable function body of a code segment.
+///
+/// The body is shared by the code segment, copies of the AST, and every
+/// function instance instantiated from it, so instantiation never duplicates
+/// instruction storage.
+struct FunctionBody {
+  std::vector<std::pair<uint32_t, ValType>> Locals;
+  InstrVec Instrs;
+};
+
 /// AST CodeSegment node.
 class CodeSegment : public Segment {
 public:
@@ -133,7 +143,31 @@ public:
   Expect<void> loadBinary(FileMgr &Mgr, const Configure &Conf) override;
 
   /// Getter of locals vector.
-  Span<const std::pair<uint32_t, ValType>> getLocals() const { return Locals; }
+  Span<const std::pair<uint32_t, ValType>> getLocals() const {
+    if (Body) {
+      return Body->Locals;
+    }
+    return {};
+  }
+
+  /// Getter of function body instructions.
+  InstrView getInstrs() const {
+    if (Body) {
+      return Body->Instrs;
+    }
+    return {};
+  }
+
+  /// Getter of the shared function body. Null before loading.
+  const std::shared_ptr<const FunctionBody> &getBody() const noexcept {
+    return Body;
+  }
+
+  /// Getter and setter of the maximum operand stack height.
+  uint32_t getMaxStackHeight() const noexcept { return MaxStackHeight; }
+  void setMaxStackHeight(const uint32_t Height) noexcept {
+    MaxStackHeight = Height;
+  }
 
   /// Getter of compiled symbol.
   const auto &getSymbol() const noexcept { return Symbol; }
@@ -147,7 +181,11 @@ private:
   /// \name Data of CodeSegment node.
   /// @{
   uint32_t SegSize = 0;
-  std::vector<std::pair<uint32_t, ValType>> Locals;
+  /// Allocated once by the loader. Function instances and module templates
+  /// take shared references, so they outlive the AST.
+  std::shared_ptr<const FunctionBody> Body;
+  /// Maximum operand stack height, recorded by the validator.
+  uint32_t MaxStackHeight = 0;
   /// @}
 
   Loader::Symbol<void> Symbol;
@@ -16,6 +16,7 @@
 #include <vector>
 
 #include "base.h"
+#include "common/functype.h"
 #include "loader/shared_library.h"
 
 namespace SSVM {
@@ -25,12 +26,17 @@ namespace AST {
 class Limit : public Base {
 public:
   /// Limit type enumeration class.
-  enum class LimitType : uint8_t { HasMin = 0x00, HasMinMax = 0x01 };
+  enum class LimitType : uint8_t {
+    HasMin = 0x00,
+    HasMinMax = 0x01,
+    SharedMinMax = 0x03
+  };
 
   Limit() = default;
   Limit(const uint32_t MinVal) : Type(LimitType::HasMin), Min(MinVal) {}
-  Limit(const uint32_t MinVal, const uint32_t MaxVal)
-      : Type(LimitType::HasMinMax), Min(MinVal), Max(MaxVal) {}
+  Limit(const uint32_t MinVal, const uint32_t MaxVal, const bool Shared = false)
+      : Type(Shared ? LimitType::SharedMinMax : LimitType::HasMinMax),
+        Min(MinVal), Max(MaxVal) {}
 
   /// Load binary from file manager.
   ///
@@ -45,7 +51,12 @@ public:
   Expect<void> loadBinary(FileMgr &Mgr, const Configure &Conf) override;
 
   /// Getter of having max in limit.
-  bool hasMax() const { return Type == LimitType::HasMinMax; }
+  bool hasMax() const {
+    return Type == LimitType::HasMinMax || Type == LimitType::SharedMinMax;
+  }
+
+  /// Getter of shared limit. Only memories of Threads proposal can be shared.
+  bool isShared() const { return Type == LimitType::SharedMinMax; }
 
   /// Getter of min.
   uint32_t getMin() const { return Min; }
@@ -87,6 +98,9 @@ public:
   /// Getter of return types vector.
   Span<const ValType> getReturnTypes() const { return ReturnTypes; }
 
+  /// Getter of canonical function type id.
+  uint32_t getTypeId() const noexcept { return TypeId; }
+
   /// Getter of compiled symbol.
   const auto &getSymbol() const noexcept { return Symbol; }
   /// Setter of compiled symbol.
@@ -97,8 +111,7 @@ public:
 
   friend bool operator==(const FunctionType &LHS,
                          const FunctionType &RHS) noexcept {
-    return LHS.ParamTypes == RHS.ParamTypes &&
-           LHS.ReturnTypes == RHS.ReturnTypes;
+    return LHS.TypeId == RHS.TypeId;
   }
 
   friend bool operator!=(const FunctionType &LHS,
@@ -111,6 +124,7 @@ private:
   /// @{
   std::vector<ValType> ParamTypes;
   std::vector<ValType> ReturnTypes;
+  uint32_t TypeId = kEmptyFuncTypeId;
   /// @}
 
   Loader::Symbol<Wrapper> Symbol;
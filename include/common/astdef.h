@@ -34,6 +34,7 @@ enum class ASTNodeAttr : uint8_t {
   Sec_Code,
   Sec_Data,
   Sec_DataCount,
+  Sec_Tag,
   Desc_Import,
   Desc_Export,
   Seg_Global,
@@ -65,6 +66,7 @@ static inline std::unordered_map<ASTNodeAttr, std::string> ASTNodeAttrStr = {
     {ASTNodeAttr::Sec_Code, "code section"},
     {ASTNodeAttr::Sec_Data, "data section"},
     {ASTNodeAttr::Sec_DataCount, "data count section"},
+    {ASTNodeAttr::Sec_Tag, "tag section"},
     {ASTNodeAttr::Desc_Import, "import description"},
     {ASTNodeAttr::Desc_Export, "export description"},
     {ASTNodeAttr::Seg_Global, "global segment"},
@@ -88,6 +90,10 @@ enum class OpCode : uint16_t {
   Loop = 0x03,
   If = 0x04,
   Else = 0x05,
+  Try = 0x06,
+  Catch = 0x07,
+  Throw = 0x08,
+  Rethrow = 0x09,
   End = 0x0B,
   Br = 0x0C,
   Br_if = 0x0D,
@@ -95,6 +101,8 @@ enum class OpCode : uint16_t {
   Return = 0x0F,
   Call = 0x10,
   Call_indirect = 0x11,
+  Delegate = 0x18,
+  Catch_all = 0x19,
 
   /// Reference Instructions
   Ref__null = 0xD0,
@@ -526,10 +534,104 @@ enum class OpCode : uint16_t {
   F64x2__floor = 0xFDDD,
   F64x2__trunc = 0xFDDE,
   F64x2__nearest = 0xFDDF,
-  I64x2__trunc_sat_f64x2_s = 0xFE00,
-  I64x2__trunc_sat_f64x2_u = 0xFE01,
-  F64x2__convert_i64x2_s = 0xFE02,
-  F64x2__convert_i64x2_u = 0xFE03
+  /// Encoded from 0xFD 0x100, numbered from 0xFF80 to keep 0xFE for atomics.
+  I64x2__trunc_sat_f64x2_s = 0xFF80,
+  I64x2__trunc_sat_f64x2_u = 0xFF81,
+  F64x2__convert_i64x2_s = 0xFF82,
+  F64x2__convert_i64x2_u = 0xFF83,
+
+  /// Relaxed SIMD Instructions
+  /// Their encodings from 0xFD 0x100 are the ones of the non-standard SIMD
+  /// instructions above, so they are numbered from 0xFF00 instead.
+  I8x16__relaxed_swizzle = 0xFF00,
+  I32x4__relaxed_trunc_f32x4_s = 0xFF01,
+  I32x4__relaxed_trunc_f32x4_u = 0xFF02,
+  I32x4__relaxed_trunc_f64x2_s_zero = 0xFF03,
+  I32x4__relaxed_trunc_f64x2_u_zero = 0xFF04,
+  F32x4__relaxed_madd = 0xFF05,
+  F32x4__relaxed_nmadd = 0xFF06,
+  F64x2__relaxed_madd = 0xFF07,
+  F64x2__relaxed_nmadd = 0xFF08,
+  I8x16__relaxed_laneselect = 0xFF09,
+  I16x8__relaxed_laneselect = 0xFF0A,
+  I32x4__relaxed_laneselect = 0xFF0B,
+  I64x2__relaxed_laneselect = 0xFF0C,
+  F32x4__relaxed_min = 0xFF0D,
+  F32x4__relaxed_max = 0xFF0E,
+  F64x2__relaxed_min = 0xFF0F,
+  F64x2__relaxed_max = 0xFF10,
+  I16x8__relaxed_q15mulr_s = 0xFF11,
+  I16x8__relaxed_dot_i8x16_i7x16_s = 0xFF12,
+  I32x4__relaxed_dot_i8x16_i7x16_add_s = 0xFF13,
+
+  /// Threads Instructions
+  Memory__atomic__notify = 0xFE00,
+  Memory__atomic__wait32 = 0xFE01,
+  Memory__atomic__wait64 = 0xFE02,
+  Atomic__fence = 0xFE03,
+  I32__atomic__load = 0xFE10,
+  I64__atomic__load = 0xFE11,
+  I32__atomic__load8_u = 0xFE12,
+  I32__atomic__load16_u = 0xFE13,
+  I64__atomic__load8_u = 0xFE14,
+  I64__atomic__load16_u = 0xFE15,
+  I64__atomic__load32_u = 0xFE16,
+  I32__atomic__store = 0xFE17,
+  I64__atomic__store = 0xFE18,
+  I32__atomic__store8 = 0xFE19,
+  I32__atomic__store16 = 0xFE1A,
+  I64__atomic__store8 = 0xFE1B,
+  I64__atomic__store16 = 0xFE1C,
+  I64__atomic__store32 = 0xFE1D,
+  I32__atomic__rmw__add = 0xFE1E,
+  I64__atomic__rmw__add = 0xFE1F,
+  I32__atomic__rmw8__add_u = 0xFE20,
+  I32__atomic__rmw16__add_u = 0xFE21,
+  I64__atomic__rmw8__add_u = 0xFE22,
+  I64__atomic__rmw16__add_u = 0xFE23,
+  I64__atomic__rmw32__add_u = 0xFE24,
+  I32__atomic__rmw__sub = 0xFE25,
+  I64__atomic__rmw__sub = 0xFE26,
+  I32__atomic__rmw8__sub_u = 0xFE27,
+  I32__atomic__rmw16__sub_u = 0xFE28,
+  I64__atomic__rmw8__sub_u = 0xFE29,
+  I64__atomic__rmw16__sub_u = 0xFE2A,
+  I64__atomic__rmw32__sub_u = 0xFE2B,
+  I32__atomic__rmw__and = 0xFE2C,
+  I64__atomic__rmw__and = 0xFE2D,
+  I32__atomic__rmw8__and_u = 0xFE2E,
+  I32__atomic__rmw16__and_u = 0xFE2F,
+  I64__atomic__rmw8__and_u = 0xFE30,
+  I64__atomic__rmw16__and_u = 0xFE31,
+  I64__atomic__rmw32__and_u = 0xFE32,
+  I32__atomic__rmw__or = 0xFE33,
+  I64__atomic__rmw__or = 0xFE34,
+  I32__atomic__rmw8__or_u = 0xFE35,
+  I32__atomic__rmw16__or_u = 0xFE36,
+  I64__atomic__rmw8__or_u = 0xFE37,
+  I64__atomic__rmw16__or_u = 0xFE38,
+  I64__atomic__rmw32__or_u = 0xFE39,
+  I32__atomic__rmw__xor = 0xFE3A,
+  I64__atomic__rmw__xor = 0xFE3B,
+  I32__atomic__rmw8__xor_u = 0xFE3C,
+  I32__atomic__rmw16__xor_u = 0xFE3D,
+  I64__atomic__rmw8__xor_u = 0xFE3E,
+  I64__atomic__rmw16__xor_u = 0xFE3F,
+  I64__atomic__rmw32__xor_u = 0xFE40,
+  I32__atomic__rmw__xchg = 0xFE41,
+  I64__atomic__rmw__xchg = 0xFE42,
+  I32__atomic__rmw8__xchg_u = 0xFE43,
+  I32__atomic__rmw16__xchg_u = 0xFE44,
+  I64__atomic__rmw8__xchg_u = 0xFE45,
+  I64__atomic__rmw16__xchg_u = 0xFE46,
+  I64__atomic__rmw32__xchg_u = 0xFE47,
+  I32__atomic__rmw__cmpxchg = 0xFE48,
+  I64__atomic__rmw__cmpxchg = 0xFE49,
+  I32__atomic__rmw8__cmpxchg_u = 0xFE4A,
+  I32__atomic__rmw16__cmpxchg_u = 0xFE4B,
+  I64__atomic__rmw8__cmpxchg_u = 0xFE4C,
+  I64__atomic__rmw16__cmpxchg_u = 0xFE4D,
+  I64__atomic__rmw32__cmpxchg_u = 0xFE4E
 };
 
 /// Instruction opcode enumeration string mapping.
@@ -541,6 +643,10 @@ static inline std::unordered_map<OpCode, std::string> OpCodeStr = {
     {OpCode::Loop, "loop"},
     {OpCode::If, "if"},
     {OpCode::Else, "else"},
+    {OpCode::Try, "try"},
+    {OpCode::Catch, "catch"},
+    {OpCode::Throw, "throw"},
+    {OpCode::Rethrow, "rethrow"},
     {OpCode::End, "end"},
     {OpCode::Br, "br"},
     {OpCode::Br_if, "br_if"},
@@ -548,6 +654,8 @@ static inline std::unordered_map<OpCode, std::string> OpCodeStr = {
     {OpCode::Return, "return"},
     {OpCode::Call, "call"},
     {OpCode::Call_indirect, "call_indirect"},
+    {OpCode::Delegate, "delegate"},
+    {OpCode::Catch_all, "catch_all"},
 
     /// Reference Instructions
     {OpCode::Ref__null, "ref.null"},
@@ -982,6 +1090,101 @@ static inline std::unordered_map<OpCode, std::string> OpCodeStr = {
     {OpCode::I64x2__trunc_sat_f64x2_s, "i64x2.trunc_sat_f64x2_s"},
     {OpCode::I64x2__trunc_sat_f64x2_u, "i64x2.trunc_sat_f64x2_u"},
     {OpCode::F64x2__convert_i64x2_s, "f64x2.convert_i64x2_s"},
-    {OpCode::F64x2__convert_i64x2_u, "f64x2.convert_i64x2_u"}};
+    {OpCode::F64x2__convert_i64x2_u, "f64x2.convert_i64x2_u"},
+
+    /// Relaxed SIMD Instructions
+    {OpCode::I8x16__relaxed_swizzle, "i8x16.relaxed_swizzle"},
+    {OpCode::I32x4__relaxed_trunc_f32x4_s, "i32x4.relaxed_trunc_f32x4_s"},
+    {OpCode::I32x4__relaxed_trunc_f32x4_u, "i32x4.relaxed_trunc_f32x4_u"},
+    {OpCode::I32x4__relaxed_trunc_f64x2_s_zero,
+     "i32x4.relaxed_trunc_f64x2_s_zero"},
+    {OpCode::I32x4__relaxed_trunc_f64x2_u_zero,
+     "i32x4.relaxed_trunc_f64x2_u_zero"},
+    {OpCode::F32x4__relaxed_madd, "f32x4.relaxed_madd"},
+    {OpCode::F32x4__relaxed_nmadd, "f32x4.relaxed_nmadd"},
+    {OpCode::F64x2__relaxed_madd, "f64x2.relaxed_madd"},
+    {OpCode::F64x2__relaxed_nmadd, "f64x2.relaxed_nmadd"},
+    {OpCode::I8x16__relaxed_laneselect, "i8x16.relaxed_laneselect"},
+    {OpCode::I16x8__relaxed_laneselect, "i16x8.relaxed_laneselect"},
+    {OpCode::I32x4__relaxed_laneselect, "i32x4.relaxed_laneselect"},
+    {OpCode::I64x2__relaxed_laneselect, "i64x2.relaxed_laneselect"},
+    {OpCode::F32x4__relaxed_min, "f32x4.relaxed_min"},
+    {OpCode::F32x4__relaxed_max, "f32x4.relaxed_max"},
+    {OpCode::F64x2__relaxed_min, "f64x2.relaxed_min"},
+    {OpCode::F64x2__relaxed_max, "f64x2.relaxed_max"},
+    {OpCode::I16x8__relaxed_q15mulr_s, "i16x8.relaxed_q15mulr_s"},
+    {OpCode::I16x8__relaxed_dot_i8x16_i7x16_s,
+     "i16x8.relaxed_dot_i8x16_i7x16_s"},
+    {OpCode::I32x4__relaxed_dot_i8x16_i7x16_add_s,
+     "i32x4.relaxed_dot_i8x16_i7x16_add_s"},
+
+    /// Threads Instructions
+    {OpCode::Memory__atomic__notify, "memory.atomic.notify"},
+    {OpCode::Memory__atomic__wait32, "memory.atomic.wait32"},
+    {OpCode::Memory__atomic__wait64, "memory.atomic.wait64"},
+    {OpCode::Atomic__fence, "atomic.fence"},
+    {OpCode::I32__atomic__load, "i32.atomic.load"},
+    {OpCode::I64__atomic__load, "i64.atomic.load"},
+    {OpCode::I32__atomic__load8_u, "i32.atomic.load8_u"},
+    {OpCode::I32__atomic__load16_u, "i32.atomic.load16_u"},
+    {OpCode::I64__atomic__load8_u, "i64.atomic.load8_u"},
+    {OpCode::I64__atomic__load16_u, "i64.atomic.load16_u"},
+    {OpCode::I64__atomic__load32_u, "i64.atomic.load32_u"},
+    {OpCode::I32__atomic__store, "i32.atomic.store"},
+    {OpCode::I64__atomic__store, "i64.atomic.store"},
+    {OpCode::I32__atomic__store8, "i32.atomic.store8"},
+    {OpCode::I32__atomic__store16, "i32.atomic.store16"},
+    {OpCode::I64__atomic__store8, "i64.atomic.store8"},
+    {OpCode::I64__atomic__store16, "i64.atomic.store16"},
+    {OpCode::I64__atomic__store32, "i64.atomic.store32"},
+    {OpCode::I32__atomic__rmw__add, "i32.atomic.rmw.add"},
+    {OpCode::I64__atomic__rmw__add, "i64.atomic.rmw.add"},
+    {OpCode::I32__atomic__rmw8__add_u, "i32.atomic.rmw8.add_u"},
+    {OpCode::I32__atomic__rmw16__add_u, "i32.atomic.rmw16.add_u"},
+    {OpCode::I64__atomic__rmw8__add_u, "i64.atomic.rmw8.add_u"},
+    {OpCode::I64__atomic__rmw16__add_u, "i64.atomic.rmw16.add_u"},
+    {OpCode::I64__atomic__rmw32__add_u, "i64.atomic.rmw32.add_u"},
+    {OpCode::I32__atomic__rmw__sub, "i32.atomic.rmw.sub"},
+    {OpCode::I64__atomic__rmw__sub, "i64.atomic.rmw.sub"},
+    {OpCode::I32__atomic__rmw8__sub_u, "i32.atomic.rmw8.sub_u"},
+    {OpCode::I32__atomic__rmw16__sub_u, "i32.atomic.rmw16.sub_u"},
+    {OpCode::I64__atomic__rmw8__sub_u, "i64.atomic.rmw8.sub_u"},
+    {OpCode::I64__atomic__rmw16__sub_u, "i64.atomic.rmw16.sub_u"},
+    {OpCode::I64__atomic__rmw32__sub_u, "i64.atomic.rmw32.sub_u"},
+    {OpCode::I32__atomic__rmw__and, "i32.atomic.rmw.and"},
+    {OpCode::I64__atomic__rmw__and, "i64.atomic.rmw.and"},
+    {OpCode::I32__atomic__rmw8__and_u, "i32.atomic.rmw8.and_u"},
+    {OpCode::I32__atomic__rmw16__and_u, "i32.atomic.rmw16.and_u"},
+    {OpCode::I64__atomic__rmw8__and_u, "i64.atomic.rmw8.and_u"},
+    {OpCode::I64__atomic__rmw16__and_u, "i64.atomic.rmw16.and_u"},
+    {OpCode::I64__atomic__rmw32__and_u, "i64.atomic.rmw32.and_u"},
+    {OpCode::I32__atomic__rmw__or, "i32.atomic.rmw.or"},
+    {OpCode::I64__atomic__rmw__or, "i64.atomic.rmw.or"},
+    {OpCode::I32__atomic__rmw8__or_u, "i32.atomic.rmw8.or_u"},
+    {OpCode::I32__atomic__rmw16__or_u, "i32.atomic.rmw16.or_u"},
+    {OpCode::I64__atomic__rmw8__or_u, "i64.atomic.rmw8.or_u"},
+    {OpCode::I64__atomic__rmw16__or_u, "i64.atomic.rmw16.or_u"},
+    {OpCode::I64__atomic__rmw32__or_u, "i64.atomic.rmw32.or_u"},
+    {OpCode::I32__atomic__rmw__xor, "i32.atomic.rmw.xor"},
+    {OpCode::I64__atomic__rmw__xor, "i64.atomic.rmw.xor"},
+    {OpCode::I32__atomic__rmw8__xor_u, "i32.atomic.rmw8.xor_u"},
+    {OpCode::I32__atomic__rmw16__xor_u, "i32.atomic.rmw16.xor_u"},
+    {OpCode::I64__atomic__rmw8__xor_u, "i64.atomic.rmw8.xor_u"},
+    {OpCode::I64__atomic__rmw16__xor_u, "i64.atomic.rmw16.xor_u"},
+    {OpCode::I64__atomic__rmw32__xor_u, "i64.atomic.rmw32.xor_u"},
+    {OpCode::I32__atomic__rmw__xchg, "i32.atomic.rmw.xchg"},
+    {OpCode::I64__atomic__rmw__xchg, "i64.atomic.rmw.xchg"},
+    {OpCode::I32__atomic__rmw8__xchg_u, "i32.atomic.rmw8.xchg_u"},
+    {OpCode::I32__atomic__rmw16__xchg_u, "i32.atomic.rmw16.xchg_u"},
+    {OpCode::I64__atomic__rmw8__xchg_u, "i64.atomic.rmw8.xchg_u"},
+    {OpCode::I64__atomic__rmw16__xchg_u, "i64.atomic.rmw16.xchg_u"},
+    {OpCode::I64__atomic__rmw32__xchg_u, "i64.atomic.rmw32.xchg_u"},
+    {OpCode::I32__atomic__rmw__cmpxchg, "i32.atomic.rmw.cmpxchg"},
+    {OpCode::I64__atomic__rmw__cmpxchg, "i64.atomic.rmw.cmpxchg"},
+    {OpCode::I32__atomic__rmw8__cmpxchg_u, "i32.atomic.rmw8.cmpxchg_u"},
+    {OpCode::I32__atomic__rmw16__cmpxchg_u, "i32.atomic.rmw16.cmpxchg_u"},
+    {OpCode::I64__atomic__rmw8__cmpxchg_u, "i64.atomic.rmw8.cmpxchg_u"},
+    {OpCode::I64__atomic__rmw16__cmpxchg_u, "i64.atomic.rmw16.cmpxchg_u"},
+    {OpCode::I64__atomic__rmw32__cmpxchg_u, "i64.atomic.rmw32.cmpxchg_u"}};
 
 } // namespace SSVM
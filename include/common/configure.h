@@ -28,6 +28,7 @@ enum class Proposal : uint8_t {
   FunctionReferences,
   Memory64,
   ReferenceTypes,
+  RelaxedSIMD,
   SIMD,
   TailCall,
   Threads,
@@ -35,7 +36,12 @@ enum class Proposal : uint8_t {
 };
 
 /// Host Module Registration enum class.
-enum class HostRegistration : uint8_t { Wasi = 0, SSVM_Process, Max };
+enum class HostRegistration : uint8_t {
+  Wasi = 0,
+  SSVM_Process,
+  WasiThreads,
+  Max
+};
 
 /// Proposal name enumeration string mapping.
 extern const std::unordered_map<Proposal, std::string_view> ProposalStr;
@@ -75,12 +81,41 @@ public:
 
   uint32_t getMaxMemoryPage() const noexcept { return MaxMemPage; }
 
+  /// Set the pages reserved for memories without a maximum in modules
+  /// compiled with explicit bounds checks. Such a memory moves to a larger
+  /// reservation when it grows past this.
+  void setMemoryReservePage(const uint32_t Page) noexcept {
+    MemReservePage = Page;
+  }
+
+  uint32_t getMemoryReservePage() const noexcept { return MemReservePage; }
+
+  /// Set the byte size of the pre-reserved value stack. Label and frame
+  /// stacks are sized proportionally.
+  void setMaxStackSize(const uint64_t Size) noexcept { MaxStackSize = Size; }
+
+  uint64_t getMaxStackSize() const noexcept { return MaxStackSize; }
+
+  /// Write perf map records of loaded compiled functions.
+  void setPerfMap(const bool Value = true) noexcept { PerfMap = Value; }
+
+  bool hasPerfMap() const noexcept { return PerfMap; }
+
+  /// Write jitdump records of loaded compiled functions.
+  void setJitDump(const bool Value = true) noexcept { JitDump = Value; }
+
+  bool hasJitDump() const noexcept { return JitDump; }
+
 private:
   void addSet(const Proposal P) noexcept { addProposal(P); }
   void addSet(const HostRegistration H) noexcept { addHostRegistration(H); }
   std::bitset<static_cast<uint8_t>(Proposal::Max)> Proposals;
   std::bitset<static_cast<uint8_t>(HostRegistration::Max)> Hosts;
   uint32_t MaxMemPage = 65536;
+  uint32_t MemReservePage = 1024;
+  uint64_t MaxStackSize = UINT64_C(8) * 1024 * 1024;
+  bool PerfMap = false;
+  bool JitDump = false;
 };
 
 } // namespace SSVM
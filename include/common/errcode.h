@@ -96,6 +96,7 @@ enum class ErrCode : uint8_t {
   InvalidMemPages = 0x53,    /// Memory pages > 65536
   InvalidStartFunc = 0x54,   /// Invalid start function signature
   InvalidLaneIdx = 0x55,     /// Invalid lane index
+  InvalidTagIdx = 0x56,      /// Invalid tag index
   /// Instantiation phase
   ModuleNameConflict = 0x60,     /// Module name conflicted when importing.
   IncompatibleImportType = 0x61, /// Import matching failed
@@ -116,7 +117,11 @@ enum class ErrCode : uint8_t {
   UninitializedElement = 0x8A, /// Uninitialized element in table instance
   UndefinedElement = 0x8B,     /// Access undefined element in table instances
   IndirectCallTypeMismatch = 0x8C, /// Func type mismatch in call_indirect
-  ExecutionFailed = 0x8D           /// Host function execution failed
+  ExecutionFailed = 0x8D,          /// Host function execution failed
+  CallStackExhausted = 0x8E,       /// Stack capacity exceeded
+  UncaughtException = 0x8F,        /// Thrown exception not caught
+  UnalignedAtomicAccess = 0x90,    /// Atomic access of unaligned address
+  ExpectSharedMemory = 0x91        /// Atomic wait on unshared memory
 };
 
 /// Error code enumeration string mapping.
@@ -181,6 +186,7 @@ static inline std::unordered_map<ErrCode, std::string> ErrCodeStr = {
      "memory size must be at most 65536 pages (4GiB)"},
     {ErrCode::InvalidStartFunc, "start function"},
     {ErrCode::InvalidLaneIdx, "invalid lane index"},
+    {ErrCode::InvalidTagIdx, "unknown tag"},
     /// Instantiation phase
     {ErrCode::ModuleNameConflict, "module name conflict"},
     {ErrCode::IncompatibleImportType, "incompatible import type"},
@@ -201,7 +207,11 @@ static inline std::unordered_map<ErrCode, std::string> ErrCodeStr = {
     {ErrCode::UninitializedElement, "uninitialized element"},
     {ErrCode::UndefinedElement, "undefined element"},
     {ErrCode::IndirectCallTypeMismatch, "indirect call type mismatch"},
-    {ErrCode::ExecutionFailed, "host function failed"}};
+    {ErrCode::ExecutionFailed, "host function failed"},
+    {ErrCode::CallStackExhausted, "call stack exhausted"},
+    {ErrCode::UncaughtException, "uncaught exception"},
+    {ErrCode::UnalignedAtomicAccess, "unaligned atomic"},
+    {ErrCode::ExpectSharedMemory, "expected shared memory"}};
 
 static inline WasmPhase getErrCodePhase(ErrCode Code) {
   return static_cast<WasmPhase>((static_cast<uint8_t>(Code) & 0xF0) >> 5);
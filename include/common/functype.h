@@ -0,0 +1,30 @@
+// SPDX-License-Identifier: Apache-2.0
+//===-- ssvm/common/functype.h - Function type interning ------------------===//
+//
+// Part of the SSVM Project.
+//
+//===----------------------------------------------------------------------===//
+///
+/// \file
+/// This file contains the process-wide registry of canonical function types.
+///
+//===----------------------------------------------------------------------===//
+#pragma once
+
+#include "span.h"
+#include "types.h"
+
+#include <cstdint>
+
+namespace SSVM {
+
+/// Intern a function type and return its canonical type id.
+///
+/// Structurally equal function types always get the same id in a process, so
+/// type equality is a single integer compare. Ids are never recycled. The type
+/// `[] -> []` has the id `kEmptyFuncTypeId`.
+uint32_t internFuncType(Span<const ValType> Params, Span<const ValType> Returns);
+
+static inline constexpr const uint32_t kEmptyFuncTypeId = 0;
+
+} // namespace SSVM
@@ -0,0 +1,31 @@
+// SPDX-License-Identifier: Apache-2.0
+//===-- ssvm/common/hash.h - Hash function definition ---------------------===//
+//
+// Part of the SSVM Project.
+//
+//===----------------------------------------------------------------------===//
+///
+/// \file
+/// This file contains the hash function shared by the AOT compiler and loader.
+///
+//===----------------------------------------------------------------------===//
+#pragma once
+
+#include "common/span.h"
+#include "common/value.h"
+
+#include <cstdint>
+
+namespace SSVM {
+
+/// 64-bit FNV-1a hash of the bytes. Detects corruption, not tampering.
+inline uint64_t hashBytes(Span<const Byte> Data) noexcept {
+  uint64_t Hash = UINT64_C(0xcbf29ce484222325);
+  for (const Byte B : Data) {
+    Hash ^= B;
+    Hash *= UINT64_C(0x100000001b3);
+  }
+  return Hash;
+}
+
+} // namespace SSVM
@@ -100,14 +100,16 @@ enum class ExternalType : uint8_t {
   Function = 0x00U,
   Table = 0x01U,
   Memory = 0x02U,
-  Global = 0x03U
+  Global = 0x03U,
+  Tag = 0x04U
 };
 
 static inline std::unordered_map<ExternalType, std::string> ExternalTypeStr = {
     {ExternalType::Function, "function"},
     {ExternalType::Table, "table"},
     {ExternalType::Memory, "memory"},
-    {ExternalType::Global, "global"}};
+    {ExternalType::Global, "global"},
+    {ExternalType::Tag, "tag"}};
 
 ///
 /// The following are const expressions to checking types.
@@ -0,0 +1,21 @@
+// SPDX-License-Identifier: Apache-2.0
+#pragma once
+
+#include "common/errcode.h"
+#include "runtime/hostfunc.h"
+#include "threadsenv.h"
+
+namespace SSVM {
+namespace Host {
+
+template <typename T> class WasiThreads : public Runtime::HostFunction<T> {
+public:
+  WasiThreads(WasiThreadsEnvironment &HostEnv)
+      : Runtime::HostFunction<T>(0), Env(HostEnv) {}
+
+protected:
+  WasiThreadsEnvironment &Env;
+};
+
+} // namespace Host
+} // namespace SSVM
@@ -0,0 +1,45 @@
+// SPDX-License-Identifier: Apache-2.0
+#pragma once
+
+#include "common/errcode.h"
+
+#include <cstdint>
+#include <functional>
+#include <future>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace SSVM {
+namespace Host {
+
+class WasiThreadsEnvironment {
+public:
+  /// Runner of a spawned thread with its thread id and start argument. It
+  /// runs on the new thread, and is set by the host of the threads module.
+  /// It sets Ready to whether the thread is set up, before it starts.
+  using Runner = std::function<Expect<void>(
+      uint32_t Tid, uint32_t StartArg, std::promise<bool> &Ready)>;
+
+  ~WasiThreadsEnvironment() noexcept { joinAll(); }
+
+  /// Set the runner of spawned threads.
+  void setRunner(Runner R) { ThreadRunner = std::move(R); }
+
+  /// Spawn a thread running with the start argument, and return its thread
+  /// id once the thread is set up.
+  Expect<uint32_t> spawn(const uint32_t StartArg);
+
+  /// Wait for all spawned threads.
+  void joinAll() noexcept;
+
+private:
+  Runner ThreadRunner;
+  std::mutex Mutex;
+  std::vector<std::thread> Threads;
+  /// Thread id 0 is the main thread, and spawned threads start from 1.
+  uint32_t NextTid = 1;
+};
+
+} // namespace Host
+} // namespace SSVM
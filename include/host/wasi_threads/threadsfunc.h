@@ -0,0 +1,21 @@
+// SPDX-License-Identifier: Apache-2.0
+#pragma once
+
+#include "common/errcode.h"
+#include "runtime/hostfunc.h"
+#include "runtime/instance/memory.h"
+#include "threadsbase.h"
+#include "threadsenv.h"
+
+namespace SSVM {
+namespace Host {
+
+class WasiThreadSpawn : public WasiThreads<WasiThreadSpawn> {
+public:
+  WasiThreadSpawn(WasiThreadsEnvironment &Env) : WasiThreads(Env) {}
+  Expect<int32_t> body(Runtime::Instance::MemoryInstance *MemInst,
+                       uint32_t StartArg);
+};
+
+} // namespace Host
+} // namespace SSVM
@@ -0,0 +1,23 @@
+// SPDX-License-Identifier: Apache-2.0
+#pragma once
+
+#include "runtime/importobj.h"
+#include "threadsenv.h"
+
+#include <cstdint>
+
+namespace SSVM {
+namespace Host {
+
+class WasiThreadsModule : public Runtime::ImportObject {
+public:
+  WasiThreadsModule();
+
+  WasiThreadsEnvironment &getEnv() { return Env; }
+
+private:
+  WasiThreadsEnvironment Env;
+};
+
+} // namespace Host
+} // namespace SSVM
@@ -479,5 +479,35 @@ Expect<void> Interpreter::runVectorAvgrOp(ValVariant &Val1,
   return {};
 }
 
+template <typename T>
+Expect<void> Interpreter::runVectorMAddOp(ValVariant &Val1,
+                                          const ValVariant &Val2,
+                                          const ValVariant &Val3) const {
+  static_assert(std::is_floating_point_v<T>);
+  using VT [[gnu::vector_size(16)]] = T;
+  VT &V1 = retrieveValue<VT>(Val1);
+  const VT &V2 = retrieveValue<VT>(Val2);
+  const VT &V3 = retrieveValue<VT>(Val3);
+  /// Fused, as the compiled code on hosts with FMA.
+  if constexpr (sizeof(T) == 4) {
+    V1 = VT{std::fma(V1[0], V2[0], V3[0]), std::fma(V1[1], V2[1], V3[1]),
+            std::fma(V1[2], V2[2], V3[2]), std::fma(V1[3], V2[3], V3[3])};
+  } else if constexpr (sizeof(T) == 8) {
+    V1 = VT{std::fma(V1[0], V2[0], V3[0]), std::fma(V1[1], V2[1], V3[1])};
+  }
+
+  return {};
+}
+
+template <typename T>
+Expect<void> Interpreter::runVectorNMAddOp(ValVariant &Val1,
+                                           const ValVariant &Val2,
+                                           const ValVariant &Val3) const {
+  using VT [[gnu::vector_size(16)]] = T;
+  VT &V1 = retrieveValue<VT>(Val1);
+  V1 = -V1;
+  return runVectorMAddOp<T>(Val1, Val2, Val3);
+}
+
 } // namespace Interpreter
 } // namespace SSVM
@@ -157,5 +157,127 @@ Interpreter::runLoadSplatOp(Runtime::Instance::MemoryInstance &MemInst,
   return {};
 }
 
+template <typename T, typename I>
+TypeU<T>
+Interpreter::runAtomicLoadOp(Runtime::Instance::MemoryInstance &MemInst,
+                             const AST::Instruction &Instr) {
+  /// Calculate EA
+  ValVariant &Val = StackMgr.getTop();
+  const uint64_t EA = static_cast<uint64_t>(retrieveValue<uint32_t>(Val)) +
+                      Instr.getMemoryOffset();
+
+  /// Value = Mem.Data[EA : sizeof(I)] in sequentially consistent order.
+  if (auto Ptr = MemInst.getAtomicPointer<I>(EA)) {
+    retrieveValue<T>(Val) =
+        static_cast<T>(__atomic_load_n(*Ptr, __ATOMIC_SEQ_CST));
+  } else {
+    LOG(ERROR) << ErrInfo::InfoInstruction(Instr.getOpCode(),
+                                           Instr.getOffset());
+    return Unexpect(Ptr);
+  }
+  return {};
+}
+
+template <typename T, typename I>
+TypeU<T>
+Interpreter::runAtomicStoreOp(Runtime::Instance::MemoryInstance &MemInst,
+                              const AST::Instruction &Instr) {
+  /// Pop the value and the address from the Stack
+  const T C = retrieveValue<T>(StackMgr.pop());
+  const uint64_t EA =
+      static_cast<uint64_t>(retrieveValue<uint32_t>(StackMgr.pop())) +
+      Instr.getMemoryOffset();
+
+  /// Store the wrapped value in sequentially consistent order.
+  if (auto Ptr = MemInst.getAtomicPointer<I>(EA)) {
+    __atomic_store_n(*Ptr, static_cast<I>(C), __ATOMIC_SEQ_CST);
+  } else {
+    LOG(ERROR) << ErrInfo::InfoInstruction(Instr.getOpCode(),
+                                           Instr.getOffset());
+    return Unexpect(Ptr);
+  }
+  return {};
+}
+
+template <Interpreter::AtomicRMWOp Op, typename T, typename I>
+TypeU<T>
+Interpreter::runAtomicRMWOp(Runtime::Instance::MemoryInstance &MemInst,
+                            const AST::Instruction &Instr) {
+  /// Pop the operand, and replace the address by the old value.
+  const I C = static_cast<I>(retrieveValue<T>(StackMgr.pop()));
+  ValVariant &Val = StackMgr.getTop();
+  const uint64_t EA = static_cast<uint64_t>(retrieveValue<uint32_t>(Val)) +
+                      Instr.getMemoryOffset();
+
+  auto Ptr = MemInst.getAtomicPointer<I>(EA);
+  if (unlikely(!Ptr)) {
+    LOG(ERROR) << ErrInfo::InfoInstruction(Instr.getOpCode(),
+                                           Instr.getOffset());
+    return Unexpect(Ptr);
+  }
+  I Old;
+  if constexpr (Op == AtomicRMWOp::Add) {
+    Old = __atomic_fetch_add(*Ptr, C, __ATOMIC_SEQ_CST);
+  } else if constexpr (Op == AtomicRMWOp::Sub) {
+    Old = __atomic_fetch_sub(*Ptr, C, __ATOMIC_SEQ_CST);
+  } else if constexpr (Op == AtomicRMWOp::And) {
+    Old = __atomic_fetch_and(*Ptr, C, __ATOMIC_SEQ_CST);
+  } else if constexpr (Op == AtomicRMWOp::Or) {
+    Old = __atomic_fetch_or(*Ptr, C, __ATOMIC_SEQ_CST);
+  } else if constexpr (Op == AtomicRMWOp::Xor) {
+    Old = __atomic_fetch_xor(*Ptr, C, __ATOMIC_SEQ_CST);
+  } else {
+    Old = __atomic_exchange_n(*Ptr, C, __ATOMIC_SEQ_CST);
+  }
+  retrieveValue<T>(Val) = static_cast<T>(Old);
+  return {};
+}
+
+template <typename T, typename I>
+TypeU<T> Interpreter::runAtomicCompareExchangeOp(
+    Runtime::Instance::MemoryInstance &MemInst, const AST::Instruction &Instr) {
+  /// Pop the replacement and the expected value, and replace the address by
+  /// the old value.
+  const I Replacement = static_cast<I>(retrieveValue<T>(StackMgr.pop()));
+  I Expected = static_cast<I>(retrieveValue<T>(StackMgr.pop()));
+  ValVariant &Val = StackMgr.getTop();
+  const uint64_t EA = static_cast<uint64_t>(retrieveValue<uint32_t>(Val)) +
+                      Instr.getMemoryOffset();
+
+  auto Ptr = MemInst.getAtomicPointer<I>(EA);
+  if (unlikely(!Ptr)) {
+    LOG(ERROR) << ErrInfo::InfoInstruction(Instr.getOpCode(),
+                                           Instr.getOffset());
+    return Unexpect(Ptr);
+  }
+  /// On failure, Expected is updated to the old value.
+  __atomic_compare_exchange_n(*Ptr, &Expected, Replacement, false,
+                              __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST);
+  retrieveValue<T>(Val) = static_cast<T>(Expected);
+  return {};
+}
+
+template <typename T>
+TypeU<T>
+Interpreter::runAtomicWaitOp(Runtime::Instance::MemoryInstance &MemInst,
+                             const AST::Instruction &Instr) {
+  /// Pop the timeout and the expected value, and replace the address by the
+  /// result.
+  const int64_t Timeout = retrieveValue<int64_t>(StackMgr.pop());
+  const T Expected = retrieveValue<T>(StackMgr.pop());
+  ValVariant &Val = StackMgr.getTop();
+
+  if (auto Res = MemInst.atomicWait<T>(retrieveValue<uint32_t>(Val),
+                                       Instr.getMemoryOffset(), Expected,
+                                       Timeout)) {
+    retrieveValue<uint32_t>(Val) = *Res;
+  } else {
+    LOG(ERROR) << ErrInfo::InfoInstruction(Instr.getOpCode(),
+                                           Instr.getOffset());
+    return Unexpect(Res);
+  }
+  return {};
+}
+
 } // namespace Interpreter
 } // namespace SSVM
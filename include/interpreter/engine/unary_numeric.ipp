@@ -227,6 +227,25 @@ Expect<void> Interpreter::runVectorTruncSatOp(ValVariant &Val) const {
   return {};
 }
 
+template <typename TOut>
+Expect<void> Interpreter::runVectorTruncSatZeroOp(ValVariant &Val) const {
+  static_assert(sizeof(TOut) == 4);
+  const double FMin = static_cast<double>(std::numeric_limits<TOut>::min());
+  const double FMax = static_cast<double>(std::numeric_limits<TOut>::max());
+  using VTOut [[gnu::vector_size(16)]] = TOut;
+  using HVTOut [[gnu::vector_size(8)]] = TOut;
+  auto &V = retrieveValue<doublex2_t>(Val);
+  auto &Result = retrieveValue<VTOut>(Val);
+  /// Both bounds are exact in double, so clamping keeps the conversion defined.
+  doublex2_t X = {std::trunc(V[0]), std::trunc(V[1])};
+  X = X == X ? X : 0;
+  X = X < FMin ? FMin : X;
+  X = X > FMax ? FMax : X;
+  const HVTOut Y = __builtin_convertvector(X, HVTOut);
+  Result = VTOut{Y[0], Y[1], 0, 0};
+  return {};
+}
+
 template <typename TIn, typename TOut>
 Expect<void> Interpreter::runVectorConvertOp(ValVariant &Val) const {
   static_assert(sizeof(TIn) == sizeof(TOut));
@@ -19,6 +19,7 @@
 #include "common/statistics.h"
 #include "common/value.h"
 #include "runtime/importobj.h"
+#include "runtime/modtemplate.h"
 #include "runtime/stackmgr.h"
 #include "runtime/storemgr.h"
 
@@ -26,6 +27,7 @@
 #include <csetjmp>
 #include <csignal>
 #include <memory>
+#include <optional>
 #include <type_traits>
 #include <vector>
 
@@ -84,14 +86,9 @@ using TypeNN =
 class Interpreter {
 public:
   Interpreter(const Configure &Conf, Statistics::Statistics *S = nullptr)
-      : Conf(Conf), Stat(S) {
+      : Conf(Conf), StackMgr(Conf), Stat(S) {
     assert(This == nullptr);
     This = this;
-    if (Stat) {
-      ExecutionContext.InstrCount = &Stat->getInstrCountRef();
-      ExecutionContext.CostTable = Stat->getCostTable().data();
-      ExecutionContext.Gas = &Stat->getTotalCostRef();
-    }
   }
   ~Interpreter() noexcept { This = nullptr; }
 
@@ -99,6 +96,14 @@ public:
   Expect<void> instantiateModule(Runtime::StoreManager &StoreMgr,
                                  const AST::Module &Mod);
 
+  /// Resolve imports and constant expressions of a validated module once.
+  Expect<Runtime::ModuleTemplate> prepareModule(Runtime::StoreManager &StoreMgr,
+                                                const AST::Module &Mod);
+
+  /// Instantiate a prepared module template as the anonymous active module.
+  Expect<void> instantiateModule(Runtime::StoreManager &StoreMgr,
+                                 const Runtime::ModuleTemplate &Tmpl);
+
   /// Register host module.
   Expect<void> registerModule(Runtime::StoreManager &StoreMgr,
                               const Runtime::ImportObject &Obj);
@@ -133,10 +138,12 @@ private:
   Expect<void> instantiate(Runtime::StoreManager &StoreMgr,
                            const AST::Module &Mod, std::string_view Name);
 
-  /// Instantiation of Import Section.
+  /// Instantiation of Import Section. Compiled functions which rely on guard
+  /// pages can only import memories with guard pages.
   Expect<void> instantiate(Runtime::StoreManager &StoreMgr,
                            Runtime::Instance::ModuleInstance &ModInst,
-                           const AST::ImportSection &ImportSec);
+                           const AST::ImportSection &ImportSec,
+                           const bool GuardPages);
 
   /// Instantiation of Function Instances.
   Expect<void> instantiate(Runtime::StoreManager &StoreMgr,
@@ -157,7 +164,13 @@ private:
   /// Instantiation of Memory Instances.
   Expect<void> instantiate(Runtime::StoreManager &StoreMgr,
                            Runtime::Instance::ModuleInstance &ModInst,
-                           const AST::MemorySection &MemSec);
+                           const AST::MemorySection &MemSec,
+                           const bool GuardPages);
+
+  /// Instantiation of Tag Instances.
+  Expect<void> instantiate(Runtime::StoreManager &StoreMgr,
+                           Runtime::Instance::ModuleInstance &ModInst,
+                           const AST::TagSection &TagSec);
 
   /// Instantiation of Element Instances.
   Expect<void> instantiate(Runtime::StoreManager &StoreMgr,
@@ -183,6 +196,57 @@ private:
   Expect<void> instantiate(Runtime::StoreManager &StoreMgr,
                            Runtime::Instance::ModuleInstance &ModInst,
                            const AST::ExportSection &ExportSec);
+
+  /// Prepare the execution context of module for compiled functions.
+  void prepareExecutionContext(Runtime::StoreManager &StoreMgr,
+                               Runtime::Instance::ModuleInstance &ModInst);
+  /// @}
+
+  /// \name Steps shared by instantiating modules and module templates.
+  /// @{
+  /// Reset the store, stacks, and exception states before instantiation.
+  void resetInstantiation(Runtime::StoreManager &StoreMgr);
+
+  /// Insert instances into store manager in the instantiation mode. Instances
+  /// of registered modules are imported and kept across instantiations.
+  uint32_t insertFunction(Runtime::StoreManager &StoreMgr,
+                          const uint32_t ModAddr,
+                          const Runtime::Instance::FType &Type,
+                          std::shared_ptr<const AST::FunctionBody> Body,
+                          const uint32_t MaxStackHeight,
+                          Loader::Symbol<void> Symbol);
+  uint32_t insertTable(Runtime::StoreManager &StoreMgr, const RefType Type,
+                       const AST::Limit &Lim);
+  uint32_t insertMemory(Runtime::StoreManager &StoreMgr, const AST::Limit &Lim,
+                        const bool GuardPages);
+  uint32_t insertTag(Runtime::StoreManager &StoreMgr,
+                     const Runtime::Instance::FType &Type);
+  uint32_t insertGlobal(Runtime::StoreManager &StoreMgr, ValVariant &Storage,
+                        const ValType Type, const ValMut Mut,
+                        const ValVariant Val);
+  uint32_t insertElement(Runtime::StoreManager &StoreMgr, const uint32_t Offset,
+                         const RefType Type, Span<const RefVariant> Refs);
+  uint32_t insertData(Runtime::StoreManager &StoreMgr, const uint32_t Offset,
+                      Span<const Byte> Data);
+
+  /// Add an export of the module instance.
+  void addExport(Runtime::Instance::ModuleInstance &ModInst,
+                 const ExternalType Type, std::string_view Name,
+                 const uint32_t Idx);
+
+  /// Check that an active segment fits into its table or memory. Skipped when
+  /// the ReferenceTypes or BulkMemoryOperations proposal is enabled.
+  Expect<void> checkElemSegBound(Runtime::StoreManager &StoreMgr,
+                                 const uint32_t TableIdx, const uint32_t Offset,
+                                 const uint32_t Size);
+  Expect<void> checkDataSegBound(Runtime::StoreManager &StoreMgr,
+                                 const uint32_t MemIdx, const uint32_t Offset,
+                                 const uint32_t Size);
+
+  /// Run the start function of the module instance in the pushed frame.
+  Expect<void> runStartFunction(Runtime::StoreManager &StoreMgr,
+                                Runtime::Instance::ModuleInstance &ModInst,
+                                const uint32_t StartIdx);
   /// @}
 
   /// \name Helper Functions for block controls.
@@ -200,6 +264,11 @@ private:
   /// Helper function for getting arity from block type.
   std::pair<uint32_t, uint32_t> getBlockArity(Runtime::StoreManager &StoreMgr,
                                               const BlockType &BType);
+
+  /// Helper function for unwinding the thrown exception to its handler in the
+  /// top frame or its callers. Fail if no handler in interpreted frames.
+  Expect<void> unwindException(Runtime::StoreManager &StoreMgr,
+                               AST::InstrView::iterator &PC);
   /// @}
 
   /// \name Helper Functions for getting instances.
@@ -216,6 +285,10 @@ private:
   Runtime::Instance::GlobalInstance *
   getGlobInstByIdx(Runtime::StoreManager &StoreMgr, const uint32_t Idx);
 
+  /// Helper function for get global value by index.
+  ValVariant &getGlobValByIdx(Runtime::StoreManager &StoreMgr,
+                              const uint32_t Idx);
+
   /// Helper function for get element instance by index.
   Runtime::Instance::ElementInstance *
   getElemInstByIdx(Runtime::StoreManager &StoreMgr, const uint32_t Idx);
@@ -223,6 +296,12 @@ private:
   /// Helper function for get data instance by index.
   Runtime::Instance::DataInstance *
   getDataInstByIdx(Runtime::StoreManager &StoreMgr, const uint32_t Idx);
+
+  /// Helper function for resolving instances when the top frame changed.
+  void updateFrameCache(Runtime::StoreManager &StoreMgr);
+
+  /// Helper function for dropping resolved instances of the top frame.
+  void resetFrameCache() noexcept { FrameCache = {}; }
   /// @}
 
   /// \name Run instructions functions
@@ -246,13 +325,20 @@ private:
   Expect<void> runBrTableOp(Runtime::StoreManager &StoreMgr,
                             const AST::Instruction &Instr,
                             AST::InstrView::iterator &PC);
-  Expect<void> runReturnOp(AST::InstrView::iterator &PC);
+  Expect<void> runReturnOp(Runtime::StoreManager &StoreMgr,
+                           AST::InstrView::iterator &PC);
   Expect<void> runCallOp(Runtime::StoreManager &StoreMgr,
                          const AST::Instruction &Instr,
                          AST::InstrView::iterator &PC);
   Expect<void> runCallIndirectOp(Runtime::StoreManager &StoreMgr,
                                  const AST::Instruction &Instr,
                                  AST::InstrView::iterator &PC);
+  Expect<void> runTryOp(Runtime::StoreManager &StoreMgr,
+                        const AST::Instruction &Instr,
+                        AST::InstrView::iterator &PC);
+  Expect<void> runThrowOp(Runtime::StoreManager &StoreMgr,
+                          const AST::Instruction &Instr);
+  Expect<void> runRethrowOp(const AST::Instruction &Instr);
   /// ======= Variable instructions =======
   Expect<void> runLocalGetOp(const uint32_t Idx);
   Expect<void> runLocalSetOp(const uint32_t Idx);
@@ -296,6 +382,27 @@ private:
                                const AST::Instruction &Instr);
   Expect<void> runMemoryFillOp(Runtime::Instance::MemoryInstance &MemInst,
                                const AST::Instruction &Instr);
+  /// ======= Atomic memory instructions =======
+  /// Read-modify-write operations of atomic memory instructions.
+  enum class AtomicRMWOp : uint8_t { Add, Sub, And, Or, Xor, Xchg };
+  template <typename T, typename I>
+  TypeU<T> runAtomicLoadOp(Runtime::Instance::MemoryInstance &MemInst,
+                           const AST::Instruction &Instr);
+  template <typename T, typename I>
+  TypeU<T> runAtomicStoreOp(Runtime::Instance::MemoryInstance &MemInst,
+                            const AST::Instruction &Instr);
+  template <AtomicRMWOp Op, typename T, typename I>
+  TypeU<T> runAtomicRMWOp(Runtime::Instance::MemoryInstance &MemInst,
+                          const AST::Instruction &Instr);
+  template <typename T, typename I>
+  TypeU<T>
+  runAtomicCompareExchangeOp(Runtime::Instance::MemoryInstance &MemInst,
+                             const AST::Instruction &Instr);
+  template <typename T>
+  TypeU<T> runAtomicWaitOp(Runtime::Instance::MemoryInstance &MemInst,
+                           const AST::Instruction &Instr);
+  Expect<void> runAtomicNotifyOp(Runtime::Instance::MemoryInstance &MemInst,
+                                 const AST::Instruction &Instr);
   /// ======= Test and Relation Numeric instructions =======
   template <typename T> TypeU<T> runEqzOp(ValVariant &Val) const;
   template <typename T>
@@ -405,6 +512,8 @@ private:
   template <typename T> Expect<void> runVectorSqrtOp(ValVariant &Val) const;
   template <typename TIn, typename TOut>
   Expect<void> runVectorTruncSatOp(ValVariant &Val) const;
+  template <typename TOut>
+  Expect<void> runVectorTruncSatZeroOp(ValVariant &Val) const;
   template <typename TIn, typename TOut>
   Expect<void> runVectorConvertOp(ValVariant &Val) const;
   template <typename T> Expect<void> runVectorAnyTrueOp(ValVariant &Val) const;
@@ -449,6 +558,12 @@ private:
   template <typename T> Expect<void> runVectorFloorOp(ValVariant &Val) const;
   template <typename T> Expect<void> runVectorTruncOp(ValVariant &Val) const;
   template <typename T> Expect<void> runVectorNearestOp(ValVariant &Val) const;
+  template <typename T>
+  Expect<void> runVectorMAddOp(ValVariant &Val1, const ValVariant &Val2,
+                               const ValVariant &Val3) const;
+  template <typename T>
+  Expect<void> runVectorNMAddOp(ValVariant &Val1, const ValVariant &Val2,
+                                const ValVariant &Val3) const;
   /// @}
 
   /// \name Run compiled functions
@@ -476,6 +591,13 @@ public:
                        const uint32_t Len) noexcept;
   Expect<void> dataDrop(Runtime::StoreManager &StoreMgr,
                         const uint32_t DataIdx) noexcept;
+  Expect<uint32_t> memAtomicNotify(Runtime::StoreManager &StoreMgr,
+                                   const uint32_t Addr, const uint32_t Offset,
+                                   const uint32_t Count) noexcept;
+  Expect<uint32_t> memAtomicWait(Runtime::StoreManager &StoreMgr,
+                                 const uint32_t Addr, const uint32_t Offset,
+                                 const uint64_t Expected, const int64_t Timeout,
+                                 const uint32_t BitWidth) noexcept;
 
   Expect<RefVariant> tableGet(Runtime::StoreManager &StoreMgr,
                               const uint32_t TableIndex,
@@ -503,10 +625,22 @@ public:
                         const uint32_t ElemIndex) noexcept;
   Expect<RefVariant> refFunc(Runtime::StoreManager &StoreMgr,
                              const uint32_t FuncIndex) noexcept;
+  Expect<void> throwException(Runtime::StoreManager &StoreMgr,
+                              const uint32_t TagIndex,
+                              const ValVariant *Args) noexcept;
+  Expect<void> rethrowException(Runtime::StoreManager &StoreMgr,
+                                const ValVariant *Payload) noexcept;
+  Expect<uint32_t> catchException(Runtime::StoreManager &StoreMgr,
+                                  const uint32_t TagIndex,
+                                  ValVariant *Payload) noexcept;
 
   static void signalEnable() noexcept;
   static void signalDisable() noexcept;
   static void signalHandler(int Signal, siginfo_t *Siginfo, void *) noexcept;
+  /// Trap from a host function thunk called by compiled functions.
+  static void hostTrap(const uint8_t Code) noexcept;
+  /// Unwind compiled functions to the landing pads for the thrown exception.
+  [[noreturn]] static void raiseException();
   struct SignalEnabler {
     SignalEnabler() noexcept { Interpreter::signalEnable(); }
     ~SignalEnabler() noexcept { Interpreter::signalDisable(); }
@@ -519,20 +653,12 @@ public:
   template <typename FuncPtr> struct ProxyHelper;
 
 private:
-  /// Pointer to current object.
-  static Interpreter *This;
-  /// jmp_buf for trap.
-  static sigjmp_buf *TrapJump;
+  /// Pointer to current object of this thread.
+  static thread_local Interpreter *This;
+  /// jmp_buf for trap of this thread.
+  static thread_local sigjmp_buf *TrapJump;
   /// Store for passing into compiled functions
   Runtime::StoreManager *CurrentStore;
-  /// Execution context for compiled functions
-  struct ExecutionContext {
-    uint8_t *Memory;
-    ValVariant *const *Globals;
-    uint64_t *InstrCount;
-    uint64_t *CostTable;
-    uint64_t *Gas;
-  } ExecutionContext;
   /// @}
 
 private:
@@ -544,6 +670,30 @@ private:
   InstantiateMode InsMode;
   /// Stack
   Runtime::StackManager StackMgr;
+  /// Resolved instances of the module of the top frame.
+  ///
+  /// Refreshed when a frame of another module is pushed or popped. The memory
+  /// instance keeps a fixed data address across growth, so growing memory
+  /// needs no refresh. The global values are cached once the execution
+  /// context of the module is prepared.
+  struct {
+    uint32_t ModAddr = UINT32_MAX;
+    const Runtime::Instance::ModuleInstance *ModInst = nullptr;
+    Runtime::Instance::MemoryInstance *MemInst = nullptr;
+    ValVariant *const *Globals = nullptr;
+  } FrameCache;
+  /// Exception with the address of its tag and its payload.
+  struct Exception {
+    uint32_t TagAddr;
+    std::vector<ValVariant> Values;
+  };
+  /// Thrown exception which is not caught yet.
+  std::optional<Exception> Thrown;
+  /// Caught exceptions for rethrow, with the label index of their handlers.
+  std::vector<std::pair<uint32_t, Exception>> Caught;
+  /// Caught exceptions for rethrow in compiled functions, with the payload
+  /// buffer of their handlers on the native stack.
+  std::vector<std::pair<const ValVariant *, Exception>> CompiledCaught;
   /// Interpreter statistics
   Statistics::Statistics *Stat;
 };
@@ -14,10 +14,12 @@
 
 #include "common/errcode.h"
 #include "common/filesystem.h"
+#include "common/span.h"
 #include "common/types.h"
 #include "common/value.h"
 #include "shared_library.h"
 
+#include <optional>
 #include <string_view>
 #include <vector>
 
@@ -29,12 +31,27 @@ public:
   /// Set the file path.
   Expect<void> setPath(const std::filesystem::path &FilePath);
 
-  /// Read embedded Wasm binary.
+  /// Read embedded Wasm binary, which only libraries without metadata carry.
   Expect<std::vector<Byte>> getWasm();
 
+  /// Read embedded metadata, the Wasm binary without function bodies and
+  /// without custom sections other than the name section. Return nullopt if
+  /// the library has no metadata. The span is valid until the path changes.
+  Expect<std::optional<Span<const Byte>>> getMetadata();
+
   /// Read ssvm version.
   Expect<uint32_t> getVersion();
 
+  /// Select the best code variant supported by the host CPU. Return nullopt
+  /// if the library was compiled for a single target.
+  Expect<std::optional<uint32_t>> getVariant();
+
+  /// Get the end of the loaded code containing the address, or nullptr if
+  /// unknown.
+  const void *getCodeEnd(const void *Addr) const noexcept {
+    return Library->getCodeEnd(Addr);
+  }
+
   /// Get symbol.
   template <typename T = void> auto getSymbol(const char *Name) noexcept {
     return Library->get<T>(Name);
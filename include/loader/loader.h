@@ -40,6 +40,9 @@ public:
   Expect<std::unique_ptr<AST::Module>> parseModule(Span<const uint8_t> Code);
 
 private:
+  /// Write profiler records of the compiled functions of a loaded library.
+  void writeProfilerRecords(const AST::Module &Mod);
+
   const Configure Conf;
   FileMgrFStream FSMgr;
   FileMgrVector FVMgr;
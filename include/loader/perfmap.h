@@ -0,0 +1,46 @@
+// SPDX-License-Identifier: Apache-2.0
+//===-- ssvm/loader/perfmap.h - Profiler records of compiled code ---------===//
+//
+// Part of the SSVM Project.
+//
+//===----------------------------------------------------------------------===//
+///
+/// \file
+/// This file contains the declaration of writing perf map and jitdump records,
+/// which let Linux perf symbolize the compiled wasm functions.
+///
+//===----------------------------------------------------------------------===//
+#pragma once
+
+#include "common/span.h"
+#include "common/value.h"
+
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+
+namespace SSVM {
+namespace Loader {
+
+/// Address range of a compiled function.
+struct CodeRecord {
+  const void *Address;
+  uint64_t Size;
+  std::string Name;
+};
+
+/// Read the function names from the "name" custom section of a wasm binary,
+/// keyed by the function index. Malformed name sections are skipped.
+std::unordered_map<uint32_t, std::string>
+readFunctionNames(Span<const Byte> Wasm);
+
+/// Append the records to `/tmp/perf-<pid>.map`.
+void writePerfMap(Span<const CodeRecord> Records);
+
+/// Append the records with their code to `jit-<pid>.dump` in the directory
+/// of the `JITDUMPDIR` environment variable or the working directory. The
+/// file is kept open until exit, and `perf inject --jit` merges it.
+void writeJitDump(Span<const CodeRecord> Records);
+
+} // namespace Loader
+} // namespace SSVM
@@ -15,6 +15,10 @@
 #include "common/errcode.h"
 #include "common/filesystem.h"
 #include <memory>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
 
 #if SSVM_OS_WINDOWS
 #include <boost/winapi/dll.hpp>
@@ -115,9 +119,30 @@ public:
                      reinterpret_cast<T *>(getSymbolAddr(Name)));
   }
 
+  /// Get the end of the executable segment containing the address, or
+  /// nullptr if the address is not in loaded code.
+  const void *getCodeEnd(const void *Addr) const noexcept;
+
 private:
   void *getSymbolAddr(const char *Name) const noexcept;
   NativeHandle Handle{};
+
+#if SSVM_OS_LINUX
+  /// Map the ELF image and apply its relocations without the dynamic loader,
+  /// which keeps the library out of the global link map and makes unloading
+  /// a plain unmap. Fail on anything else than self-contained position
+  /// independent code, and the caller falls back to dlopen.
+  Expect<void> map(const std::filesystem::path &Path) noexcept;
+
+  /// \name Data of mapped image.
+  /// @{
+  uint8_t *Image = nullptr;
+  size_t ImageSize = 0;
+  std::unordered_map<std::string, void *> Exports;
+  std::vector<std::pair<const uint8_t *, const uint8_t *>> CodeRanges;
+  const uint8_t *EhFrame = nullptr;
+  /// @}
+#endif
 };
 
 } // namespace Loader
@@ -12,13 +12,16 @@
 #pragma once
 
 #include "common/span.h"
+#include "common/statistics.h"
 #include "common/value.h"
 #include "instance/memory.h"
+#include "instance/module.h"
 #include "instance/type.h"
 #include "stackmgr.h"
 
 #include <memory>
 #include <tuple>
+#include <type_traits>
 #include <vector>
 
 namespace SSVM {
@@ -43,15 +46,21 @@ public:
   /// Getter of host function cost.
   uint64_t getCost() const { return Cost; }
 
+  /// Getter of the native thunk for compiled functions. It's nullptr if the
+  /// function type can not be passed as plain C arguments.
+  void *getThunk() const { return Thunk; }
+
 protected:
   Instance::FType FuncType;
   const uint64_t Cost;
+  void *Thunk = nullptr;
 };
 
 template <typename T> class HostFunction : public HostFunctionBase {
 public:
   HostFunction(const uint64_t FuncCost = 0) : HostFunctionBase(FuncCost) {
     initializeFuncType();
+    initializeThunk();
   }
 
   Expect<void> run(Instance::MemoryInstance *MemInst,
@@ -95,16 +104,77 @@ protected:
   void initializeFuncType() {
     using F = FuncTraits<decltype(&T::body)>;
     using ArgsT = typename F::ArgsT;
-    FuncType.Params.reserve(F::ArgsN);
-    pushValType<ArgsT>(std::make_index_sequence<F::ArgsN>());
+    std::vector<ValType> Params, Returns;
+    Params.reserve(F::ArgsN);
+    pushValType<ArgsT>(Params, std::make_index_sequence<F::ArgsN>());
     if constexpr (F::hasReturn) {
-      FuncType.Returns.reserve(F::RetsN);
+      Returns.reserve(F::RetsN);
       using RetsT = typename F::RetsT;
-      pushRetType<RetsT>(std::make_index_sequence<F::RetsN>());
+      pushValType<RetsT>(Returns, std::make_index_sequence<F::RetsN>());
+    }
+    FuncType.setTypes(std::move(Params), std::move(Returns));
+  }
+
+  void initializeThunk() {
+    using F = FuncTraits<decltype(&T::body)>;
+    if constexpr (F::IsScalar) {
+      using ThunkT = ThunkHelper<typename F::ArgsT, typename F::RetT>;
+      Thunk = reinterpret_cast<void *>(&ThunkT::thunk);
     }
   }
 
 private:
+  /// Native thunk called by compiled functions with the wasm typed arguments.
+  /// It does the same accounting as calling the host function through the
+  /// interpreter, and traps through the entry on errors which stop execution.
+  /// A fault in the host function is not a trap of the compiled code, so the
+  /// trap signal handlers are removed while it runs, as in the interpreter.
+  template <typename ArgsT, typename RetT> struct ThunkHelper;
+  template <typename... A, typename RetT>
+  struct ThunkHelper<std::tuple<A...>, RetT> {
+    static RetT thunk(Instance::HostCallEntry *Entry, A... Args) noexcept {
+      auto *Stat = Entry->Stat;
+      if (Stat) {
+        if (unlikely(!Stat->addCost(Entry->Func->getCost()))) {
+          Entry->Trap(uint8_t(ErrCode::CostLimitExceeded));
+        }
+        Stat->stopRecordWasm();
+        Stat->startRecordHost();
+      }
+      Entry->SignalDisable();
+      auto Res =
+          static_cast<T *>(Entry->Func)->body(Entry->MemInst, Args...);
+      if (Stat) {
+        Stat->stopRecordHost();
+        Stat->startRecordWasm();
+      }
+      if (unlikely(!Res)) {
+        if (Res.error() == ErrCode::ExecutionFailed) {
+          /// Jump out with the handlers removed, as the interpreter proxies.
+          Entry->Trap(uint8_t(Res.error()));
+        }
+        Entry->SignalEnable();
+        if constexpr (!std::is_void_v<RetT>) {
+          return RetT{};
+        } else {
+          return;
+        }
+      }
+      Entry->SignalEnable();
+      if constexpr (!std::is_void_v<RetT>) {
+        return *Res;
+      }
+    }
+  };
+
+  /// Only the wasm number types map to plain C arguments, other arithmetic
+  /// types such as bool or char have no wasm type.
+  template <typename U>
+  static inline constexpr const bool IsNumType =
+      std::is_same_v<U, uint32_t> || std::is_same_v<U, int32_t> ||
+      std::is_same_v<U, uint64_t> || std::is_same_v<U, int64_t> ||
+      std::is_same_v<U, float> || std::is_same_v<U, double>;
+
   template <typename U> struct Wrap { using Type = std::tuple<U>; };
   template <typename... U> struct Wrap<std::tuple<U...>> {
     using Type = std::tuple<U...>;
@@ -114,16 +184,21 @@ private:
   struct FuncTraits<Expect<R> (C::*)(Instance::MemoryInstance *, A...)> {
     using ArgsT = std::tuple<A...>;
     using RetsT = typename Wrap<R>::Type;
+    using RetT = R;
     static inline constexpr const std::size_t ArgsN = std::tuple_size_v<ArgsT>;
     static inline constexpr const std::size_t RetsN = std::tuple_size_v<RetsT>;
     static inline constexpr const bool hasReturn = true;
+    static inline constexpr const bool IsScalar =
+        IsNumType<R> && (IsNumType<A> && ...);
   };
   template <typename C, typename... A>
   struct FuncTraits<Expect<void> (C::*)(Instance::MemoryInstance *, A...)> {
     using ArgsT = std::tuple<A...>;
+    using RetT = void;
     static inline constexpr const std::size_t ArgsN = std::tuple_size_v<ArgsT>;
     static inline constexpr const std::size_t RetsN = 0;
     static inline constexpr const bool hasReturn = false;
+    static inline constexpr const bool IsScalar = (IsNumType<A> && ...);
   };
 
   template <typename Tuple, typename SpanT, size_t... Indices>
@@ -141,16 +216,9 @@ private:
   }
 
   template <typename Tuple, std::size_t... Indices>
-  void pushValType(std::index_sequence<Indices...>) {
-    (FuncType.Params.push_back(
-         ValTypeFromType<std::tuple_element_t<Indices, Tuple>>()),
-     ...);
-  }
-
-  template <typename Tuple, std::size_t... Indices>
-  void pushRetType(std::index_sequence<Indices...>) {
-    (FuncType.Returns.push_back(
-         ValTypeFromType<std::tuple_element_t<Indices, Tuple>>()),
+  static void pushValType(std::vector<ValType> &Types,
+                          std::index_sequence<Indices...>) {
+    (Types.push_back(ValTypeFromType<std::tuple_element_t<Indices, Tuple>>()),
      ...);
   }
 };
@@ -13,6 +13,7 @@
 
 #include "common/span.h"
 #include "common/types.h"
+#include "common/value.h"
 
 #include <vector>
 
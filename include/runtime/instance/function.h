@@ -12,6 +12,7 @@
 #pragma once
 
 #include "ast/instruction.h"
+#include "ast/segment.h"
 #include "module.h"
 #include "runtime/hostfunc.h"
 
@@ -32,12 +33,13 @@ public:
   FunctionInstance(FunctionInstance &&Inst) noexcept
       : ModuleAddr(Inst.ModuleAddr), FuncType(Inst.FuncType),
         Data(std::move(Inst.Data)) {}
-  /// Constructor for native function.
+  /// Constructor for native function. The body is shared, not copied.
   FunctionInstance(const uint32_t ModAddr, const FType &Type,
-                   Span<const std::pair<uint32_t, ValType>> Locs,
-                   AST::InstrView Expr) noexcept
+                   std::shared_ptr<const AST::FunctionBody> Body,
+                   const uint32_t MaxStackHeight) noexcept
       : ModuleAddr(ModAddr), FuncType(Type),
-        Data(std::in_place_type_t<WasmFunction>(), Locs, Expr) {}
+        Data(std::in_place_type_t<WasmFunction>(), std::move(Body),
+             MaxStackHeight) {}
   /// Constructor for compiled function.
   FunctionInstance(const uint32_t ModAddr, const FType &Type,
                    Loader::Symbol<CompiledFunction> S) noexcept
@@ -75,13 +77,18 @@ public:
 
   /// Getter of function local variables.
   Span<const std::pair<uint32_t, ValType>> getLocals() const noexcept {
-    return std::get_if<WasmFunction>(&Data)->Locals;
+    return std::get_if<WasmFunction>(&Data)->Body->Locals;
+  }
+
+  /// Getter of the maximum operand stack height of function body.
+  uint32_t getMaxStackHeight() const noexcept {
+    return std::get_if<WasmFunction>(&Data)->MaxStackHeight;
   }
 
   /// Getter of function body instrs.
   AST::InstrView getInstrs() const noexcept {
     if (std::holds_alternative<WasmFunction>(Data)) {
-      return std::get<WasmFunction>(Data).Instrs;
+      return std::get<WasmFunction>(Data).Body->Instrs;
     } else {
       return {};
     }
@@ -99,11 +106,11 @@ public:
 
 private:
   struct WasmFunction {
-    const std::vector<std::pair<uint32_t, ValType>> Locals;
-    const AST::InstrVec Instrs;
-    WasmFunction(Span<const std::pair<uint32_t, ValType>> Locs,
-                 AST::InstrView Expr) noexcept
-        : Locals(Locs.begin(), Locs.end()), Instrs(Expr.begin(), Expr.end()) {}
+    const std::shared_ptr<const AST::FunctionBody> Body;
+    const uint32_t MaxStackHeight;
+    WasmFunction(std::shared_ptr<const AST::FunctionBody> B,
+                 const uint32_t H) noexcept
+        : Body(std::move(B)), MaxStackHeight(H) {}
   };
 
   /// \name Data of function instance.
@@ -14,16 +14,33 @@
 #include "common/types.h"
 #include "common/value.h"
 
+#include <memory>
+
 namespace SSVM {
 namespace Runtime {
 namespace Instance {
 
+/// Global instance. The value is always accessed through `ValuePtr`. Globals
+/// defined by module instances point to their slots in the globals block of
+/// the module, and own no value. Other globals, such as the globals of host
+/// modules, own their value.
 class GlobalInstance {
 public:
   GlobalInstance() = delete;
   GlobalInstance(const ValType ValueType, const ValMut Mutibility,
                  const ValVariant Val = uint32_t(0))
-      : Type(ValueType), Mut(Mutibility), Value(Val) {}
+      : Type(ValueType), Mut(Mutibility),
+        OwnedValue(std::make_unique<ValVariant>(Val)),
+        ValuePtr(OwnedValue.get()) {}
+  /// Construct with the value kept in external storage, such as the globals
+  /// block of a module instance.
+  GlobalInstance(ValVariant &Storage, const ValType ValueType,
+                 const ValMut Mutibility, const ValVariant Val = uint32_t(0))
+      : Type(ValueType), Mut(Mutibility), ValuePtr(&Storage) {
+    Storage = Val;
+  }
+  GlobalInstance(const GlobalInstance &) = delete;
+  GlobalInstance &operator=(const GlobalInstance &) = delete;
   virtual ~GlobalInstance() = default;
 
   /// Getter the global value type.
@@ -32,18 +49,23 @@ public:
   /// Getter the global mutation.
   ValMut getValMut() const { return Mut; }
 
+  /// Getter of checking the value is kept in external storage.
+  bool isExternalStorage() const noexcept { return !OwnedValue; }
+
   /// Getter of value.
-  const ValVariant &getValue() const { return Value; }
+  const ValVariant &getValue() const { return *ValuePtr; }
 
   /// Getter of value.
-  ValVariant &getValue() { return Value; }
+  ValVariant &getValue() { return *ValuePtr; }
 
 private:
   /// \name Data of global instance.
   /// @{
   const ValType Type;
   const ValMut Mut;
-  ValVariant Value;
+  /// Value of the global if it is not kept in external storage.
+  const std::unique_ptr<ValVariant> OwnedValue;
+  ValVariant *const ValuePtr;
   /// @}
 };
 
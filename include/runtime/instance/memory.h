@@ -19,15 +19,24 @@
 #include "common/value.h"
 
 #include <algorithm>
+#include <cerrno>
+#include <chrono>
 #include <cstdint>
 #include <cstring>
+#include <ctime>
 #include <fstream>
+#include <list>
 #include <memory>
+#include <mutex>
 #include <set>
+#include <unordered_map>
 #include <utility>
 
+#include <linux/futex.h>
 #include <linux/mman.h>
 #include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
 
 namespace SSVM {
 namespace Runtime {
@@ -69,23 +78,68 @@ public:
   MemoryInstance(MemoryInstance &&Inst) noexcept
       : HasMaxPage(Inst.HasMaxPage), MinPage(Inst.MinPage),
         MaxPage(Inst.MaxPage), DataPtr(Inst.DataPtr),
-        PageLimit(Inst.PageLimit) {
+        PageLimit(Inst.PageLimit), ReservedSize(Inst.ReservedSize),
+        GuardPages(Inst.GuardPages), Waiters(std::move(Inst.Waiters)) {
     Inst.DataPtr = nullptr;
   }
-  MemoryInstance(const AST::Limit &Lim, const uint32_t PageLim = 65536)
+  /// Create a memory instance. Compiled code relying on guard pages needs the
+  /// memory to be followed by an 8 GiB unmapped region. Memories of modules
+  /// compiled with explicit bounds checks set `GuardPages` to false and only
+  /// reserve the pages they can grow to. Without a maximum they reserve
+  /// `ReservePage` pages, and move to a larger reservation when growing past
+  /// it. Shared memories are accessed by other threads while growing, so they
+  /// always reserve the pages they can grow to and are never moved.
+  MemoryInstance(const AST::Limit &Lim, const uint32_t PageLim = 65536,
+                 const bool GuardPages = true,
+                 const uint32_t ReservePage = 1024)
       : HasMaxPage(Lim.hasMax()), MinPage(Lim.getMin()), MaxPage(Lim.getMax()),
-        PageLimit(PageLim) {
-    const auto UsableAddress = getUsableAddress();
-    if (UsableAddress == UINT64_C(-1)) {
-      LOG(ERROR) << "Unable to find usable memory address";
-      return;
-    }
+        PageLimit(PageLim), GuardPages(GuardPages) {
     if (MinPage > PageLimit) {
       LOG(ERROR)
           << "Create memory instance failed -- exceeded limit page size: "
           << PageLimit;
       return;
     }
+    if (Lim.isShared()) {
+      Waiters = std::make_unique<WaiterTable>();
+    }
+    if (!GuardPages || Lim.isShared()) {
+      uint32_t ReservedPage = std::min(getMaxPageCaped(), PageLimit);
+      if (!GuardPages && !Lim.isShared() && !HasMaxPage) {
+        ReservedPage = std::min(ReservedPage, std::max(MinPage, ReservePage));
+      }
+      ReservedSize = std::max(ReservedPage, UINT32_C(1)) * kPageSize;
+      void *Hint = nullptr;
+      int Flags = MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE;
+      if (GuardPages) {
+        /// The guard pages follow the reservation in the usable region.
+        const auto UsableAddress = getUsableAddress();
+        if (UsableAddress == UINT64_C(-1)) {
+          LOG(ERROR) << "Unable to find usable memory address";
+          return;
+        }
+        Hint = reinterpret_cast<void *>(UsableAddress);
+        Flags |= MAP_FIXED;
+      }
+      void *Ptr = mmap(Hint, ReservedSize, PROT_NONE, Flags, -1, 0);
+      if (Ptr == MAP_FAILED) {
+        LOG(ERROR) << "mmap failed";
+        return;
+      }
+      if (MinPage != 0 && mprotect(Ptr, MinPage * kPageSize,
+                                   PROT_READ | PROT_WRITE) != 0) {
+        LOG(ERROR) << "mprotect failed";
+        munmap(Ptr, ReservedSize);
+        return;
+      }
+      DataPtr = static_cast<uint8_t *>(Ptr);
+      return;
+    }
+    const auto UsableAddress = getUsableAddress();
+    if (UsableAddress == UINT64_C(-1)) {
+      LOG(ERROR) << "Unable to find usable memory address";
+      return;
+    }
     DataPtr = reinterpret_cast<uint8_t *>(UsableAddress);
     if (MinPage != 0) {
       if ((mmap(DataPtr, MinPage * kPageSize, PROT_READ | PROT_WRITE,
@@ -98,13 +152,22 @@ public:
   }
   ~MemoryInstance() noexcept {
     if (DataPtr) {
-      munmap(DataPtr, MinPage * kPageSize);
+      munmap(DataPtr, ReservedSize ? ReservedSize : MinPage * kPageSize);
     }
   }
 
+  /// Check the memory is followed by guard pages for compiled code.
+  bool hasGuardPages() const noexcept { return GuardPages; }
+
+  /// Check the memory is shared between threads.
+  bool isShared() const noexcept { return Waiters != nullptr; }
+
   /// Get page size of memory.data
   uint32_t getDataPageSize() const noexcept { return MinPage; }
 
+  /// Get address of the page size for compiled functions.
+  const uint32_t *getDataPageSizeAddr() const noexcept { return &MinPage; }
+
   /// Getter of limit definition.
   bool getHasMax() const noexcept { return HasMaxPage; }
 
@@ -131,12 +194,12 @@ public:
     if (Count == 0) {
       return true;
     }
-    /// Maximum pages count, 65536
-    uint32_t MaxPageCaped = k4G / kPageSize;
-    if (HasMaxPage) {
-      MaxPageCaped = std::min(MaxPage, MaxPageCaped);
+    std::unique_lock<std::mutex> Lock;
+    if (Waiters) {
+      /// Other threads can grow the shared memory at the same time.
+      Lock = std::unique_lock(Waiters->Mutex);
     }
-    if (Count + MinPage > MaxPageCaped) {
+    if (Count + MinPage > getMaxPageCaped()) {
       return false;
     }
     if (Count + MinPage > PageLimit) {
@@ -144,7 +207,18 @@ public:
                  << PageLimit;
       return false;
     }
-    if (MinPage == 0) {
+    if (ReservedSize) {
+      /// The pages were reserved at creation, or the memory moves to a larger
+      /// reservation.
+      if ((MinPage + Count) * kPageSize > ReservedSize &&
+          !moveReservation(MinPage + Count)) {
+        return false;
+      }
+      if (mprotect(DataPtr + MinPage * kPageSize, Count * kPageSize,
+                   PROT_READ | PROT_WRITE) != 0) {
+        return false;
+      }
+    } else if (MinPage == 0) {
       if (mmap(DataPtr, Count * kPageSize, PROT_READ | PROT_WRITE,
                MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED, -1, 0) == MAP_FAILED) {
         return false;
@@ -153,10 +227,109 @@ public:
                       (MinPage + Count) * kPageSize, 0) == MAP_FAILED) {
       return false;
     }
-    MinPage += Count;
+    /// Compiled code of other threads reads the page size without the lock.
+    __atomic_store_n(&MinPage, MinPage + Count, __ATOMIC_RELEASE);
     return true;
   }
 
+  /// Wake up to Count threads waiting on the address Addr + Offset, and
+  /// return the number of woken threads. No thread waits on unshared
+  /// memories.
+  Expect<uint32_t> atomicNotify(const uint32_t Addr, const uint32_t Offset,
+                                const uint32_t Count) noexcept {
+    const uint64_t EA = static_cast<uint64_t>(Addr) + Offset;
+    if (auto Res = checkAtomicAccess(EA, sizeof(uint32_t)); !Res) {
+      return Unexpect(Res);
+    }
+    if (!Waiters) {
+      return 0;
+    }
+    std::unique_lock Lock(Waiters->Mutex);
+    auto It = Waiters->Queues.find(static_cast<uint32_t>(EA));
+    if (It == Waiters->Queues.end()) {
+      return 0;
+    }
+    uint32_t Woken = 0;
+    auto &Queue = It->second;
+    while (Woken < Count && !Queue.empty()) {
+      uint32_t *Futex = Queue.front();
+      Queue.pop_front();
+      __atomic_store_n(Futex, UINT32_C(1), __ATOMIC_RELEASE);
+      syscall(SYS_futex, Futex, FUTEX_WAKE_PRIVATE, 1, nullptr, nullptr, 0);
+      ++Woken;
+    }
+    if (Queue.empty()) {
+      Waiters->Queues.erase(It);
+    }
+    return Woken;
+  }
+
+  /// Wait on the address Addr + Offset until notified or Timeout nanoseconds
+  /// passed, if the value there equals Expected. A negative Timeout waits
+  /// forever. Return 0 when notified, 1 when the value is not Expected, and 2
+  /// when timed out.
+  template <typename T>
+  Expect<uint32_t> atomicWait(const uint32_t Addr, const uint32_t Offset,
+                              const T Expected,
+                              const int64_t Timeout) noexcept {
+    const uint64_t EA = static_cast<uint64_t>(Addr) + Offset;
+    if (auto Res = checkAtomicAccess(EA, sizeof(T)); !Res) {
+      return Unexpect(Res);
+    }
+    if (!Waiters) {
+      LOG(ERROR) << ErrCode::ExpectSharedMemory;
+      return Unexpect(ErrCode::ExpectSharedMemory);
+    }
+    const auto Start = std::chrono::steady_clock::now();
+    /// Each waiter sleeps on a futex word of its own, so that notifying wakes
+    /// exactly the dequeued waiters in order.
+    uint32_t Futex = 0;
+    std::unique_lock Lock(Waiters->Mutex);
+    if (__atomic_load_n(reinterpret_cast<T *>(DataPtr + EA),
+                        __ATOMIC_SEQ_CST) != Expected) {
+      return 1;
+    }
+    auto &Queue = Waiters->Queues[static_cast<uint32_t>(EA)];
+    const auto Pos = Queue.insert(Queue.end(), &Futex);
+    Lock.unlock();
+    while (__atomic_load_n(&Futex, __ATOMIC_ACQUIRE) == 0) {
+      struct timespec Remain {};
+      if (Timeout >= 0) {
+        const int64_t Left =
+            Timeout - std::chrono::duration_cast<std::chrono::nanoseconds>(
+                          std::chrono::steady_clock::now() - Start)
+                          .count();
+        if (Left <= 0) {
+          break;
+        }
+        Remain.tv_sec = Left / 1000000000;
+        Remain.tv_nsec = Left % 1000000000;
+      }
+      syscall(SYS_futex, &Futex, FUTEX_WAIT_PRIVATE, 0,
+              Timeout >= 0 ? &Remain : nullptr, nullptr, 0);
+    }
+    Lock.lock();
+    if (Futex == 0) {
+      /// Timed out and not dequeued by notifying.
+      auto It = Waiters->Queues.find(static_cast<uint32_t>(EA));
+      It->second.erase(Pos);
+      if (It->second.empty()) {
+        Waiters->Queues.erase(It);
+      }
+      return 2;
+    }
+    return 0;
+  }
+
+  /// Get pointer of an atomic access of type T at the address EA, which
+  /// must be in bounds and naturally aligned.
+  template <typename T> Expect<T *> getAtomicPointer(const uint64_t EA) {
+    if (auto Res = checkAtomicAccess(EA, sizeof(T)); !Res) {
+      return Unexpect(Res);
+    }
+    return reinterpret_cast<T *>(DataPtr + EA);
+  }
+
   /// Get slice of Data[Offset : Offset + Length - 1]
   Expect<Span<Byte>> getBytes(const uint32_t Offset,
                               const uint32_t Length) const noexcept {
@@ -365,7 +538,65 @@ public:
 
   uint8_t *getDataPtr() const noexcept { return DataPtr; }
 
+  /// Get address of the data pointer for compiled functions, which reload it
+  /// after calls when the memory can move.
+  uint8_t *const *getDataPtrAddr() const noexcept { return &DataPtr; }
+
 private:
+  /// Move an unshared memory without guard pages to a reservation of at least
+  /// Page pages. The reservation at least doubles, so growing moves rarely.
+  /// The mapped pages are moved without copying.
+  bool moveReservation(const uint32_t Page) noexcept {
+    const uint64_t LimitSize =
+        static_cast<uint64_t>(std::min(getMaxPageCaped(), PageLimit)) *
+        kPageSize;
+    const uint64_t NewSize =
+        std::min(std::max(Page * kPageSize, ReservedSize * 2), LimitSize);
+    void *Ptr = mmap(nullptr, NewSize, PROT_NONE,
+                     MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+    if (Ptr == MAP_FAILED) {
+      return false;
+    }
+    const uint64_t MappedSize = MinPage * kPageSize;
+    if (MappedSize != 0 &&
+        mremap(DataPtr, MappedSize, MappedSize, MREMAP_MAYMOVE | MREMAP_FIXED,
+               Ptr) == MAP_FAILED) {
+      munmap(Ptr, NewSize);
+      return false;
+    }
+    /// Only the rest of the old reservation is still mapped.
+    if (ReservedSize > MappedSize) {
+      munmap(DataPtr + MappedSize, ReservedSize - MappedSize);
+    }
+    DataPtr = static_cast<uint8_t *>(Ptr);
+    ReservedSize = NewSize;
+    return true;
+  }
+
+  /// Check the atomic access of Size bytes at the address EA.
+  Expect<void> checkAtomicAccess(const uint64_t EA,
+                                 const uint32_t Size) const noexcept {
+    if (EA > UINT32_MAX || !checkAccessBound(static_cast<uint32_t>(EA), Size)) {
+      LOG(ERROR) << ErrCode::MemoryOutOfBounds;
+      LOG(ERROR) << ErrInfo::InfoBoundary(EA, Size, getBoundIdx());
+      return Unexpect(ErrCode::MemoryOutOfBounds);
+    }
+    if (EA % Size != 0) {
+      LOG(ERROR) << ErrCode::UnalignedAtomicAccess;
+      return Unexpect(ErrCode::UnalignedAtomicAccess);
+    }
+    return {};
+  }
+
+  /// Maximum pages count, 65536, capped by the limit definition.
+  uint32_t getMaxPageCaped() const noexcept {
+    uint32_t MaxPageCaped = k4G / kPageSize;
+    if (HasMaxPage) {
+      MaxPageCaped = std::min(MaxPage, MaxPageCaped);
+    }
+    return MaxPageCaped;
+  }
+
   /// \name Data of memory instance.
   /// @{
   const bool HasMaxPage;
@@ -373,6 +604,17 @@ private:
   const uint32_t MaxPage;
   uint8_t *DataPtr = nullptr;
   const uint32_t PageLimit;
+  /// Size of the reservation, 0 for unshared memories followed by guard
+  /// pages.
+  uint64_t ReservedSize = 0;
+  const bool GuardPages;
+  /// Threads waiting on the addresses of shared memories, with the lock of
+  /// growing shared memories. Null for unshared memories.
+  struct WaiterTable {
+    std::mutex Mutex;
+    std::unordered_map<uint32_t, std::list<uint32_t *>> Queues;
+  };
+  std::unique_ptr<WaiterTable> Waiters;
   /// @}
 };
 
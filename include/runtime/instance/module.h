@@ -17,14 +17,54 @@
 #include "type.h"
 
 #include <map>
+#include <memory>
 #include <optional>
 #include <string>
 #include <vector>
 
 namespace SSVM {
+namespace Statistics {
+class Statistics;
+} // namespace Statistics
 namespace Runtime {
+class HostFunctionBase;
 namespace Instance {
 
+struct CompiledTable;
+class MemoryInstance;
+
+/// Binding of an imported host function for compiled functions. Compiled code
+/// calls `Thunk(Entry, Args...)` with the plain wasm typed arguments when the
+/// thunk is set, and goes through the interpreter otherwise. The layout is
+/// shared with the AOT compiler.
+struct HostCallEntry {
+  void *Thunk = nullptr;
+  HostFunctionBase *Func = nullptr;
+  MemoryInstance *MemInst = nullptr;
+  Statistics::Statistics *Stat = nullptr;
+  void (*Trap)(const uint8_t Code) noexcept = nullptr;
+  /// Remove and restore the trap signal handlers around the host function.
+  void (*SignalDisable)() noexcept = nullptr;
+  void (*SignalEnable)() noexcept = nullptr;
+};
+
+/// Execution context for compiled functions of a module. The layout is shared
+/// with the AOT compiler.
+struct ExecutionContext {
+  /// Address of the memory base, which changes when a memory without guard
+  /// pages moves on growth.
+  uint8_t *const *Memory = nullptr;
+  ValVariant *const *Globals = nullptr;
+  uint64_t *InstrCount = nullptr;
+  uint64_t *CostTable = nullptr;
+  uint64_t *Gas = nullptr;
+  const uint32_t *FuncTypeIds = nullptr;
+  const CompiledTable *const *Tables = nullptr;
+  const uint32_t *MemoryPages = nullptr;
+  ValVariant *GlobalsBlock = nullptr;
+  HostCallEntry *HostCalls = nullptr;
+};
+
 class ModuleInstance {
 public:
   ModuleInstance(std::string_view Name) : ModName(Name) {}
@@ -33,10 +73,10 @@ public:
   std::string_view getModuleName() const { return ModName; }
 
   /// Copy the function types in type section to module instance.
-  void addFuncType(Span<const ValType> Params, Span<const ValType> Returns,
-                   Loader::Symbol<FType::Wrapper> Symbol) {
-    FuncTypes.emplace_back(Params, Returns, Symbol);
+  void addFuncType(const AST::FunctionType &Type) {
+    FuncTypes.emplace_back(Type);
   }
+  void addFuncType(const FType &Type) { FuncTypes.push_back(Type); }
 
   /// Register module owns instances with address in Store.
   void addFuncAddr(const uint32_t FuncAddr) { FuncAddrs.push_back(FuncAddr); }
@@ -47,6 +87,7 @@ public:
   }
   void addElemAddr(const uint32_t ElemAddr) { ElemAddrs.push_back(ElemAddr); }
   void addDataAddr(const uint32_t DataAddr) { DataAddrs.push_back(DataAddr); }
+  void addTagAddr(const uint32_t TagAddr) { TagAddrs.push_back(TagAddr); }
 
   /// Import instances.
   void importFunction(const uint32_t FuncAddr) {
@@ -65,6 +106,10 @@ public:
     ImpGlobalNum++;
     addGlobalAddr(GlobAddr);
   }
+  void importTag(const uint32_t TagAddr) {
+    ImpTagNum++;
+    addTagAddr(TagAddr);
+  }
 
   /// Export instances.
   void exportFunction(std::string_view Name, const uint32_t Idx) {
@@ -79,12 +124,16 @@ public:
   void exportGlobal(std::string_view Name, const uint32_t Idx) {
     ExpGlobals.emplace(Name, GlobalAddrs[Idx]);
   }
+  void exportTag(std::string_view Name, const uint32_t Idx) {
+    ExpTags.emplace(Name, TagAddrs[Idx]);
+  }
 
   /// Get import nums.
   uint32_t getFuncImportNum() const { return ImpFuncNum; }
   uint32_t getTableImportNum() const { return ImpTableNum; }
   uint32_t getMemImportNum() const { return ImpMemNum; }
   uint32_t getGlobalImportNum() const { return ImpGlobalNum; }
+  uint32_t getTagImportNum() const { return ImpTagNum; }
 
   /// Get export maps.
   const std::map<std::string, uint32_t, std::less<>> &getFuncExports() const {
@@ -99,6 +148,9 @@ public:
   const std::map<std::string, uint32_t, std::less<>> &getGlobalExports() const {
     return ExpGlobals;
   }
+  const std::map<std::string, uint32_t, std::less<>> &getTagExports() const {
+    return ExpTags;
+  }
 
   /// Get function type by index.
   Expect<const FType *> getFuncType(const uint32_t Idx) const {
@@ -151,14 +203,45 @@ public:
     }
     return DataAddrs[Idx];
   }
+  Expect<uint32_t> getTagAddr(const uint32_t Idx) const {
+    if (Idx >= TagAddrs.size()) {
+      /// Error logging need to be handled in caller.
+      return Unexpect(ErrCode::WrongInstanceIndex);
+    }
+    return TagAddrs[Idx];
+  }
+
+  /// Unsafe getters of the external values by index for validated code.
+  const FType &unsafeGetFuncType(const uint32_t Idx) const {
+    return FuncTypes[Idx];
+  }
+  uint32_t unsafeGetFuncAddr(const uint32_t Idx) const {
+    return FuncAddrs[Idx];
+  }
+  uint32_t unsafeGetTableAddr(const uint32_t Idx) const {
+    return TableAddrs[Idx];
+  }
+  uint32_t unsafeGetMemAddr(const uint32_t Idx) const { return MemAddrs[Idx]; }
+  uint32_t unsafeGetGlobalAddr(const uint32_t Idx) const {
+    return GlobalAddrs[Idx];
+  }
+  uint32_t unsafeGetElemAddr(const uint32_t Idx) const {
+    return ElemAddrs[Idx];
+  }
+  uint32_t unsafeGetDataAddr(const uint32_t Idx) const {
+    return DataAddrs[Idx];
+  }
+  uint32_t unsafeGetTagAddr(const uint32_t Idx) const { return TagAddrs[Idx]; }
 
   /// Get the added external values' numbers.
+  uint32_t getFuncTypeNum() const { return FuncTypes.size(); }
   uint32_t getFuncNum() const { return FuncAddrs.size(); }
   uint32_t getTableNum() const { return TableAddrs.size(); }
   uint32_t getMemNum() const { return MemAddrs.size(); }
   uint32_t getGlobalNum() const { return GlobalAddrs.size(); }
   uint32_t getElemNum() const { return ElemAddrs.size(); }
   uint32_t getDataNum() const { return DataAddrs.size(); }
+  uint32_t getTagNum() const { return TagAddrs.size(); }
 
   /// Set start function index and find the address in Store.
   void setStartIdx(const uint32_t Idx) {
@@ -177,10 +260,18 @@ public:
   /// Module Instance address in store manager.
   uint32_t Addr;
 
+  /// Contiguous storage of the values of globals defined in this module.
+  std::unique_ptr<ValVariant[]> GlobalsBlock;
+
   /// \name Data for compiled functions.
   /// @{
-  uint8_t *MemoryPtr;
+  uint8_t *const *MemoryPtr;
+  const uint32_t *MemoryPagesPtr;
   std::vector<ValVariant *> GlobalsPtr;
+  std::vector<uint32_t> FuncTypeIds;
+  std::vector<const CompiledTable *> TablesPtr;
+  std::vector<HostCallEntry> HostCalls;
+  ExecutionContext ExecCtx;
   /// @}
 
 private:
@@ -197,18 +288,21 @@ private:
   std::vector<uint32_t> GlobalAddrs;
   std::vector<uint32_t> ElemAddrs;
   std::vector<uint32_t> DataAddrs;
+  std::vector<uint32_t> TagAddrs;
 
   /// Imports.
   uint32_t ImpFuncNum = 0;
   uint32_t ImpTableNum = 0;
   uint32_t ImpMemNum = 0;
   uint32_t ImpGlobalNum = 0;
+  uint32_t ImpTagNum = 0;
 
   /// Exports.
   std::map<std::string, uint32_t, std::less<>> ExpFuncs;
   std::map<std::string, uint32_t, std::less<>> ExpTables;
   std::map<std::string, uint32_t, std::less<>> ExpMems;
   std::map<std::string, uint32_t, std::less<>> ExpGlobals;
+  std::map<std::string, uint32_t, std::less<>> ExpTags;
 
   /// Start function address
   bool HasStartFunc = false;
@@ -20,20 +20,82 @@
 
 #include <algorithm>
 #include <cstdint>
+#include <functional>
 #include <vector>
 
 namespace SSVM {
 namespace Runtime {
 namespace Instance {
 
+/// Flat entry of a function table for compiled functions.
+///
+/// `Function` is the native code of a compiled function, and `Context` is the
+/// execution context of its module. Both are nullptr for null references and
+/// for functions which must be called through the runtime.
+struct FuncTableEntry {
+  uint32_t TypeId = UINT32_MAX;
+  void *Function = nullptr;
+  void *Context = nullptr;
+};
+
+/// Flat view of a table for compiled functions. The layout is shared with the
+/// AOT compiler.
+struct CompiledTable {
+  const RefVariant *Refs = nullptr;
+  const FuncTableEntry *Entries = nullptr;
+  uint32_t Size = 0;
+};
+
 class TableInstance {
 public:
+  /// Resolver of the flat entry of a function reference.
+  using EntryResolver = std::function<FuncTableEntry(const RefVariant &)>;
+
   TableInstance() = delete;
   TableInstance(const RefType &Ref, const AST::Limit &Lim)
       : Type(Ref), HasMaxSize(Lim.hasMax()), MaxSize(Lim.getMax()),
-        Refs(Lim.getMin(), genNullRef(Ref)) {}
+        Refs(Lim.getMin(), genNullRef(Ref)) {
+    if (Type == RefType::FuncRef) {
+      Entries.resize(Refs.size());
+    }
+    updateView();
+  }
+  TableInstance(const TableInstance &) = delete;
+  TableInstance &operator=(const TableInstance &) = delete;
   virtual ~TableInstance() = default;
 
+  /// Setter of the entry resolver. Entries of existing references are resolved
+  /// again. The owner is the store whose instances the resolver refers to.
+  void setEntryResolver(EntryResolver R, const void *Owner) {
+    Resolver = std::move(R);
+    ResolverOwner = Owner;
+    resolveEntries(0, Refs.size());
+  }
+
+  /// Drop the entry resolver if it was set by the owner.
+  void clearEntryResolver(const void *Owner) {
+    if (ResolverOwner == Owner) {
+      setEntryResolver({}, nullptr);
+    }
+  }
+
+  /// Clear the flat entries of the references to functions from FuncAddr on,
+  /// which were dropped from the store of the owner. The references are
+  /// resolved by the runtime until they are written again.
+  void clearDroppedEntries(const uint32_t FuncAddr, const void *Owner) {
+    if (Type != RefType::FuncRef || ResolverOwner != Owner) {
+      return;
+    }
+    for (uint32_t I = 0; I < Refs.size(); ++I) {
+      if (!isNullRef(Refs[I]) && retrieveFuncIdx(Refs[I]) >= FuncAddr) {
+        Entries[I] = FuncTableEntry();
+      }
+    }
+  }
+
+  /// Getter of flat view for compiled functions.
+  const CompiledTable *getCompiledTable() const noexcept { return &View; }
+
   /// Getter of reference type.
   RefType getReferenceType() const noexcept { return Type; }
 
@@ -72,6 +134,11 @@ public:
     }
     Refs.resize(Refs.size() + Count);
     std::fill_n(Refs.end() - Count, Count, Val);
+    if (Type == RefType::FuncRef) {
+      Entries.resize(Refs.size());
+      resolveEntries(Refs.size() - Count, Count);
+    }
+    updateView();
     return true;
   }
   bool growTable(const uint32_t Count) {
@@ -109,6 +176,7 @@ public:
 
     /// Copy references.
     std::copy_n(Slice.begin() + Start, Length, Refs.begin() + Offset);
+    resolveEntries(Offset, Length);
     return {};
   }
 
@@ -124,6 +192,7 @@ public:
 
     /// Fill references.
     std::fill_n(Refs.begin() + Offset, Length, Val);
+    resolveEntries(Offset, Length);
     return {};
   }
 
@@ -145,10 +214,32 @@ public:
       return Unexpect(ErrCode::TableOutOfBounds);
     }
     Refs[Idx] = Val;
+    resolveEntries(Idx, 1);
     return {};
   }
 
 private:
+  /// Resolve flat entries of Refs[Offset : Offset + Length - 1].
+  void resolveEntries(const uint32_t Offset, const uint32_t Length) {
+    if (Type != RefType::FuncRef) {
+      return;
+    }
+    for (uint32_t I = Offset; I < Offset + Length; ++I) {
+      if (Resolver && !isNullRef(Refs[I])) {
+        Entries[I] = Resolver(Refs[I]);
+      } else {
+        Entries[I] = FuncTableEntry();
+      }
+    }
+  }
+
+  /// Update flat view after the storage changed.
+  void updateView() noexcept {
+    View.Refs = Refs.data();
+    View.Entries = Entries.data();
+    View.Size = Refs.size();
+  }
+
   /// \name Data of table instance.
   /// @{
   const RefType Type;
@@ -156,6 +247,14 @@ private:
   const uint32_t MaxSize;
   std::vector<RefVariant> Refs;
   /// @}
+
+  /// \name Data for compiled functions.
+  /// @{
+  std::vector<FuncTableEntry> Entries;
+  CompiledTable View;
+  EntryResolver Resolver;
+  const void *ResolverOwner = nullptr;
+  /// @}
 };
 
 } // namespace Instance
@@ -0,0 +1,41 @@
+// SPDX-License-Identifier: Apache-2.0
+//===-- ssvm/runtime/instance/tag.h - Tag Instance definition -------------===//
+//
+// Part of the SSVM Project.
+//
+//===----------------------------------------------------------------------===//
+///
+/// \file
+/// This file contains the tag instance definition in store manager.
+///
+//===----------------------------------------------------------------------===//
+#pragma once
+
+#include "type.h"
+
+namespace SSVM {
+namespace Runtime {
+namespace Instance {
+
+class TagInstance {
+public:
+  TagInstance() = delete;
+  TagInstance(const FType &Type) : TagType(Type) {}
+  TagInstance(const TagInstance &) = delete;
+  TagInstance &operator=(const TagInstance &) = delete;
+  virtual ~TagInstance() = default;
+
+  /// Getter of the function type of the tag. The parameters are the types of
+  /// the exception payload.
+  const FType &getTagType() const { return TagType; }
+
+private:
+  /// \name Data of tag instance.
+  /// @{
+  const FType TagType;
+  /// @}
+};
+
+} // namespace Instance
+} // namespace Runtime
+} // namespace SSVM
@@ -12,6 +12,7 @@
 #pragma once
 
 #include "ast/type.h"
+#include "common/functype.h"
 #include "common/span.h"
 #include "common/types.h"
 #include "common/value.h"
@@ -23,27 +24,51 @@ namespace Runtime {
 namespace Instance {
 
 /// Function type definition in this module.
-struct FType {
+class FType {
+public:
   using Wrapper = AST::FunctionType::Wrapper;
 
   FType() = default;
-  FType(Span<const ValType> P, Span<const ValType> R, Loader::Symbol<Wrapper> S)
-      : Params(P.begin(), P.end()), Returns(R.begin(), R.end()),
-        Symbol(std::move(S)) {}
+  /// Copy the function type in type section. The canonical type id is
+  /// interned when the module is loaded.
+  explicit FType(const AST::FunctionType &Type)
+      : Params(Type.getParamTypes().begin(), Type.getParamTypes().end()),
+        Returns(Type.getReturnTypes().begin(), Type.getReturnTypes().end()),
+        TypeId(Type.getTypeId()), Symbol(Type.getSymbol()) {}
 
   friend bool operator==(const FType &LHS, const FType &RHS) noexcept {
-    return LHS.Params == RHS.Params && LHS.Returns == RHS.Returns;
+    return LHS.TypeId == RHS.TypeId;
   }
 
   friend bool operator!=(const FType &LHS, const FType &RHS) noexcept {
     return !(LHS == RHS);
   }
 
+  /// Getter of parameter types vector.
+  const std::vector<ValType> &getParamTypes() const noexcept { return Params; }
+
+  /// Getter of return types vector.
+  const std::vector<ValType> &getReturnTypes() const noexcept {
+    return Returns;
+  }
+
+  /// Setter of parameter and return types. Interns the new canonical id.
+  void setTypes(std::vector<ValType> P, std::vector<ValType> R) {
+    Params = std::move(P);
+    Returns = std::move(R);
+    TypeId = internFuncType(Params, Returns);
+  }
+
+  /// Getter of canonical function type id.
+  uint32_t getTypeId() const noexcept { return TypeId; }
+
   /// Getter of symbol
   const auto &getSymbol() const noexcept { return Symbol; }
 
+private:
   std::vector<ValType> Params;
   std::vector<ValType> Returns;
+  uint32_t TypeId = kEmptyFuncTypeId;
 
   Loader::Symbol<Wrapper> Symbol;
 };
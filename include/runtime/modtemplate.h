@@ -0,0 +1,109 @@
+// SPDX-License-Identifier: Apache-2.0
+//===-- ssvm/runtime/modtemplate.h - Module template definition -----------===//
+//
+// Part of the SSVM Project.
+//
+//===----------------------------------------------------------------------===//
+///
+/// \file
+/// This file contains the definition of module template, the pre-linked plan
+/// for instantiating the same validated module repeatedly.
+///
+//===----------------------------------------------------------------------===//
+#pragma once
+
+#include "ast/segment.h"
+#include "ast/type.h"
+#include "common/types.h"
+#include "common/value.h"
+#include "instance/type.h"
+
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace SSVM {
+namespace Runtime {
+
+/// Module template holds everything of an instantiation which does not depend
+/// on the new instance: resolved import addresses, function types, shared
+/// function bodies, and the evaluated constant expressions of globals,
+/// elements, and data segments.
+///
+/// The import addresses refer to the registered modules of the store manager
+/// which prepared the template. The template must be rebuilt after the
+/// registered modules are reset.
+struct ModuleTemplate {
+  /// Evaluated constant expression. `ref.func` results are kept as function
+  /// indices and relocated to addresses of the new instance.
+  struct InitValue {
+    ValVariant Value;
+    std::optional<uint32_t> FuncIdx;
+  };
+
+  struct Function {
+    uint32_t TypeIdx;
+    std::shared_ptr<const AST::FunctionBody> Body;
+    uint32_t MaxStackHeight;
+    Loader::Symbol<void> Symbol;
+  };
+
+  struct Global {
+    ValType Type;
+    ValMut Mut;
+    InitValue Init;
+  };
+
+  struct Table {
+    RefType Type;
+    AST::Limit Lim;
+  };
+
+  struct Element {
+    AST::ElementSegment::ElemMode Mode;
+    RefType Type;
+    uint32_t TableIdx;
+    uint32_t Offset;
+    std::vector<InitValue> Inits;
+  };
+
+  struct Data {
+    AST::DataSegment::DataMode Mode;
+    uint32_t MemoryIdx;
+    uint32_t Offset;
+    std::vector<Byte> Bytes;
+  };
+
+  struct Export {
+    ExternalType Type;
+    std::string Name;
+    uint32_t Idx;
+  };
+
+  /// \name Data of module template.
+  /// @{
+  std::vector<Instance::FType> FuncTypes;
+  std::vector<uint32_t> ImpFuncAddrs;
+  std::vector<uint32_t> ImpTableAddrs;
+  std::vector<uint32_t> ImpMemAddrs;
+  std::vector<uint32_t> ImpGlobalAddrs;
+  std::vector<uint32_t> ImpTagAddrs;
+  std::vector<Function> Functions;
+  std::vector<Table> Tables;
+  std::vector<AST::Limit> Memories;
+  std::vector<Global> Globals;
+  /// Function type indices of the tags.
+  std::vector<uint32_t> Tags;
+  std::vector<Element> Elements;
+  std::vector<Data> Datas;
+  std::vector<Export> Exports;
+  std::optional<uint32_t> StartIdx;
+  /// Whether the memories are followed by guard pages for compiled code.
+  bool GuardPages = true;
+  /// @}
+};
+
+} // namespace Runtime
+} // namespace SSVM
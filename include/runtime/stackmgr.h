@@ -11,11 +11,20 @@
 //===----------------------------------------------------------------------===//
 #pragma once
 
+#include <algorithm>
 #include <cassert>
+#include <cstdint>
+#include <new>
 #include <optional>
-#include <vector>
+#include <type_traits>
+
+#include <sys/mman.h>
+#include <unistd.h>
 
 #include "ast/instruction.h"
+#include "common/configure.h"
+#include "common/errcode.h"
+#include "common/log.h"
 #include "common/span.h"
 #include "common/value.h"
 
@@ -27,12 +36,15 @@ public:
   struct Label {
     Label() = delete;
     Label(const uint32_t S, const uint32_t A, AST::InstrView::iterator FromIt,
-          std::optional<AST::InstrView::iterator> ContIt)
-        : VStackOff(S), Arity(A), From(FromIt), Cont(ContIt) {}
+          std::optional<AST::InstrView::iterator> ContIt,
+          std::optional<AST::InstrView::iterator> TryIt)
+        : VStackOff(S), Arity(A), From(FromIt), Cont(ContIt), Try(TryIt) {}
     uint32_t VStackOff;
     uint32_t Arity;
     AST::InstrView::iterator From;
     std::optional<AST::InstrView::iterator> Cont;
+    /// The try instruction while executing the body of a try block.
+    std::optional<AST::InstrView::iterator> Try;
   };
 
   struct Frame {
@@ -50,14 +62,96 @@ public:
 
   using Value = ValVariant;
 
+private:
+  /// Fixed capacity stack living in a pre-reserved mapping.
+  ///
+  /// The mapping is followed by an inaccessible guard page, so a push past the
+  /// reserved region faults instead of corrupting adjacent memory. Entries are
+  /// trivially copyable and never destroyed, which makes truncation O(1).
+  template <typename T> class ReservedStack {
+    static_assert(std::is_trivially_copyable_v<T> &&
+                      std::is_trivially_destructible_v<T>,
+                  "stack entries must be trivially copyable");
+
+  public:
+    ReservedStack(const size_t Cap) noexcept {
+      const size_t PageSize = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+      Bytes = (Cap * sizeof(T) + PageSize - 1) & ~(PageSize - 1);
+      void *Ptr = mmap(nullptr, Bytes + PageSize, PROT_NONE,
+                       MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+      if (Ptr == MAP_FAILED) {
+        LOG(ERROR) << "Stack reservation failed, size: " << Bytes;
+        Bytes = 0;
+        return;
+      }
+      if (Bytes > 0 && mprotect(Ptr, Bytes, PROT_READ | PROT_WRITE) != 0) {
+        LOG(ERROR) << "Stack protection failed, size: " << Bytes;
+        munmap(Ptr, Bytes + PageSize);
+        Bytes = 0;
+        return;
+      }
+      Base = Top = static_cast<T *>(Ptr);
+      Limit = Base + Bytes / sizeof(T);
+      MapBytes = Bytes + PageSize;
+    }
+    ReservedStack(const ReservedStack &) = delete;
+    ReservedStack &operator=(const ReservedStack &) = delete;
+    ~ReservedStack() noexcept {
+      if (Base) {
+        munmap(Base, MapBytes);
+      }
+    }
+
+    size_t size() const noexcept { return static_cast<size_t>(Top - Base); }
+    size_t capacity() const noexcept { return static_cast<size_t>(Limit - Base); }
+    size_t available() const noexcept { return static_cast<size_t>(Limit - Top); }
+    T &operator[](const size_t N) noexcept { return Base[N]; }
+    const T &operator[](const size_t N) const noexcept { return Base[N]; }
+    T &back() noexcept { return *(Top - 1); }
+    const T &back() const noexcept { return *(Top - 1); }
+    T *end() noexcept { return Top; }
+
+    template <typename... ArgsT> void emplace_back(ArgsT &&... Args) noexcept {
+      new (Top) T(std::forward<ArgsT>(Args)...);
+      ++Top;
+    }
+    void pop_back() noexcept { --Top; }
+    void truncate(const size_t N) noexcept { Top = Base + N; }
+    void clear() noexcept { Top = Base; }
+
+    /// Drop entries from `Off` while keeping the top `Keep` entries.
+    void unwind(const size_t Off, const size_t Keep) noexcept {
+      T *Dst = Base + Off;
+      if (Keep > 0 && Dst != Top - Keep) {
+        std::copy(Top - Keep, Top, Dst);
+      }
+      Top = Dst + Keep;
+    }
+
+  private:
+    T *Base = nullptr;
+    T *Top = nullptr;
+    T *Limit = nullptr;
+    size_t Bytes = 0;
+    size_t MapBytes = 0;
+  };
+
+public:
+  /// Value slots kept free beyond the checked limit when pushing a frame.
+  ///
+  /// Frames reserve their locals and maximum operand height up front. This
+  /// headroom covers the values pushed outside of function bodies, such as
+  /// invocation arguments and constant expressions.
+  static inline constexpr const uint32_t kValueReserve = 4096U;
+
   /// Stack manager provides the stack control for Wasm execution with VALIDATED
   /// modules. All operations of instructions passed validation, therefore no
   /// unexpect operations will occur.
-  StackManager() {
-    ValueStack.reserve(2048U);
-    LabelStack.reserve(64U);
-    FrameStack.reserve(16U);
-  };
+  StackManager(const Configure &Conf)
+      : ValueStack(std::max(Conf.getMaxStackSize() / sizeof(Value),
+                            UINT64_C(2) * kValueReserve)),
+        LabelStack(ValueStack.capacity() / 4),
+        FrameStack(ValueStack.capacity() / 16) {}
   ~StackManager() = default;
 
   /// Getter of stack size.
@@ -76,56 +170,92 @@ public:
 
   /// Push a new value entry to stack.
   template <typename T> void push(T &&Val) {
-    ValueStack.push_back(std::forward<T>(Val));
+    ValueStack.emplace_back(std::forward<T>(Val));
   }
 
   /// Unsafe Pop and return the top entry.
   Value pop() {
-    Value V = std::move(ValueStack.back());
+    Value V = ValueStack.back();
     ValueStack.pop_back();
     return V;
   }
 
-  /// Push a new frame entry to stack.
-  void pushFrame(const uint32_t ModuleAddr, const uint32_t LocalNum = 0,
-                 const uint32_t ArityNum = 0) {
+  /// Push a new frame entry to stack. Fail if the frame, its label, or the
+  /// `ExtraNum` values it pushes at most would not fit into the reserved
+  /// stacks.
+  Expect<void> pushFrame(const uint32_t ModuleAddr, const uint32_t LocalNum = 0,
+                         const uint32_t ArityNum = 0,
+                         const uint64_t ExtraNum = 0) {
+    if (unlikely(FrameStack.available() == 0 ||
+                 LabelStack.available() == 0 ||
+                 ValueStack.available() < ExtraNum + kValueReserve)) {
+      LOG(ERROR) << ErrCode::CallStackExhausted;
+      return Unexpect(ErrCode::CallStackExhausted);
+    }
     FrameStack.emplace_back(ModuleAddr, ValueStack.size() - LocalNum,
                             LabelStack.size(), ArityNum);
+    return {};
   }
 
   /// Push a dummy frame for invokation base.
-  void pushDummyFrame() {
+  Expect<void> pushDummyFrame() {
+    if (unlikely(FrameStack.available() == 0)) {
+      LOG(ERROR) << ErrCode::CallStackExhausted;
+      return Unexpect(ErrCode::CallStackExhausted);
+    }
     FrameStack.emplace_back(0, ValueStack.size(), LabelStack.size(), 0, true);
+    return {};
   }
 
   /// Unsafe pop top frame.
   void popFrame() {
-    assert(LabelStack.size() >= FrameStack.back().LStackOff);
-    LabelStack.erase(LabelStack.begin() + FrameStack.back().LStackOff,
-                     LabelStack.end());
-    assert(ValueStack.size() >=
-           FrameStack.back().VStackOff + FrameStack.back().Arity);
-    ValueStack.erase(ValueStack.begin() + FrameStack.back().VStackOff,
-                     ValueStack.end() - FrameStack.back().Arity);
+    const Frame &F = FrameStack.back();
+    assert(LabelStack.size() >= F.LStackOff);
+    LabelStack.truncate(F.LStackOff);
+    assert(ValueStack.size() >= F.VStackOff + F.Arity);
+    ValueStack.unwind(F.VStackOff, F.Arity);
     FrameStack.pop_back();
   }
 
-  /// Push a new label entry to stack.
-  void pushLabel(const uint32_t LocalNum, const uint32_t ArityNum,
-                 AST::InstrView::iterator From,
-                 std::optional<AST::InstrView::iterator> Cont = std::nullopt) {
-    LabelStack.emplace_back(ValueStack.size() - LocalNum, ArityNum, From, Cont);
+  /// Push a new label entry to stack. Fail if the label stack is exhausted.
+  Expect<void>
+  pushLabel(const uint32_t LocalNum, const uint32_t ArityNum,
+            AST::InstrView::iterator From,
+            std::optional<AST::InstrView::iterator> Cont = std::nullopt,
+            std::optional<AST::InstrView::iterator> Try = std::nullopt) {
+    if (unlikely(LabelStack.available() == 0)) {
+      LOG(ERROR) << ErrCode::CallStackExhausted;
+      return Unexpect(ErrCode::CallStackExhausted);
+    }
+    LabelStack.emplace_back(ValueStack.size() - LocalNum, ArityNum, From, Cont,
+                            Try);
+    return {};
+  }
+
+  /// Unsafe unwind to the top count of label for handling an exception. The
+  /// label is kept with the values under it, and leaves its try body.
+  void unwindToTryLabel(const uint32_t Count) {
+    LabelStack.truncate(LabelStack.size() - Count);
+    auto &L = LabelStack.back();
+    ValueStack.truncate(L.VStackOff);
+    L.Try.reset();
+  }
+
+  /// Unsafe unwind the top frame for an uncaught exception, dropping all its
+  /// labels and values.
+  void unwindFrame() {
+    const Frame &F = FrameStack.back();
+    LabelStack.truncate(F.LStackOff);
+    ValueStack.truncate(F.VStackOff);
+    FrameStack.pop_back();
   }
 
   /// Unsafe pop top label.
   AST::InstrView::iterator popLabel(const uint32_t Cnt = 1) {
     const auto &L = getLabelWithCount(Cnt - 1);
-    ValueStack.erase(ValueStack.begin() + L.VStackOff,
-                     ValueStack.end() - L.Arity);
+    ValueStack.unwind(L.VStackOff, L.Arity);
     auto It = L.From;
-    for (uint32_t I = 0; I < Cnt; ++I) {
-      LabelStack.pop_back();
-    }
+    LabelStack.truncate(LabelStack.size() - Cnt);
     return It;
   }
 
@@ -154,6 +284,14 @@ public:
     return LabelStack[LabelStack.size() - Count - 1];
   }
 
+  /// Getter of the count of labels in the top frame.
+  uint32_t getFrameLabelCount() const {
+    return LabelStack.size() - FrameStack.back().LStackOff;
+  }
+
+  /// Getter of the count of all labels in stack.
+  uint32_t getLabelCount() const { return LabelStack.size(); }
+
   /// Unsafe getter of the bottom label on the top frame.
   const Label &getBottomLabel() const {
     return LabelStack[FrameStack.back().LStackOff];
@@ -172,9 +310,9 @@ public:
 private:
   /// \name Data of stack manager.
   /// @{
-  std::vector<Value> ValueStack;
-  std::vector<Label> LabelStack;
-  std::vector<Frame> FrameStack;
+  ReservedStack<Value> ValueStack;
+  ReservedStack<Label> LabelStack;
+  ReservedStack<Frame> FrameStack;
   /// @}
 };
 
@@ -18,8 +18,11 @@
 #include "instance/memory.h"
 #include "instance/module.h"
 #include "instance/table.h"
+#include "instance/tag.h"
 
+#include <cassert>
 #include <memory>
+#include <new>
 #include <type_traits>
 #include <vector>
 
@@ -33,7 +36,8 @@ inline constexpr const bool IsImportEntityV =
     std::is_same_v<T, Instance::FunctionInstance> ||
     std::is_same_v<T, Instance::TableInstance> ||
     std::is_same_v<T, Instance::MemoryInstance> ||
-    std::is_same_v<T, Instance::GlobalInstance>;
+    std::is_same_v<T, Instance::GlobalInstance> ||
+    std::is_same_v<T, Instance::TagInstance>;
 
 /// Return true if T is entities.
 template <typename T>
@@ -47,12 +51,15 @@ inline constexpr const bool IsInstanceV =
     IsEntityV<T> || std::is_same_v<T, Instance::ModuleInstance>;
 } // namespace
 
+/// Store of the instances of modules. It is not synchronized: only its owner
+/// thread adds or drops instances. Threads spawned by the VM instantiate into
+/// stores of their own, and only read the instances they share from here.
 class StoreManager {
 public:
   StoreManager()
       : NumMod(0), NumFunc(0), NumTab(0), NumMem(0), NumGlob(0), NumElem(0),
-        NumData(0) {}
-  ~StoreManager() = default;
+        NumData(0), NumTag(0) {}
+  ~StoreManager() noexcept { clearHostTableResolvers(); }
 
   /// Import instances and move owner to store manager.
   template <typename... Args> uint32_t importModule(Args &&... Values) {
@@ -66,7 +73,10 @@ public:
                           std::forward<Args>(Values)...);
   }
   template <typename... Args> uint32_t importTable(Args &&... Values) {
-    return importInstance(ImpTabInsts, TabInsts, std::forward<Args>(Values)...);
+    uint32_t TabAddr =
+        importInstance(ImpTabInsts, TabInsts, std::forward<Args>(Values)...);
+    setTableResolver(*TabInsts.back());
+    return TabAddr;
   }
   template <typename... Args> uint32_t importMemory(Args &&... Values) {
     return importInstance(ImpMemInsts, MemInsts, std::forward<Args>(Values)...);
@@ -75,6 +85,9 @@ public:
     return importInstance(ImpGlobInsts, GlobInsts,
                           std::forward<Args>(Values)...);
   }
+  template <typename... Args> uint32_t importTag(Args &&... Values) {
+    return importInstance(ImpTagInsts, TagInsts, std::forward<Args>(Values)...);
+  }
   template <typename... Args> uint32_t importElement(Args &&... Values) {
     return importInstance(ImpElemInsts, ElemInsts,
                           std::forward<Args>(Values)...);
@@ -89,6 +102,8 @@ public:
     return importHostInstance(Func, FuncInsts);
   }
   uint32_t importHostTable(Instance::TableInstance &Tab) {
+    setTableResolver(Tab);
+    HostTabInsts.push_back(&Tab);
     return importHostInstance(Tab, TabInsts);
   }
   uint32_t importHostMemory(Instance::MemoryInstance &Mem) {
@@ -97,6 +112,9 @@ public:
   uint32_t importHostGlobal(Instance::GlobalInstance &Glob) {
     return importHostInstance(Glob, GlobInsts);
   }
+  uint32_t importHostTag(Instance::TagInstance &Tag) {
+    return importHostInstance(Tag, TagInsts);
+  }
 
   /// Insert instances for instantiation and move ownership to store manager.
   template <typename... Args> uint32_t pushModule(Args &&... Values) {
@@ -113,7 +131,10 @@ public:
   }
   template <typename... Args> uint32_t pushTable(Args &&... Values) {
     ++NumTab;
-    return importInstance(ImpTabInsts, TabInsts, std::forward<Args>(Values)...);
+    uint32_t TabAddr =
+        importInstance(ImpTabInsts, TabInsts, std::forward<Args>(Values)...);
+    setTableResolver(*TabInsts.back());
+    return TabAddr;
   }
   template <typename... Args> uint32_t pushMemory(Args &&... Values) {
     ++NumMem;
@@ -124,6 +145,10 @@ public:
     return importInstance(ImpGlobInsts, GlobInsts,
                           std::forward<Args>(Values)...);
   }
+  template <typename... Args> uint32_t pushTag(Args &&... Values) {
+    ++NumTag;
+    return importInstance(ImpTagInsts, TagInsts, std::forward<Args>(Values)...);
+  }
   template <typename... Args> uint32_t pushElement(Args &&... Values) {
     ++NumElem;
     return importInstance(ImpElemInsts, ElemInsts,
@@ -139,7 +164,7 @@ public:
   void popModule() {
     if (NumMod > 0) {
       --NumMod;
-      ImpModInsts.pop_back();
+      ImpModInsts.truncate(1);
       ModInsts.pop_back();
     }
   }
@@ -160,6 +185,9 @@ public:
   Expect<Instance::GlobalInstance *> getGlobal(const uint32_t Addr) {
     return getInstance(Addr, GlobInsts);
   }
+  Expect<Instance::TagInstance *> getTag(const uint32_t Addr) {
+    return getInstance(Addr, TagInsts);
+  }
   Expect<Instance::ElementInstance *> getElement(const uint32_t Addr) {
     return getInstance(Addr, ElemInsts);
   }
@@ -167,6 +195,40 @@ public:
     return getInstance(Addr, DataInsts);
   }
 
+  /// Unsafe getter of instances by address for validated code.
+  Instance::ModuleInstance *unsafeGetModule(const uint32_t Addr) const {
+    assert(Addr < ModInsts.size());
+    return ModInsts[Addr];
+  }
+  Instance::FunctionInstance *unsafeGetFunction(const uint32_t Addr) const {
+    assert(Addr < FuncInsts.size());
+    return FuncInsts[Addr];
+  }
+  Instance::TableInstance *unsafeGetTable(const uint32_t Addr) const {
+    assert(Addr < TabInsts.size());
+    return TabInsts[Addr];
+  }
+  Instance::MemoryInstance *unsafeGetMemory(const uint32_t Addr) const {
+    assert(Addr < MemInsts.size());
+    return MemInsts[Addr];
+  }
+  Instance::GlobalInstance *unsafeGetGlobal(const uint32_t Addr) const {
+    assert(Addr < GlobInsts.size());
+    return GlobInsts[Addr];
+  }
+  Instance::TagInstance *unsafeGetTag(const uint32_t Addr) const {
+    assert(Addr < TagInsts.size());
+    return TagInsts[Addr];
+  }
+  Instance::ElementInstance *unsafeGetElement(const uint32_t Addr) const {
+    assert(Addr < ElemInsts.size());
+    return ElemInsts[Addr];
+  }
+  Instance::DataInstance *unsafeGetData(const uint32_t Addr) const {
+    assert(Addr < DataInsts.size());
+    return DataInsts[Addr];
+  }
+
   /// Get exported instances of instantiated module.
   const std::map<std::string, uint32_t, std::less<>> getFuncExports() const {
     if (NumMod > 0) {
@@ -192,6 +254,12 @@ public:
     }
     return {};
   }
+  const std::map<std::string, uint32_t, std::less<>> getTagExports() const {
+    if (NumMod > 0) {
+      return ModInsts.back()->getTagExports();
+    }
+    return {};
+  }
 
   /// Get active instance of instantiated module.
   Expect<Instance::ModuleInstance *> getActiveModule() const {
@@ -214,8 +282,15 @@ public:
   }
 
   /// Reset store.
+  ///
+  /// The instances of the instantiated module are destroyed, which releases
+  /// their memory mappings and code, but the slab chunks are kept for the
+  /// next instantiation. Tables which are kept may still hold references to
+  /// the dropped functions, so their flat entries are cleared, or compiled
+  /// code would call the dropped functions directly.
   void reset(bool IsResetRegistered = false) {
     if (IsResetRegistered) {
+      clearHostTableResolvers();
       NumMod = 0;
       NumFunc = 0;
       NumTab = 0;
@@ -223,6 +298,7 @@ public:
       NumGlob = 0;
       NumElem = 0;
       NumData = 0;
+      NumTag = 0;
       ModInsts.clear();
       FuncInsts.clear();
       TabInsts.clear();
@@ -230,6 +306,7 @@ public:
       GlobInsts.clear();
       ElemInsts.clear();
       DataInsts.clear();
+      TagInsts.clear();
       ImpModInsts.clear();
       ImpFuncInsts.clear();
       ImpTabInsts.clear();
@@ -237,57 +314,121 @@ public:
       ImpGlobInsts.clear();
       ImpElemInsts.clear();
       ImpDataInsts.clear();
+      ImpTagInsts.clear();
     } else {
-      while (NumMod > 0) {
-        --NumMod;
-        ImpModInsts.pop_back();
-        ModInsts.pop_back();
-      }
-      while (NumFunc > 0) {
-        --NumFunc;
-        ImpFuncInsts.pop_back();
-        FuncInsts.pop_back();
-      }
-      while (NumTab > 0) {
-        --NumTab;
-        ImpTabInsts.pop_back();
-        TabInsts.pop_back();
-      }
-      while (NumMem > 0) {
-        --NumMem;
-        ImpMemInsts.pop_back();
-        MemInsts.pop_back();
-      }
-      while (NumGlob > 0) {
-        --NumGlob;
-        ImpGlobInsts.pop_back();
-        GlobInsts.pop_back();
-      }
-      while (NumElem > 0) {
-        --NumElem;
-        ImpElemInsts.pop_back();
-        ElemInsts.pop_back();
-      }
-      while (NumData > 0) {
-        --NumData;
-        ImpDataInsts.pop_back();
-        DataInsts.pop_back();
+      if (NumFunc > 0) {
+        const uint32_t FuncAddr = FuncInsts.size() - NumFunc;
+        for (uint32_t I = 0; I < TabInsts.size() - NumTab; ++I) {
+          TabInsts[I]->clearDroppedEntries(FuncAddr, this);
+        }
       }
+      truncate(ImpModInsts, ModInsts, NumMod);
+      truncate(ImpFuncInsts, FuncInsts, NumFunc);
+      truncate(ImpTabInsts, TabInsts, NumTab);
+      truncate(ImpMemInsts, MemInsts, NumMem);
+      truncate(ImpGlobInsts, GlobInsts, NumGlob);
+      truncate(ImpElemInsts, ElemInsts, NumElem);
+      truncate(ImpDataInsts, DataInsts, NumData);
+      truncate(ImpTagInsts, TagInsts, NumTag);
     }
   }
 
 private:
+  /// Resolve function references of the table to flat entries for compiled
+  /// functions. The resolver refers to this store, so host tables, which may
+  /// outlive it, drop the resolver when they are unregistered.
+  void setTableResolver(Instance::TableInstance &Tab) {
+    Tab.setEntryResolver(
+        [this](const RefVariant &Ref) {
+          const auto *FuncInst = FuncInsts[retrieveFuncIdx(Ref)];
+          Instance::FuncTableEntry Entry;
+          Entry.TypeId = FuncInst->getFuncType().getTypeId();
+          if (FuncInst->isCompiledFunction()) {
+            Entry.Function = FuncInst->getSymbol().get();
+            Entry.Context = &ModInsts[FuncInst->getModuleAddr()]->ExecCtx;
+          }
+          return Entry;
+        },
+        this);
+  }
+
+  /// Drop the resolvers of this store from the registered host tables.
+  void clearHostTableResolvers() noexcept {
+    for (auto *Tab : HostTabInsts) {
+      Tab->clearEntryResolver(this);
+    }
+    HostTabInsts.clear();
+  }
+
+  /// Typed slab arena for owned instances.
+  ///
+  /// Instances are constructed in place in fixed-size chunks, so they never
+  /// move and neighbouring instances share cache lines. Popped instances are
+  /// destroyed at once, but their chunks are kept and reused.
+  template <typename T> class Slab {
+  public:
+    static inline constexpr const size_t kChunkSize = 64;
+
+    Slab() = default;
+    Slab(const Slab &) = delete;
+    Slab &operator=(const Slab &) = delete;
+    ~Slab() noexcept { clear(); }
+
+    size_t size() const noexcept { return Size; }
+
+    template <typename... Args> T *emplace_back(Args &&... Values) {
+      if (Size / kChunkSize == Chunks.size()) {
+        Chunks.push_back(std::make_unique<Storage[]>(kChunkSize));
+      }
+      T *Ptr = new (&Chunks[Size / kChunkSize][Size % kChunkSize])
+          T(std::forward<Args>(Values)...);
+      ++Size;
+      return Ptr;
+    }
+
+    /// Destroy the last N instances.
+    void truncate(const size_t N) noexcept {
+      assert(N <= Size);
+      for (size_t I = 0; I < N; ++I) {
+        at(--Size)->~T();
+      }
+    }
+
+    void clear() noexcept { truncate(Size); }
+
+  private:
+    using Storage = std::aligned_storage_t<sizeof(T), alignof(T)>;
+
+    T *at(const size_t Idx) noexcept {
+      return std::launder(
+          reinterpret_cast<T *>(&Chunks[Idx / kChunkSize][Idx % kChunkSize]));
+    }
+
+    std::vector<std::unique_ptr<Storage[]>> Chunks;
+    /// Number of live instances.
+    size_t Size = 0;
+  };
+
   /// Helper function for importing instances and move ownership.
   template <typename T, typename... Args>
   std::enable_if_t<IsInstanceV<T>, uint32_t>
-  importInstance(std::vector<std::unique_ptr<T>> &ImpInstsVec,
-                 std::vector<T *> &InstsVec, Args &&... Values) {
+  importInstance(Slab<T> &ImpInstsVec, std::vector<T *> &InstsVec,
+                 Args &&... Values) {
     uint32_t Addr = InstsVec.size();
-    ImpInstsVec.push_back(std::make_unique<T>(std::forward<Args>(Values)...));
-    InstsVec.push_back(ImpInstsVec.back().get());
+    InstsVec.push_back(
+        ImpInstsVec.emplace_back(std::forward<Args>(Values)...));
     return Addr;
   }
 
+  /// Helper function for dropping the instances of instantiated module.
+  template <typename T>
+  void truncate(Slab<T> &ImpInstsVec, std::vector<T *> &InstsVec,
+                uint32_t &Num) {
+    InstsVec.resize(InstsVec.size() - Num);
+    ImpInstsVec.truncate(Num);
+    Num = 0;
+  }
+
   /// Helper function for importing host instances.
   template <typename T>
   std::enable_if_t<IsImportEntityV<T>, uint32_t>
@@ -310,13 +451,14 @@ private:
 
   /// \name Store owned instances by StoreManager.
   /// @{
-  std::vector<std::unique_ptr<Instance::ModuleInstance>> ImpModInsts;
-  std::vector<std::unique_ptr<Instance::FunctionInstance>> ImpFuncInsts;
-  std::vector<std::unique_ptr<Instance::TableInstance>> ImpTabInsts;
-  std::vector<std::unique_ptr<Instance::MemoryInstance>> ImpMemInsts;
-  std::vector<std::unique_ptr<Instance::GlobalInstance>> ImpGlobInsts;
-  std::vector<std::unique_ptr<Instance::ElementInstance>> ImpElemInsts;
-  std::vector<std::unique_ptr<Instance::DataInstance>> ImpDataInsts;
+  Slab<Instance::ModuleInstance> ImpModInsts;
+  Slab<Instance::FunctionInstance> ImpFuncInsts;
+  Slab<Instance::TableInstance> ImpTabInsts;
+  Slab<Instance::MemoryInstance> ImpMemInsts;
+  Slab<Instance::GlobalInstance> ImpGlobInsts;
+  Slab<Instance::ElementInstance> ImpElemInsts;
+  Slab<Instance::DataInstance> ImpDataInsts;
+  Slab<Instance::TagInstance> ImpTagInsts;
   /// @}
 
   /// \name Pointers to imported instances from modules or import objects.
@@ -328,8 +470,12 @@ private:
   std::vector<Instance::GlobalInstance *> GlobInsts;
   std::vector<Instance::ElementInstance *> ElemInsts;
   std::vector<Instance::DataInstance *> DataInsts;
+  std::vector<Instance::TagInstance *> TagInsts;
   /// @}
 
+  /// Host tables not owned by store manager.
+  std::vector<Instance::TableInstance *> HostTabInsts;
+
   /// \name Data for instantiated module.
   /// @{
   uint32_t NumMod;
@@ -339,6 +485,7 @@ private:
   uint32_t NumGlob;
   uint32_t NumElem;
   uint32_t NumData;
+  uint32_t NumTag;
   /// @}
 };
 
@@ -63,15 +63,19 @@ public:
   void addElem(const AST::ElementSegment &Elem);
   void addData(const AST::DataSegment &Data);
   void addRef(const uint32_t FuncIdx);
+  void addTag(const uint32_t TypeIdx);
   void addLocal(const ValType &V);
   void addLocal(const VType &V);
 
   std::vector<VType> result() { return ValStack; };
+  /// Getter of the maximum operand stack height of the last validation.
+  uint32_t getMaxHeight() const { return MaxHeight; }
   auto &getTypes() { return Types; }
   auto &getFunctions() { return Funcs; }
   auto &getTables() { return Tables; }
   auto &getMemories() { return Mems; }
   auto &getGlobals() { return Globals; }
+  auto &getTags() { return Tags; }
   uint32_t getNumImportFuncs() const { return NumImportFuncs; }
   uint32_t getNumImportGlobals() const { return NumImportGlobals; }
 
@@ -136,6 +140,7 @@ private:
   std::vector<RefType> Elems;
   std::vector<uint32_t> Datas;
   std::unordered_set<uint32_t> Refs;
+  std::vector<uint32_t> Tags;
   uint32_t NumImportFuncs = 0;
   uint32_t NumImportGlobals = 0;
   std::vector<VType> Locals;
@@ -144,6 +149,7 @@ private:
   /// Running stack.
   std::vector<CtrlFrame> CtrlStack;
   std::vector<VType> ValStack;
+  uint32_t MaxHeight = 0;
 };
 
 } // namespace Validator
@@ -28,8 +28,9 @@ public:
   Validator(const Configure &Conf) noexcept : Conf(Conf) {}
   ~Validator() = default;
 
-  /// Validate AST::Module.
-  Expect<void> validate(const AST::Module &Mod);
+  /// Validate AST::Module, and record the operand stack heights of its code
+  /// segments.
+  Expect<void> validate(AST::Module &Mod);
 
 private:
   /// Validate AST::Types
@@ -41,7 +42,7 @@ private:
   /// Validate AST::Segments
   Expect<void> validate(const AST::GlobalSegment &GlobSeg);
   Expect<void> validate(const AST::ElementSegment &ElemSeg);
-  Expect<void> validate(const AST::CodeSegment &CodeSeg,
+  Expect<void> validate(AST::CodeSegment &CodeSeg,
                         const uint32_t TypeIdx);
   Expect<void> validate(const AST::DataSegment &DataSeg);
 
@@ -56,10 +57,14 @@ private:
   Expect<void> validate(const AST::MemorySection &MemSec);
   Expect<void> validate(const AST::GlobalSection &GlobSec);
   Expect<void> validate(const AST::ElementSection &ElemSec);
-  Expect<void> validate(const AST::CodeSection &CodeSec);
+  Expect<void> validate(AST::CodeSection &CodeSec);
   Expect<void> validate(const AST::DataSection &DataSec);
   Expect<void> validate(const AST::StartSection &StartSec);
   Expect<void> validate(const AST::ExportSection &ExportSec);
+  Expect<void> validate(const AST::TagSection &TagSec);
+
+  /// Validate the function type index of a tag.
+  Expect<void> validateTagType(const uint32_t TypeIdx);
 
   /// Validate const expression
   Expect<void> validateConstExpr(AST::InstrView Instrs,
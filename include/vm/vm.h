@@ -25,6 +25,7 @@
 #include "runtime/storemgr.h"
 
 #include <cstdint>
+#include <future>
 #include <memory>
 #include <string>
 #include <vector>
@@ -38,14 +39,16 @@ public:
   VM() = delete;
   VM(const Configure &Conf);
   VM(const Configure &Conf, Runtime::StoreManager &S);
-  ~VM() = default;
+  /// Spawned threads are joined before any member is destroyed, since they
+  /// run on the instances of the store and the host modules.
+  ~VM() noexcept;
 
   /// ======= Functions can be called before instantiated stage. =======
   /// Register wasm modules and host modules.
   Expect<void> registerModule(std::string_view Name,
                               const std::filesystem::path &Path);
   Expect<void> registerModule(std::string_view Name, Span<const Byte> Code);
-  Expect<void> registerModule(std::string_view Name, const AST::Module &Module);
+  Expect<void> registerModule(std::string_view Name, AST::Module &Module);
   Expect<void> registerModule(const Runtime::ImportObject &Obj);
 
   /// Rapidly load, validate, instantiate, and run wasm function.
@@ -56,7 +59,7 @@ public:
   runWasmFile(Span<const Byte> Code, std::string_view Func,
               Span<const ValVariant> Params = {});
   Expect<std::vector<ValVariant>>
-  runWasmFile(const AST::Module &Module, std::string_view Func,
+  runWasmFile(AST::Module &Module, std::string_view Func,
               Span<const ValVariant> Params = {});
 
   /// Load given wasm file, wasm bytecode, or wasm module.
@@ -104,6 +107,20 @@ private:
 
   void initVM();
 
+  /// Wait for all threads spawned by the threads host module.
+  void joinThreads() noexcept;
+
+  /// Run `wasi_thread_start` of the active module on a spawned thread. The
+  /// thread instantiates the module again in a store of its own, so it has
+  /// its own globals and tables, and shares the imported memory.
+  Expect<void> runThread(const uint32_t Tid, const uint32_t StartArg,
+                         std::promise<bool> &Ready);
+
+  /// Instantiate the active module for a spawned thread into ThreadStore,
+  /// and return the address of its `wasi_thread_start`.
+  Expect<uint32_t> instantiateThread(Interpreter::Interpreter &ThreadEngine,
+                                     Runtime::StoreManager &ThreadStore);
+
   /// VM environment.
   const Configure Conf;
   Statistics::Statistics Stat;
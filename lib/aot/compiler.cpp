@@ -1,25 +1,55 @@
 // SPDX-License-Identifier: Apache-2.0
 #include "aot/version.h"
 #include "aot/compiler.h"
+#include "common/version.h"
 #include "common/filesystem.h"
+#include "common/hash.h"
 #include "common/log.h"
+#include "loader/perfmap.h"
 #include "runtime/instance/memory.h"
+#include "runtime/instance/module.h"
 #include "runtime/instance/table.h"
 #include <lld/Common/Driver.h>
+#include <llvm/ADT/StringExtras.h>
 #include <llvm/Analysis/TargetLibraryInfo.h>
+#include <llvm/Bitcode/BitcodeReader.h>
+#include <llvm/Bitcode/BitcodeWriter.h>
+#include <llvm/DebugInfo/DWARF/DWARFContext.h>
+#include <llvm/IR/DIBuilder.h>
 #include <llvm/IR/IRBuilder.h>
 #include <llvm/IR/LegacyPassManager.h>
+#include <llvm/IR/MDBuilder.h>
+#include <llvm/IR/PassInstrumentation.h>
 #include <llvm/IR/Verifier.h>
+#include <llvm/MC/MCSubtargetInfo.h>
 #include <llvm/MC/SubtargetFeature.h>
 #include <llvm/Passes/PassBuilder.h>
+#include <llvm/Remarks/Remark.h>
+#include <llvm/Remarks/RemarkSerializer.h>
 #include <llvm/Support/FileSystem.h>
+#include <llvm/Support/Format.h>
 #include <llvm/Support/Host.h>
+#include <llvm/Support/MemoryBuffer.h>
+#include <llvm/Support/Path.h>
+#include <llvm/Support/Process.h>
+#include <llvm/Support/SHA1.h>
 #include <llvm/Support/TargetRegistry.h>
 #include <llvm/Support/TargetSelect.h>
 #include <llvm/Target/TargetMachine.h>
 #include <llvm/Transforms/IPO/AlwaysInliner.h>
+#include <llvm/Transforms/Scalar/InductiveRangeCheckElimination.h>
 #include <llvm/Transforms/Utils/BasicBlockUtils.h>
+#include <llvm/Transforms/Utils/SplitModule.h>
+#include <algorithm>
+#include <map>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <mutex>
 #include <numeric>
+#include <optional>
+#include <thread>
+#include <unordered_map>
 
 #if LLVM_VERSION_MAJOR >= 10
 #include <llvm/IR/IntrinsicsAArch64.h>
@@ -27,6 +57,13 @@
 #include <llvm/Support/Alignment.h>
 #endif
 
+#if LLVM_VERSION_MAJOR >= 11
+#include <llvm/IR/LLVMRemarkStreamer.h>
+#include <llvm/Remarks/RemarkStreamer.h>
+#else
+#include <llvm/IR/RemarkStreamer.h>
+#endif
+
 namespace {
 
 /// is x86_64
@@ -43,6 +80,26 @@ static inline constexpr const bool kAArch64 = true;
 static inline constexpr const bool kAArch64 = false;
 #endif
 
+/// Features recorded for code variants of named target CPUs. The loader checks
+/// them against the host CPU, so it must know every name listed here. Code of
+/// a variant is generated for the baseline CPU with exactly these features,
+/// and the named CPU is only used for tuning, so nothing else the named CPU
+/// supports can reach the code.
+#if defined(__x86_64__) || defined(_M_X64)
+static inline constexpr const char *kVariantBaseCPU = "x86-64";
+static inline constexpr const std::array kVariantFeatures = {
+    "sse3",    "ssse3",    "sse4.1",   "sse4.2",   "popcnt",
+    "avx",     "avx2",     "bmi",      "bmi2",     "fma",
+    "avx512f", "avx512bw", "avx512cd", "avx512dq", "avx512vl",
+    "avx512vnni"};
+#elif defined(__aarch64__)
+static inline constexpr const char *kVariantBaseCPU = "generic";
+static inline constexpr const std::array kVariantFeatures = {"neon"};
+#else
+static inline constexpr const char *kVariantBaseCPU = "generic";
+static inline constexpr const std::array<const char *, 0> kVariantFeatures{};
+#endif
+
 inline void setIsFPConstrained(llvm::IRBuilder<> &Builder) {
   Builder.setIsFPConstrained(true);
 #if LLVM_VERSION_MAJOR >= 11
@@ -71,6 +128,37 @@ using Align = llvm::Align;
 static inline unsigned Align(unsigned Value) noexcept { return Value; }
 #endif
 
+/// Atomic instructions of wasm are sequentially consistent, and naturally
+/// aligned by the checks before them.
+inline llvm::AtomicRMWInst *createAtomicRMW(llvm::IRBuilder<> &Builder,
+                                            llvm::AtomicRMWInst::BinOp Op,
+                                            llvm::Value *Ptr,
+                                            llvm::Value *Val) {
+#if LLVM_VERSION_MAJOR >= 13
+  return Builder.CreateAtomicRMW(Op, Ptr, Val, llvm::MaybeAlign(),
+                                 llvm::AtomicOrdering::SequentiallyConsistent);
+#else
+  return Builder.CreateAtomicRMW(Op, Ptr, Val,
+                                 llvm::AtomicOrdering::SequentiallyConsistent);
+#endif
+}
+
+inline llvm::AtomicCmpXchgInst *createAtomicCmpXchg(llvm::IRBuilder<> &Builder,
+                                                    llvm::Value *Ptr,
+                                                    llvm::Value *Cmp,
+                                                    llvm::Value *New) {
+#if LLVM_VERSION_MAJOR >= 13
+  return Builder.CreateAtomicCmpXchg(
+      Ptr, Cmp, New, llvm::MaybeAlign(),
+      llvm::AtomicOrdering::SequentiallyConsistent,
+      llvm::AtomicOrdering::SequentiallyConsistent);
+#else
+  return Builder.CreateAtomicCmpXchg(
+      Ptr, Cmp, New, llvm::AtomicOrdering::SequentiallyConsistent,
+      llvm::AtomicOrdering::SequentiallyConsistent);
+#endif
+}
+
 static bool isVoidReturn(SSVM::Span<const SSVM::ValType> ValTypes);
 static llvm::Type *toLLVMType(llvm::LLVMContext &LLContext,
                               const SSVM::ValType &ValType);
@@ -104,6 +192,13 @@ static inline constexpr const bool kForceDivCheck = true;
 /// Size of a ValVariant
 static inline constexpr const uint32_t kValSize = sizeof(SSVM::ValVariant);
 
+/// Size of a host call entry in pointers
+static inline constexpr const uint32_t kHostCallEntrySize =
+    sizeof(SSVM::Runtime::Instance::HostCallEntry) / sizeof(void *);
+
+/// Size of a Wasm memory page
+static inline constexpr const uint64_t kPageSize = UINT64_C(65536);
+
 /// Translate Compiler::OptimizationLevel to llvm::PassBuilder version
 static inline llvm::PassBuilder::OptimizationLevel
 toLLVMLevel(SSVM::AOT::Compiler::OptimizationLevel Level) {
@@ -126,6 +221,484 @@ toLLVMLevel(SSVM::AOT::Compiler::OptimizationLevel Level) {
     __builtin_unreachable();
   }
 }
+
+/// Build the metadata of a validated module: the Wasm binary without custom
+/// sections other than the name section, and with every function body reduced
+/// to its locals, so loading a compiled module decodes no instructions. The
+/// name section is kept for the profiler records of the loader.
+static std::vector<SSVM::Byte>
+buildMetadata(SSVM::Span<const SSVM::Byte> Data) {
+  auto ReadU32 = [&Data](size_t &Pos) {
+    uint32_t Value = 0;
+    for (uint32_t Shift = 0;; Shift += 7) {
+      const SSVM::Byte B = Data[Pos++];
+      Value |= static_cast<uint32_t>(B & UINT8_C(0x7F)) << Shift;
+      if ((B & UINT8_C(0x80)) == 0) {
+        return Value;
+      }
+    }
+  };
+  auto WriteU32 = [](std::vector<SSVM::Byte> &Out, uint32_t Value) {
+    do {
+      SSVM::Byte B = Value & UINT8_C(0x7F);
+      Value >>= 7;
+      Out.push_back(Value ? (B | UINT8_C(0x80)) : B);
+    } while (Value);
+  };
+  auto Append = [&Data](std::vector<SSVM::Byte> &Out, size_t Begin,
+                        size_t End) {
+    Out.insert(Out.end(), Data.data() + Begin, Data.data() + End);
+  };
+
+  /// Magic and version.
+  std::vector<SSVM::Byte> Meta;
+  Append(Meta, 0, 8);
+  size_t Pos = 8;
+  while (Pos < Data.size()) {
+    const SSVM::Byte Id = Data[Pos++];
+    const uint32_t Size = ReadU32(Pos);
+    const size_t End = Pos + Size;
+    if (Id == 0x00) {
+      /// Custom section, keep only the name section.
+      size_t NamePos = Pos;
+      const uint32_t NameSize = ReadU32(NamePos);
+      if (NameSize == 4 && NamePos + NameSize <= End &&
+          std::equal(Data.data() + NamePos, Data.data() + NamePos + NameSize,
+                     "name")) {
+        Meta.push_back(Id);
+        WriteU32(Meta, Size);
+        Append(Meta, Pos, End);
+      }
+    } else if (Id != 0x0A) {
+      Meta.push_back(Id);
+      WriteU32(Meta, Size);
+      Append(Meta, Pos, End);
+    } else {
+      /// Code section, keep the locals and end every body immediately.
+      std::vector<SSVM::Byte> Codes;
+      const uint32_t Count = ReadU32(Pos);
+      WriteU32(Codes, Count);
+      for (uint32_t I = 0; I < Count; ++I) {
+        const uint32_t BodySize = ReadU32(Pos);
+        const size_t BodyEnd = Pos + BodySize;
+        const size_t LocalsBegin = Pos;
+        const uint32_t LocalVecCnt = ReadU32(Pos);
+        for (uint32_t J = 0; J < LocalVecCnt; ++J) {
+          ReadU32(Pos);
+          ++Pos;
+        }
+        WriteU32(Codes, Pos - LocalsBegin + 1);
+        Append(Codes, LocalsBegin, Pos);
+        Codes.push_back(0x0B);
+        Pos = BodyEnd;
+      }
+      Meta.push_back(Id);
+      WriteU32(Meta, Codes.size());
+      Meta.insert(Meta.end(), Codes.begin(), Codes.end());
+    }
+    Pos = End;
+  }
+  return Meta;
+}
+
+/// Row of a guest line table, located by the offset in the Wasm binary.
+struct GuestLine {
+  uint64_t Offset;
+  std::string File;
+  uint32_t Line;
+  uint32_t Column;
+  bool EndSequence;
+};
+
+/// Read the line tables of the DWARF custom sections of a Wasm binary. Guest
+/// addresses are offsets into the code section, and are rebased onto the
+/// instruction offsets in the binary.
+static std::vector<GuestLine>
+readGuestLines(SSVM::Span<const SSVM::Byte> Data) {
+  auto ReadU32 = [&Data](size_t &Pos) {
+    uint32_t Value = 0;
+    for (uint32_t Shift = 0;; Shift += 7) {
+      const SSVM::Byte B = Data[Pos++];
+      Value |= static_cast<uint32_t>(B & UINT8_C(0x7F)) << Shift;
+      if ((B & UINT8_C(0x80)) == 0) {
+        return Value;
+      }
+    }
+  };
+
+  llvm::StringMap<std::unique_ptr<llvm::MemoryBuffer>> Sections;
+  uint64_t CodeBase = 0, CodeSize = 0;
+  size_t Pos = 8;
+  while (Pos < Data.size()) {
+    const SSVM::Byte Id = Data[Pos++];
+    const uint32_t Size = ReadU32(Pos);
+    const size_t End = Pos + Size;
+    if (Id == 0x00) {
+      const uint32_t NameSize = ReadU32(Pos);
+      const llvm::StringRef Name(reinterpret_cast<const char *>(&Data[Pos]),
+                                 NameSize);
+      Pos += NameSize;
+      if (Name.startswith(".debug_")) {
+        /// DWARF sections are keyed without the leading dot.
+        Sections[Name.drop_front()] = llvm::MemoryBuffer::getMemBufferCopy(
+            llvm::StringRef(reinterpret_cast<const char *>(&Data[Pos]),
+                            End - Pos),
+            Name);
+      }
+    } else if (Id == 0x0A) {
+      CodeBase = Pos;
+      CodeSize = Size;
+    }
+    Pos = End;
+  }
+  if (Sections.count("debug_line") == 0) {
+    return {};
+  }
+
+  std::vector<GuestLine> Lines;
+  auto DICtx = llvm::DWARFContext::create(Sections, 4, true);
+  for (const auto &CU : DICtx->compile_units()) {
+    const auto *LineTable = DICtx->getLineTableForUnit(CU.get());
+    if (!LineTable) {
+      continue;
+    }
+    for (const auto &Row : LineTable->Rows) {
+      /// Rows of discarded code are moved out of the code section.
+      if (Row.Address.Address > CodeSize) {
+        continue;
+      }
+      std::string File;
+      LineTable->getFileNameByIndex(
+          Row.File, CU->getCompilationDir(),
+          llvm::DILineInfoSpecifier::FileLineInfoKind::AbsoluteFilePath, File);
+      Lines.push_back({CodeBase + Row.Address.Address, std::move(File),
+                       Row.Line, Row.Column,
+                       static_cast<bool>(Row.EndSequence)});
+    }
+  }
+  /// A sequence ends before the next one starting at the same offset.
+  std::stable_sort(Lines.begin(), Lines.end(),
+                   [](const GuestLine &LHS, const GuestLine &RHS) {
+                     return std::make_pair(LHS.Offset, !LHS.EndSequence) <
+                            std::make_pair(RHS.Offset, !RHS.EndSequence);
+                   });
+  return Lines;
+}
+
+/// Wall time report of compilation stages and optimization passes. Stages of
+/// partitions are summed over the partitions, which may run in parallel.
+class TimeReport {
+public:
+  using Clock = std::chrono::steady_clock;
+
+  void addStage(llvm::StringRef Name, Clock::duration Time) {
+    std::unique_lock Lock(Mutex);
+    auto It =
+        std::find_if(Stages.begin(), Stages.end(),
+                     [Name](const auto &Row) { return Row.first == Name; });
+    if (It == Stages.end()) {
+      Stages.emplace_back(Name.str(), Time);
+    } else {
+      It->second += Time;
+    }
+  }
+
+  void addPasses(const llvm::StringMap<Clock::duration> &Times) {
+    std::unique_lock Lock(Mutex);
+    for (const auto &Entry : Times) {
+      Passes[Entry.first()] += Entry.second;
+    }
+  }
+
+  void print(llvm::raw_ostream &OS) const {
+    std::unique_lock Lock(Mutex);
+    printTable(OS, "Compilation stage timing report", Stages);
+    std::vector<std::pair<std::string, Clock::duration>> Rows;
+    Rows.reserve(Passes.size());
+    for (const auto &Entry : Passes) {
+      Rows.emplace_back(Entry.first().str(), Entry.second);
+    }
+    std::sort(Rows.begin(), Rows.end(), [](const auto &LHS, const auto &RHS) {
+      return LHS.second > RHS.second;
+    });
+    printTable(OS, "Optimization pass timing report", Rows);
+  }
+
+private:
+  static void
+  printTable(llvm::raw_ostream &OS, llvm::StringRef Title,
+             const std::vector<std::pair<std::string, Clock::duration>> &Rows) {
+    using Seconds = std::chrono::duration<double>;
+    Seconds Total{};
+    for (const auto &Row : Rows) {
+      Total += Row.second;
+    }
+    const std::string Line(79, '-');
+    OS << "===" << Line.substr(0, 73) << "===\n";
+    OS.indent((80 - Title.size()) / 2) << Title << '\n';
+    OS << "===" << Line.substr(0, 73) << "===\n";
+    OS << llvm::format("  Total Wall Time: %.4f seconds\n\n", Total.count());
+    OS << "   ---Wall Time---  --- Name ---\n";
+    for (const auto &[Name, Time] : Rows) {
+      const double Value = Seconds(Time).count();
+      OS << llvm::format("  %8.4f (%5.1f%%)  ", Value,
+                         Total.count() > 0 ? Value * 100 / Total.count() : 0.0)
+         << Name << '\n';
+    }
+    OS << '\n';
+  }
+
+  mutable std::mutex Mutex;
+  std::vector<std::pair<std::string, Clock::duration>> Stages;
+  llvm::StringMap<Clock::duration> Passes;
+};
+
+/// Serializer of optimization remarks in YAML, which names the compiled
+/// function `f<N>` after the name of wasm function N and notes the index.
+class WasmRemarkSerializer : public llvm::remarks::RemarkSerializer {
+public:
+  WasmRemarkSerializer(llvm::raw_ostream &OS,
+                       const std::unordered_map<uint32_t, std::string> &Names)
+      : RemarkSerializer(llvm::remarks::Format::YAML, OS,
+                         llvm::remarks::SerializerMode::Standalone),
+        Names(Names),
+        Serializer(llvm::cantFail(llvm::remarks::createRemarkSerializer(
+            llvm::remarks::Format::YAML,
+            llvm::remarks::SerializerMode::Standalone, OS))) {}
+
+  void emit(const llvm::remarks::Remark &Remark) override {
+    llvm::StringRef Name = Remark.FunctionName;
+    uint32_t Index;
+    if (!Name.consume_front("f") || Name.getAsInteger(10, Index)) {
+      Serializer->emit(Remark);
+      return;
+    }
+    const std::string IndexStr = std::to_string(Index);
+    auto It = Names.find(Index);
+    const std::string WasmName = It != Names.end()
+                                     ? It->second
+                                     : "wasm-function[" + IndexStr + "]";
+    auto Copy = Remark.clone();
+    Copy.FunctionName = WasmName;
+    llvm::remarks::Argument Arg;
+    Arg.Key = "String";
+    Arg.Val = " in wasm function ";
+    Copy.Args.push_back(Arg);
+    Arg.Key = "WasmFunction";
+    Arg.Val = IndexStr;
+    Copy.Args.push_back(Arg);
+    Serializer->emit(Copy);
+  }
+
+  std::unique_ptr<llvm::remarks::MetaSerializer>
+  metaSerializer(llvm::raw_ostream &OS,
+                 llvm::Optional<llvm::StringRef> ExternalFilename) override {
+    return Serializer->metaSerializer(OS, ExternalFilename);
+  }
+
+private:
+  const std::unordered_map<uint32_t, std::string> &Names;
+  std::unique_ptr<llvm::remarks::RemarkSerializer> Serializer;
+};
+
+/// Optional diagnostics of optimizing and emitting a partition.
+struct EmitDiagnostics {
+  /// Stream of optimization remarks, or nullptr.
+  llvm::raw_ostream *Remarks = nullptr;
+  const std::unordered_map<uint32_t, std::string> *FunctionNames = nullptr;
+  /// Report of stage and pass times, or nullptr.
+  TimeReport *Times = nullptr;
+};
+
+/// Optimize the module and emit an object file into OS. The target machine is
+/// created here, so partitions in their own contexts can run in parallel.
+static bool optimizeAndEmit(llvm::Module &LLModule, const std::string &CPU,
+                            const std::string &SubtargetFeatures,
+                            SSVM::AOT::Compiler::OptimizationLevel Level,
+                            bool BoundsChecks, llvm::raw_pwrite_stream &OS,
+                            const char *DumpPath,
+                            const EmitDiagnostics &Diagnostics) {
+  using Clock = TimeReport::Clock;
+  auto StageStart = Clock::now();
+  auto &LLContext = LLModule.getContext();
+  if (Diagnostics.Remarks) {
+    auto Serializer = std::make_unique<WasmRemarkSerializer>(
+        *Diagnostics.Remarks, *Diagnostics.FunctionNames);
+#if LLVM_VERSION_MAJOR >= 11
+    LLContext.setMainRemarkStreamer(
+        std::make_unique<llvm::remarks::RemarkStreamer>(std::move(Serializer)));
+    LLContext.setLLVMRemarkStreamer(std::make_unique<llvm::LLVMRemarkStreamer>(
+        *LLContext.getMainRemarkStreamer()));
+#else
+    LLContext.setRemarkStreamer(
+        std::make_unique<llvm::RemarkStreamer>(std::move(Serializer)));
+#endif
+  }
+  /// Detach the remark streamer before the remark stream goes away.
+  struct RemarksCleanup {
+    ~RemarksCleanup() {
+#if LLVM_VERSION_MAJOR >= 11
+      LLContext.setLLVMRemarkStreamer(nullptr);
+      LLContext.setMainRemarkStreamer(nullptr);
+#else
+      LLContext.setRemarkStreamer(nullptr);
+#endif
+    }
+    llvm::LLVMContext &LLContext;
+  } Cleanup{LLContext};
+
+  std::string Error;
+  std::string Triple = LLModule.getTargetTriple();
+  const llvm::Target *TheTarget =
+      llvm::TargetRegistry::lookupTarget(Triple, Error);
+  if (!TheTarget) {
+    LOG(ERROR) << "lookupTarget failed";
+    return false;
+  }
+
+  llvm::TargetOptions Options;
+  /// Wasm rounds every multiply and add, so they are never fused.
+  Options.AllowFPOpFusion = llvm::FPOpFusion::Strict;
+  llvm::Reloc::Model RM = llvm::Reloc::PIC_;
+  std::unique_ptr<llvm::TargetMachine> TM(TheTarget->createTargetMachine(
+      Triple, CPU, SubtargetFeatures, Options, RM,
+      llvm::None, llvm::CodeGenOpt::Level::Aggressive));
+  LLModule.setDataLayout(TM->createDataLayout());
+
+  llvm::TargetLibraryInfoImpl TLII(llvm::Triple(LLModule.getTargetTriple()));
+
+  {
+    /// Time passes exclusively of the passes nested in them.
+    llvm::PassInstrumentationCallbacks PIC;
+    std::vector<std::pair<std::string, Clock::time_point>> PassStack;
+    llvm::StringMap<Clock::duration> PassTimes;
+    if (Diagnostics.Times) {
+      auto BeforePass = [&PassStack, &PassTimes](llvm::StringRef Name) {
+        const auto Now = Clock::now();
+        if (!PassStack.empty()) {
+          PassTimes[PassStack.back().first] += Now - PassStack.back().second;
+        }
+        PassStack.emplace_back(Name.str(), Now);
+      };
+      auto AfterPass = [&PassStack, &PassTimes]() {
+        const auto Now = Clock::now();
+        PassTimes[PassStack.back().first] += Now - PassStack.back().second;
+        PassStack.pop_back();
+        if (!PassStack.empty()) {
+          PassStack.back().second = Now;
+        }
+      };
+#if LLVM_VERSION_MAJOR >= 12
+      PIC.registerBeforeNonSkippedPassCallback(
+          [BeforePass](llvm::StringRef Name, llvm::Any) { BeforePass(Name); });
+#else
+      PIC.registerBeforePassCallback(
+          [BeforePass](llvm::StringRef Name, llvm::Any) {
+            BeforePass(Name);
+            return true;
+          });
+#endif
+      PIC.registerAfterPassCallback(
+          [AfterPass](llvm::StringRef, llvm::Any, auto &&...) { AfterPass(); });
+      PIC.registerAfterPassInvalidatedCallback(
+          [AfterPass](llvm::StringRef, auto &&...) { AfterPass(); });
+    }
+
+#if LLVM_VERSION_MAJOR >= 9
+    llvm::PassBuilder PB(TM.get(), llvm::PipelineTuningOptions(), llvm::None,
+                         &PIC);
+#else
+    llvm::PassBuilder PB(TM.get(), llvm::None);
+#endif
+
+    llvm::LoopAnalysisManager LAM(false);
+    llvm::FunctionAnalysisManager FAM(false);
+    llvm::CGSCCAnalysisManager CGAM(false);
+    llvm::ModuleAnalysisManager MAM(false);
+
+    // Register the AA manager first so that our version is the one
+    // used.
+    FAM.registerPass([&] { return PB.buildDefaultAAPipeline(); });
+
+    // Register the target library analysis directly and give it a
+    // customized preset TLI.
+    FAM.registerPass([&] { return llvm::TargetLibraryAnalysis(TLII); });
+#if LLVM_VERSION_MAJOR <= 9
+    MAM.registerPass([&] { return llvm::TargetLibraryAnalysis(TLII); });
+#endif
+
+    // Register all the basic analyses with the managers.
+    PB.registerModuleAnalyses(MAM);
+    PB.registerCGSCCAnalyses(CGAM);
+    PB.registerFunctionAnalyses(FAM);
+    PB.registerLoopAnalyses(LAM);
+    PB.crossRegisterProxies(LAM, FAM, CGAM, MAM);
+
+    if (BoundsChecks) {
+      /// Split loops so the bounds checks of induction variables are hoisted
+      /// out of the main iterations.
+#if LLVM_VERSION_MAJOR >= 12
+      PB.registerScalarOptimizerLateEPCallback(
+          [](llvm::FunctionPassManager &FPM, auto) {
+            FPM.addPass(llvm::IRCEPass());
+          });
+#else
+      PB.registerLateLoopOptimizationsEPCallback(
+          [](llvm::LoopPassManager &LPM, auto) {
+            LPM.addPass(llvm::IRCEPass());
+          });
+#endif
+    }
+
+    llvm::ModulePassManager MPM(false);
+    if (Level == SSVM::AOT::Compiler::OptimizationLevel::O0) {
+      MPM.addPass(llvm::AlwaysInlinerPass(false));
+    } else {
+      MPM.addPass(PB.buildPerModuleDefaultPipeline(toLLVMLevel(Level)));
+    }
+
+    MPM.run(LLModule, MAM);
+    if (Diagnostics.Times) {
+      Diagnostics.Times->addPasses(PassTimes);
+    }
+  }
+  if (Diagnostics.Times) {
+    const auto Now = Clock::now();
+    Diagnostics.Times->addStage("optimization", Now - StageStart);
+    StageStart = Now;
+  }
+
+  llvm::legacy::PassManager CodeGenPasses;
+  CodeGenPasses.add(
+      llvm::createTargetTransformInfoWrapperPass(TM->getTargetIRAnalysis()));
+
+  // Add LibraryInfo.
+  CodeGenPasses.add(new llvm::TargetLibraryInfoWrapperPass(TLII));
+
+#if LLVM_VERSION_MAJOR >= 10
+  using llvm::CGFT_ObjectFile;
+#else
+  const auto CGFT_ObjectFile = llvm::TargetMachine::CGFT_ObjectFile;
+#endif
+  if (TM->addPassesToEmitFile(CodeGenPasses, OS, nullptr, CGFT_ObjectFile,
+                              false)) {
+    LOG(ERROR) << "addPassesToEmitFile failed";
+    return false;
+  }
+
+  if (DumpPath) {
+    int Fd;
+    llvm::sys::fs::openFileForWrite(DumpPath, Fd);
+    llvm::raw_fd_ostream DumpOS(Fd, true);
+    LLModule.print(DumpOS, nullptr);
+  }
+  LOG(INFO) << "codegen start";
+  CodeGenPasses.run(LLModule);
+  if (Diagnostics.Times) {
+    Diagnostics.Times->addStage("code generation", Clock::now() - StageStart);
+  }
+  return true;
+}
 } // namespace
 
 struct SSVM::AOT::Compiler::CompileContext {
@@ -150,9 +723,13 @@ struct SSVM::AOT::Compiler::CompileContext {
   llvm::PointerType *Int32PtrTy;
   llvm::PointerType *Int64PtrTy;
   llvm::PointerType *Int128PtrTy;
+  llvm::StructType *FuncTableEntryTy;
+  llvm::StructType *CompiledTableTy;
   llvm::StructType *ExecCtxTy;
   llvm::PointerType *ExecCtxPtrTy;
   llvm::SubtargetFeatures SubtargetFeatures;
+  /// Comma separated features the code requires, for a named target CPU.
+  std::string RequiredFeatures;
 
 #if defined(__AVX512F__) || defined(__AVX__) || defined(__SSE4_1__) ||         \
     defined(__ARM_NEON__) || defined(__ARM_NEON) || defined(__ARM_NEON_FP)
@@ -169,16 +746,49 @@ struct SSVM::AOT::Compiler::CompileContext {
   bool SupportShuffle = false;
 #endif
 
+  /// Native instructions of relaxed SIMD: variable blends of SSE4.1, byte
+  /// multiply-adds and rounding multiplies of SSSE3, and dot products of
+  /// AVX512-VNNI.
+  bool SupportBlend = false;
+  bool SupportPMAdd = false;
+  bool SupportVNNI = false;
+
   std::vector<const AST::FunctionType *> FunctionTypes;
   std::vector<llvm::Function *> FunctionWrappers;
   std::vector<
       std::tuple<uint32_t, llvm::Function *, const SSVM::AST::CodeSegment *>>
       Functions;
   std::vector<llvm::Type *> Globals;
+  uint32_t ImpGlobalNum = 0;
+  /// Function types of tags, and the most values in a payload of them.
+  std::vector<const AST::FunctionType *> Tags;
+  uint32_t MaxTagParams = 0;
   llvm::GlobalVariable *IntrinsicsTable;
   llvm::Function *Trap;
+  llvm::Function *Personality = nullptr;
+  /// TBAA tags of linear memory, globals, and runtime state, which never
+  /// alias each other.
+  llvm::MDNode *MemoryTBAA;
+  llvm::MDNode *GlobalsTBAA;
+  llvm::MDNode *RuntimeTBAA;
   uint32_t MemMin = 1, MemMax = 65536;
-  CompileContext(llvm::Module &M)
+  bool HasMemory = false;
+  /// Other threads may grow a shared memory at any time.
+  bool SharedMemory = false;
+  /// Emit constrained floating-point operations.
+  bool StrictFP;
+  /// Debug info of compiled functions. Instructions are located by the line
+  /// tables of the guest DWARF sections when present, and otherwise by their
+  /// offset in the function body as the line number in the "wasm" file.
+  llvm::DIBuilder DebugBuilder;
+  llvm::DIFile *DebugWasmFile;
+  llvm::DICompileUnit *DebugUnit;
+  llvm::DISubroutineType *DebugFuncTy;
+  std::vector<GuestLine> GuestLines;
+  std::unordered_map<std::string, llvm::DIFile *> GuestFiles;
+  std::unordered_map<uint32_t, std::string> FunctionNames;
+  /// Target the host CPU if CPU is empty.
+  CompileContext(llvm::Module &M, bool StrictFP, llvm::StringRef CPU = {})
       : LLContext(M.getContext()), LLModule(M),
         VoidTy(llvm::Type::getVoidTy(LLContext)),
         Int8Ty(llvm::Type::getInt8Ty(LLContext)),
@@ -199,10 +809,26 @@ struct SSVM::AOT::Compiler::CompileContext {
         Int32PtrTy(llvm::Type::getInt32PtrTy(LLContext)),
         Int64PtrTy(Int64Ty->getPointerTo()),
         Int128PtrTy(Int128Ty->getPointerTo()),
+        FuncTableEntryTy(llvm::StructType::create(
+            "FuncTableEntry",
+            /// TypeId
+            Int32Ty,
+            /// Function
+            Int8PtrTy,
+            /// Context
+            Int8PtrTy)),
+        CompiledTableTy(llvm::StructType::create(
+            "CompiledTable",
+            /// Refs
+            Int64PtrTy,
+            /// Entries
+            FuncTableEntryTy->getPointerTo(),
+            /// Size
+            Int32Ty)),
         ExecCtxTy(llvm::StructType::create(
             "ExecCtx",
             /// Memory
-            Int8PtrTy,
+            Int8PtrTy->getPointerTo(),
             /// Globals
             Int128PtrTy->getPointerTo(),
             /// InstrCount
@@ -210,7 +836,17 @@ struct SSVM::AOT::Compiler::CompileContext {
             /// CostTable
             llvm::ArrayType::get(Int64Ty, UINT16_MAX + 1)->getPointerTo(),
             /// Gas
-            Int64PtrTy)),
+            Int64PtrTy,
+            /// FuncTypeIds
+            Int32PtrTy,
+            /// Tables
+            CompiledTableTy->getPointerTo()->getPointerTo(),
+            /// MemoryPages
+            Int32PtrTy,
+            /// GlobalsBlock
+            Int8PtrTy,
+            /// HostCalls
+            Int8PtrTy->getPointerTo())),
         ExecCtxPtrTy(ExecCtxTy->getPointerTo()),
         IntrinsicsTable(new llvm::GlobalVariable(
             LLModule,
@@ -220,8 +856,32 @@ struct SSVM::AOT::Compiler::CompileContext {
             "intrinsics")),
         Trap(llvm::Function::Create(
             llvm::FunctionType::get(VoidTy, {Int8Ty}, false),
-            llvm::Function::PrivateLinkage, "trap", LLModule)) {
-    Trap->addFnAttr(llvm::Attribute::StrictFP);
+            llvm::Function::PrivateLinkage, "trap", LLModule)),
+        StrictFP(StrictFP), DebugBuilder(M),
+        DebugWasmFile(DebugBuilder.createFile("wasm", "")),
+        DebugUnit(DebugBuilder.createCompileUnit(
+            llvm::dwarf::DW_LANG_C, DebugWasmFile, "ssvmc", true, "", 0, "",
+            llvm::DICompileUnit::LineTablesOnly)),
+        DebugFuncTy(DebugBuilder.createSubroutineType(
+            DebugBuilder.getOrCreateTypeArray({}))) {
+    LLModule.addModuleFlag(llvm::Module::Warning, "Dwarf Version", 4);
+    LLModule.addModuleFlag(llvm::Module::Warning, "Debug Info Version",
+                           llvm::DEBUG_METADATA_VERSION);
+    if (StrictFP) {
+      Trap->addFnAttr(llvm::Attribute::StrictFP);
+    }
+
+    {
+      llvm::MDBuilder MDB(LLContext);
+      auto *Root = MDB.createTBAARoot("SSVM TBAA");
+      auto CreateTag = [&MDB, Root](llvm::StringRef Name) {
+        auto *Type = MDB.createTBAAScalarTypeNode(Name, Root);
+        return MDB.createTBAAStructTagNode(Type, Type, 0);
+      };
+      MemoryTBAA = CreateTag("memory");
+      GlobalsTBAA = CreateTag("globals");
+      RuntimeTBAA = CreateTag("runtime");
+    }
     Trap->addFnAttr(llvm::Attribute::NoReturn);
     Trap->addFnAttr(llvm::Attribute::Cold);
     Trap->addFnAttr(llvm::Attribute::NoInline);
@@ -232,7 +892,29 @@ struct SSVM::AOT::Compiler::CompileContext {
 
     {
       llvm::StringMap<bool> FeatureMap;
-      llvm::sys::getHostCPUFeatures(FeatureMap);
+      if (CPU.empty()) {
+        llvm::sys::getHostCPUFeatures(FeatureMap);
+      } else {
+        /// Do not inherit the support of the build machine.
+        SupportRoundeven = SupportShuffle = false;
+        SupportBlend = SupportPMAdd = SupportVNNI = false;
+        std::string Error;
+        const std::string Triple = LLModule.getTargetTriple();
+        const auto *TheTarget =
+            llvm::TargetRegistry::lookupTarget(Triple, Error);
+        std::unique_ptr<llvm::MCSubtargetInfo> STI(
+            TheTarget->createMCSubtargetInfo(Triple, CPU, ""));
+        for (const char *Name : kVariantFeatures) {
+          const bool Enabled = STI->checkFeatures("+" + std::string(Name));
+          FeatureMap[Name] = Enabled;
+          if (Enabled) {
+            if (!RequiredFeatures.empty()) {
+              RequiredFeatures += ',';
+            }
+            RequiredFeatures += Name;
+          }
+        }
+      }
       for (auto &Feature : FeatureMap) {
         if (!SupportRoundeven && Feature.second) {
           auto Check = llvm::StringSwitch<bool>(Feature.first());
@@ -257,8 +939,24 @@ struct SSVM::AOT::Compiler::CompileContext {
           }
         }
 
+        if constexpr (kX86_64) {
+          if (Feature.second) {
+            SupportBlend |= llvm::StringSwitch<bool>(Feature.first())
+                                .Cases("avx512f", "avx", "sse4.1", true)
+                                .Default(false);
+            SupportPMAdd |= llvm::StringSwitch<bool>(Feature.first())
+                                .Cases("avx512f", "avx", "ssse3", true)
+                                .Default(false);
+          }
+        }
+
         SubtargetFeatures.AddFeature(Feature.first(), Feature.second);
       }
+      if constexpr (kX86_64) {
+        /// The 128-bit forms need VL.
+        SupportVNNI =
+            FeatureMap.lookup("avx512vnni") && FeatureMap.lookup("avx512vl");
+      }
     }
 
     {
@@ -273,15 +971,97 @@ struct SSVM::AOT::Compiler::CompileContext {
       Builder.CreateUnreachable();
     }
   }
+  void addTag(const AST::FunctionType &Type) {
+    Tags.push_back(&Type);
+    MaxTagParams = std::max(
+        MaxTagParams, static_cast<uint32_t>(Type.getParamTypes().size()));
+  }
+  /// Personality of the landing pads. The landing pads catch all foreign
+  /// exceptions, which are raised by the runtime for Wasm exceptions only.
+  llvm::Function *getPersonality() {
+    if (!Personality) {
+      Personality = llvm::Function::Create(
+          llvm::FunctionType::get(Int32Ty, true),
+          llvm::Function::ExternalLinkage, "__gxx_personality_v0", LLModule);
+    }
+    return Personality;
+  }
+  /// Read function names and guest line tables for debug info.
+  void loadDebugInfo(Span<const Byte> Data) {
+    FunctionNames = Loader::readFunctionNames(Data);
+    GuestLines = readGuestLines(Data);
+  }
+  /// Create the debug info of a compiled function. Lines in the "wasm" file
+  /// count the bytes from the first instruction of the function, starting at
+  /// 1, so the debug info of a function, which takes part in the object cache
+  /// key, does not change when other functions do.
+  llvm::DISubprogram *createDebugFunction(uint32_t FuncID,
+                                          llvm::StringRef LinkageName) {
+    auto It = FunctionNames.find(FuncID);
+    return DebugBuilder.createFunction(
+        DebugUnit, It != FunctionNames.end() ? It->second : LinkageName,
+        LinkageName, DebugWasmFile, 1, DebugFuncTy, 1,
+        llvm::DINode::FlagPrototyped,
+        llvm::DISubprogram::SPFlagDefinition |
+            llvm::DISubprogram::SPFlagOptimized);
+  }
+  /// Get the location of the instruction at the offset of the Wasm binary, in
+  /// the function whose first instruction is at FuncOffset.
+  llvm::DILocation *getDebugLoc(llvm::DISubprogram *SP, uint32_t Offset,
+                                uint32_t FuncOffset) {
+    auto It = std::upper_bound(GuestLines.begin(), GuestLines.end(), Offset,
+                               [](uint32_t Offset, const GuestLine &Row) {
+                                 return Offset < Row.Offset;
+                               });
+    if (It != GuestLines.begin() && !std::prev(It)->EndSequence) {
+      const auto &Row = *std::prev(It);
+      auto &File = GuestFiles[Row.File];
+      if (!File) {
+        File = DebugBuilder.createFile(llvm::sys::path::filename(Row.File),
+                                       llvm::sys::path::parent_path(Row.File));
+      }
+      auto *Scope = DebugBuilder.createLexicalBlockFile(SP, File);
+      return llvm::DILocation::get(LLContext, Row.Line, Row.Column, Scope);
+    }
+    return llvm::DILocation::get(LLContext, Offset - FuncOffset + 1, 0, SP);
+  }
+  /// Load runtime state which may change during execution.
+  llvm::LoadInst *createRuntimeLoad(llvm::IRBuilder<> &Builder,
+                                    llvm::Value *Ptr) {
+    auto *Load = Builder.CreateLoad(Ptr);
+    Load->setMetadata(llvm::LLVMContext::MD_tbaa, RuntimeTBAA);
+    return Load;
+  }
+  /// Load runtime state which is fixed after instantiation.
+  llvm::LoadInst *createInvariantLoad(llvm::IRBuilder<> &Builder,
+                                      llvm::Value *Ptr) {
+    auto *Load = createRuntimeLoad(Builder, Ptr);
+    Load->setMetadata(llvm::LLVMContext::MD_invariant_load,
+                      llvm::MDNode::get(LLContext, {}));
+    return Load;
+  }
+  llvm::StoreInst *createRuntimeStore(llvm::IRBuilder<> &Builder,
+                                      llvm::Value *Val, llvm::Value *Ptr) {
+    auto *Store = Builder.CreateStore(Val, Ptr);
+    Store->setMetadata(llvm::LLVMContext::MD_tbaa, RuntimeTBAA);
+    return Store;
+  }
   llvm::Value *getMemory(llvm::IRBuilder<> &Builder, llvm::LoadInst *ExecCtx) {
     return Builder.CreateExtractValue(ExecCtx, {0});
   }
   llvm::Value *getGlobals(llvm::IRBuilder<> &Builder, llvm::LoadInst *ExecCtx,
                           uint32_t Index) {
     llvm::Type *Type = Globals[Index];
+    if (Index >= ImpGlobalNum) {
+      /// Defined globals are addressed by offset in the globals block.
+      auto *Block = Builder.CreateExtractValue(ExecCtx, {8});
+      auto *VPtr = Builder.CreateConstInBoundsGEP1_64(
+          Block, uint64_t(Index - ImpGlobalNum) * kValSize);
+      return Builder.CreateBitCast(VPtr, Type);
+    }
     auto *Array = Builder.CreateExtractValue(ExecCtx, {1});
-    auto *VPtr =
-        Builder.CreateLoad(Builder.CreateConstInBoundsGEP1_64(Array, Index));
+    auto *VPtr = createInvariantLoad(
+        Builder, Builder.CreateConstInBoundsGEP1_64(Array, Index));
     auto *Ptr = Builder.CreateBitCast(VPtr, Type);
     return Ptr;
   }
@@ -296,6 +1076,43 @@ struct SSVM::AOT::Compiler::CompileContext {
   llvm::Value *getGas(llvm::IRBuilder<> &Builder, llvm::LoadInst *ExecCtx) {
     return Builder.CreateExtractValue(ExecCtx, {4});
   }
+  llvm::Value *getFuncTypeId(llvm::IRBuilder<> &Builder,
+                             llvm::LoadInst *ExecCtx, uint32_t Index) {
+    auto *Array = Builder.CreateExtractValue(ExecCtx, {5});
+    return createInvariantLoad(
+        Builder, Builder.CreateConstInBoundsGEP1_64(Array, Index));
+  }
+  llvm::Value *getTable(llvm::IRBuilder<> &Builder, llvm::LoadInst *ExecCtx,
+                        uint32_t Index) {
+    auto *Array = Builder.CreateExtractValue(ExecCtx, {6});
+    return createInvariantLoad(
+        Builder, Builder.CreateConstInBoundsGEP1_64(Array, Index));
+  }
+  llvm::Value *getMemoryPages(llvm::IRBuilder<> &Builder,
+                              llvm::LoadInst *ExecCtx) {
+    return createRuntimeLoad(Builder, Builder.CreateExtractValue(ExecCtx, {7}));
+  }
+  /// Get the page count of a shared memory. The acquire load pairs with the
+  /// release store of the thread which grew the memory.
+  llvm::Value *getSharedMemoryPages(llvm::IRBuilder<> &Builder,
+                                    llvm::LoadInst *ExecCtx) {
+    auto *Load = createRuntimeLoad(Builder,
+                                   Builder.CreateExtractValue(ExecCtx, {7}));
+    Load->setAtomic(llvm::AtomicOrdering::Acquire);
+    Load->setAlignment(Align(4));
+    return Load;
+  }
+  /// Get the entry of an imported host function and its native thunk, which
+  /// is nullptr when the host function has none.
+  std::pair<llvm::Value *, llvm::Value *>
+  getHostCall(llvm::IRBuilder<> &Builder, llvm::LoadInst *ExecCtx,
+              uint32_t Index) {
+    auto *Array = Builder.CreateExtractValue(ExecCtx, {9});
+    auto *EntryPtr = Builder.CreateConstInBoundsGEP1_64(
+        Array, uint64_t(Index) * kHostCallEntrySize);
+    return {Builder.CreateBitCast(EntryPtr, Int8PtrTy),
+            createInvariantLoad(Builder, EntryPtr)};
+  }
   llvm::FunctionCallee getIntrinsic(llvm::IRBuilder<> &Builder,
                                     AST::Module::Intrinsics Index,
                                     llvm::FunctionType *Ty) {
@@ -339,6 +1156,20 @@ static bool isVoidReturn(Span<const SSVM::ValType> ValTypes) {
          (ValTypes.size() == 1 && ValTypes.front() == ValType::None);
 }
 
+/// Check the function type can be passed to host function thunks as plain C
+/// arguments.
+static bool isScalarFunctionType(const AST::FunctionType &FuncType) {
+  auto IsScalar = [](const ValType &Type) {
+    return Type == ValType::I32 || Type == ValType::I64 ||
+           Type == ValType::F32 || Type == ValType::F64;
+  };
+  const auto &Params = FuncType.getParamTypes();
+  const auto &Returns = FuncType.getReturnTypes();
+  return std::all_of(Params.begin(), Params.end(), IsScalar) &&
+         (isVoidReturn(Returns) ||
+          (Returns.size() == 1 && IsScalar(Returns.front())));
+}
+
 static llvm::Type *toLLVMType(llvm::LLVMContext &LLContext,
                               const ValType &ValType) {
   switch (ValType) {
@@ -429,12 +1260,40 @@ class FunctionCompiler {
 public:
   FunctionCompiler(AOT::Compiler::CompileContext &Context, llvm::Function *F,
                    Span<const ValType> Locals, bool InstructionCounting,
-                   bool GasMeasuring, bool OptNone)
-      : Context(Context), LLContext(Context.LLContext), OptNone(OptNone), F(F),
+                   bool GasMeasuring, bool BoundsChecks, bool OptNone)
+      : Context(Context), LLContext(Context.LLContext),
+        BoundsChecks(BoundsChecks), OptNone(OptNone), F(F),
         Builder(llvm::BasicBlock::Create(LLContext, "entry", F)) {
     if (F) {
-      setIsFPConstrained(Builder);
-      ExecCtx = Builder.CreateLoad(F->arg_begin());
+      /// Relaxed mode emits plain instructions without fast-math flags, so
+      /// no multiply and add is contracted into a fused operation.
+      if (Context.StrictFP) {
+        setIsFPConstrained(Builder);
+      }
+      if (auto *SP = F->getSubprogram()) {
+        Builder.SetCurrentDebugLocation(
+            llvm::DILocation::get(LLContext, SP->getLine(), 0, SP));
+      }
+      /// The execution context is not modified while compiled functions run.
+      ExecCtx = Context.createInvariantLoad(Builder, F->arg_begin());
+
+      /// The page count is cached in a local and reloaded after calls which
+      /// may grow the memory. Memories with guard pages never move, but the
+      /// base of a memory without them is reloaded along with the page count.
+      /// The page count of a shared memory is loaded again at each use.
+      if (Context.HasMemory) {
+        LocalMemory = Builder.CreateAlloca(Context.Int8PtrTy);
+        if (!BoundsChecks) {
+          Builder.CreateStore(
+              Context.createInvariantLoad(Builder,
+                                          Context.getMemory(Builder, ExecCtx)),
+              LocalMemory);
+        }
+        if (!Context.SharedMemory) {
+          LocalMemoryPages = Builder.CreateAlloca(Context.Int32Ty);
+        }
+        readMemoryPages();
+      }
 
       if (InstructionCounting) {
         LocalInstrCount = Builder.CreateAlloca(Context.Int64Ty);
@@ -458,6 +1317,7 @@ public:
         Builder.CreateStore(toLLVMConstantZero(LLContext, Type), ArgPtr);
         Local.push_back(ArgPtr);
       }
+      LocalCurrent.assign(Local.size(), nullptr);
     }
   }
 
@@ -503,9 +1363,13 @@ public:
   void compile(AST::InstrView Instrs) {
     auto Dispatch = [this](const AST::Instruction &Instr) -> void {
       switch (Instr.getOpCode()) {
-      case OpCode::Block: {
-        auto *Block = llvm::BasicBlock::Create(LLContext, "block", F);
-        auto *EndBlock = llvm::BasicBlock::Create(LLContext, "block.end", F);
+      case OpCode::Block:
+      case OpCode::Try: {
+        const bool IsTry = Instr.getOpCode() == OpCode::Try;
+        auto *Block =
+            llvm::BasicBlock::Create(LLContext, IsTry ? "try" : "block", F);
+        auto *EndBlock = llvm::BasicBlock::Create(
+            LLContext, IsTry ? "try.end" : "block.end", F);
         Builder.CreateBr(Block);
 
         Builder.SetInsertPoint(Block);
@@ -525,6 +1389,9 @@ public:
         }
         enterBlock(EndBlock, nullptr, nullptr, std::move(Args),
                    std::move(Type));
+        if (IsTry) {
+          enterTry();
+        }
         return;
       }
       case OpCode::Loop: {
@@ -596,6 +1463,64 @@ public:
                      std::move(Entry.Type), std::move(Entry.ReturnPHI));
           Entry = leaveBlock();
         }
+        if (Entry.Dispatch) {
+          /// No catch clause matched. Pass to the enclosing try blocks.
+          Builder.SetInsertPoint(Entry.Dispatch);
+          compileUnwind(0);
+          Builder.SetInsertPoint(Entry.JumpBlock);
+        }
+        buildPHI(Entry.Type.second, Entry.ReturnPHI);
+        return;
+      }
+      case OpCode::Catch:
+      case OpCode::Catch_all: {
+        auto Entry = leaveBlock();
+        auto *Block = Entry.JumpBlock;
+        auto *CatchBB = llvm::BasicBlock::Create(LLContext, "catch", F);
+        llvm::BasicBlock *NextBB = nullptr;
+        Builder.SetInsertPoint(Entry.Dispatch);
+        const bool IsCatchAll = Instr.getOpCode() == OpCode::Catch_all;
+        auto *TagAddr = Builder.CreateCall(
+            Context.getIntrinsic(
+                Builder, AST::Module::Intrinsics::kCatch,
+                llvm::FunctionType::get(Context.Int32Ty,
+                                        {Context.Int32Ty, Context.Int8PtrTy},
+                                        false)),
+            {Builder.getInt32(IsCatchAll ? UINT32_MAX
+                                         : Instr.getTargetIndex()),
+             Entry.Caught});
+        if (IsCatchAll) {
+          Builder.CreateBr(CatchBB);
+        } else {
+          NextBB = llvm::BasicBlock::Create(LLContext, "catch.next", F);
+          Builder.CreateCondBr(
+              Builder.CreateICmpNE(TagAddr, Builder.getInt32(UINT32_MAX)),
+              CatchBB, NextBB);
+        }
+
+        Builder.SetInsertPoint(CatchBB);
+        enterBlock(Block, nullptr, nullptr, {}, {{}, Entry.Type.second},
+                   std::move(Entry.ReturnPHI));
+        ControlStack.back().Dispatch = NextBB;
+        ControlStack.back().Caught = Entry.Caught;
+        if (!IsCatchAll) {
+          const auto &Params =
+              Context.Tags[Instr.getTargetIndex()]->getParamTypes();
+          for (size_t I = 0; I < Params.size(); ++I) {
+            auto *VPtr =
+                Builder.CreateConstInBoundsGEP1_64(Entry.Caught, I * kValSize);
+            auto *Ptr = Builder.CreateBitCast(
+                VPtr, toLLVMType(LLContext, Params[I])->getPointerTo());
+            stackPush(Builder.CreateLoad(Ptr));
+          }
+        }
+        return;
+      }
+      case OpCode::Delegate: {
+        auto Entry = leaveBlock();
+        Builder.SetInsertPoint(Entry.Dispatch);
+        compileUnwind(Instr.getTargetIndex());
+        Builder.SetInsertPoint(Entry.JumpBlock);
         buildPHI(Entry.Type.second, Entry.ReturnPHI);
         return;
       }
@@ -672,6 +1597,58 @@ public:
         writeGas();
         compileIndirectCallOp(Instr.getSourceIndex(), Instr.getTargetIndex());
         break;
+      case OpCode::Throw: {
+        updateInstrCount();
+        writeGas();
+        const auto &Params =
+            Context.Tags[Instr.getTargetIndex()]->getParamTypes();
+        llvm::Value *Args;
+        if (Params.empty()) {
+          Args = llvm::ConstantPointerNull::get(Context.Int8PtrTy);
+        } else {
+          auto *Alloca = Builder.CreateAlloca(
+              Context.Int8Ty, Builder.getInt64(Params.size() * kValSize));
+          Alloca->setAlignment(Align(kValSize));
+          Args = Alloca;
+        }
+        for (size_t I = 0; I < Params.size(); ++I) {
+          const size_t J = Params.size() - 1 - I;
+          auto *Arg = stackPop();
+          auto *Ptr = Builder.CreateConstInBoundsGEP1_64(Args, J * kValSize);
+          Builder.CreateStore(
+              Arg, Builder.CreateBitCast(Ptr, Arg->getType()->getPointerTo()));
+        }
+        createThrowingCall(
+            Context.getIntrinsic(
+                Builder, AST::Module::Intrinsics::kThrow,
+                llvm::FunctionType::get(Context.VoidTy,
+                                        {Context.Int32Ty, Context.Int8PtrTy},
+                                        false)),
+            {Builder.getInt32(Instr.getTargetIndex()), Args})
+            ->setDoesNotReturn();
+        Builder.CreateUnreachable();
+        setUnreachable();
+        Builder.SetInsertPoint(
+            llvm::BasicBlock::Create(LLContext, "throw.end", F));
+        break;
+      }
+      case OpCode::Rethrow: {
+        updateInstrCount();
+        writeGas();
+        auto &Entry = *(ControlStack.rbegin() + Instr.getTargetIndex());
+        createThrowingCall(
+            Context.getIntrinsic(Builder, AST::Module::Intrinsics::kRethrow,
+                                 llvm::FunctionType::get(Context.VoidTy,
+                                                         {Context.Int8PtrTy},
+                                                         false)),
+            {Entry.Caught})
+            ->setDoesNotReturn();
+        Builder.CreateUnreachable();
+        setUnreachable();
+        Builder.SetInsertPoint(
+            llvm::BasicBlock::Create(LLContext, "rethrow.end", F));
+        break;
+      }
       case OpCode::Ref__null:
         stackPush(Builder.getInt64(0));
         break;
@@ -699,33 +1676,63 @@ public:
         stackPush(Builder.CreateSelect(Cond, True, False));
         break;
       }
-      case OpCode::Local__get:
-        stackPush(Builder.CreateLoad(Local[Instr.getTargetIndex()]));
+      case OpCode::Local__get: {
+        auto *Load = Builder.CreateLoad(Local[Instr.getTargetIndex()]);
+        if (BoundsChecks) {
+          /// Loads of a local which is not written in between have the same
+          /// value.
+          auto &Current = LocalCurrent[Instr.getTargetIndex()];
+          if (Current) {
+            LocalCanon.emplace(Load, Current);
+          } else {
+            Current = Load;
+          }
+        }
+        stackPush(Load);
         break;
+      }
       case OpCode::Local__set:
         Builder.CreateStore(stackPop(), Local[Instr.getTargetIndex()]);
+        if (BoundsChecks) {
+          LocalCurrent[Instr.getTargetIndex()] = nullptr;
+        }
         break;
       case OpCode::Local__tee:
         Builder.CreateStore(Stack.back(), Local[Instr.getTargetIndex()]);
+        if (BoundsChecks) {
+          LocalCurrent[Instr.getTargetIndex()] = nullptr;
+        }
         break;
-      case OpCode::Global__get:
-        stackPush(Builder.CreateLoad(
-            Context.getGlobals(Builder, ExecCtx, Instr.getTargetIndex())));
+      case OpCode::Global__get: {
+        auto *Load = Builder.CreateLoad(
+            Context.getGlobals(Builder, ExecCtx, Instr.getTargetIndex()));
+        Load->setMetadata(llvm::LLVMContext::MD_tbaa, Context.GlobalsTBAA);
+        stackPush(Load);
         break;
-      case OpCode::Global__set:
-        Builder.CreateStore(
+      }
+      case OpCode::Global__set: {
+        auto *Store = Builder.CreateStore(
             stackPop(),
             Context.getGlobals(Builder, ExecCtx, Instr.getTargetIndex()));
+        Store->setMetadata(llvm::LLVMContext::MD_tbaa, Context.GlobalsTBAA);
         break;
+      }
       case OpCode::Table__get: {
         auto *Idx = stackPop();
-        stackPush(Builder.CreateCall(
-            Context.getIntrinsic(
-                Builder, AST::Module::Intrinsics::kTableGet,
-                llvm::FunctionType::get(Context.Int64Ty,
-                                        {Context.Int32Ty, Context.Int32Ty},
-                                        false)),
-            {Builder.getInt32(Instr.getTargetIndex()), Idx}));
+        auto *Table = Context.getTable(Builder, ExecCtx, Instr.getTargetIndex());
+        auto *Size = Context.createRuntimeLoad(Builder,
+                                               Builder.CreateStructGEP(Table, 2));
+        auto *OkBB = llvm::BasicBlock::Create(LLContext, "table_get.ok", F);
+        auto *IsInBound = createLikely(Builder, Builder.CreateICmpULT(Idx, Size));
+        Builder.CreateCondBr(IsInBound, OkBB,
+                             getTrapBB(ErrCode::TableOutOfBounds));
+
+        Builder.SetInsertPoint(OkBB);
+        auto *Refs = Context.createRuntimeLoad(Builder,
+                                               Builder.CreateStructGEP(Table, 0));
+        stackPush(Context.createRuntimeLoad(
+            Builder, Builder.CreateInBoundsGEP(
+                         Refs, Builder.CreateZExt(Idx, Context.Int64Ty))));
         break;
       }
       case OpCode::Table__set: {
@@ -795,12 +1802,9 @@ public:
         break;
       }
       case OpCode::Table__size: {
-        stackPush(Builder.CreateCall(
-            Context.getIntrinsic(Builder, AST::Module::Intrinsics::kTableSize,
-                                 llvm::FunctionType::get(Context.Int32Ty,
-                                                         {Context.Int32Ty},
-                                                         false)),
-            {Builder.getInt32(Instr.getTargetIndex())}));
+        auto *Table = Context.getTable(Builder, ExecCtx, Instr.getTargetIndex());
+        stackPush(Context.createRuntimeLoad(Builder,
+                                            Builder.CreateStructGEP(Table, 2)));
         break;
       }
       case OpCode::Table__fill: {
@@ -905,9 +1909,7 @@ public:
                        Context.Int32Ty, true);
         break;
       case OpCode::Memory__size:
-        stackPush(Builder.CreateCall(Context.getIntrinsic(
-            Builder, AST::Module::Intrinsics::kMemSize,
-            llvm::FunctionType::get(Context.Int32Ty, false))));
+        stackPush(loadMemoryPages());
         break;
       case OpCode::Memory__grow: {
         auto *Diff = stackPop();
@@ -917,6 +1919,7 @@ public:
                                                          {Context.Int32Ty},
                                                          false)),
             {Diff}));
+        readMemoryPages();
         break;
       }
       case OpCode::Memory__init: {
@@ -945,29 +1948,299 @@ public:
         auto *Len = stackPop();
         auto *Src = stackPop();
         auto *Dst = stackPop();
-        Builder.CreateCall(
-            Context.getIntrinsic(
-                Builder, AST::Module::Intrinsics::kMemCopy,
-                llvm::FunctionType::get(
-                    Context.VoidTy,
-                    {Context.Int32Ty, Context.Int32Ty, Context.Int32Ty},
-                    false)),
-            {Dst, Src, Len});
+        auto *Len64 = Builder.CreateZExt(Len, Context.Int64Ty);
+        auto *Src64 = Builder.CreateZExt(Src, Context.Int64Ty);
+        auto *Dst64 = Builder.CreateZExt(Dst, Context.Int64Ty);
+        compileMemoryRangeCheck(Builder.CreateAdd(
+            Builder.CreateSelect(Builder.CreateICmpUGT(Src64, Dst64), Src64,
+                                 Dst64),
+            Len64));
+        auto *Memory = getMemoryBase();
+        Builder.CreateMemMove(Builder.CreateInBoundsGEP(Memory, {Dst64}),
+                              Align(1),
+                              Builder.CreateInBoundsGEP(Memory, {Src64}),
+                              Align(1), Len64, false, Context.MemoryTBAA);
         break;
       }
       case OpCode::Memory__fill: {
         auto *Len = stackPop();
         auto *Val = Builder.CreateTrunc(stackPop(), Context.Int8Ty);
         auto *Off = stackPop();
-        Builder.CreateCall(
+        auto *Len64 = Builder.CreateZExt(Len, Context.Int64Ty);
+        auto *Off64 = Builder.CreateZExt(Off, Context.Int64Ty);
+        compileMemoryRangeCheck(Builder.CreateAdd(Off64, Len64));
+        Builder.CreateMemSet(
+            Builder.CreateInBoundsGEP(getMemoryBase(), {Off64}), Val, Len64,
+            Align(1), false, Context.MemoryTBAA);
+        break;
+      }
+      case OpCode::Memory__atomic__notify: {
+        auto *Count = stackPop();
+        auto *Addr = stackPop();
+        stackPush(Builder.CreateCall(
             Context.getIntrinsic(
-                Builder, AST::Module::Intrinsics::kMemFill,
+                Builder, AST::Module::Intrinsics::kMemAtomicNotify,
                 llvm::FunctionType::get(
-                    Context.VoidTy,
-                    {Context.Int32Ty, Context.Int8Ty, Context.Int32Ty}, false)),
-            {Off, Val, Len});
+                    Context.Int32Ty,
+                    {Context.Int32Ty, Context.Int32Ty, Context.Int32Ty},
+                    false)),
+            {Addr, Builder.getInt32(Instr.getMemoryOffset()), Count}));
         break;
       }
+      case OpCode::Memory__atomic__wait32:
+        compileAtomicWaitOp(Instr.getMemoryOffset(), 32);
+        break;
+      case OpCode::Memory__atomic__wait64:
+        compileAtomicWaitOp(Instr.getMemoryOffset(), 64);
+        break;
+      case OpCode::Atomic__fence:
+        Builder.CreateFence(llvm::AtomicOrdering::SequentiallyConsistent);
+        break;
+      case OpCode::I32__atomic__load:
+        compileAtomicLoadOp(Instr.getMemoryOffset(), Context.Int32Ty,
+                            Context.Int32Ty);
+        break;
+      case OpCode::I64__atomic__load:
+        compileAtomicLoadOp(Instr.getMemoryOffset(), Context.Int64Ty,
+                            Context.Int64Ty);
+        break;
+      case OpCode::I32__atomic__load8_u:
+        compileAtomicLoadOp(Instr.getMemoryOffset(), Context.Int8Ty,
+                            Context.Int32Ty);
+        break;
+      case OpCode::I32__atomic__load16_u:
+        compileAtomicLoadOp(Instr.getMemoryOffset(), Context.Int16Ty,
+                            Context.Int32Ty);
+        break;
+      case OpCode::I64__atomic__load8_u:
+        compileAtomicLoadOp(Instr.getMemoryOffset(), Context.Int8Ty,
+                            Context.Int64Ty);
+        break;
+      case OpCode::I64__atomic__load16_u:
+        compileAtomicLoadOp(Instr.getMemoryOffset(), Context.Int16Ty,
+                            Context.Int64Ty);
+        break;
+      case OpCode::I64__atomic__load32_u:
+        compileAtomicLoadOp(Instr.getMemoryOffset(), Context.Int32Ty,
+                            Context.Int64Ty);
+        break;
+      case OpCode::I32__atomic__store:
+        compileAtomicStoreOp(Instr.getMemoryOffset(), Context.Int32Ty);
+        break;
+      case OpCode::I64__atomic__store:
+        compileAtomicStoreOp(Instr.getMemoryOffset(), Context.Int64Ty);
+        break;
+      case OpCode::I32__atomic__store8:
+        compileAtomicStoreOp(Instr.getMemoryOffset(), Context.Int8Ty);
+        break;
+      case OpCode::I32__atomic__store16:
+        compileAtomicStoreOp(Instr.getMemoryOffset(), Context.Int16Ty);
+        break;
+      case OpCode::I64__atomic__store8:
+        compileAtomicStoreOp(Instr.getMemoryOffset(), Context.Int8Ty);
+        break;
+      case OpCode::I64__atomic__store16:
+        compileAtomicStoreOp(Instr.getMemoryOffset(), Context.Int16Ty);
+        break;
+      case OpCode::I64__atomic__store32:
+        compileAtomicStoreOp(Instr.getMemoryOffset(), Context.Int32Ty);
+        break;
+      case OpCode::I32__atomic__rmw__add:
+        compileAtomicRMWOp(Instr.getMemoryOffset(), llvm::AtomicRMWInst::Add,
+                           Context.Int32Ty, Context.Int32Ty);
+        break;
+      case OpCode::I64__atomic__rmw__add:
+        compileAtomicRMWOp(Instr.getMemoryOffset(), llvm::AtomicRMWInst::Add,
+                           Context.Int64Ty, Context.Int64Ty);
+        break;
+      case OpCode::I32__atomic__rmw8__add_u:
+        compileAtomicRMWOp(Instr.getMemoryOffset(), llvm::AtomicRMWInst::Add,
+                           Context.Int8Ty, Context.Int32Ty);
+        break;
+      case OpCode::I32__atomic__rmw16__add_u:
+        compileAtomicRMWOp(Instr.getMemoryOffset(), llvm::AtomicRMWInst::Add,
+                           Context.Int16Ty, Context.Int32Ty);
+        break;
+      case OpCode::I64__atomic__rmw8__add_u:
+        compileAtomicRMWOp(Instr.getMemoryOffset(), llvm::AtomicRMWInst::Add,
+                           Context.Int8Ty, Context.Int64Ty);
+        break;
+      case OpCode::I64__atomic__rmw16__add_u:
+        compileAtomicRMWOp(Instr.getMemoryOffset(), llvm::AtomicRMWInst::Add,
+                           Context.Int16Ty, Context.Int64Ty);
+        break;
+      case OpCode::I64__atomic__rmw32__add_u:
+        compileAtomicRMWOp(Instr.getMemoryOffset(), llvm::AtomicRMWInst::Add,
+                           Context.Int32Ty, Context.Int64Ty);
+        break;
+      case OpCode::I32__atomic__rmw__sub:
+        compileAtomicRMWOp(Instr.getMemoryOffset(), llvm::AtomicRMWInst::Sub,
+                           Context.Int32Ty, Context.Int32Ty);
+        break;
+      case OpCode::I64__atomic__rmw__sub:
+        compileAtomicRMWOp(Instr.getMemoryOffset(), llvm::AtomicRMWInst::Sub,
+                           Context.Int64Ty, Context.Int64Ty);
+        break;
+      case OpCode::I32__atomic__rmw8__sub_u:
+        compileAtomicRMWOp(Instr.getMemoryOffset(), llvm::AtomicRMWInst::Sub,
+                           Context.Int8Ty, Context.Int32Ty);
+        break;
+      case OpCode::I32__atomic__rmw16__sub_u:
+        compileAtomicRMWOp(Instr.getMemoryOffset(), llvm::AtomicRMWInst::Sub,
+                           Context.Int16Ty, Context.Int32Ty);
+        break;
+      case OpCode::I64__atomic__rmw8__sub_u:
+        compileAtomicRMWOp(Instr.getMemoryOffset(), llvm::AtomicRMWInst::Sub,
+                           Context.Int8Ty, Context.Int64Ty);
+        break;
+      case OpCode::I64__atomic__rmw16__sub_u:
+        compileAtomicRMWOp(Instr.getMemoryOffset(), llvm::AtomicRMWInst::Sub,
+                           Context.Int16Ty, Context.Int64Ty);
+        break;
+      case OpCode::I64__atomic__rmw32__sub_u:
+        compileAtomicRMWOp(Instr.getMemoryOffset(), llvm::AtomicRMWInst::Sub,
+                           Context.Int32Ty, Context.Int64Ty);
+        break;
+      case OpCode::I32__atomic__rmw__and:
+        compileAtomicRMWOp(Instr.getMemoryOffset(), llvm::AtomicRMWInst::And,
+                           Context.Int32Ty, Context.Int32Ty);
+        break;
+      case OpCode::I64__atomic__rmw__and:
+        compileAtomicRMWOp(Instr.getMemoryOffset(), llvm::AtomicRMWInst::And,
+                           Context.Int64Ty, Context.Int64Ty);
+        break;
+      case OpCode::I32__atomic__rmw8__and_u:
+        compileAtomicRMWOp(Instr.getMemoryOffset(), llvm::AtomicRMWInst::And,
+                           Context.Int8Ty, Context.Int32Ty);
+        break;
+      case OpCode::I32__atomic__rmw16__and_u:
+        compileAtomicRMWOp(Instr.getMemoryOffset(), llvm::AtomicRMWInst::And,
+                           Context.Int16Ty, Context.Int32Ty);
+        break;
+      case OpCode::I64__atomic__rmw8__and_u:
+        compileAtomicRMWOp(Instr.getMemoryOffset(), llvm::AtomicRMWInst::And,
+                           Context.Int8Ty, Context.Int64Ty);
+        break;
+      case OpCode::I64__atomic__rmw16__and_u:
+        compileAtomicRMWOp(Instr.getMemoryOffset(), llvm::AtomicRMWInst::And,
+                           Context.Int16Ty, Context.Int64Ty);
+        break;
+      case OpCode::I64__atomic__rmw32__and_u:
+        compileAtomicRMWOp(Instr.getMemoryOffset(), llvm::AtomicRMWInst::And,
+                           Context.Int32Ty, Context.Int64Ty);
+        break;
+      case OpCode::I32__atomic__rmw__or:
+        compileAtomicRMWOp(Instr.getMemoryOffset(), llvm::AtomicRMWInst::Or,
+                           Context.Int32Ty, Context.Int32Ty);
+        break;
+      case OpCode::I64__atomic__rmw__or:
+        compileAtomicRMWOp(Instr.getMemoryOffset(), llvm::AtomicRMWInst::Or,
+                           Context.Int64Ty, Context.Int64Ty);
+        break;
+      case OpCode::I32__atomic__rmw8__or_u:
+        compileAtomicRMWOp(Instr.getMemoryOffset(), llvm::AtomicRMWInst::Or,
+                           Context.Int8Ty, Context.Int32Ty);
+        break;
+      case OpCode::I32__atomic__rmw16__or_u:
+        compileAtomicRMWOp(Instr.getMemoryOffset(), llvm::AtomicRMWInst::Or,
+                           Context.Int16Ty, Context.Int32Ty);
+        break;
+      case OpCode::I64__atomic__rmw8__or_u:
+        compileAtomicRMWOp(Instr.getMemoryOffset(), llvm::AtomicRMWInst::Or,
+                           Context.Int8Ty, Context.Int64Ty);
+        break;
+      case OpCode::I64__atomic__rmw16__or_u:
+        compileAtomicRMWOp(Instr.getMemoryOffset(), llvm::AtomicRMWInst::Or,
+                           Context.Int16Ty, Context.Int64Ty);
+        break;
+      case OpCode::I64__atomic__rmw32__or_u:
+        compileAtomicRMWOp(Instr.getMemoryOffset(), llvm::AtomicRMWInst::Or,
+                           Context.Int32Ty, Context.Int64Ty);
+        break;
+      case OpCode::I32__atomic__rmw__xor:
+        compileAtomicRMWOp(Instr.getMemoryOffset(), llvm::AtomicRMWInst::Xor,
+                           Context.Int32Ty, Context.Int32Ty);
+        break;
+      case OpCode::I64__atomic__rmw__xor:
+        compileAtomicRMWOp(Instr.getMemoryOffset(), llvm::AtomicRMWInst::Xor,
+                           Context.Int64Ty, Context.Int64Ty);
+        break;
+      case OpCode::I32__atomic__rmw8__xor_u:
+        compileAtomicRMWOp(Instr.getMemoryOffset(), llvm::AtomicRMWInst::Xor,
+                           Context.Int8Ty, Context.Int32Ty);
+        break;
+      case OpCode::I32__atomic__rmw16__xor_u:
+        compileAtomicRMWOp(Instr.getMemoryOffset(), llvm::AtomicRMWInst::Xor,
+                           Context.Int16Ty, Context.Int32Ty);
+        break;
+      case OpCode::I64__atomic__rmw8__xor_u:
+        compileAtomicRMWOp(Instr.getMemoryOffset(), llvm::AtomicRMWInst::Xor,
+                           Context.Int8Ty, Context.Int64Ty);
+        break;
+      case OpCode::I64__atomic__rmw16__xor_u:
+        compileAtomicRMWOp(Instr.getMemoryOffset(), llvm::AtomicRMWInst::Xor,
+                           Context.Int16Ty, Context.Int64Ty);
+        break;
+      case OpCode::I64__atomic__rmw32__xor_u:
+        compileAtomicRMWOp(Instr.getMemoryOffset(), llvm::AtomicRMWInst::Xor,
+                           Context.Int32Ty, Context.Int64Ty);
+        break;
+      case OpCode::I32__atomic__rmw__xchg:
+        compileAtomicRMWOp(Instr.getMemoryOffset(), llvm::AtomicRMWInst::Xchg,
+                           Context.Int32Ty, Context.Int32Ty);
+        break;
+      case OpCode::I64__atomic__rmw__xchg:
+        compileAtomicRMWOp(Instr.getMemoryOffset(), llvm::AtomicRMWInst::Xchg,
+                           Context.Int64Ty, Context.Int64Ty);
+        break;
+      case OpCode::I32__atomic__rmw8__xchg_u:
+        compileAtomicRMWOp(Instr.getMemoryOffset(), llvm::AtomicRMWInst::Xchg,
+                           Context.Int8Ty, Context.Int32Ty);
+        break;
+      case OpCode::I32__atomic__rmw16__xchg_u:
+        compileAtomicRMWOp(Instr.getMemoryOffset(), llvm::AtomicRMWInst::Xchg,
+                           Context.Int16Ty, Context.Int32Ty);
+        break;
+      case OpCode::I64__atomic__rmw8__xchg_u:
+        compileAtomicRMWOp(Instr.getMemoryOffset(), llvm::AtomicRMWInst::Xchg,
+                           Context.Int8Ty, Context.Int64Ty);
+        break;
+      case OpCode::I64__atomic__rmw16__xchg_u:
+        compileAtomicRMWOp(Instr.getMemoryOffset(), llvm::AtomicRMWInst::Xchg,
+                           Context.Int16Ty, Context.Int64Ty);
+        break;
+      case OpCode::I64__atomic__rmw32__xchg_u:
+        compileAtomicRMWOp(Instr.getMemoryOffset(), llvm::AtomicRMWInst::Xchg,
+                           Context.Int32Ty, Context.Int64Ty);
+        break;
+      case OpCode::I32__atomic__rmw__cmpxchg:
+        compileAtomicCompareExchangeOp(Instr.getMemoryOffset(), Context.Int32Ty,
+                                       Context.Int32Ty);
+        break;
+      case OpCode::I64__atomic__rmw__cmpxchg:
+        compileAtomicCompareExchangeOp(Instr.getMemoryOffset(), Context.Int64Ty,
+                                       Context.Int64Ty);
+        break;
+      case OpCode::I32__atomic__rmw8__cmpxchg_u:
+        compileAtomicCompareExchangeOp(Instr.getMemoryOffset(), Context.Int8Ty,
+                                       Context.Int32Ty);
+        break;
+      case OpCode::I32__atomic__rmw16__cmpxchg_u:
+        compileAtomicCompareExchangeOp(Instr.getMemoryOffset(), Context.Int16Ty,
+                                       Context.Int32Ty);
+        break;
+      case OpCode::I64__atomic__rmw8__cmpxchg_u:
+        compileAtomicCompareExchangeOp(Instr.getMemoryOffset(), Context.Int8Ty,
+                                       Context.Int64Ty);
+        break;
+      case OpCode::I64__atomic__rmw16__cmpxchg_u:
+        compileAtomicCompareExchangeOp(Instr.getMemoryOffset(), Context.Int16Ty,
+                                       Context.Int64Ty);
+        break;
+      case OpCode::I64__atomic__rmw32__cmpxchg_u:
+        compileAtomicCompareExchangeOp(Instr.getMemoryOffset(), Context.Int32Ty,
+                                       Context.Int64Ty);
+        break;
       case OpCode::I32__const:
         stackPush(Builder.getInt32(std::get<uint32_t>(Instr.getNum())));
         break;
@@ -1136,6 +2409,10 @@ public:
 #if LLVM_VERSION_MAJOR >= 10
         stackPush(Builder.CreateFPTrunc(stackPop(), Context.FloatTy));
 #else
+        if (!Context.StrictFP) {
+          stackPush(Builder.CreateFPTrunc(stackPop(), Context.FloatTy));
+          break;
+        }
         /// llvm 9 didn't add constrains on fptrunc, do it manually.
         auto &LLContext = Context.LLContext;
         auto *Value = stackPop();
@@ -1772,11 +3049,21 @@ public:
       case OpCode::F64x2__replace_lane:
         compileReplaceLaneOp(Context.Doublex2Ty, Instr.getTargetIndex());
         break;
-      case OpCode::I8x16__swizzle: {
+      case OpCode::I8x16__swizzle:
+      case OpCode::I8x16__relaxed_swizzle: {
         auto *Index = Builder.CreateBitCast(stackPop(), Context.Int8x16Ty);
         auto *Vector = Builder.CreateBitCast(stackPop(), Context.Int8x16Ty);
 
         if constexpr (kX86_64) {
+          if (Context.SupportShuffle &&
+              Instr.getOpCode() == OpCode::I8x16__relaxed_swizzle) {
+            /// Indices out of range select any lane or zero.
+            stackPush(Builder.CreateBitCast(
+                Builder.CreateIntrinsic(llvm::Intrinsic::x86_ssse3_pshuf_b_128,
+                                        {}, {Vector, Index}),
+                Context.Int64x2Ty));
+            break;
+          }
           if (Context.SupportShuffle) {
             auto *Magic = Builder.CreateVectorSplat(16, Builder.getInt8(112));
             auto *Added = Builder.CreateAdd(Index, Magic);
@@ -2055,6 +3342,18 @@ public:
             Builder.CreateAnd(Builder.CreateXor(V1, V2), C), V2));
         break;
       }
+      case OpCode::I8x16__relaxed_laneselect:
+        compileVectorLaneSelect(Context.Int8x16Ty);
+        break;
+      case OpCode::I16x8__relaxed_laneselect:
+        compileVectorLaneSelect(Context.Int16x8Ty);
+        break;
+      case OpCode::I32x4__relaxed_laneselect:
+        compileVectorLaneSelect(Context.Int32x4Ty);
+        break;
+      case OpCode::I64x2__relaxed_laneselect:
+        compileVectorLaneSelect(Context.Int64x2Ty);
+        break;
       case OpCode::I8x16__abs:
         compileVectorAbs(Context.Int8x16Ty);
         break;
@@ -2334,10 +3633,10 @@ public:
         compileVectorVectorFPMax(Context.Floatx4Ty);
         break;
       case OpCode::F32x4__qfma:
-        compileVectorVectorVectorQFMA(Context.Floatx4Ty);
+        compileVectorVectorVectorQFMA(Context.Floatx4Ty, false);
         break;
       case OpCode::F32x4__qfms:
-        compileVectorVectorVectorQFMS(Context.Floatx4Ty);
+        compileVectorVectorVectorQFMA(Context.Floatx4Ty, true);
         break;
       case OpCode::F32x4__ceil:
         compileVectorFCeil(Context.Floatx4Ty);
@@ -2385,10 +3684,10 @@ public:
         compileVectorVectorFPMax(Context.Doublex2Ty);
         break;
       case OpCode::F64x2__qfma:
-        compileVectorVectorVectorQFMA(Context.Doublex2Ty);
+        compileVectorVectorVectorQFMA(Context.Doublex2Ty, false);
         break;
       case OpCode::F64x2__qfms:
-        compileVectorVectorVectorQFMS(Context.Doublex2Ty);
+        compileVectorVectorVectorQFMA(Context.Doublex2Ty, true);
         break;
       case OpCode::F64x2__ceil:
         compileVectorFCeil(Context.Doublex2Ty);
@@ -2417,21 +3716,119 @@ public:
       case OpCode::I64x2__trunc_sat_f64x2_s:
         compileVectorTruncSatS(Context.Doublex2Ty, 64);
         break;
-      case OpCode::I64x2__trunc_sat_f64x2_u:
-        compileVectorTruncSatU(Context.Doublex2Ty, 64);
+      case OpCode::I64x2__trunc_sat_f64x2_u:
+        compileVectorTruncSatU(Context.Doublex2Ty, 64);
+        break;
+      case OpCode::F64x2__convert_i64x2_s:
+        compileVectorConvertS(Context.Int64x2Ty, Context.Doublex2Ty);
+        break;
+      case OpCode::F64x2__convert_i64x2_u:
+        compileVectorConvertU(Context.Int64x2Ty, Context.Doublex2Ty);
+        break;
+
+      case OpCode::I32x4__relaxed_trunc_f32x4_s:
+        if constexpr (kX86_64) {
+          /// Lanes out of range become INT32_MIN.
+          compileVectorOp(Context.Floatx4Ty, [this](auto *V) {
+            return Builder.CreateIntrinsic(
+                llvm::Intrinsic::x86_sse2_cvttps2dq, {}, {V});
+          });
+          break;
+        }
+        compileVectorTruncSatS(Context.Floatx4Ty, 32);
+        break;
+      case OpCode::I32x4__relaxed_trunc_f32x4_u:
+        compileVectorTruncSatU(Context.Floatx4Ty, 32);
+        break;
+      case OpCode::I32x4__relaxed_trunc_f64x2_s_zero:
+        if constexpr (kX86_64) {
+          compileVectorOp(Context.Doublex2Ty, [this](auto *V) {
+            return Builder.CreateIntrinsic(
+                llvm::Intrinsic::x86_sse2_cvttpd2dq, {}, {V});
+          });
+          break;
+        }
+        compileVectorTruncSatZero(true);
+        break;
+      case OpCode::I32x4__relaxed_trunc_f64x2_u_zero:
+        compileVectorTruncSatZero(false);
+        break;
+      case OpCode::F32x4__relaxed_madd:
+        compileVectorVectorVectorMAdd(Context.Floatx4Ty, false);
+        break;
+      case OpCode::F32x4__relaxed_nmadd:
+        compileVectorVectorVectorMAdd(Context.Floatx4Ty, true);
+        break;
+      case OpCode::F64x2__relaxed_madd:
+        compileVectorVectorVectorMAdd(Context.Doublex2Ty, false);
+        break;
+      case OpCode::F64x2__relaxed_nmadd:
+        compileVectorVectorVectorMAdd(Context.Doublex2Ty, true);
+        break;
+      case OpCode::F32x4__relaxed_min:
+        compileVectorVectorFPMin(Context.Floatx4Ty);
+        break;
+      case OpCode::F32x4__relaxed_max:
+        compileVectorVectorFPMax(Context.Floatx4Ty);
+        break;
+      case OpCode::F64x2__relaxed_min:
+        compileVectorVectorFPMin(Context.Doublex2Ty);
         break;
-      case OpCode::F64x2__convert_i64x2_s:
-        compileVectorConvertS(Context.Int64x2Ty, Context.Doublex2Ty);
+      case OpCode::F64x2__relaxed_max:
+        compileVectorVectorFPMax(Context.Doublex2Ty);
         break;
-      case OpCode::F64x2__convert_i64x2_u:
-        compileVectorConvertU(Context.Int64x2Ty, Context.Doublex2Ty);
+      case OpCode::I16x8__relaxed_q15mulr_s:
+        compileVectorVectorQ15MulR();
+        break;
+      case OpCode::I16x8__relaxed_dot_i8x16_i7x16_s:
+        compileVectorVectorOp(Context.Int8x16Ty, [this](auto *LHS, auto *RHS) {
+          return compileVectorDotI8x16(LHS, RHS);
+        });
+        break;
+      case OpCode::I32x4__relaxed_dot_i8x16_i7x16_add_s: {
+        auto *C = Builder.CreateBitCast(stackPop(), Context.Int32x4Ty);
+        auto *RHS = Builder.CreateBitCast(stackPop(), Context.Int8x16Ty);
+        auto *LHS = Builder.CreateBitCast(stackPop(), Context.Int8x16Ty);
+        llvm::Value *Ret;
+        if (Context.SupportVNNI) {
+          /// The unsigned operand is the one of 7-bit lanes.
+          Ret = Builder.CreateIntrinsic(
+              llvm::Intrinsic::x86_avx512_vpdpbusd_128, {},
+              {C, Builder.CreateBitCast(RHS, Context.Int32x4Ty),
+               Builder.CreateBitCast(LHS, Context.Int32x4Ty)});
+        } else {
+          auto *Dot = compileVectorDotI8x16(LHS, RHS);
+          if (Context.SupportPMAdd) {
+            Dot = Builder.CreateIntrinsic(
+                llvm::Intrinsic::x86_sse2_pmadd_wd, {},
+                {Dot, Builder.CreateVectorSplat(8, Builder.getInt16(1))});
+          } else {
+            auto *ExtendTy = llvm::VectorType::getExtendedElementVectorType(
+                Context.Int16x8Ty);
+            auto *Undef = llvm::UndefValue::get(ExtendTy);
+            auto *M = Builder.CreateSExt(Dot, ExtendTy);
+            auto *L = Builder.CreateShuffleVector(
+                M, Undef, std::array<ShuffleElement, 4>{0, 2, 4, 6});
+            auto *R = Builder.CreateShuffleVector(
+                M, Undef, std::array<ShuffleElement, 4>{1, 3, 5, 7});
+            Dot = Builder.CreateAdd(L, R);
+          }
+          Ret = Builder.CreateAdd(Dot, C);
+        }
+        stackPush(Builder.CreateBitCast(Ret, Context.Int64x2Ty));
         break;
+      }
       default:
         assert(false);
       }
       return;
     };
     for (const auto &Instr : Instrs) {
+      if (auto *SP = F->getSubprogram()) {
+        Builder.SetCurrentDebugLocation(Context.getDebugLoc(
+            SP, Instr.getOffset(), Instrs.front().getOffset()));
+      }
+
       /// Update instruction count
       if (LocalInstrCount) {
         Builder.CreateStore(
@@ -2442,9 +3839,10 @@ public:
       if (LocalGas) {
         auto *NewGas = Builder.CreateAdd(
             Builder.CreateLoad(LocalGas),
-            Builder.CreateLoad(Builder.CreateConstInBoundsGEP2_64(
-                Context.getCostTable(Builder, ExecCtx), 0,
-                uint16_t(Instr.getOpCode()))));
+            Context.createInvariantLoad(
+                Builder, Builder.CreateConstInBoundsGEP2_64(
+                             Context.getCostTable(Builder, ExecCtx), 0,
+                             uint16_t(Instr.getOpCode()))));
         Builder.CreateStore(NewGas, LocalGas);
       }
 
@@ -2627,24 +4025,50 @@ public:
   void updateInstrCount() {
     if (LocalInstrCount) {
       auto *Ptr = Context.getInstrCount(Builder, ExecCtx);
-      Builder.CreateStore(Builder.CreateAdd(Builder.CreateLoad(LocalInstrCount),
-                                            Builder.CreateLoad(Ptr)),
-                          Ptr);
+      Context.createRuntimeStore(
+          Builder,
+          Builder.CreateAdd(Builder.CreateLoad(LocalInstrCount),
+                            Context.createRuntimeLoad(Builder, Ptr)),
+          Ptr);
       Builder.CreateStore(Builder.getInt64(0), LocalInstrCount);
     }
   }
 
   void readGas() {
     if (LocalGas) {
-      Builder.CreateStore(Builder.CreateLoad(Context.getGas(Builder, ExecCtx)),
-                          LocalGas);
+      Builder.CreateStore(
+          Context.createRuntimeLoad(Builder, Context.getGas(Builder, ExecCtx)),
+          LocalGas);
+    }
+  }
+
+  llvm::Value *getMemoryBase() { return Builder.CreateLoad(LocalMemory); }
+
+  /// Get the current page count of the memory.
+  llvm::Value *loadMemoryPages() {
+    if (Context.SharedMemory) {
+      return Context.getSharedMemoryPages(Builder, ExecCtx);
+    }
+    return Builder.CreateLoad(LocalMemoryPages);
+  }
+
+  void readMemoryPages() {
+    if (LocalMemoryPages) {
+      Builder.CreateStore(Context.getMemoryPages(Builder, ExecCtx),
+                          LocalMemoryPages);
+    }
+    if (LocalMemory && BoundsChecks) {
+      Builder.CreateStore(
+          Context.createRuntimeLoad(Builder,
+                                    Context.getMemory(Builder, ExecCtx)),
+          LocalMemory);
     }
   }
 
   void writeGas() {
     if (LocalGas) {
-      Builder.CreateStore(Builder.CreateLoad(LocalGas),
-                          Context.getGas(Builder, ExecCtx));
+      Context.createRuntimeStore(Builder, Builder.CreateLoad(LocalGas),
+                                 Context.getGas(Builder, ExecCtx));
     }
   }
 
@@ -2662,7 +4086,7 @@ private:
       Args[J + 1] = stackPop();
     }
 
-    auto *Ret = Builder.CreateCall(Function, Args);
+    auto *Ret = createThrowingCall(Function, Args);
     auto *Ty = Ret->getType();
     if (Ty->isVoidTy()) {
       // nothing to do
@@ -2675,6 +4099,7 @@ private:
     }
 
     readGas();
+    readMemoryPages();
   }
 
   void compileIndirectCallOp(const uint32_t TableIndex,
@@ -2687,77 +4112,225 @@ private:
     const auto ArgSize = FuncType.getParamTypes().size();
     const auto RetSize = RTy->isVoidTy() ? 0 : FuncType.getReturnTypes().size();
 
-    llvm::Value *Args;
-    if (ArgSize == 0) {
-      Args = llvm::ConstantPointerNull::get(Builder.getInt8PtrTy());
-    } else {
-      auto *Alloca = Builder.CreateAlloca(Builder.getInt8Ty(),
-                                          Builder.getInt64(ArgSize * kValSize));
-      Alloca->setAlignment(Align(kValSize));
-      Args = Alloca;
+    std::vector<llvm::Value *> ArgsVec(ArgSize + 1);
+    ArgsVec[0] = F->arg_begin();
+    for (unsigned I = 0; I < ArgSize; ++I) {
+      const unsigned J = ArgSize - 1 - I;
+      ArgsVec[J + 1] = stackPop();
     }
 
-    llvm::Value *Rets;
-    if (RetSize == 0) {
-      Rets = llvm::ConstantPointerNull::get(Builder.getInt8PtrTy());
-    } else {
-      auto *Alloca = Builder.CreateAlloca(Builder.getInt8Ty(),
-                                          Builder.getInt64(RetSize * kValSize));
-      Alloca->setAlignment(Align(kValSize));
-      Rets = Alloca;
+    /// Call the compiled function of the same module directly when the table
+    /// entry matches. Other cases, including every trap except the bound
+    /// check, go through the intrinsic.
+    auto *InBoundBB =
+        llvm::BasicBlock::Create(LLContext, "call_indirect.inbound", F);
+    auto *FastBB = llvm::BasicBlock::Create(LLContext, "call_indirect.fast", F);
+    auto *SlowBB = llvm::BasicBlock::Create(LLContext, "call_indirect.slow", F);
+    auto *EndBB = llvm::BasicBlock::Create(LLContext, "call_indirect.end", F);
+
+    auto *Table = Context.getTable(Builder, ExecCtx, TableIndex);
+    auto *Size =
+        Context.createRuntimeLoad(Builder, Builder.CreateStructGEP(Table, 2));
+    Builder.CreateCondBr(
+        createLikely(Builder, Builder.CreateICmpULT(FuncIndex, Size)),
+        InBoundBB, SlowBB);
+
+    Builder.SetInsertPoint(InBoundBB);
+    auto *Entries =
+        Context.createRuntimeLoad(Builder, Builder.CreateStructGEP(Table, 1));
+    auto *Entry = Builder.CreateInBoundsGEP(
+        Entries, Builder.CreateZExt(FuncIndex, Context.Int64Ty));
+    auto *TypeId =
+        Context.createRuntimeLoad(Builder, Builder.CreateStructGEP(Entry, 0));
+    auto *Function =
+        Context.createRuntimeLoad(Builder, Builder.CreateStructGEP(Entry, 1));
+    auto *CalleeCtx =
+        Context.createRuntimeLoad(Builder, Builder.CreateStructGEP(Entry, 2));
+    auto *IsMatched = Builder.CreateAnd(
+        Builder.CreateICmpEQ(
+            TypeId, Context.getFuncTypeId(Builder, ExecCtx, FuncTypeIndex)),
+        Builder.CreateICmpEQ(
+            CalleeCtx, Builder.CreateBitCast(F->arg_begin(), Context.Int8PtrTy)));
+    Builder.CreateCondBr(createLikely(Builder, IsMatched), FastBB, SlowBB);
+
+    Builder.SetInsertPoint(FastBB);
+    std::vector<llvm::Value *> FastRets;
+    {
+      auto *Ret = createThrowingCall(
+          llvm::FunctionCallee(
+              FTy, Builder.CreateBitCast(Function, FTy->getPointerTo())),
+          ArgsVec);
+      if (RetSize == 0) {
+        // nothing to do
+      } else if (RetSize == 1) {
+        FastRets.push_back(Ret);
+      } else {
+        FastRets = unpackStruct(Builder, Ret);
+      }
     }
+    FastBB = Builder.GetInsertBlock();
+    Builder.CreateBr(EndBB);
 
-    for (unsigned I = 0; I < ArgSize; ++I) {
-      const unsigned J = ArgSize - 1 - I;
-      auto *Arg = stackPop();
-      auto *Ptr = Builder.CreateConstInBoundsGEP1_64(Args, J * kValSize);
-      Builder.CreateStore(
-          Arg, Builder.CreateBitCast(Ptr, Arg->getType()->getPointerTo()));
-    }
+    Builder.SetInsertPoint(SlowBB);
+    std::vector<llvm::Value *> SlowRets;
+    {
+      llvm::Value *Args;
+      if (ArgSize == 0) {
+        Args = llvm::ConstantPointerNull::get(Builder.getInt8PtrTy());
+      } else {
+        auto *Alloca = Builder.CreateAlloca(
+            Builder.getInt8Ty(), Builder.getInt64(ArgSize * kValSize));
+        Alloca->setAlignment(Align(kValSize));
+        Args = Alloca;
+      }
 
-    Builder.CreateCall(
-        Context.getIntrinsic(
-            Builder, AST::Module::Intrinsics::kCallIndirect,
-            llvm::FunctionType::get(Context.VoidTy,
-                                    {Context.Int32Ty, Context.Int32Ty,
-                                     Context.Int32Ty, Context.Int8PtrTy,
-                                     Context.Int8PtrTy},
-                                    false)),
-        {Builder.getInt32(TableIndex), Builder.getInt32(FuncTypeIndex),
-         FuncIndex, Args, Rets});
+      llvm::Value *Rets;
+      if (RetSize == 0) {
+        Rets = llvm::ConstantPointerNull::get(Builder.getInt8PtrTy());
+      } else {
+        auto *Alloca = Builder.CreateAlloca(
+            Builder.getInt8Ty(), Builder.getInt64(RetSize * kValSize));
+        Alloca->setAlignment(Align(kValSize));
+        Rets = Alloca;
+      }
 
-    if (RetSize == 0) {
-      // nothing to do
-    } else if (RetSize == 1) {
-      auto *VPtr = Builder.CreateConstInBoundsGEP1_64(Rets, 0);
-      auto *Ptr = Builder.CreateBitCast(VPtr, RTy->getPointerTo());
-      stackPush(Builder.CreateLoad(Ptr));
-    } else {
-      for (unsigned I = 0; I < RetSize; ++I) {
-        auto *VPtr = Builder.CreateConstInBoundsGEP1_64(Rets, I * kValSize);
-        auto *Ptr = Builder.CreateBitCast(
-            VPtr, RTy->getStructElementType(I)->getPointerTo());
-        stackPush(Builder.CreateLoad(Ptr));
+      for (unsigned I = 0; I < ArgSize; ++I) {
+        auto *Arg = ArgsVec[I + 1];
+        auto *Ptr = Builder.CreateConstInBoundsGEP1_64(Args, I * kValSize);
+        Builder.CreateStore(
+            Arg, Builder.CreateBitCast(Ptr, Arg->getType()->getPointerTo()));
+      }
+
+      createThrowingCall(
+          Context.getIntrinsic(
+              Builder, AST::Module::Intrinsics::kCallIndirect,
+              llvm::FunctionType::get(Context.VoidTy,
+                                      {Context.Int32Ty, Context.Int32Ty,
+                                       Context.Int32Ty, Context.Int8PtrTy,
+                                       Context.Int8PtrTy},
+                                      false)),
+          {Builder.getInt32(TableIndex), Builder.getInt32(FuncTypeIndex),
+           FuncIndex, Args, Rets});
+
+      if (RetSize == 0) {
+        // nothing to do
+      } else if (RetSize == 1) {
+        auto *VPtr = Builder.CreateConstInBoundsGEP1_64(Rets, 0);
+        auto *Ptr = Builder.CreateBitCast(VPtr, RTy->getPointerTo());
+        SlowRets.push_back(Builder.CreateLoad(Ptr));
+      } else {
+        for (unsigned I = 0; I < RetSize; ++I) {
+          auto *VPtr = Builder.CreateConstInBoundsGEP1_64(Rets, I * kValSize);
+          auto *Ptr = Builder.CreateBitCast(
+              VPtr, RTy->getStructElementType(I)->getPointerTo());
+          SlowRets.push_back(Builder.CreateLoad(Ptr));
+        }
       }
     }
+    SlowBB = Builder.GetInsertBlock();
+    Builder.CreateBr(EndBB);
+
+    Builder.SetInsertPoint(EndBB);
+    for (unsigned I = 0; I < RetSize; ++I) {
+      auto *PHIRet = Builder.CreatePHI(FastRets[I]->getType(), 2);
+      PHIRet->addIncoming(FastRets[I], FastBB);
+      PHIRet->addIncoming(SlowRets[I], SlowBB);
+      stackPush(PHIRet);
+    }
 
     readGas();
+    readMemoryPages();
+  }
+
+  /// Trap if the accessed range ending at End exceeds the current memory.
+  void compileMemoryRangeCheck(llvm::Value *End) {
+    auto *Size = Builder.CreateMul(
+        Builder.CreateZExt(loadMemoryPages(), Context.Int64Ty),
+        Builder.getInt64(kPageSize));
+    auto *OkBB = llvm::BasicBlock::Create(LLContext, "mem.inbound", F);
+    auto *IsInBound = createLikely(Builder, Builder.CreateICmpULE(End, Size));
+    Builder.CreateCondBr(IsInBound, OkBB,
+                         getTrapBB(ErrCode::MemoryOutOfBounds));
+    Builder.SetInsertPoint(OkBB);
+  }
+
+  /// Size in bytes of a memory access of Type.
+  static uint64_t getAccessSize(llvm::Type *Type) {
+    return Type->getPrimitiveSizeInBits() / 8;
+  }
+
+  /// Key of an address for merging bounds checks. Addresses with the same key
+  /// have the same value: loads of a local are keyed by the first load since
+  /// it was written, and added constants are kept in the key modulo 2^32.
+  std::pair<llvm::Value *, uint32_t> getAddressKey(llvm::Value *Addr) {
+    uint32_t Addend = 0;
+    while (auto *Add = llvm::dyn_cast<llvm::BinaryOperator>(Addr)) {
+      if (Add->getOpcode() != llvm::Instruction::Add) {
+        break;
+      }
+      if (auto *C = llvm::dyn_cast<llvm::ConstantInt>(Add->getOperand(1))) {
+        Addend += static_cast<uint32_t>(C->getZExtValue());
+        Addr = Add->getOperand(0);
+      } else if (auto *C =
+                     llvm::dyn_cast<llvm::ConstantInt>(Add->getOperand(0))) {
+        Addend += static_cast<uint32_t>(C->getZExtValue());
+        Addr = Add->getOperand(1);
+      } else {
+        break;
+      }
+    }
+    if (auto It = LocalCanon.find(Addr); It != LocalCanon.end()) {
+      Addr = It->second;
+    }
+    return {Addr, Addend};
+  }
+
+  /// Trap if the access of Size bytes at Off + Offset exceeds the current
+  /// memory. The memory never shrinks, so an access in straight-line code is
+  /// covered by an earlier check of the same address which reached as far.
+  void compileBoundsCheck(llvm::Value *Addr, llvm::Value *Off,
+                          uint64_t Offset, uint64_t Size) {
+    if (Builder.GetInsertBlock() != CheckedBlock) {
+      CheckedEnds.clear();
+    }
+    const auto Key = getAddressKey(Addr);
+    const uint64_t End = Offset + Size;
+    if (auto It = CheckedEnds.find(Key);
+        It != CheckedEnds.end() && End <= It->second) {
+      return;
+    }
+    auto *MemSize = Builder.CreateMul(
+        Builder.CreateZExt(loadMemoryPages(), Context.Int64Ty),
+        Builder.getInt64(kPageSize));
+    /// `Off + End <= MemSize`, in the form of a range check.
+    auto *Last = Builder.CreateAdd(Off, Builder.getInt64(End - 1));
+    auto *OkBB = llvm::BasicBlock::Create(LLContext, "mem.inbound", F);
+    Builder.CreateCondBr(
+        createLikely(Builder, Builder.CreateICmpULT(Last, MemSize)), OkBB,
+        getTrapBB(ErrCode::MemoryOutOfBounds));
+    Builder.SetInsertPoint(OkBB);
+    CheckedBlock = OkBB;
+    CheckedEnds[Key] = End;
   }
 
   void compileLoadOp(unsigned Offset, unsigned Alignment, llvm::Type *LoadTy) {
     if constexpr (kForceUnalignment) {
       Alignment = 0;
     }
-    auto *Off = Builder.CreateZExt(stackPop(), Context.Int64Ty);
+    auto *Addr = stackPop();
+    auto *Off = Builder.CreateZExt(Addr, Context.Int64Ty);
+    if (BoundsChecks) {
+      compileBoundsCheck(Addr, Off, Offset, getAccessSize(LoadTy));
+    }
     if (Offset != 0) {
       Off = Builder.CreateAdd(Off, Builder.getInt64(Offset));
     }
 
-    auto *VPtr =
-        Builder.CreateInBoundsGEP(Context.getMemory(Builder, ExecCtx), {Off});
+    auto *VPtr = Builder.CreateInBoundsGEP(getMemoryBase(), {Off});
     auto *Ptr = Builder.CreateBitCast(VPtr, LoadTy->getPointerTo());
     auto *LoadInst = Builder.CreateLoad(Ptr, OptNone);
     LoadInst->setAlignment(Align(UINT64_C(1) << Alignment));
+    LoadInst->setMetadata(llvm::LLVMContext::MD_tbaa, Context.MemoryTBAA);
     stackPush(LoadInst);
   }
   void compileLoadOp(unsigned Offset, unsigned Alignment, llvm::Type *LoadTy,
@@ -2791,7 +4364,11 @@ private:
       Alignment = 0;
     }
     auto *V = stackPop();
-    auto *Off = Builder.CreateZExt(stackPop(), Context.Int64Ty);
+    auto *Addr = stackPop();
+    auto *Off = Builder.CreateZExt(Addr, Context.Int64Ty);
+    if (BoundsChecks) {
+      compileBoundsCheck(Addr, Off, Offset, getAccessSize(LoadTy));
+    }
     if (Offset != 0) {
       Off = Builder.CreateAdd(Off, Builder.getInt64(Offset));
     }
@@ -2802,11 +4379,86 @@ private:
     if (BitCast) {
       V = Builder.CreateBitCast(V, LoadTy);
     }
-    auto *VPtr =
-        Builder.CreateInBoundsGEP(Context.getMemory(Builder, ExecCtx), {Off});
+    auto *VPtr = Builder.CreateInBoundsGEP(getMemoryBase(), {Off});
     auto *Ptr = Builder.CreateBitCast(VPtr, LoadTy->getPointerTo());
     auto *StoreInst = Builder.CreateStore(V, Ptr, OptNone);
     StoreInst->setAlignment(Align(UINT64_C(1) << Alignment));
+    StoreInst->setMetadata(llvm::LLVMContext::MD_tbaa, Context.MemoryTBAA);
+  }
+  /// Get the pointer of an atomic access of Type at Addr + Offset, trapping
+  /// when the access is out of bounds or not naturally aligned.
+  llvm::Value *compileAtomicPointer(llvm::Value *Addr, unsigned Offset,
+                                    llvm::Type *Type) {
+    const uint64_t Size = getAccessSize(Type);
+    auto *Off = Builder.CreateZExt(Addr, Context.Int64Ty);
+    if (BoundsChecks) {
+      compileBoundsCheck(Addr, Off, Offset, Size);
+    }
+    if (Offset != 0) {
+      Off = Builder.CreateAdd(Off, Builder.getInt64(Offset));
+    }
+    if (Size > 1) {
+      auto *OkBB = llvm::BasicBlock::Create(LLContext, "atomic.aligned", F);
+      auto *IsAligned = createLikely(
+          Builder, Builder.CreateICmpEQ(
+                       Builder.CreateAnd(Off, Builder.getInt64(Size - 1)),
+                       Builder.getInt64(0)));
+      Builder.CreateCondBr(IsAligned, OkBB,
+                           getTrapBB(ErrCode::UnalignedAtomicAccess));
+      Builder.SetInsertPoint(OkBB);
+    }
+    auto *VPtr = Builder.CreateInBoundsGEP(getMemoryBase(), {Off});
+    return Builder.CreateBitCast(VPtr, Type->getPointerTo());
+  }
+  void compileAtomicLoadOp(unsigned Offset, llvm::Type *LoadTy,
+                           llvm::Type *ExtendTy) {
+    auto *Ptr = compileAtomicPointer(stackPop(), Offset, LoadTy);
+    auto *LoadInst = Builder.CreateLoad(Ptr);
+    LoadInst->setAlignment(Align(getAccessSize(LoadTy)));
+    LoadInst->setAtomic(llvm::AtomicOrdering::SequentiallyConsistent);
+    LoadInst->setMetadata(llvm::LLVMContext::MD_tbaa, Context.MemoryTBAA);
+    stackPush(Builder.CreateZExt(LoadInst, ExtendTy));
+  }
+  void compileAtomicStoreOp(unsigned Offset, llvm::Type *StoreTy) {
+    auto *V = Builder.CreateTrunc(stackPop(), StoreTy);
+    auto *Ptr = compileAtomicPointer(stackPop(), Offset, StoreTy);
+    auto *StoreInst = Builder.CreateStore(V, Ptr);
+    StoreInst->setAlignment(Align(getAccessSize(StoreTy)));
+    StoreInst->setAtomic(llvm::AtomicOrdering::SequentiallyConsistent);
+    StoreInst->setMetadata(llvm::LLVMContext::MD_tbaa, Context.MemoryTBAA);
+  }
+  void compileAtomicRMWOp(unsigned Offset, llvm::AtomicRMWInst::BinOp Op,
+                          llvm::Type *RMWTy, llvm::Type *ExtendTy) {
+    auto *V = Builder.CreateTrunc(stackPop(), RMWTy);
+    auto *Ptr = compileAtomicPointer(stackPop(), Offset, RMWTy);
+    auto *Old = createAtomicRMW(Builder, Op, Ptr, V);
+    stackPush(Builder.CreateZExt(Old, ExtendTy));
+  }
+  void compileAtomicCompareExchangeOp(unsigned Offset, llvm::Type *RMWTy,
+                                      llvm::Type *ExtendTy) {
+    auto *New = Builder.CreateTrunc(stackPop(), RMWTy);
+    auto *Cmp = Builder.CreateTrunc(stackPop(), RMWTy);
+    auto *Ptr = compileAtomicPointer(stackPop(), Offset, RMWTy);
+    auto *Inst = createAtomicCmpXchg(Builder, Ptr, Cmp, New);
+    stackPush(Builder.CreateZExt(Builder.CreateExtractValue(Inst, {0}),
+                                 ExtendTy));
+  }
+  void compileAtomicWaitOp(unsigned Offset, unsigned BitWidth) {
+    auto *Timeout = stackPop();
+    auto *Expected = Builder.CreateZExt(stackPop(), Context.Int64Ty);
+    auto *Addr = stackPop();
+    stackPush(Builder.CreateCall(
+        Context.getIntrinsic(
+            Builder, AST::Module::Intrinsics::kMemAtomicWait,
+            llvm::FunctionType::get(Context.Int32Ty,
+                                    {Context.Int32Ty, Context.Int32Ty,
+                                     Context.Int64Ty, Context.Int64Ty,
+                                     Context.Int32Ty},
+                                    false)),
+        {Addr, Builder.getInt32(Offset), Expected, Timeout,
+         Builder.getInt32(BitWidth)}));
+    /// Other threads may grow the shared memory while waiting.
+    readMemoryPages();
   }
   void compileSplatOp(llvm::VectorType *VectorTy) {
     const uint32_t kZero = 0;
@@ -3250,21 +4902,207 @@ private:
     auto *A = Builder.CreateBitCast(stackPop(), VectorTy);
     stackPush(Builder.CreateBitCast(Op(A, B, C), Context.Int64x2Ty));
   }
-  void compileVectorVectorVectorQFMA(llvm::VectorType *VectorTy) {
-    /// XXX: Not in testsuite yet
-    compileVectorVectorVectorOp(VectorTy, [this](auto *A, auto *B, auto *C) {
-      return Builder.CreateIntrinsic(llvm::Intrinsic::fmuladd, {A->getType()},
-                                     {A, B, C});
+  /// Compute A * B + C, or -(A * B) + C if negated, fused on hosts with FMA.
+  void compileVectorVectorVectorMAdd(llvm::VectorType *VectorTy,
+                                     bool Negate) {
+    compileVectorVectorVectorOp(
+        VectorTy, [this, Negate](auto *A, auto *B, auto *C) {
+          if (Negate) {
+            A = Builder.CreateFNeg(A);
+          }
+          return Builder.CreateIntrinsic(llvm::Intrinsic::fmuladd,
+                                         {A->getType()}, {A, B, C});
+        });
+  }
+  /// Compute A + B * C, or A - B * C if negated.
+  void compileVectorVectorVectorQFMA(llvm::VectorType *VectorTy, bool Negate) {
+    compileVectorVectorVectorOp(
+        VectorTy, [this, Negate](auto *A, auto *B, auto *C) {
+          if (Negate) {
+            B = Builder.CreateFNeg(B);
+          }
+          return Builder.CreateIntrinsic(llvm::Intrinsic::fmuladd,
+                                         {A->getType()}, {B, C, A});
+        });
+  }
+  /// Select bits, or whole lanes by their top bit with blends, which is the
+  /// same for masks of all ones or zeros.
+  void compileVectorLaneSelect(llvm::VectorType *VectorTy) {
+    compileVectorVectorVectorOp(VectorTy, [this, VectorTy](auto *V1, auto *V2,
+                                                           auto *C) {
+      if constexpr (kX86_64) {
+        if (Context.SupportBlend) {
+          const auto Size = VectorTy->getElementCount().Min;
+          llvm::Intrinsic::ID ID = llvm::Intrinsic::not_intrinsic;
+          llvm::VectorType *BlendTy = nullptr;
+          if (Size == 16) {
+            ID = llvm::Intrinsic::x86_sse41_pblendvb;
+            BlendTy = Context.Int8x16Ty;
+          } else if (Size == 4) {
+            ID = llvm::Intrinsic::x86_sse41_blendvps;
+            BlendTy = Context.Floatx4Ty;
+          } else if (Size == 2) {
+            ID = llvm::Intrinsic::x86_sse41_blendvpd;
+            BlendTy = Context.Doublex2Ty;
+          }
+          if (BlendTy) {
+            auto *Ret = Builder.CreateIntrinsic(
+                ID, {},
+                {Builder.CreateBitCast(V2, BlendTy),
+                 Builder.CreateBitCast(V1, BlendTy),
+                 Builder.CreateBitCast(C, BlendTy)});
+            return Builder.CreateBitCast(Ret, VectorTy);
+          }
+        }
+      }
+      return Builder.CreateXor(
+          Builder.CreateAnd(Builder.CreateXor(V1, V2), C), V2);
     });
   }
-  void compileVectorVectorVectorQFMS(llvm::VectorType *VectorTy) {
-    /// XXX: Not in testsuite yet
-    compileVectorVectorVectorOp(VectorTy, [this](auto *A, auto *B, auto *C) {
-      C = Builder.CreateFNeg(C);
-      return Builder.CreateIntrinsic(llvm::Intrinsic::fmuladd, {A->getType()},
-                                     {A, B, C});
+  /// Truncate f64x2 to the low lanes of i32x4, saturated.
+  void compileVectorTruncSatZero(bool Signed) {
+    compileVectorOp(Context.Doublex2Ty, [this, Signed](auto *V) {
+      auto *Min = llvm::ConstantFP::get(
+          Context.Doublex2Ty, Signed ? double(INT32_MIN) : 0.0);
+      auto *Max = llvm::ConstantFP::get(
+          Context.Doublex2Ty, Signed ? double(INT32_MAX) : double(UINT32_MAX));
+      auto *Int32x2Ty = llvm::VectorType::get(Context.Int32Ty, 2, false);
+      /// Both bounds are exact, so the clamped conversion is defined.
+      auto *Normal = Builder.CreateFCmpORD(V, V);
+      V = Builder.CreateSelect(Builder.CreateFCmpOLT(V, Min), Min, V);
+      V = Builder.CreateSelect(Builder.CreateFCmpOGT(V, Max), Max, V);
+      V = Builder.CreateSelect(
+          Normal, V, llvm::ConstantAggregateZero::get(Context.Doublex2Ty));
+      V = Signed ? Builder.CreateFPToSI(V, Int32x2Ty)
+                 : Builder.CreateFPToUI(V, Int32x2Ty);
+      return Builder.CreateShuffleVector(
+          V, llvm::ConstantAggregateZero::get(Int32x2Ty),
+          std::array<ShuffleElement, 4>{0, 1, 2, 3});
     });
   }
+  /// Multiply Q15 numbers with rounding. The overflowing lane of -0x8000
+  /// squared wraps, as x86 does.
+  void compileVectorVectorQ15MulR() {
+    compileVectorVectorOp(
+        Context.Int16x8Ty, [this](auto *LHS, auto *RHS) -> llvm::Value * {
+          if constexpr (kX86_64) {
+            if (Context.SupportPMAdd) {
+              return Builder.CreateIntrinsic(
+                  llvm::Intrinsic::x86_ssse3_pmul_hr_sw_128, {}, {LHS, RHS});
+            }
+          }
+          auto *ExtendTy =
+              llvm::VectorType::getExtendedElementVectorType(Context.Int16x8Ty);
+          auto *M = Builder.CreateMul(Builder.CreateSExt(LHS, ExtendTy),
+                                      Builder.CreateSExt(RHS, ExtendTy));
+          M = Builder.CreateAdd(
+              M, Builder.CreateVectorSplat(8, Builder.getInt32(0x4000)));
+          M = Builder.CreateAShr(M, 15);
+          return Builder.CreateTrunc(M, Context.Int16x8Ty);
+        });
+  }
+  /// Sum products of adjacent lanes, of which the right ones have 7 bits.
+  llvm::Value *compileVectorDotI8x16(llvm::Value *LHS, llvm::Value *RHS) {
+    if constexpr (kX86_64) {
+      if (Context.SupportPMAdd) {
+        /// The unsigned operand is the one of 7-bit lanes.
+        return Builder.CreateIntrinsic(
+            llvm::Intrinsic::x86_ssse3_pmadd_ub_sw_128, {}, {RHS, LHS});
+      }
+    }
+    auto *ExtendTy =
+        llvm::VectorType::getExtendedElementVectorType(Context.Int8x16Ty);
+    auto *Undef = llvm::UndefValue::get(ExtendTy);
+    auto *M = Builder.CreateMul(Builder.CreateSExt(LHS, ExtendTy),
+                                Builder.CreateSExt(RHS, ExtendTy));
+    auto *L = Builder.CreateShuffleVector(
+        M, Undef, std::array<ShuffleElement, 8>{0, 2, 4, 6, 8, 10, 12, 14});
+    auto *R = Builder.CreateShuffleVector(
+        M, Undef, std::array<ShuffleElement, 8>{1, 3, 5, 7, 9, 11, 13, 15});
+    return Builder.CreateAdd(L, R);
+  }
+
+  /// Create an alloca in the entry block, which is allocated once however
+  /// often its block runs.
+  llvm::AllocaInst *createEntryAlloca(llvm::Type *Ty,
+                                      llvm::Value *ArraySize = nullptr) {
+    auto &Entry = F->getEntryBlock();
+    llvm::IRBuilder<> EntryBuilder(&Entry, Entry.begin());
+    return EntryBuilder.CreateAlloca(Ty, ArraySize);
+  }
+
+  /// Create the landing pad of the entered try block. Exceptions are raised
+  /// as foreign exceptions by the runtime, which keeps the thrown one, so the
+  /// landing pad catches all and dispatches by asking the runtime.
+  void enterTry() {
+    auto &Entry = ControlStack.back();
+    auto *ExceptionTy =
+        llvm::StructType::get(Context.Int8PtrTy, Context.Int32Ty);
+    if (!F->hasPersonalityFn()) {
+      F->setPersonalityFn(Context.getPersonality());
+    }
+    auto *Caught = createEntryAlloca(
+        Context.Int8Ty,
+        Builder.getInt64(std::max(Context.MaxTagParams, 1U) * kValSize));
+    Caught->setAlignment(Align(kValSize));
+    Entry.Caught = Caught;
+    Entry.LandingPad = llvm::BasicBlock::Create(LLContext, "try.lpad", F);
+    Entry.Dispatch = llvm::BasicBlock::Create(LLContext, "try.dispatch", F);
+
+    auto *Curr = Builder.GetInsertBlock();
+    Builder.SetInsertPoint(Entry.LandingPad);
+    auto *LandingPad = Builder.CreateLandingPad(ExceptionTy, 1);
+    LandingPad->addClause(llvm::ConstantPointerNull::get(Context.Int8PtrTy));
+    readGas();
+    readMemoryPages();
+    Builder.CreateBr(Entry.Dispatch);
+    Builder.SetInsertPoint(Curr);
+  }
+
+  /// Get the landing pad of the innermost try block whose body is compiling.
+  llvm::BasicBlock *getUnwindBlock() const {
+    for (auto It = ControlStack.rbegin(); It != ControlStack.rend(); ++It) {
+      if (It->LandingPad) {
+        return It->LandingPad;
+      }
+    }
+    return nullptr;
+  }
+
+  /// Pass the uncaught exception to the handlers of the innermost try block
+  /// from the label, or to the caller. Resuming the unwinding of a foreign
+  /// exception skips the catch-all frames of the caller, so the runtime raises
+  /// the kept exception again instead.
+  void compileUnwind(unsigned int Index) {
+    for (auto It = ControlStack.rbegin() + Index; It != ControlStack.rend();
+         ++It) {
+      if (It->LandingPad) {
+        Builder.CreateBr(It->Dispatch);
+        return;
+      }
+    }
+    Builder
+        .CreateCall(
+            Context.getIntrinsic(Builder, AST::Module::Intrinsics::kRethrow,
+                                 llvm::FunctionType::get(Context.VoidTy,
+                                                         {Context.Int8PtrTy},
+                                                         false)),
+            {llvm::ConstantPointerNull::get(Context.Int8PtrTy)})
+        ->setDoesNotReturn();
+    Builder.CreateUnreachable();
+  }
+
+  /// Call the function, which unwinds to the enclosing try block on throw.
+  llvm::CallBase *createThrowingCall(llvm::FunctionCallee Callee,
+                                     llvm::ArrayRef<llvm::Value *> Args) {
+    if (auto *Unwind = getUnwindBlock()) {
+      auto *Cont = llvm::BasicBlock::Create(LLContext, "invoke.cont", F);
+      auto *Invoke = Builder.CreateInvoke(Callee, Cont, Unwind, Args);
+      Builder.SetInsertPoint(Cont);
+      return Invoke;
+    }
+    return Builder.CreateCall(Callee, Args);
+  }
 
   void enterBlock(
       llvm::BasicBlock *JumpBlock, llvm::BasicBlock *NextBlock,
@@ -3392,8 +5230,17 @@ private:
   std::vector<llvm::Value *> Stack;
   llvm::Value *LocalInstrCount = nullptr;
   llvm::Value *LocalGas = nullptr;
+  llvm::Value *LocalMemory = nullptr;
+  llvm::Value *LocalMemoryPages = nullptr;
   std::unordered_map<ErrCode, llvm::BasicBlock *> TrapBB;
+  /// Furthest checked end of each memory address in the straight-line code
+  /// which follows the last bounds check.
+  std::map<std::pair<llvm::Value *, uint32_t>, uint64_t> CheckedEnds;
+  llvm::BasicBlock *CheckedBlock = nullptr;
+  std::vector<llvm::Value *> LocalCurrent;
+  std::unordered_map<llvm::Value *, llvm::Value *> LocalCanon;
   bool IsUnreachable = false;
+  bool BoundsChecks = false;
   bool OptNone = false;
   struct Control {
     size_t StackSize;
@@ -3404,6 +5251,13 @@ private:
     std::pair<std::vector<ValType>, std::vector<ValType>> Type;
     std::vector<std::tuple<std::vector<llvm::Value *>, llvm::BasicBlock *>>
         ReturnPHI;
+    /// Landing pad while compiling the body of a try block.
+    llvm::BasicBlock *LandingPad = nullptr;
+    /// Next test of catch clauses, until a catch_all clause.
+    llvm::BasicBlock *Dispatch = nullptr;
+    /// Payload buffer of the caught exception, also identifying it for
+    /// rethrow.
+    llvm::Value *Caught = nullptr;
     Control(
         size_t S, llvm::BasicBlock *J, llvm::BasicBlock *N, llvm::BasicBlock *E,
         std::vector<llvm::Value *> A,
@@ -3459,172 +5313,380 @@ Expect<void> Compiler::compile(Span<const Byte> Data, const AST::Module &Module,
   llvm::InitializeNativeTarget();
   llvm::InitializeNativeTargetAsmPrinter();
 
-  llvm::LLVMContext LLContext;
-  auto LLModule = std::make_unique<llvm::Module>(LLPath.u8string(), LLContext);
-  LLModule->setTargetTriple(llvm::sys::getProcessTriple());
-  LLModule->setPICLevel(llvm::PICLevel::Level::SmallPIC);
-  CompileContext NewContext(*LLModule);
-  struct RAIICleanup {
-    RAIICleanup(CompileContext *&Context, CompileContext &NewContext)
-        : Context(Context) {
-      Context = &NewContext;
-    }
-    ~RAIICleanup() { Context = nullptr; }
-    CompileContext *&Context;
-  };
-  RAIICleanup Cleanup(Context, NewContext);
-
-  /// Compile Function Types
-  compile(Module.getTypeSection());
-  /// Compile ImportSection
-  compile(Module.getImportSection());
-  /// Compile GlobalSection
-  compile(Module.getGlobalSection());
-  /// Compile MemorySection (MemorySec, DataSec)
-  compile(Module.getMemorySection(), Module.getDataSection());
-  /// Compile TableSection (TableSec, ElemSec)
-  compile(Module.getTableSection(), Module.getElementSection());
-  /// compile Functions in module. (FunctionSec, CodeSec)
-  compile(Module.getFunctionSection(), Module.getCodeSection());
-  /// Compile ExportSection
-  compile(Module.getExportSection());
-  /// StartSection is not required to compile
-
-  /// create wasm.code and wasm.size
-  {
-    auto *Int32Ty = Context->Int32Ty;
-    auto *Content = llvm::ConstantDataArray::getString(
-        LLContext,
-        llvm::StringRef(reinterpret_cast<const char *>(Data.data()),
-                        Data.size()),
-        false);
-    new llvm::GlobalVariable(Context->LLModule, Content->getType(), false,
-                             llvm::GlobalValue::ExternalLinkage, Content,
-                             "wasm.code");
-    new llvm::GlobalVariable(
-        Context->LLModule, Int32Ty, false, llvm::GlobalValue::ExternalLinkage,
-        llvm::ConstantInt::get(Int32Ty, Data.size()), "wasm.size");
+  /// Validate the target CPUs before any code generation.
+  for (const auto &CPU : TargetCPUs) {
+    std::string Error;
+    const std::string Triple = llvm::sys::getProcessTriple();
+    const auto *TheTarget = llvm::TargetRegistry::lookupTarget(Triple, Error);
+    std::unique_ptr<llvm::MCSubtargetInfo> STI(
+        TheTarget ? TheTarget->createMCSubtargetInfo(Triple, CPU, "")
+                  : nullptr);
+    if (!STI || !STI->isCPUStringValid(CPU)) {
+      LOG(ERROR) << "unknown target cpu: " << CPU;
+      return Unexpect(ErrCode::InvalidPath);
+    }
   }
 
-  if (DumpIR) {
-    int Fd;
-    llvm::sys::fs::openFileForWrite("wasm.ll", Fd);
-    llvm::raw_fd_ostream OS(Fd, true);
-    LLModule->print(OS, nullptr);
+  /// Remarks of every partition are collected in its own buffer, and written
+  /// in order after the partitions are done.
+  std::unique_ptr<llvm::raw_fd_ostream> RemarksFile;
+  if (!RemarksPath.empty()) {
+    std::error_code EC;
+    RemarksFile =
+        std::make_unique<llvm::raw_fd_ostream>(RemarksPath.u8string(), EC);
+    if (EC) {
+      LOG(ERROR) << "remarks file creation failed:" << RemarksPath.u8string();
+      return Unexpect(ErrCode::InvalidPath);
+    }
   }
-
-  LOG(INFO) << "verify start";
-  llvm::verifyModule(*LLModule, &llvm::errs());
-  LOG(INFO) << "optimize start";
+  TimeReport Times;
+  auto StageStart = TimeReport::Clock::now();
+  auto EndStage = [&](llvm::StringRef Name) {
+    if (TimePasses) {
+      const auto Now = TimeReport::Clock::now();
+      Times.addStage(Name, Now - StageStart);
+      StageStart = Now;
+    }
+  };
 
   // tempfile
-  auto Object = llvm::sys::fs::TempFile::create(OPath.u8string());
-  if (!Object) {
-    // TODO:return error
-    LOG(ERROR) << "so file creation failed:" << OPath.native();
-    llvm::consumeError(Object.takeError());
-    return Unexpect(ErrCode::InvalidPath);
-  }
-  std::error_code EC;
-  auto OS = std::make_unique<llvm::raw_fd_ostream>(Object->TmpName, EC);
-  if (EC) {
-    // TODO:return error
-    LOG(ERROR) << "object file creation failed:" << Object->TmpName;
-    llvm::consumeError(Object->discard());
-    return Unexpect(ErrCode::InvalidPath);
-  }
-
-  // optimize + codegen
-  {
-    std::string Error;
-    std::string Triple = LLModule->getTargetTriple();
-    const llvm::Target *TheTarget =
-        llvm::TargetRegistry::lookupTarget(Triple, Error);
-    if (!TheTarget) {
-      // TODO:return error
-      LOG(ERROR) << "lookupTarget failed";
-      llvm::consumeError(Object->discard());
-      return Unexpect(ErrCode::InvalidPath);
+  std::vector<llvm::sys::fs::TempFile> Objects;
+  auto DiscardObjects = [&Objects]() {
+    for (auto &Object : Objects) {
+      llvm::consumeError(Object.discard());
     }
+  };
 
-    llvm::TargetOptions Options;
-    llvm::Reloc::Model RM = llvm::Reloc::PIC_;
-    std::unique_ptr<llvm::TargetMachine> TM(TheTarget->createTargetMachine(
-        Triple, llvm::sys::getHostCPUName(),
-        Context->SubtargetFeatures.getString(), Options, RM, llvm::None,
-        llvm::CodeGenOpt::Level::Aggressive));
-    LLModule->setDataLayout(TM->createDataLayout());
-
-    llvm::TargetLibraryInfoImpl TLII(llvm::Triple(LLModule->getTargetTriple()));
+  /// Every target CPU gets a full copy of the code. The tables of a variant are
+  /// suffixed by its index, and the loader picks the last one the host runs.
+  const uint32_t VariantNum =
+      std::max(static_cast<uint32_t>(TargetCPUs.size()), UINT32_C(1));
+  for (uint32_t Variant = 0; Variant < VariantNum; ++Variant) {
+    const std::string CPU = TargetCPUs.empty()
+                                ? llvm::sys::getHostCPUName().str()
+                                : std::string(kVariantBaseCPU);
+    const size_t ObjectBase = Objects.size();
+
+    llvm::LLVMContext LLContext;
+    auto LLModule =
+        std::make_unique<llvm::Module>(LLPath.u8string(), LLContext);
+    LLModule->setTargetTriple(llvm::sys::getProcessTriple());
+    LLModule->setPICLevel(llvm::PICLevel::Level::SmallPIC);
+    CompileContext NewContext(*LLModule, !RelaxedFP,
+                              TargetCPUs.empty()
+                                  ? llvm::StringRef()
+                                  : llvm::StringRef(TargetCPUs[Variant]));
+    struct RAIICleanup {
+      RAIICleanup(CompileContext *&Context, CompileContext &NewContext)
+          : Context(Context) {
+        Context = &NewContext;
+      }
+      ~RAIICleanup() { Context = nullptr; }
+      CompileContext *&Context;
+    };
+    RAIICleanup Cleanup(Context, NewContext);
+
+    Context->loadDebugInfo(Data);
+    /// Compile Function Types
+    compile(Module.getTypeSection());
+    /// Compile ImportSection
+    compile(Module.getImportSection());
+    /// Compile GlobalSection
+    compile(Module.getGlobalSection());
+    /// Compile MemorySection (MemorySec, DataSec)
+    compile(Module.getMemorySection(), Module.getDataSection());
+    /// Compile TagSection
+    compile(Module.getTagSection());
+    /// Compile TableSection (TableSec, ElemSec)
+    compile(Module.getTableSection(), Module.getElementSection());
+    /// compile Functions in module. (FunctionSec, CodeSec)
+    compile(Module.getFunctionSection(), Module.getCodeSection());
+    /// Compile ExportSection
+    compile(Module.getExportSection());
+    /// StartSection is not required to compile
+    Context->DebugBuilder.finalize();
+
+    /// create wasm.meta, wasm.meta.size, and wasm.meta.hash. The Wasm binary
+    /// itself is not embedded, the metadata carries every section the loader
+    /// reads.
+    if (Variant == 0) {
+      auto *Int32Ty = Context->Int32Ty;
+      const auto Meta = buildMetadata(Data);
+      auto *MetaContent = llvm::ConstantDataArray::get(
+          LLContext, llvm::ArrayRef<uint8_t>(Meta.data(), Meta.size()));
+      new llvm::GlobalVariable(Context->LLModule, MetaContent->getType(), true,
+                               llvm::GlobalValue::ExternalLinkage, MetaContent,
+                               "wasm.meta");
+      new llvm::GlobalVariable(
+          Context->LLModule, Int32Ty, true, llvm::GlobalValue::ExternalLinkage,
+          llvm::ConstantInt::get(Int32Ty, Meta.size()), "wasm.meta.size");
+      new llvm::GlobalVariable(
+          Context->LLModule, Context->Int64Ty, true,
+          llvm::GlobalValue::ExternalLinkage,
+          llvm::ConstantInt::get(Context->Int64Ty, SSVM::hashBytes(Meta)),
+          "wasm.meta.hash");
+
+      /// Mark the memory accesses as explicitly checked, so the memories of
+      /// the module need no guard pages.
+      if (BoundsChecks) {
+        new llvm::GlobalVariable(
+            Context->LLModule, Int32Ty, true,
+            llvm::GlobalValue::ExternalLinkage,
+            llvm::ConstantInt::get(Int32Ty, 1), "bounds_checks");
+      }
+    }
 
-    {
-#if LLVM_VERSION_MAJOR >= 9
-      llvm::PassBuilder PB(TM.get(), llvm::PipelineTuningOptions(), llvm::None);
-#else
-      llvm::PassBuilder PB(TM.get(), llvm::None);
+    if (!TargetCPUs.empty()) {
+      auto *Int32Ty = Context->Int32Ty;
+      const std::string Suffix = "." + std::to_string(Variant);
+      for (const char *Name : {"types", "codes"}) {
+        if (auto *Table = LLModule->getNamedGlobal(Name)) {
+          Table->setName(Name + Suffix);
+        }
+      }
+      /// Splitting externalizes the local symbols shared between partitions
+      /// under their own names, which must not clash with other variants.
+      for (auto &Value : LLModule->global_values()) {
+        if (Value.hasLocalLinkage()) {
+          const llvm::StringRef Name =
+              Value.hasName() ? Value.getName() : "local";
+          Value.setName(Name.str() + Suffix);
+        }
+      }
+#if LLVM_VERSION_MAJOR >= 12
+      for (auto &F : *LLModule) {
+        if (!F.isDeclaration()) {
+          F.addFnAttr("tune-cpu", TargetCPUs[Variant]);
+        }
+      }
 #endif
+      auto *Features = llvm::ConstantDataArray::getString(
+          LLContext, Context->RequiredFeatures, true);
+      new llvm::GlobalVariable(*LLModule, Features->getType(), true,
+                               llvm::GlobalValue::ExternalLinkage, Features,
+                               "features" + Suffix);
+      if (Variant == 0) {
+        new llvm::GlobalVariable(
+            *LLModule, Int32Ty, true, llvm::GlobalValue::ExternalLinkage,
+            llvm::ConstantInt::get(Int32Ty, VariantNum), "variants");
+      } else {
+        /// The version is defined once by the first variant.
+        LLModule->getNamedGlobal("version")->eraseFromParent();
+      }
+    }
 
-      llvm::LoopAnalysisManager LAM(false);
-      llvm::FunctionAnalysisManager FAM(false);
-      llvm::CGSCCAnalysisManager CGAM(false);
-      llvm::ModuleAnalysisManager MAM(false);
-
-      // Register the AA manager first so that our version is the one
-      // used.
-      FAM.registerPass([&] { return PB.buildDefaultAAPipeline(); });
+    if (DumpIR) {
+      int Fd;
+      llvm::sys::fs::openFileForWrite("wasm.ll", Fd);
+      llvm::raw_fd_ostream OS(Fd, true);
+      LLModule->print(OS, nullptr);
+    }
 
-      // Register the target library analysis directly and give it a
-      // customized preset TLI.
-      FAM.registerPass([&] { return llvm::TargetLibraryAnalysis(TLII); });
-#if LLVM_VERSION_MAJOR <= 9
-      MAM.registerPass([&] { return llvm::TargetLibraryAnalysis(TLII); });
+    EndStage("IR generation");
+    LOG(INFO) << "verify start";
+    llvm::verifyModule(*LLModule, &llvm::errs());
+    EndStage("verification");
+    LOG(INFO) << "optimize start";
+
+    /// Split the module into partitions. Each partition is serialized and
+    /// optimized in its own context on a worker thread. With an object cache,
+    /// the module is always split so unchanged partitions can be reused.
+    const uint32_t Partitions =
+        std::max({Threads, CacheDir.empty() ? UINT32_C(1) : CachePartitions,
+                  UINT32_C(1)});
+    std::vector<llvm::SmallString<0>> Bitcodes;
+    if (Partitions > 1 || !CacheDir.empty()) {
+      Bitcodes.reserve(Partitions);
+      bool SplitFailed = false;
+      auto WritePartition = [&Bitcodes,
+                             &SplitFailed](std::unique_ptr<llvm::Module> Part) {
+        /// Drop the output path, which must not take part in the cache key.
+        Part->setModuleIdentifier("wasm");
+        Part->setSourceFileName("wasm");
+        /// A partition referring to a symbol it can not link against would
+        /// only fail later in the linker, so reject it here.
+        if (llvm::verifyModule(*Part, &llvm::errs())) {
+          SplitFailed = true;
+        }
+        llvm::raw_svector_ostream BCOS(Bitcodes.emplace_back());
+        llvm::WriteBitcodeToFile(*Part, BCOS);
+        if (Bitcodes.back().empty()) {
+          SplitFailed = true;
+        }
+      };
+#if LLVM_VERSION_MAJOR >= 13
+      llvm::SplitModule(*LLModule, Partitions, WritePartition);
+#else
+      llvm::SplitModule(std::move(LLModule), Partitions, WritePartition);
 #endif
+      if (SplitFailed || Bitcodes.size() != Partitions) {
+        LOG(ERROR) << "module splitting failed";
+        DiscardObjects();
+        return Unexpect(ErrCode::InvalidPath);
+      }
+      EndStage("module splitting");
+    }
 
-      // Register all the basic analyses with the managers.
-      PB.registerModuleAnalyses(MAM);
-      PB.registerCGSCCAnalyses(CGAM);
-      PB.registerFunctionAnalyses(FAM);
-      PB.registerLoopAnalyses(LAM);
-      PB.crossRegisterProxies(LAM, FAM, CGAM, MAM);
+    // tempfile
+    Objects.reserve(ObjectBase + Partitions);
+    for (uint32_t I = 0; I < Partitions; ++I) {
+      auto Object = llvm::sys::fs::TempFile::create(OPath.u8string());
+      if (!Object) {
+        LOG(ERROR) << "so file creation failed:" << OPath.native();
+        llvm::consumeError(Object.takeError());
+        DiscardObjects();
+        return Unexpect(ErrCode::InvalidPath);
+      }
+      Objects.push_back(std::move(*Object));
+    }
 
-      llvm::ModulePassManager MPM(false);
-      if (optNone()) {
-        MPM.addPass(llvm::AlwaysInlinerPass(false));
+    // optimize + codegen
+    const std::string Features = Context->SubtargetFeatures.getString();
+    std::atomic<bool> Failed{false};
+
+    /// Look up the object cache. A partition is keyed by its unoptimized
+    /// bitcode, which already carries the function bodies, signatures and
+    /// instrumentation, together with everything else fed to code generation.
+    std::vector<fs::path> CachePaths;
+    std::vector<bool> Cached(Partitions, false);
+    std::vector<std::string> Remarks(RemarksFile ? Partitions : 0);
+    if (!CacheDir.empty()) {
+      std::error_code EC;
+      if (fs::create_directories(CacheDir, EC); EC) {
+        LOG(WARNING) << "object cache disabled:" << CacheDir.u8string() << ": "
+                     << EC.message();
       } else {
-        MPM.addPass(PB.buildPerModuleDefaultPipeline(toLLVMLevel(Level)));
+        CachePaths.reserve(Partitions);
       }
-
-      MPM.run(*LLModule, MAM);
+      for (uint32_t I = 0; I < Partitions && !EC; ++I) {
+        llvm::SHA1 Hasher;
+        Hasher.update(Bitcodes[I].str());
+        Hasher.update(CPU);
+        Hasher.update(Features);
+        Hasher.update(std::to_string(static_cast<int>(Level)));
+        Hasher.update(BoundsChecks ? "explicit" : "guard");
+        Hasher.update(std::to_string(kBinaryVersion));
+        Hasher.update(
+            llvm::StringRef(kVersionString.data(), kVersionString.size()));
+        Hasher.update(LLVM_VERSION_STRING);
+        CachePaths.push_back(CacheDir /
+                             (llvm::toHex(Hasher.final(), true) + ".o"s));
+        /// Reused partitions produce no remarks or timing, so the cache is
+        /// only read when those are not requested.
+        std::error_code CopyEC;
+        if (RemarksFile || TimePasses || !fs::exists(CachePaths[I], CopyEC)) {
+          continue;
+        }
+        /// An object which can not be copied is compiled again, and the fresh
+        /// object replaces the cached one.
+        if (fs::copy_file(CachePaths[I], Objects[ObjectBase + I].TmpName,
+                          fs::copy_options::overwrite_existing, CopyEC) &&
+            !CopyEC) {
+          Cached[I] = true;
+        } else {
+          LOG(WARNING) << "object cache read failed:"
+                       << CachePaths[I].u8string() << ": "
+                       << CopyEC.message();
+        }
+      }
+      LOG(INFO) << "object cache: "
+                << std::count(Cached.begin(), Cached.end(), true) << '/'
+                << Partitions << " partitions reused";
+      EndStage("object cache lookup");
     }
 
-    llvm::legacy::PassManager CodeGenPasses;
-    CodeGenPasses.add(
-        llvm::createTargetTransformInfoWrapperPass(TM->getTargetIRAnalysis()));
-
-    // Add LibraryInfo.
-    CodeGenPasses.add(new llvm::TargetLibraryInfoWrapperPass(TLII));
-
-#if LLVM_VERSION_MAJOR >= 10
-    using llvm::CGFT_ObjectFile;
-#else
-    const auto CGFT_ObjectFile = llvm::TargetMachine::CGFT_ObjectFile;
-#endif
-    if (TM->addPassesToEmitFile(CodeGenPasses, *OS, nullptr, CGFT_ObjectFile,
-                                false)) {
-      // TODO:return error
-      LOG(ERROR) << "addPassesToEmitFile failed";
-      llvm::consumeError(Object->discard());
+    auto EmitPartition = [&](llvm::Module &Part, uint32_t Index,
+                             const char *DumpPath) {
+      const auto &Object = Objects[ObjectBase + Index];
+      {
+        std::error_code EC;
+        llvm::raw_fd_ostream OS(Object.TmpName, EC);
+        if (EC) {
+          LOG(ERROR) << "object file creation failed:" << Object.TmpName;
+          Failed = true;
+          return;
+        }
+        std::optional<llvm::raw_string_ostream> RemarksOS;
+        EmitDiagnostics Diagnostics;
+        if (RemarksFile) {
+          Diagnostics.Remarks = &RemarksOS.emplace(Remarks[Index]);
+          Diagnostics.FunctionNames = &Context->FunctionNames;
+        }
+        if (TimePasses) {
+          Diagnostics.Times = &Times;
+        }
+        if (!optimizeAndEmit(Part, CPU, Features, Level, BoundsChecks, OS,
+                             DumpPath, Diagnostics)) {
+          Failed = true;
+          return;
+        }
+      }
+      if (!CachePaths.empty()) {
+        /// Publish the object with a rename, so concurrent compilers sharing
+        /// the directory never observe a partial file.
+        std::error_code EC;
+        fs::path Staging(CachePaths[Index]);
+        Staging += "."s + std::to_string(llvm::sys::Process::getProcessId()) +
+                   "."s + std::to_string(Index);
+        if (!fs::copy_file(Object.TmpName, Staging,
+                           fs::copy_options::overwrite_existing, EC)) {
+          return;
+        }
+        fs::rename(Staging, CachePaths[Index], EC);
+        if (EC) {
+          fs::remove(Staging, EC);
+        }
+      }
+    };
+    if (Bitcodes.empty()) {
+      EmitPartition(*LLModule, 0, DumpIR ? "wasm-opt.ll" : nullptr);
+    } else {
+      std::vector<uint32_t> Pending;
+      for (uint32_t I = 0; I < Partitions; ++I) {
+        if (!Cached[I]) {
+          Pending.push_back(I);
+        }
+      }
+      std::atomic<uint32_t> Next{0};
+      auto Work = [&]() {
+        for (uint32_t N = Next++; N < Pending.size(); N = Next++) {
+          const uint32_t I = Pending[N];
+          const std::string DumpPath =
+              DumpIR ? "wasm-opt." + std::to_string(I) + ".ll" : "";
+          llvm::LLVMContext PartContext;
+          auto Part = llvm::parseBitcodeFile(
+              llvm::MemoryBufferRef(Bitcodes[I].str(), "partition"),
+              PartContext);
+          if (!Part) {
+            LOG(ERROR) << "partition " << I << " parse failed";
+            llvm::consumeError(Part.takeError());
+            Failed = true;
+            continue;
+          }
+          EmitPartition(**Part, I, DumpIR ? DumpPath.c_str() : nullptr);
+        }
+      };
+      const uint32_t WorkerNum =
+          std::min(std::max(Threads, UINT32_C(1)),
+                   static_cast<uint32_t>(Pending.size()));
+      std::vector<std::thread> Workers;
+      Workers.reserve(WorkerNum);
+      for (uint32_t I = 1; I < WorkerNum; ++I) {
+        Workers.emplace_back(Work);
+      }
+      Work();
+      for (auto &Worker : Workers) {
+        Worker.join();
+      }
+    }
+    if (Failed) {
+      DiscardObjects();
       return Unexpect(ErrCode::InvalidPath);
     }
-
-    if (DumpIR) {
-      int Fd;
-      llvm::sys::fs::openFileForWrite("wasm-opt.ll", Fd);
-      llvm::raw_fd_ostream OS(Fd, true);
-      LLModule->print(OS, nullptr);
+    StageStart = TimeReport::Clock::now();
+    for (const auto &Buffer : Remarks) {
+      *RemarksFile << Buffer;
     }
-    LOG(INFO) << "codegen start";
-    CodeGenPasses.run(*LLModule);
   }
 
   // link
@@ -3633,9 +5695,19 @@ Expect<void> Compiler::compile(Span<const Byte> Data, const AST::Module &Module,
 #else
   using lld::elf::link;
 #endif
-  link(std::array{"lld", "--shared", "--gc-sections", Object->TmpName.c_str(),
-                  "-o", OutputPath.u8string().c_str()},
-       false,
+  std::vector<const char *> LinkArgs = {"lld", "--shared", "--gc-sections"};
+#ifndef __APPLE__
+  /// Let the unwinder find the unwind tables of libraries loaded by the
+  /// dynamic loader.
+  LinkArgs.push_back("--eh-frame-hdr");
+#endif
+  for (const auto &Object : Objects) {
+    LinkArgs.push_back(Object.TmpName.c_str());
+  }
+  const std::string Output = OutputPath.u8string();
+  LinkArgs.push_back("-o");
+  LinkArgs.push_back(Output.c_str());
+  link(LinkArgs, false,
 #if LLVM_VERSION_MAJOR >= 10
        llvm::outs(), llvm::errs()
 #else
@@ -3643,7 +5715,11 @@ Expect<void> Compiler::compile(Span<const Byte> Data, const AST::Module &Module,
 #endif
   );
 
-  llvm::consumeError(Object->discard());
+  DiscardObjects();
+  EndStage("linking");
+  if (TimePasses) {
+    Times.print(llvm::errs());
+  }
   LOG(INFO) << "compile done";
 
   return {};
@@ -3664,28 +5740,22 @@ void Compiler::compile(const AST::TypeSection &TypeSection) {
   Types.reserve(Size);
   Context->FunctionTypes.reserve(Size);
   Context->FunctionWrappers.reserve(Size);
+  /// Map from canonical type id to the first type index with the id.
+  std::unordered_map<uint32_t, size_t> UniqueTypes;
+  UniqueTypes.reserve(Size);
 
   /// Iterate and compile types.
   for (size_t I = 0; I < Size; ++I) {
     const auto &FuncType = FuncTypes[I];
 
     /// Check function type is unique
-    {
-      bool Unique = true;
-      for (size_t J = 0; J < I; ++J) {
-        const auto &OldFuncType = *Context->FunctionTypes[J];
-        if (OldFuncType == FuncType) {
-          Unique = false;
-          Context->FunctionTypes.push_back(&OldFuncType);
-          auto *F = Context->FunctionWrappers[J];
-          Context->FunctionWrappers.push_back(F);
-          Types.push_back(Types[J]);
-          break;
-        }
-      }
-      if (!Unique) {
-        continue;
-      }
+    if (auto [It, Inserted] = UniqueTypes.try_emplace(FuncType.getTypeId(), I);
+        !Inserted) {
+      const size_t J = It->second;
+      Context->FunctionTypes.push_back(Context->FunctionTypes[J]);
+      Context->FunctionWrappers.push_back(Context->FunctionWrappers[J]);
+      Types.push_back(Types[J]);
+      continue;
     }
 
     /// Create Wrapper
@@ -3693,7 +5763,10 @@ void Compiler::compile(const AST::TypeSection &TypeSection) {
         WrapperTy, llvm::Function::InternalLinkage,
         "t" + std::to_string(Context->FunctionTypes.size()), Context->LLModule);
     {
-      F->addFnAttr(llvm::Attribute::StrictFP);
+      if (Context->StrictFP) {
+        F->addFnAttr(llvm::Attribute::StrictFP);
+      }
+      F->addFnAttr(llvm::Attribute::UWTable);
       F->addParamAttr(0, llvm::Attribute::AttrKind::ReadOnly);
       F->addParamAttr(0, llvm::Attribute::AttrKind::NoAlias);
       F->addParamAttr(1, llvm::Attribute::AttrKind::NoAlias);
@@ -3702,7 +5775,9 @@ void Compiler::compile(const AST::TypeSection &TypeSection) {
 
       llvm::IRBuilder<> Builder(
           llvm::BasicBlock::Create(F->getContext(), "entry", F));
-      setIsFPConstrained(Builder);
+      if (Context->StrictFP) {
+        setIsFPConstrained(Builder);
+      }
       auto *FTy = toLLVMType(Context->ExecCtxPtrTy, FuncType);
       auto *RTy = FTy->getReturnType();
       const size_t ArgCount = FTy->getNumParams() - 1;
@@ -3780,18 +5855,57 @@ void Compiler::compile(const AST::ImportSection &ImportSec) {
       auto *F = llvm::Function::Create(FTy, llvm::Function::InternalLinkage,
                                        "f" + std::to_string(FuncID),
                                        Context->LLModule);
-      F->addFnAttr(llvm::Attribute::StrictFP);
+      if (Context->StrictFP) {
+        F->addFnAttr(llvm::Attribute::StrictFP);
+      }
+      F->addFnAttr(llvm::Attribute::UWTable);
       F->addParamAttr(0, llvm::Attribute::AttrKind::ReadOnly);
       F->addParamAttr(0, llvm::Attribute::AttrKind::NoAlias);
 
       auto *Entry = llvm::BasicBlock::Create(Context->LLContext, "entry", F);
       llvm::IRBuilder<> Builder(Entry);
-      setIsFPConstrained(Builder);
+      if (Context->StrictFP) {
+        setIsFPConstrained(Builder);
+      }
 
       const auto ArgSize = FuncType.getParamTypes().size();
       const auto RetSize =
           RTy->isVoidTy() ? 0 : FuncType.getReturnTypes().size();
 
+      if (isScalarFunctionType(FuncType)) {
+        /// Call the native thunk of the host function directly if it has one.
+        auto *ExecCtx = Context->createInvariantLoad(Builder, F->arg_begin());
+        auto [EntryPtr, Thunk] = Context->getHostCall(Builder, ExecCtx, FuncID);
+        auto *DirectBB =
+            llvm::BasicBlock::Create(Context->LLContext, "direct", F);
+        auto *SlowBB = llvm::BasicBlock::Create(Context->LLContext, "slow", F);
+        Builder.CreateCondBr(
+            createLikely(Builder, Builder.CreateIsNotNull(Thunk)), DirectBB,
+            SlowBB);
+
+        Builder.SetInsertPoint(DirectBB);
+        std::vector<llvm::Type *> ThunkArgsTy(FTy->param_begin(),
+                                              FTy->param_end());
+        ThunkArgsTy.front() = Context->Int8PtrTy;
+        auto *ThunkTy = llvm::FunctionType::get(RTy, ThunkArgsTy, false);
+        std::vector<llvm::Value *> ThunkArgs;
+        ThunkArgs.reserve(ArgSize + 1);
+        ThunkArgs.push_back(EntryPtr);
+        for (unsigned I = 0; I < ArgSize; ++I) {
+          ThunkArgs.push_back(F->arg_begin() + 1 + I);
+        }
+        auto *Ret = Builder.CreateCall(
+            ThunkTy,
+            Builder.CreateBitCast(Thunk, ThunkTy->getPointerTo()), ThunkArgs);
+        if (RetSize == 0) {
+          Builder.CreateRetVoid();
+        } else {
+          Builder.CreateRet(Ret);
+        }
+
+        Builder.SetInsertPoint(SlowBB);
+      }
+
       llvm::Value *Args;
       if (ArgSize == 0) {
         Args = llvm::ConstantPointerNull::get(Context->Int8PtrTy);
@@ -3859,7 +5973,14 @@ void Compiler::compile(const AST::ImportSection &ImportSec) {
     }
     case ExternalType::Memory: /// Memory type
     {
-      /// Nothing to do.
+      Context->HasMemory = true;
+      Context->SharedMemory =
+          ImpDesc.getExternalMemoryType().getLimit().isShared();
+      break;
+    }
+    case ExternalType::Tag: /// Tag type
+    {
+      Context->addTag(*Context->FunctionTypes[ImpDesc.getExternalTagTypeIdx()]);
       break;
     }
     case ExternalType::Global: /// Global type
@@ -3869,6 +5990,7 @@ void Compiler::compile(const AST::ImportSection &ImportSec) {
       const auto &ValType = GlobType.getValueType();
       auto *Type = toLLVMType(Context->LLContext, ValType)->getPointerTo();
       Context->Globals.push_back(Type);
+      ++Context->ImpGlobalNum;
       break;
     }
     default:
@@ -3894,6 +6016,8 @@ void Compiler::compile(const AST::MemorySection &MemorySection,
   }
   assert(MemorySection.getContent().size() == 1);
   const auto &Limit = MemorySection.getContent().front().getLimit();
+  Context->HasMemory = true;
+  Context->SharedMemory = Limit.isShared();
   Context->MemMin = Limit.getMin();
   Context->MemMax = Limit.hasMax() ? Limit.getMax() : 65536;
 }
@@ -3901,6 +6025,12 @@ void Compiler::compile(const AST::MemorySection &MemorySection,
 void Compiler::compile(const AST::TableSection &TableSection,
                        const AST::ElementSection &ElementSection) {}
 
+void Compiler::compile(const AST::TagSection &TagSection) {
+  for (const auto &TypeIdx : TagSection.getContent()) {
+    Context->addTag(*Context->FunctionTypes[TypeIdx]);
+  }
+}
+
 void Compiler::compile(const AST::FunctionSection &FuncSec,
                        const AST::CodeSection &CodeSec) {
   const auto &TypeIdxs = FuncSec.getContent();
@@ -3922,9 +6052,14 @@ void Compiler::compile(const AST::FunctionSection &FuncSec,
     auto *F =
         llvm::Function::Create(FTy, llvm::Function::InternalLinkage,
                                "f" + std::to_string(FuncID), Context->LLModule);
-    F->addFnAttr(llvm::Attribute::StrictFP);
+    if (Context->StrictFP) {
+      F->addFnAttr(llvm::Attribute::StrictFP);
+    }
+    /// Unwind tables let exceptions pass through compiled functions.
+    F->addFnAttr(llvm::Attribute::UWTable);
     F->addParamAttr(0, llvm::Attribute::AttrKind::ReadOnly);
     F->addParamAttr(0, llvm::Attribute::AttrKind::NoAlias);
+    F->setSubprogram(Context->createDebugFunction(FuncID, F->getName()));
 
     Context->Functions.emplace_back(TypeIdx, F, &Code);
     Codes.push_back(llvm::ConstantExpr::getBitCast(F, Context->Int8PtrTy));
@@ -3949,7 +6084,7 @@ void Compiler::compile(const AST::FunctionSection &FuncSec,
       }
     }
     FunctionCompiler FC(*Context, F, Locals, InstructionCounting, GasMeasuring,
-                        optNone());
+                        BoundsChecks, optNone());
     auto Type = Context->resolveBlockType(T);
     FC.compile(*Code, std::move(Type));
     llvm::EliminateUnreachableBlocks(*F);
@@ -51,6 +51,30 @@ Expect<void> ImportDesc::loadBinary(FileMgr &Mgr, const Configure &Conf) {
     /// Read the global type node.
     return GlobType.loadBinary(Mgr, Conf);
   }
+  case ExternalType::Tag: {
+    /// This import type is for ExceptionHandling proposal.
+    if (!Conf.hasProposal(Proposal::ExceptionHandling)) {
+      return logNeedProposal(ErrCode::InvalidGrammar,
+                             Proposal::ExceptionHandling, Mgr.getOffset() - 1,
+                             NodeAttr);
+    }
+    /// Read the tag attribute, which should be 0 for exceptions.
+    if (auto Res = Mgr.readByte()) {
+      if (*Res != 0x00U) {
+        return logLoadError(ErrCode::InvalidGrammar, Mgr.getOffset() - 1,
+                            NodeAttr);
+      }
+    } else {
+      return logLoadError(Res.error(), Mgr.getOffset(), NodeAttr);
+    }
+    /// Read the function type index of the tag.
+    if (auto Res = Mgr.readU32()) {
+      TagTypeIdx = *Res;
+    } else {
+      return logLoadError(Res.error(), Mgr.getOffset(), NodeAttr);
+    }
+    break;
+  }
   default:
     return logLoadError(ErrCode::InvalidGrammar, Mgr.getOffset() - 1, NodeAttr);
   }
@@ -78,6 +102,14 @@ Expect<void> ExportDesc::loadBinary(FileMgr &Mgr, const Configure &Conf) {
   case ExternalType::Memory:
   case ExternalType::Global:
     break;
+  case ExternalType::Tag:
+    /// This export type is for ExceptionHandling proposal.
+    if (!Conf.hasProposal(Proposal::ExceptionHandling)) {
+      return logNeedProposal(ErrCode::InvalidGrammar,
+                             Proposal::ExceptionHandling, Mgr.getOffset() - 1,
+                             NodeAttr);
+    }
+    break;
   default:
     return logLoadError(ErrCode::InvalidGrammar, Mgr.getOffset() - 1, NodeAttr);
   }
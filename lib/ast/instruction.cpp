@@ -27,13 +27,36 @@ Expect<void> checkInstrProposals(OpCode Code, const Configure &Conf,
       return logNeedProposal(ErrCode::InvalidOpCode, Proposal::ReferenceTypes,
                              Offset, ASTNodeAttr::Instruction);
     }
-  } else if (Code >= OpCode::V128__load &&
-             Code <= OpCode::F64x2__convert_i64x2_u) {
+  } else if ((Code >= OpCode::Try && Code <= OpCode::Rethrow) ||
+             Code == OpCode::Delegate || Code == OpCode::Catch_all) {
+    /// These instructions are for ExceptionHandling proposal.
+    if (!Conf.hasProposal(Proposal::ExceptionHandling)) {
+      return logNeedProposal(ErrCode::InvalidOpCode,
+                             Proposal::ExceptionHandling, Offset,
+                             ASTNodeAttr::Instruction);
+    }
+  } else if ((Code >= OpCode::V128__load && Code <= OpCode::F64x2__qfms) ||
+             (Code >= OpCode::I64x2__trunc_sat_f64x2_s &&
+              Code <= OpCode::F64x2__convert_i64x2_u)) {
     /// These instructions are for SIMD proposal.
     if (!Conf.hasProposal(Proposal::SIMD)) {
       return logNeedProposal(ErrCode::InvalidOpCode, Proposal::SIMD, Offset,
                              ASTNodeAttr::Instruction);
     }
+  } else if (Code >= OpCode::I8x16__relaxed_swizzle &&
+             Code <= OpCode::I32x4__relaxed_dot_i8x16_i7x16_add_s) {
+    /// These instructions are for RelaxedSIMD proposal, which builds on SIMD.
+    if (!Conf.hasProposal(Proposal::SIMD)) {
+      return logNeedProposal(ErrCode::InvalidOpCode, Proposal::SIMD, Offset,
+                             ASTNodeAttr::Instruction);
+    }
+  } else if (Code >= OpCode::Memory__atomic__notify &&
+             Code <= OpCode::I64__atomic__rmw32__cmpxchg_u) {
+    /// These instructions are for Threads proposal.
+    if (!Conf.hasProposal(Proposal::Threads)) {
+      return logNeedProposal(ErrCode::InvalidOpCode, Proposal::Threads, Offset,
+                             ASTNodeAttr::Instruction);
+    }
   }
   return {};
 }
@@ -73,11 +96,13 @@ Expect<void> Instruction::loadBinary(FileMgr &Mgr, const Configure &Conf) {
   case OpCode::Return:
   case OpCode::End:
   case OpCode::Else:
+  case OpCode::Catch_all:
     return {};
 
   case OpCode::Block:
   case OpCode::Loop:
   case OpCode::If:
+  case OpCode::Try:
     /// Read the block return type.
     if (auto Res = Mgr.readS32()) {
       if (*Res < 0) {
@@ -126,6 +151,16 @@ Expect<void> Instruction::loadBinary(FileMgr &Mgr, const Configure &Conf) {
   case OpCode::Call:
     return readU32(TargetIdx);
 
+  /// Exception handling instructions.
+  case OpCode::Catch:
+  case OpCode::Throw:
+    /// Read the tag index.
+    return readU32(TargetIdx);
+  case OpCode::Rethrow:
+  case OpCode::Delegate:
+    /// Read the label index.
+    return readU32(TargetIdx);
+
   case OpCode::Call_indirect:
     /// Read function index.
     if (auto Res = readU32(TargetIdx); !Res) {
@@ -244,6 +279,72 @@ Expect<void> Instruction::loadBinary(FileMgr &Mgr, const Configure &Conf) {
   case OpCode::I64__store8:
   case OpCode::I64__store16:
   case OpCode::I64__store32:
+  case OpCode::Memory__atomic__notify:
+  case OpCode::Memory__atomic__wait32:
+  case OpCode::Memory__atomic__wait64:
+  case OpCode::I32__atomic__load:
+  case OpCode::I64__atomic__load:
+  case OpCode::I32__atomic__load8_u:
+  case OpCode::I32__atomic__load16_u:
+  case OpCode::I64__atomic__load8_u:
+  case OpCode::I64__atomic__load16_u:
+  case OpCode::I64__atomic__load32_u:
+  case OpCode::I32__atomic__store:
+  case OpCode::I64__atomic__store:
+  case OpCode::I32__atomic__store8:
+  case OpCode::I32__atomic__store16:
+  case OpCode::I64__atomic__store8:
+  case OpCode::I64__atomic__store16:
+  case OpCode::I64__atomic__store32:
+  case OpCode::I32__atomic__rmw__add:
+  case OpCode::I64__atomic__rmw__add:
+  case OpCode::I32__atomic__rmw8__add_u:
+  case OpCode::I32__atomic__rmw16__add_u:
+  case OpCode::I64__atomic__rmw8__add_u:
+  case OpCode::I64__atomic__rmw16__add_u:
+  case OpCode::I64__atomic__rmw32__add_u:
+  case OpCode::I32__atomic__rmw__sub:
+  case OpCode::I64__atomic__rmw__sub:
+  case OpCode::I32__atomic__rmw8__sub_u:
+  case OpCode::I32__atomic__rmw16__sub_u:
+  case OpCode::I64__atomic__rmw8__sub_u:
+  case OpCode::I64__atomic__rmw16__sub_u:
+  case OpCode::I64__atomic__rmw32__sub_u:
+  case OpCode::I32__atomic__rmw__and:
+  case OpCode::I64__atomic__rmw__and:
+  case OpCode::I32__atomic__rmw8__and_u:
+  case OpCode::I32__atomic__rmw16__and_u:
+  case OpCode::I64__atomic__rmw8__and_u:
+  case OpCode::I64__atomic__rmw16__and_u:
+  case OpCode::I64__atomic__rmw32__and_u:
+  case OpCode::I32__atomic__rmw__or:
+  case OpCode::I64__atomic__rmw__or:
+  case OpCode::I32__atomic__rmw8__or_u:
+  case OpCode::I32__atomic__rmw16__or_u:
+  case OpCode::I64__atomic__rmw8__or_u:
+  case OpCode::I64__atomic__rmw16__or_u:
+  case OpCode::I64__atomic__rmw32__or_u:
+  case OpCode::I32__atomic__rmw__xor:
+  case OpCode::I64__atomic__rmw__xor:
+  case OpCode::I32__atomic__rmw8__xor_u:
+  case OpCode::I32__atomic__rmw16__xor_u:
+  case OpCode::I64__atomic__rmw8__xor_u:
+  case OpCode::I64__atomic__rmw16__xor_u:
+  case OpCode::I64__atomic__rmw32__xor_u:
+  case OpCode::I32__atomic__rmw__xchg:
+  case OpCode::I64__atomic__rmw__xchg:
+  case OpCode::I32__atomic__rmw8__xchg_u:
+  case OpCode::I32__atomic__rmw16__xchg_u:
+  case OpCode::I64__atomic__rmw8__xchg_u:
+  case OpCode::I64__atomic__rmw16__xchg_u:
+  case OpCode::I64__atomic__rmw32__xchg_u:
+  case OpCode::I32__atomic__rmw__cmpxchg:
+  case OpCode::I64__atomic__rmw__cmpxchg:
+  case OpCode::I32__atomic__rmw8__cmpxchg_u:
+  case OpCode::I32__atomic__rmw16__cmpxchg_u:
+  case OpCode::I64__atomic__rmw8__cmpxchg_u:
+  case OpCode::I64__atomic__rmw16__cmpxchg_u:
+  case OpCode::I64__atomic__rmw32__cmpxchg_u:
     /// Read memory arguments.
     if (auto Res = readU32(MemAlign); !Res) {
       return Unexpect(Res);
@@ -258,6 +359,7 @@ Expect<void> Instruction::loadBinary(FileMgr &Mgr, const Configure &Conf) {
   case OpCode::Memory__grow:
   case OpCode::Memory__size:
   case OpCode::Memory__fill:
+  case OpCode::Atomic__fence:
     return readCheck(0x00);
   case OpCode::Memory__init:
     if (auto Res = readU32(SourceIdx); !Res) {
@@ -695,6 +797,27 @@ Expect<void> Instruction::loadBinary(FileMgr &Mgr, const Configure &Conf) {
   case OpCode::I64x2__trunc_sat_f64x2_u:
   case OpCode::F64x2__convert_i64x2_s:
   case OpCode::F64x2__convert_i64x2_u:
+
+  case OpCode::I8x16__relaxed_swizzle:
+  case OpCode::I32x4__relaxed_trunc_f32x4_s:
+  case OpCode::I32x4__relaxed_trunc_f32x4_u:
+  case OpCode::I32x4__relaxed_trunc_f64x2_s_zero:
+  case OpCode::I32x4__relaxed_trunc_f64x2_u_zero:
+  case OpCode::F32x4__relaxed_madd:
+  case OpCode::F32x4__relaxed_nmadd:
+  case OpCode::F64x2__relaxed_madd:
+  case OpCode::F64x2__relaxed_nmadd:
+  case OpCode::I8x16__relaxed_laneselect:
+  case OpCode::I16x8__relaxed_laneselect:
+  case OpCode::I32x4__relaxed_laneselect:
+  case OpCode::I64x2__relaxed_laneselect:
+  case OpCode::F32x4__relaxed_min:
+  case OpCode::F32x4__relaxed_max:
+  case OpCode::F64x2__relaxed_min:
+  case OpCode::F64x2__relaxed_max:
+  case OpCode::I16x8__relaxed_q15mulr_s:
+  case OpCode::I16x8__relaxed_dot_i8x16_i7x16_s:
+  case OpCode::I32x4__relaxed_dot_i8x16_i7x16_add_s:
     return {};
 
   default:
@@ -704,7 +827,7 @@ Expect<void> Instruction::loadBinary(FileMgr &Mgr, const Configure &Conf) {
 }
 
 /// OpCode loader. See "include/ast/instruction.h".
-Expect<OpCode> loadOpCode(FileMgr &Mgr) {
+Expect<OpCode> loadOpCode(FileMgr &Mgr, const Configure &Conf) {
   uint16_t Payload;
   if (auto B1 = Mgr.readByte()) {
     Payload = (*B1);
@@ -712,9 +835,23 @@ Expect<OpCode> loadOpCode(FileMgr &Mgr) {
     return logLoadError(B1.error(), Mgr.getOffset(), ASTNodeAttr::Instruction);
   }
 
-  if (Payload == 0xFCU || Payload == 0xFDU) {
+  if (Payload == 0xFCU || Payload == 0xFDU || Payload == 0xFEU) {
     /// 2-bytes OpCode case.
     if (auto B2 = Mgr.readU32()) {
+      if (Payload == 0xFDU && *B2 >= 0x100U && *B2 <= 0x113U &&
+          Conf.hasProposal(Proposal::RelaxedSIMD)) {
+        /// Relaxed SIMD instructions take the encodings of the non-standard
+        /// ones.
+        return static_cast<OpCode>(0xFF00U + (*B2 - 0x100U));
+      }
+      if (Payload == 0xFDU && *B2 >= 0x100U && *B2 <= 0x103U) {
+        /// Non-standard SIMD instructions from 0xFD 0x100.
+        return static_cast<OpCode>(0xFF80U + (*B2 - 0x100U));
+      }
+      if (*B2 > 0xFFU) {
+        return logLoadError(ErrCode::InvalidGrammar, Mgr.getOffset() - 1,
+                            ASTNodeAttr::Instruction);
+      }
       Payload <<= 8;
       Payload += (*B2);
     } else {
@@ -735,7 +872,7 @@ Expect<InstrVec> loadInstrSeq(FileMgr &Mgr, const Configure &Conf) {
   do {
     /// Read the opcode and check if error.
     uint32_t Offset = Mgr.getOffset();
-    if (auto Res = loadOpCode(Mgr)) {
+    if (auto Res = loadOpCode(Mgr, Conf)) {
       Code = *Res;
     } else {
       return Unexpect(Res);
@@ -747,8 +884,33 @@ Expect<InstrVec> loadInstrSeq(FileMgr &Mgr, const Configure &Conf) {
     }
 
     /// Process the instructions which contain a block.
-    if (Code == OpCode::Block || Code == OpCode::Loop || Code == OpCode::If) {
+    if (Code == OpCode::Block || Code == OpCode::Loop || Code == OpCode::If ||
+        Code == OpCode::Try) {
       BlockStack.push_back(std::make_pair(Code, Cnt));
+    } else if (Code == OpCode::Catch || Code == OpCode::Catch_all) {
+      if (BlockStack.size() == 0 || BlockStack.back().first != OpCode::Try) {
+        return logLoadError(ErrCode::InvalidGrammar, Mgr.getOffset() - 1,
+                            ASTNodeAttr::Instruction);
+      }
+      uint32_t Pos = BlockStack.back().second;
+      auto CatchList = Instrs[Pos].getLabelList();
+      if (CatchList.size() > 0 &&
+          Instrs[Pos + CatchList.back()].getOpCode() == OpCode::Catch_all) {
+        /// No more catch clauses after the Catch_all instruction.
+        return logLoadError(ErrCode::InvalidGrammar, Mgr.getOffset() - 1,
+                            ASTNodeAttr::Instruction);
+      }
+      Instrs[Pos].addJumpCatch(Cnt - Pos);
+    } else if (Code == OpCode::Delegate) {
+      if (BlockStack.size() == 0 || BlockStack.back().first != OpCode::Try ||
+          Instrs[BlockStack.back().second].getLabelList().size() > 0) {
+        /// Delegate can only end a Try block without catch clauses.
+        return logLoadError(ErrCode::InvalidGrammar, Mgr.getOffset() - 1,
+                            ASTNodeAttr::Instruction);
+      }
+      uint32_t Pos = BlockStack.back().second;
+      Instrs[Pos].setJumpEnd(Cnt - Pos);
+      BlockStack.pop_back();
     } else if (Code == OpCode::Else) {
       if (BlockStack.size() == 0 || BlockStack.back().first != OpCode::If) {
         return logLoadError(ErrCode::InvalidGrammar, Mgr.getOffset() - 1,
@@ -2,6 +2,8 @@
 #include "ast/module.h"
 #include "common/log.h"
 
+#include <string>
+
 namespace SSVM {
 namespace AST {
 
@@ -138,6 +140,18 @@ Expect<void> Module::loadBinary(FileMgr &Mgr, const Configure &Conf) {
         return Unexpect(Res);
       }
       break;
+    case 0x0D:
+      /// This section is for ExceptionHandling proposal.
+      if (!Conf.hasProposal(Proposal::ExceptionHandling)) {
+        return logNeedProposal(ErrCode::InvalidGrammar,
+                               Proposal::ExceptionHandling,
+                               Mgr.getOffset() - 1, NodeAttr);
+      }
+      if (auto Res = TagSec.loadBinary(Mgr, Conf); !Res) {
+        LOG(ERROR) << ErrInfo::InfoAST(NodeAttr);
+        return Unexpect(Res);
+      }
+      break;
     default:
       return logLoadError(ErrCode::InvalidGrammar, Mgr.getOffset() - 1,
                           NodeAttr);
@@ -157,17 +171,27 @@ Expect<void> Module::loadBinary(FileMgr &Mgr, const Configure &Conf) {
 
 /// Load compiled function from loadable manager. See "include/ast/module.h".
 Expect<void> Module::loadCompiled(LDMgr &Mgr) {
-  if (auto Symbol = Mgr.getSymbol<FunctionType::Wrapper *[]>("types")) {
+  std::string TypesName = "types", CodesName = "codes";
+  if (auto Variant = Mgr.getVariant(); !Variant) {
+    return Unexpect(Variant);
+  } else if (*Variant) {
+    TypesName += "." + std::to_string(**Variant);
+    CodesName += "." + std::to_string(**Variant);
+  }
+  if (auto Symbol =
+          Mgr.getSymbol<FunctionType::Wrapper *[]>(TypesName.c_str())) {
     auto &FuncTypes = TypeSec.getContent();
     for (size_t I = 0; I < FuncTypes.size(); ++I) {
       FuncTypes[I].setSymbol(Symbol.index(I).deref());
     }
   }
-  if (auto Symbol = Mgr.getSymbol<void *[]>("codes")) {
+  if (auto Symbol = Mgr.getSymbol<void *[]>(CodesName.c_str())) {
     auto &CodeSegs = CodeSec.getContent();
     for (size_t I = 0; I < CodeSegs.size(); ++I) {
       CodeSegs[I].setSymbol(Symbol.index(I).deref());
     }
+    BoundsChecks = static_cast<bool>(Mgr.getSymbol<uint32_t>("bounds_checks"));
+    GuardPages = !BoundsChecks;
   }
   return {};
 }
@@ -123,5 +123,35 @@ Expect<void> DataCountSection::loadContent(FileMgr &Mgr,
   return {};
 }
 
+/// Load vector of tag section. See "include/ast/section.h".
+Expect<void> TagSection::loadContent(FileMgr &Mgr, const Configure &Conf) {
+  uint32_t VecCnt = 0;
+  /// Read vector count.
+  if (auto Res = Mgr.readU32()) {
+    VecCnt = *Res;
+    Content.reserve(Content.size() + VecCnt);
+  } else {
+    return logLoadError(Res.error(), Mgr.getOffset(), NodeAttr);
+  }
+  for (uint32_t i = 0; i < VecCnt; ++i) {
+    /// Read the tag attribute. Only the exception attribute 0 is defined.
+    if (auto Res = Mgr.readByte()) {
+      if (*Res != 0x00U) {
+        return logLoadError(ErrCode::InvalidGrammar, Mgr.getOffset() - 1,
+                            NodeAttr);
+      }
+    } else {
+      return logLoadError(Res.error(), Mgr.getOffset(), NodeAttr);
+    }
+    /// Read the function type index.
+    if (auto Res = Mgr.readU32()) {
+      Content.push_back(*Res);
+    } else {
+      return logLoadError(Res.error(), Mgr.getOffset(), NodeAttr);
+    }
+  }
+  return {};
+}
+
 } // namespace AST
 } // namespace SSVM
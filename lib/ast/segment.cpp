@@ -212,6 +212,8 @@ Expect<void> CodeSegment::loadBinary(FileMgr &Mgr, const Configure &Conf) {
   }
 
   /// Read the vector of local variable counts and types.
+  auto NewBody = std::make_shared<FunctionBody>();
+  auto &Locals = NewBody->Locals;
   uint32_t VecCnt = 0;
   if (auto Res = Mgr.readU32()) {
     VecCnt = *Res;
@@ -240,11 +242,15 @@ Expect<void> CodeSegment::loadBinary(FileMgr &Mgr, const Configure &Conf) {
     Locals.push_back(std::make_pair(LocalCnt, LocalType));
   }
 
-  /// Read function body.
-  if (auto Res = Segment::loadExpression(Mgr, Conf); !Res) {
+  /// Read function body into the shared storage.
+  if (auto Res = loadInstrSeq(Mgr, Conf)) {
+    NewBody->Instrs = std::move(*Res);
+  } else {
+    LOG(ERROR) << ErrInfo::InfoAST(ASTNodeAttr::Expression);
     LOG(ERROR) << ErrInfo::InfoAST(NodeAttr);
     return Unexpect(Res);
   }
+  Body = std::move(NewBody);
 
   return {};
 }
@@ -15,6 +15,12 @@ Expect<void> Limit::loadBinary(FileMgr &Mgr, const Configure &Conf) {
     case LimitType::HasMin:
     case LimitType::HasMinMax:
       break;
+    case LimitType::SharedMinMax:
+      if (!Conf.hasProposal(Proposal::Threads)) {
+        return logNeedProposal(ErrCode::InvalidGrammar, Proposal::Threads,
+                               Mgr.getOffset() - 1, NodeAttr);
+      }
+      break;
     default:
       return logLoadError(ErrCode::InvalidGrammar, Mgr.getOffset() - 1,
                           NodeAttr);
@@ -29,7 +35,7 @@ Expect<void> Limit::loadBinary(FileMgr &Mgr, const Configure &Conf) {
   } else {
     return logLoadError(Res.error(), Mgr.getOffset(), NodeAttr);
   }
-  if (Type == LimitType::HasMinMax) {
+  if (hasMax()) {
     if (auto Res = Mgr.readU32()) {
       Max = *Res;
     } else {
@@ -94,6 +100,7 @@ Expect<void> FunctionType::loadBinary(FileMgr &Mgr, const Configure &Conf) {
       return logLoadError(Res.error(), Mgr.getOffset(), NodeAttr);
     }
   }
+  TypeId = internFuncType(ParamTypes, ReturnTypes);
   return {};
 }
 
@@ -117,8 +124,14 @@ Expect<void> TableType::loadBinary(FileMgr &Mgr, const Configure &Conf) {
     return logLoadError(Res.error(), Mgr.getOffset(), NodeAttr);
   }
 
-  /// Read limit.
-  return TableLim.loadBinary(Mgr, Conf);
+  /// Read limit. Tables can not be shared.
+  if (auto Res = TableLim.loadBinary(Mgr, Conf); !Res) {
+    return Unexpect(Res);
+  }
+  if (TableLim.isShared()) {
+    return logLoadError(ErrCode::InvalidGrammar, Mgr.getOffset(), NodeAttr);
+  }
+  return {};
 }
 
 /// Load binary to construct GlobalType node. See "include/ast/type.h".
@@ -10,6 +10,7 @@ const std::unordered_map<Proposal, std::string_view> ProposalStr = {
     {Proposal::FunctionReferences, "function-references"sv},
     {Proposal::Memory64, "memory64"sv},
     {Proposal::ReferenceTypes, "reference-types"sv},
+    {Proposal::RelaxedSIMD, "relaxed-simd"sv},
     {Proposal::SIMD, "simd"sv},
     {Proposal::TailCall, "tail-call"sv},
     {Proposal::Threads, "threads"sv}};
@@ -0,0 +1,33 @@
+// SPDX-License-Identifier: Apache-2.0
+#include "common/functype.h"
+
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+namespace SSVM {
+
+uint32_t internFuncType(Span<const ValType> Params,
+                        Span<const ValType> Returns) {
+  static std::mutex Mutex;
+  static std::unordered_map<std::string, uint32_t> TypeIds = {{"\x40", 0}};
+
+  /// Params and returns are separated by `ValType::None`, which never occurs
+  /// in a value type list.
+  std::string Key;
+  Key.reserve(Params.size() + Returns.size() + 1);
+  for (const auto &Type : Params) {
+    Key.push_back(static_cast<char>(Type));
+  }
+  Key.push_back(static_cast<char>(ValType::None));
+  for (const auto &Type : Returns) {
+    Key.push_back(static_cast<char>(Type));
+  }
+
+  std::unique_lock Lock(Mutex);
+  const auto [It, Inserted] =
+      TypeIds.try_emplace(std::move(Key), uint32_t(TypeIds.size()));
+  return It->second;
+}
+
+} // namespace SSVM
@@ -0,0 +1,62 @@
+// SPDX-License-Identifier: Apache-2.0
+#include "host/wasi_threads/threadsenv.h"
+
+#include <system_error>
+
+namespace SSVM {
+namespace Host {
+
+Expect<uint32_t> WasiThreadsEnvironment::spawn(const uint32_t StartArg) {
+  if (!ThreadRunner) {
+    return Unexpect(ErrCode::ExecutionFailed);
+  }
+  std::promise<bool> Ready;
+  auto IsReady = Ready.get_future();
+  uint32_t Tid;
+  {
+    std::unique_lock Lock(Mutex);
+    /// Thread ids are positive 29-bit integers.
+    if (NextTid >= (UINT32_C(1) << 29)) {
+      return Unexpect(ErrCode::ExecutionFailed);
+    }
+    Tid = NextTid++;
+    try {
+      /// Errors of the thread are logged by its runner.
+      Threads.emplace_back(
+          [this, Tid, StartArg, Ready = std::move(Ready)]() mutable {
+            ThreadRunner(Tid, StartArg, Ready);
+          });
+    } catch (const std::system_error &) {
+      return Unexpect(ErrCode::ExecutionFailed);
+    }
+  }
+  /// Setting up the thread may spawn more threads, so wait without the lock.
+  try {
+    if (!IsReady.get()) {
+      return Unexpect(ErrCode::ExecutionFailed);
+    }
+  } catch (const std::future_error &) {
+    return Unexpect(ErrCode::ExecutionFailed);
+  }
+  return Tid;
+}
+
+void WasiThreadsEnvironment::joinAll() noexcept {
+  /// Spawned threads may spawn more threads while joining.
+  while (true) {
+    std::vector<std::thread> Joining;
+    {
+      std::unique_lock Lock(Mutex);
+      Joining.swap(Threads);
+    }
+    if (Joining.empty()) {
+      break;
+    }
+    for (auto &Thread : Joining) {
+      Thread.join();
+    }
+  }
+}
+
+} // namespace Host
+} // namespace SSVM
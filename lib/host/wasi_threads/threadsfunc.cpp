@@ -0,0 +1,21 @@
+// SPDX-License-Identifier: Apache-2.0
+#include "host/wasi_threads/threadsfunc.h"
+
+namespace SSVM {
+namespace Host {
+
+Expect<int32_t>
+WasiThreadSpawn::body(Runtime::Instance::MemoryInstance *MemInst,
+                      uint32_t StartArg) {
+  /// Spawned threads share the memory, which must be shared.
+  if (MemInst == nullptr || !MemInst->isShared()) {
+    return -1;
+  }
+  if (auto Res = Env.spawn(StartArg)) {
+    return static_cast<int32_t>(*Res);
+  }
+  return -1;
+}
+
+} // namespace Host
+} // namespace SSVM
@@ -0,0 +1,15 @@
+// SPDX-License-Identifier: Apache-2.0
+#include "host/wasi_threads/threadsmodule.h"
+#include "host/wasi_threads/threadsfunc.h"
+
+#include <memory>
+
+namespace SSVM {
+namespace Host {
+
+WasiThreadsModule::WasiThreadsModule() : ImportObject("wasi") {
+  addHostFunc("thread-spawn", std::make_unique<WasiThreadSpawn>(Env));
+}
+
+} // namespace Host
+} // namespace SSVM
@@ -15,8 +15,7 @@ Expect<void> Interpreter::runBlockOp(Runtime::StoreManager &StoreMgr,
   AST::InstrView::iterator Cont = PC + Instr.getJumpEnd();
 
   /// Create Label{ nothing } and push.
-  StackMgr.pushLabel(BlockSig.first, BlockSig.second, Cont);
-  return {};
+  return StackMgr.pushLabel(BlockSig.first, BlockSig.second, Cont);
 }
 
 Expect<void> Interpreter::runLoopOp(Runtime::StoreManager &StoreMgr,
@@ -27,8 +26,7 @@ Expect<void> Interpreter::runLoopOp(Runtime::StoreManager &StoreMgr,
   AST::InstrView::iterator Cont = PC + Instr.getJumpEnd();
 
   /// Create Label{ loop-instruction } and push.
-  StackMgr.pushLabel(BlockSig.first, BlockSig.first, Cont, PC);
-  return {};
+  return StackMgr.pushLabel(BlockSig.first, BlockSig.first, Cont, PC);
 }
 
 Expect<void> Interpreter::runIfElseOp(Runtime::StoreManager &StoreMgr,
@@ -57,8 +55,7 @@ Expect<void> Interpreter::runIfElseOp(Runtime::StoreManager &StoreMgr,
       PC += Instr.getJumpElse();
     }
   }
-  StackMgr.pushLabel(BlockSig.first, BlockSig.second, Cont);
-  return {};
+  return StackMgr.pushLabel(BlockSig.first, BlockSig.second, Cont);
 }
 
 Expect<void> Interpreter::runBrOp(Runtime::StoreManager &StoreMgr,
@@ -90,9 +87,11 @@ Expect<void> Interpreter::runBrTableOp(Runtime::StoreManager &StoreMgr,
   return branchToLabel(StoreMgr, Instr.getTargetIndex(), PC);
 }
 
-Expect<void> Interpreter::runReturnOp(AST::InstrView::iterator &PC) {
+Expect<void> Interpreter::runReturnOp(Runtime::StoreManager &StoreMgr,
+                                      AST::InstrView::iterator &PC) {
   PC = StackMgr.getBottomLabel().From;
   StackMgr.popFrame();
+  updateFrameCache(StoreMgr);
   return {};
 }
 
@@ -100,9 +99,9 @@ Expect<void> Interpreter::runCallOp(Runtime::StoreManager &StoreMgr,
                                     const AST::Instruction &Instr,
                                     AST::InstrView::iterator &PC) {
   /// Get Function address.
-  const auto *ModInst = *StoreMgr.getModule(StackMgr.getModuleAddr());
-  const uint32_t FuncAddr = *ModInst->getFuncAddr(Instr.getTargetIndex());
-  const auto *FuncInst = *StoreMgr.getFunction(FuncAddr);
+  const uint32_t FuncAddr =
+      FrameCache.ModInst->unsafeGetFuncAddr(Instr.getTargetIndex());
+  const auto *FuncInst = StoreMgr.unsafeGetFunction(FuncAddr);
   if (auto Res = enterFunction(StoreMgr, *FuncInst, PC); !Res) {
     return Unexpect(Res);
   } else {
@@ -118,8 +117,8 @@ Expect<void> Interpreter::runCallIndirectOp(Runtime::StoreManager &StoreMgr,
   const auto *TabInst = getTabInstByIdx(StoreMgr, Instr.getSourceIndex());
 
   /// Get function type at index x.
-  const auto *ModInst = *StoreMgr.getModule(StackMgr.getModuleAddr());
-  const auto *TargetFuncType = *ModInst->getFuncType(Instr.getTargetIndex());
+  const auto *TargetFuncType =
+      &FrameCache.ModInst->unsafeGetFuncType(Instr.getTargetIndex());
 
   /// Pop the value i32.const i from the Stack.
   uint32_t Idx = retrieveValue<uint32_t>(StackMgr.pop());
@@ -146,16 +145,17 @@ Expect<void> Interpreter::runCallIndirectOp(Runtime::StoreManager &StoreMgr,
   FuncAddr = retrieveFuncIdx(Ref);
 
   /// Check function type.
-  const auto *FuncInst = *StoreMgr.getFunction(FuncAddr);
+  const auto *FuncInst = StoreMgr.unsafeGetFunction(FuncAddr);
   const auto &FuncType = FuncInst->getFuncType();
-  if (*TargetFuncType != FuncType) {
+  if (TargetFuncType->getTypeId() != FuncType.getTypeId()) {
     LOG(ERROR) << ErrCode::IndirectCallTypeMismatch;
     LOG(ERROR) << ErrInfo::InfoInstruction(Instr.getOpCode(), Instr.getOffset(),
                                            {Idx},
                                            {ValTypeFromType<uint32_t>()});
-    LOG(ERROR) << ErrInfo::InfoMismatch(TargetFuncType->Params,
-                                        TargetFuncType->Returns,
-                                        FuncType.Params, FuncType.Returns);
+    LOG(ERROR) << ErrInfo::InfoMismatch(TargetFuncType->getParamTypes(),
+                                        TargetFuncType->getReturnTypes(),
+                                        FuncType.getParamTypes(),
+                                        FuncType.getReturnTypes());
     return Unexpect(ErrCode::IndirectCallTypeMismatch);
   }
   if (auto Res = enterFunction(StoreMgr, *FuncInst, PC); !Res) {
@@ -166,5 +166,46 @@ Expect<void> Interpreter::runCallIndirectOp(Runtime::StoreManager &StoreMgr,
   return {};
 }
 
+Expect<void> Interpreter::runTryOp(Runtime::StoreManager &StoreMgr,
+                                   const AST::Instruction &Instr,
+                                   AST::InstrView::iterator &PC) {
+  /// Get result type for arity.
+  auto BlockSig = getBlockArity(StoreMgr, Instr.getBlockType());
+  AST::InstrView::iterator Cont = PC + Instr.getJumpEnd();
+
+  /// Create Label{ nothing } with the handlers of try-instruction and push.
+  return StackMgr.pushLabel(BlockSig.first, BlockSig.second, Cont,
+                            std::nullopt, PC);
+}
+
+Expect<void> Interpreter::runThrowOp(Runtime::StoreManager &StoreMgr,
+                                     const AST::Instruction &Instr) {
+  /// Pop the payload of tag type into the exception.
+  const uint32_t TagAddr =
+      FrameCache.ModInst->unsafeGetTagAddr(Instr.getTargetIndex());
+  const auto &TagType = StoreMgr.unsafeGetTag(TagAddr)->getTagType();
+  auto Args = StackMgr.getTopSpan(TagType.getParamTypes().size());
+  Thrown.emplace(
+      Exception{TagAddr, std::vector<ValVariant>(Args.begin(), Args.end())});
+  for (size_t I = 0; I < Args.size(); ++I) {
+    ValVariant Val [[maybe_unused]] = StackMgr.pop();
+  }
+  return Unexpect(ErrCode::UncaughtException);
+}
+
+Expect<void> Interpreter::runRethrowOp(const AST::Instruction &Instr) {
+  /// Find the exception caught by the handler of the label.
+  const uint32_t LabelIdx =
+      StackMgr.getLabelCount() - 1 - Instr.getTargetIndex();
+  for (auto It = Caught.rbegin(); It != Caught.rend(); ++It) {
+    if (It->first == LabelIdx) {
+      Thrown.emplace(It->second);
+      break;
+    }
+  }
+  assert(Thrown);
+  return Unexpect(ErrCode::UncaughtException);
+}
+
 } // namespace Interpreter
 } // namespace SSVM
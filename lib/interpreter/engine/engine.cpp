@@ -10,7 +10,9 @@ namespace Interpreter {
 
 Expect<void> Interpreter::runExpression(Runtime::StoreManager &StoreMgr,
                                         AST::InstrView Instrs) {
-  StackMgr.pushLabel(0, 0, Instrs.end() - 1);
+  if (auto Res = StackMgr.pushLabel(0, 0, Instrs.end() - 1); unlikely(!Res)) {
+    return Unexpect(Res);
+  }
   return execute(StoreMgr, Instrs.begin(), Instrs.end());
 }
 
@@ -25,7 +27,13 @@ Interpreter::runFunction(Runtime::StoreManager &StoreMgr,
 
   /// Reset and push a dummy frame into stack.
   StackMgr.reset();
-  StackMgr.pushDummyFrame();
+  Thrown.reset();
+  Caught.clear();
+  CompiledCaught.clear();
+  if (auto Res = StackMgr.pushDummyFrame(); unlikely(!Res)) {
+    return Unexpect(Res);
+  }
+  resetFrameCache();
 
   /// Push arguments.
   for (auto &Val : Params) {
@@ -45,6 +53,8 @@ Interpreter::runFunction(Runtime::StoreManager &StoreMgr,
     LOG(DEBUG) << " Execution succeeded.";
   } else if (Res.error() == ErrCode::Terminated) {
     LOG(DEBUG) << " Terminated.";
+  } else if (Res.error() == ErrCode::UncaughtException) {
+    LOG(ERROR) << ErrCode::UncaughtException;
   }
 
   /// Print time cost.
@@ -102,6 +112,18 @@ Expect<void> Interpreter::execute(Runtime::StoreManager &StoreMgr,
       return runLoopOp(StoreMgr, Instr, PC);
     case OpCode::If:
       return runIfElseOp(StoreMgr, Instr, PC);
+    case OpCode::Try:
+      return runTryOp(StoreMgr, Instr, PC);
+    case OpCode::Throw:
+      return runThrowOp(StoreMgr, Instr);
+    case OpCode::Rethrow:
+      return runRethrowOp(Instr);
+    case OpCode::Catch:
+    case OpCode::Catch_all:
+    case OpCode::Delegate:
+      /// Reach here means end of try-statement or catch-statement.
+      PC = StackMgr.leaveLabel();
+      return {};
     case OpCode::Else:
       if (Stat) {
         /// Reach here means end of if-statement.
@@ -114,7 +136,13 @@ Expect<void> Interpreter::execute(Runtime::StoreManager &StoreMgr,
       }
       [[fallthrough]];
     case OpCode::End:
-      PC = StackMgr.leaveLabel();
+      if (StackMgr.getFrameLabelCount() == 1) {
+        /// Leaving the function body pops the frame.
+        PC = StackMgr.leaveLabel();
+        updateFrameCache(StoreMgr);
+      } else {
+        PC = StackMgr.leaveLabel();
+      }
       return {};
     case OpCode::Br:
       return runBrOp(StoreMgr, Instr, PC);
@@ -123,7 +151,7 @@ Expect<void> Interpreter::execute(Runtime::StoreManager &StoreMgr,
     case OpCode::Br_table:
       return runBrTableOp(StoreMgr, Instr, PC);
     case OpCode::Return:
-      return runReturnOp(PC);
+      return runReturnOp(StoreMgr, PC);
     case OpCode::Call:
       return runCallOp(StoreMgr, Instr, PC);
     case OpCode::Call_indirect:
@@ -143,8 +171,8 @@ Expect<void> Interpreter::execute(Runtime::StoreManager &StoreMgr,
       return {};
     }
     case OpCode::Ref__func: {
-      const auto *ModInst = *StoreMgr.getModule(StackMgr.getModuleAddr());
-      const uint32_t FuncAddr = *ModInst->getFuncAddr(Instr.getTargetIndex());
+      const uint32_t FuncAddr =
+          FrameCache.ModInst->unsafeGetFuncAddr(Instr.getTargetIndex());
       StackMgr.push(genFuncRef(FuncAddr));
       return {};
     }
@@ -268,6 +296,206 @@ Expect<void> Interpreter::execute(Runtime::StoreManager &StoreMgr,
     case OpCode::Memory__fill:
       return runMemoryFillOp(*getMemInstByIdx(StoreMgr, 0), Instr);
 
+    /// Atomic memory instructions
+    case OpCode::Memory__atomic__notify:
+      return runAtomicNotifyOp(*getMemInstByIdx(StoreMgr, 0), Instr);
+    case OpCode::Memory__atomic__wait32:
+      return runAtomicWaitOp<uint32_t>(*getMemInstByIdx(StoreMgr, 0), Instr);
+    case OpCode::Memory__atomic__wait64:
+      return runAtomicWaitOp<uint64_t>(*getMemInstByIdx(StoreMgr, 0), Instr);
+    case OpCode::Atomic__fence:
+      __atomic_thread_fence(__ATOMIC_SEQ_CST);
+      return {};
+    case OpCode::I32__atomic__load:
+      return runAtomicLoadOp<uint32_t, uint32_t>(
+          *getMemInstByIdx(StoreMgr, 0), Instr);
+    case OpCode::I64__atomic__load:
+      return runAtomicLoadOp<uint64_t, uint64_t>(
+          *getMemInstByIdx(StoreMgr, 0), Instr);
+    case OpCode::I32__atomic__load8_u:
+      return runAtomicLoadOp<uint32_t, uint8_t>(
+          *getMemInstByIdx(StoreMgr, 0), Instr);
+    case OpCode::I32__atomic__load16_u:
+      return runAtomicLoadOp<uint32_t, uint16_t>(
+          *getMemInstByIdx(StoreMgr, 0), Instr);
+    case OpCode::I64__atomic__load8_u:
+      return runAtomicLoadOp<uint64_t, uint8_t>(
+          *getMemInstByIdx(StoreMgr, 0), Instr);
+    case OpCode::I64__atomic__load16_u:
+      return runAtomicLoadOp<uint64_t, uint16_t>(
+          *getMemInstByIdx(StoreMgr, 0), Instr);
+    case OpCode::I64__atomic__load32_u:
+      return runAtomicLoadOp<uint64_t, uint32_t>(
+          *getMemInstByIdx(StoreMgr, 0), Instr);
+    case OpCode::I32__atomic__store:
+      return runAtomicStoreOp<uint32_t, uint32_t>(
+          *getMemInstByIdx(StoreMgr, 0), Instr);
+    case OpCode::I64__atomic__store:
+      return runAtomicStoreOp<uint64_t, uint64_t>(
+          *getMemInstByIdx(StoreMgr, 0), Instr);
+    case OpCode::I32__atomic__store8:
+      return runAtomicStoreOp<uint32_t, uint8_t>(
+          *getMemInstByIdx(StoreMgr, 0), Instr);
+    case OpCode::I32__atomic__store16:
+      return runAtomicStoreOp<uint32_t, uint16_t>(
+          *getMemInstByIdx(StoreMgr, 0), Instr);
+    case OpCode::I64__atomic__store8:
+      return runAtomicStoreOp<uint64_t, uint8_t>(
+          *getMemInstByIdx(StoreMgr, 0), Instr);
+    case OpCode::I64__atomic__store16:
+      return runAtomicStoreOp<uint64_t, uint16_t>(
+          *getMemInstByIdx(StoreMgr, 0), Instr);
+    case OpCode::I64__atomic__store32:
+      return runAtomicStoreOp<uint64_t, uint32_t>(
+          *getMemInstByIdx(StoreMgr, 0), Instr);
+    case OpCode::I32__atomic__rmw__add:
+      return runAtomicRMWOp<AtomicRMWOp::Add, uint32_t, uint32_t>(
+          *getMemInstByIdx(StoreMgr, 0), Instr);
+    case OpCode::I64__atomic__rmw__add:
+      return runAtomicRMWOp<AtomicRMWOp::Add, uint64_t, uint64_t>(
+          *getMemInstByIdx(StoreMgr, 0), Instr);
+    case OpCode::I32__atomic__rmw8__add_u:
+      return runAtomicRMWOp<AtomicRMWOp::Add, uint32_t, uint8_t>(
+          *getMemInstByIdx(StoreMgr, 0), Instr);
+    case OpCode::I32__atomic__rmw16__add_u:
+      return runAtomicRMWOp<AtomicRMWOp::Add, uint32_t, uint16_t>(
+          *getMemInstByIdx(StoreMgr, 0), Instr);
+    case OpCode::I64__atomic__rmw8__add_u:
+      return runAtomicRMWOp<AtomicRMWOp::Add, uint64_t, uint8_t>(
+          *getMemInstByIdx(StoreMgr, 0), Instr);
+    case OpCode::I64__atomic__rmw16__add_u:
+      return runAtomicRMWOp<AtomicRMWOp::Add, uint64_t, uint16_t>(
+          *getMemInstByIdx(StoreMgr, 0), Instr);
+    case OpCode::I64__atomic__rmw32__add_u:
+      return runAtomicRMWOp<AtomicRMWOp::Add, uint64_t, uint32_t>(
+          *getMemInstByIdx(StoreMgr, 0), Instr);
+    case OpCode::I32__atomic__rmw__sub:
+      return runAtomicRMWOp<AtomicRMWOp::Sub, uint32_t, uint32_t>(
+          *getMemInstByIdx(StoreMgr, 0), Instr);
+    case OpCode::I64__atomic__rmw__sub:
+      return runAtomicRMWOp<AtomicRMWOp::Sub, uint64_t, uint64_t>(
+          *getMemInstByIdx(StoreMgr, 0), Instr);
+    case OpCode::I32__atomic__rmw8__sub_u:
+      return runAtomicRMWOp<AtomicRMWOp::Sub, uint32_t, uint8_t>(
+          *getMemInstByIdx(StoreMgr, 0), Instr);
+    case OpCode::I32__atomic__rmw16__sub_u:
+      return runAtomicRMWOp<AtomicRMWOp::Sub, uint32_t, uint16_t>(
+          *getMemInstByIdx(StoreMgr, 0), Instr);
+    case OpCode::I64__atomic__rmw8__sub_u:
+      return runAtomicRMWOp<AtomicRMWOp::Sub, uint64_t, uint8_t>(
+          *getMemInstByIdx(StoreMgr, 0), Instr);
+    case OpCode::I64__atomic__rmw16__sub_u:
+      return runAtomicRMWOp<AtomicRMWOp::Sub, uint64_t, uint16_t>(
+          *getMemInstByIdx(StoreMgr, 0), Instr);
+    case OpCode::I64__atomic__rmw32__sub_u:
+      return runAtomicRMWOp<AtomicRMWOp::Sub, uint64_t, uint32_t>(
+          *getMemInstByIdx(StoreMgr, 0), Instr);
+    case OpCode::I32__atomic__rmw__and:
+      return runAtomicRMWOp<AtomicRMWOp::And, uint32_t, uint32_t>(
+          *getMemInstByIdx(StoreMgr, 0), Instr);
+    case OpCode::I64__atomic__rmw__and:
+      return runAtomicRMWOp<AtomicRMWOp::And, uint64_t, uint64_t>(
+          *getMemInstByIdx(StoreMgr, 0), Instr);
+    case OpCode::I32__atomic__rmw8__and_u:
+      return runAtomicRMWOp<AtomicRMWOp::And, uint32_t, uint8_t>(
+          *getMemInstByIdx(StoreMgr, 0), Instr);
+    case OpCode::I32__atomic__rmw16__and_u:
+      return runAtomicRMWOp<AtomicRMWOp::And, uint32_t, uint16_t>(
+          *getMemInstByIdx(StoreMgr, 0), Instr);
+    case OpCode::I64__atomic__rmw8__and_u:
+      return runAtomicRMWOp<AtomicRMWOp::And, uint64_t, uint8_t>(
+          *getMemInstByIdx(StoreMgr, 0), Instr);
+    case OpCode::I64__atomic__rmw16__and_u:
+      return runAtomicRMWOp<AtomicRMWOp::And, uint64_t, uint16_t>(
+          *getMemInstByIdx(StoreMgr, 0), Instr);
+    case OpCode::I64__atomic__rmw32__and_u:
+      return runAtomicRMWOp<AtomicRMWOp::And, uint64_t, uint32_t>(
+          *getMemInstByIdx(StoreMgr, 0), Instr);
+    case OpCode::I32__atomic__rmw__or:
+      return runAtomicRMWOp<AtomicRMWOp::Or, uint32_t, uint32_t>(
+          *getMemInstByIdx(StoreMgr, 0), Instr);
+    case OpCode::I64__atomic__rmw__or:
+      return runAtomicRMWOp<AtomicRMWOp::Or, uint64_t, uint64_t>(
+          *getMemInstByIdx(StoreMgr, 0), Instr);
+    case OpCode::I32__atomic__rmw8__or_u:
+      return runAtomicRMWOp<AtomicRMWOp::Or, uint32_t, uint8_t>(
+          *getMemInstByIdx(StoreMgr, 0), Instr);
+    case OpCode::I32__atomic__rmw16__or_u:
+      return runAtomicRMWOp<AtomicRMWOp::Or, uint32_t, uint16_t>(
+          *getMemInstByIdx(StoreMgr, 0), Instr);
+    case OpCode::I64__atomic__rmw8__or_u:
+      return runAtomicRMWOp<AtomicRMWOp::Or, uint64_t, uint8_t>(
+          *getMemInstByIdx(StoreMgr, 0), Instr);
+    case OpCode::I64__atomic__rmw16__or_u:
+      return runAtomicRMWOp<AtomicRMWOp::Or, uint64_t, uint16_t>(
+          *getMemInstByIdx(StoreMgr, 0), Instr);
+    case OpCode::I64__atomic__rmw32__or_u:
+      return runAtomicRMWOp<AtomicRMWOp::Or, uint64_t, uint32_t>(
+          *getMemInstByIdx(StoreMgr, 0), Instr);
+    case OpCode::I32__atomic__rmw__xor:
+      return runAtomicRMWOp<AtomicRMWOp::Xor, uint32_t, uint32_t>(
+          *getMemInstByIdx(StoreMgr, 0), Instr);
+    case OpCode::I64__atomic__rmw__xor:
+      return runAtomicRMWOp<AtomicRMWOp::Xor, uint64_t, uint64_t>(
+          *getMemInstByIdx(StoreMgr, 0), Instr);
+    case OpCode::I32__atomic__rmw8__xor_u:
+      return runAtomicRMWOp<AtomicRMWOp::Xor, uint32_t, uint8_t>(
+          *getMemInstByIdx(StoreMgr, 0), Instr);
+    case OpCode::I32__atomic__rmw16__xor_u:
+      return runAtomicRMWOp<AtomicRMWOp::Xor, uint32_t, uint16_t>(
+          *getMemInstByIdx(StoreMgr, 0), Instr);
+    case OpCode::I64__atomic__rmw8__xor_u:
+      return runAtomicRMWOp<AtomicRMWOp::Xor, uint64_t, uint8_t>(
+          *getMemInstByIdx(StoreMgr, 0), Instr);
+    case OpCode::I64__atomic__rmw16__xor_u:
+      return runAtomicRMWOp<AtomicRMWOp::Xor, uint64_t, uint16_t>(
+          *getMemInstByIdx(StoreMgr, 0), Instr);
+    case OpCode::I64__atomic__rmw32__xor_u:
+      return runAtomicRMWOp<AtomicRMWOp::Xor, uint64_t, uint32_t>(
+          *getMemInstByIdx(StoreMgr, 0), Instr);
+    case OpCode::I32__atomic__rmw__xchg:
+      return runAtomicRMWOp<AtomicRMWOp::Xchg, uint32_t, uint32_t>(
+          *getMemInstByIdx(StoreMgr, 0), Instr);
+    case OpCode::I64__atomic__rmw__xchg:
+      return runAtomicRMWOp<AtomicRMWOp::Xchg, uint64_t, uint64_t>(
+          *getMemInstByIdx(StoreMgr, 0), Instr);
+    case OpCode::I32__atomic__rmw8__xchg_u:
+      return runAtomicRMWOp<AtomicRMWOp::Xchg, uint32_t, uint8_t>(
+          *getMemInstByIdx(StoreMgr, 0), Instr);
+    case OpCode::I32__atomic__rmw16__xchg_u:
+      return runAtomicRMWOp<AtomicRMWOp::Xchg, uint32_t, uint16_t>(
+          *getMemInstByIdx(StoreMgr, 0), Instr);
+    case OpCode::I64__atomic__rmw8__xchg_u:
+      return runAtomicRMWOp<AtomicRMWOp::Xchg, uint64_t, uint8_t>(
+          *getMemInstByIdx(StoreMgr, 0), Instr);
+    case OpCode::I64__atomic__rmw16__xchg_u:
+      return runAtomicRMWOp<AtomicRMWOp::Xchg, uint64_t, uint16_t>(
+          *getMemInstByIdx(StoreMgr, 0), Instr);
+    case OpCode::I64__atomic__rmw32__xchg_u:
+      return runAtomicRMWOp<AtomicRMWOp::Xchg, uint64_t, uint32_t>(
+          *getMemInstByIdx(StoreMgr, 0), Instr);
+    case OpCode::I32__atomic__rmw__cmpxchg:
+      return runAtomicCompareExchangeOp<uint32_t, uint32_t>(
+          *getMemInstByIdx(StoreMgr, 0), Instr);
+    case OpCode::I64__atomic__rmw__cmpxchg:
+      return runAtomicCompareExchangeOp<uint64_t, uint64_t>(
+          *getMemInstByIdx(StoreMgr, 0), Instr);
+    case OpCode::I32__atomic__rmw8__cmpxchg_u:
+      return runAtomicCompareExchangeOp<uint32_t, uint8_t>(
+          *getMemInstByIdx(StoreMgr, 0), Instr);
+    case OpCode::I32__atomic__rmw16__cmpxchg_u:
+      return runAtomicCompareExchangeOp<uint32_t, uint16_t>(
+          *getMemInstByIdx(StoreMgr, 0), Instr);
+    case OpCode::I64__atomic__rmw8__cmpxchg_u:
+      return runAtomicCompareExchangeOp<uint64_t, uint8_t>(
+          *getMemInstByIdx(StoreMgr, 0), Instr);
+    case OpCode::I64__atomic__rmw16__cmpxchg_u:
+      return runAtomicCompareExchangeOp<uint64_t, uint16_t>(
+          *getMemInstByIdx(StoreMgr, 0), Instr);
+    case OpCode::I64__atomic__rmw32__cmpxchg_u:
+      return runAtomicCompareExchangeOp<uint64_t, uint32_t>(
+          *getMemInstByIdx(StoreMgr, 0), Instr);
+
     /// Const numeric instructions
     case OpCode::I32__const:
     case OpCode::I64__const:
@@ -818,7 +1046,8 @@ Expect<void> Interpreter::execute(Runtime::StoreManager &StoreMgr,
     }
 
       /// SIMD Numeric Instructions
-    case OpCode::I8x16__swizzle: {
+    case OpCode::I8x16__swizzle:
+    case OpCode::I8x16__relaxed_swizzle: {
       const ValVariant Val2 = StackMgr.pop();
       ValVariant &Val1 = StackMgr.getTop();
       const uint8x16_t &Index = retrieveValue<uint8x16_t>(Val2);
@@ -1051,7 +1280,11 @@ Expect<void> Interpreter::execute(Runtime::StoreManager &StoreMgr,
       retrieveValue<uint64x2_t>(Val1) ^= retrieveValue<uint64x2_t>(Val2);
       return {};
     }
-    case OpCode::V128__bitselect: {
+    case OpCode::V128__bitselect:
+    case OpCode::I8x16__relaxed_laneselect:
+    case OpCode::I16x8__relaxed_laneselect:
+    case OpCode::I32x4__relaxed_laneselect:
+    case OpCode::I64x2__relaxed_laneselect: {
       const uint64x2_t C = retrieveValue<uint64x2_t>(StackMgr.pop());
       const uint64x2_t Val2 = retrieveValue<uint64x2_t>(StackMgr.pop());
       uint64x2_t &Val1 = retrieveValue<uint64x2_t>(StackMgr.getTop());
@@ -1421,9 +1654,29 @@ Expect<void> Interpreter::execute(Runtime::StoreManager &StoreMgr,
     case OpCode::F32x4__qfma:
     case OpCode::F32x4__qfms:
     case OpCode::F64x2__qfma:
-    case OpCode::F64x2__qfms:
-      /// XXX: Not in testsuite yet
-      return Unexpect(ErrCode::InvalidOpCode);
+    case OpCode::F64x2__qfms: {
+      /// Compute A + B * C or A - B * C, which are the relaxed ones with the
+      /// addend at the bottom.
+      const ValVariant C = StackMgr.pop();
+      ValVariant B = StackMgr.pop();
+      ValVariant &A = StackMgr.getTop();
+      switch (Instr.getOpCode()) {
+      case OpCode::F32x4__qfma:
+        runVectorMAddOp<float>(B, C, A);
+        break;
+      case OpCode::F32x4__qfms:
+        runVectorNMAddOp<float>(B, C, A);
+        break;
+      case OpCode::F64x2__qfma:
+        runVectorMAddOp<double>(B, C, A);
+        break;
+      default:
+        runVectorNMAddOp<double>(B, C, A);
+        break;
+      }
+      A = B;
+      return {};
+    }
     case OpCode::F32x4__ceil:
       return runVectorCeilOp<float>(StackMgr.getTop());
     case OpCode::F32x4__floor:
@@ -1449,6 +1702,89 @@ Expect<void> Interpreter::execute(Runtime::StoreManager &StoreMgr,
     case OpCode::F64x2__convert_i64x2_u:
       return runVectorConvertOp<uint64_t, double>(StackMgr.getTop());
 
+    case OpCode::I32x4__relaxed_trunc_f32x4_s:
+      return runVectorTruncSatOp<float, int32_t>(StackMgr.getTop());
+    case OpCode::I32x4__relaxed_trunc_f32x4_u:
+      return runVectorTruncSatOp<float, uint32_t>(StackMgr.getTop());
+    case OpCode::I32x4__relaxed_trunc_f64x2_s_zero:
+      return runVectorTruncSatZeroOp<int32_t>(StackMgr.getTop());
+    case OpCode::I32x4__relaxed_trunc_f64x2_u_zero:
+      return runVectorTruncSatZeroOp<uint32_t>(StackMgr.getTop());
+    case OpCode::F32x4__relaxed_madd: {
+      const ValVariant C = StackMgr.pop();
+      const ValVariant B = StackMgr.pop();
+      return runVectorMAddOp<float>(StackMgr.getTop(), B, C);
+    }
+    case OpCode::F32x4__relaxed_nmadd: {
+      const ValVariant C = StackMgr.pop();
+      const ValVariant B = StackMgr.pop();
+      return runVectorNMAddOp<float>(StackMgr.getTop(), B, C);
+    }
+    case OpCode::F64x2__relaxed_madd: {
+      const ValVariant C = StackMgr.pop();
+      const ValVariant B = StackMgr.pop();
+      return runVectorMAddOp<double>(StackMgr.getTop(), B, C);
+    }
+    case OpCode::F64x2__relaxed_nmadd: {
+      const ValVariant C = StackMgr.pop();
+      const ValVariant B = StackMgr.pop();
+      return runVectorNMAddOp<double>(StackMgr.getTop(), B, C);
+    }
+    case OpCode::F32x4__relaxed_min: {
+      ValVariant Rhs = StackMgr.pop();
+      return runVectorMinOp<float>(StackMgr.getTop(), Rhs);
+    }
+    case OpCode::F32x4__relaxed_max: {
+      ValVariant Rhs = StackMgr.pop();
+      return runVectorMaxOp<float>(StackMgr.getTop(), Rhs);
+    }
+    case OpCode::F64x2__relaxed_min: {
+      ValVariant Rhs = StackMgr.pop();
+      return runVectorMinOp<double>(StackMgr.getTop(), Rhs);
+    }
+    case OpCode::F64x2__relaxed_max: {
+      ValVariant Rhs = StackMgr.pop();
+      return runVectorMaxOp<double>(StackMgr.getTop(), Rhs);
+    }
+    case OpCode::I16x8__relaxed_q15mulr_s: {
+      using int32x8_t [[gnu::vector_size(32)]] = int32_t;
+      const ValVariant Val2 = StackMgr.pop();
+      auto &V1 = retrieveValue<int16x8_t>(StackMgr.getTop());
+      const auto &V2 = retrieveValue<int16x8_t>(Val2);
+      /// The overflowing lane of -0x8000 squared wraps, as x86 does.
+      const auto M = __builtin_convertvector(V1, int32x8_t) *
+                     __builtin_convertvector(V2, int32x8_t);
+      V1 = __builtin_convertvector((M + 0x4000) >> 15, int16x8_t);
+      return {};
+    }
+    case OpCode::I16x8__relaxed_dot_i8x16_i7x16_s: {
+      using int16x16_t [[gnu::vector_size(32)]] = int16_t;
+      const ValVariant Val2 = StackMgr.pop();
+      ValVariant &Val1 = StackMgr.getTop();
+      const auto M =
+          __builtin_convertvector(retrieveValue<int8x16_t>(Val1), int16x16_t) *
+          __builtin_convertvector(retrieveValue<int8x16_t>(Val2), int16x16_t);
+      const int16x8_t L = {M[0], M[2], M[4], M[6], M[8], M[10], M[12], M[14]};
+      const int16x8_t R = {M[1], M[3], M[5], M[7], M[9], M[11], M[13], M[15]};
+      retrieveValue<int16x8_t>(Val1) = L + R;
+      return {};
+    }
+    case OpCode::I32x4__relaxed_dot_i8x16_i7x16_add_s: {
+      using int32x16_t [[gnu::vector_size(64)]] = int32_t;
+      const ValVariant Val3 = StackMgr.pop();
+      const ValVariant Val2 = StackMgr.pop();
+      ValVariant &Val1 = StackMgr.getTop();
+      const auto M =
+          __builtin_convertvector(retrieveValue<int8x16_t>(Val1), int32x16_t) *
+          __builtin_convertvector(retrieveValue<int8x16_t>(Val2), int32x16_t);
+      int32x4_t Result = retrieveValue<int32x4_t>(Val3);
+      for (uint32_t I = 0; I < 4; ++I) {
+        Result[I] += M[I * 4] + M[I * 4 + 1] + M[I * 4 + 2] + M[I * 4 + 3];
+      }
+      retrieveValue<int32x4_t>(Val1) = Result;
+      return {};
+    }
+
     default:
       return {};
     }
@@ -1464,7 +1800,13 @@ Expect<void> Interpreter::execute(Runtime::StoreManager &StoreMgr,
       }
     }
     if (auto Res = Dispatch(); !Res) {
-      return Unexpect(Res);
+      if (Res.error() != ErrCode::UncaughtException) {
+        return Unexpect(Res);
+      }
+      /// Continue at the handler, or pass to the caller of this execution.
+      if (auto UnwindRes = unwindException(StoreMgr, PC); !UnwindRes) {
+        return Unexpect(UnwindRes);
+      }
     }
     PC++;
   }
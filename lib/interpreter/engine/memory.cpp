@@ -96,5 +96,23 @@ Interpreter::runMemoryFillOp(Runtime::Instance::MemoryInstance &MemInst,
   }
 }
 
+Expect<void>
+Interpreter::runAtomicNotifyOp(Runtime::Instance::MemoryInstance &MemInst,
+                               const AST::Instruction &Instr) {
+  /// Pop the count, and replace the address by the number of woken threads.
+  const uint32_t Count = retrieveValue<uint32_t>(StackMgr.pop());
+  ValVariant &Val = StackMgr.getTop();
+
+  if (auto Res = MemInst.atomicNotify(retrieveValue<uint32_t>(Val),
+                                      Instr.getMemoryOffset(), Count)) {
+    retrieveValue<uint32_t>(Val) = *Res;
+    return {};
+  } else {
+    LOG(ERROR) << ErrInfo::InfoInstruction(Instr.getOpCode(),
+                                           Instr.getOffset());
+    return Unexpect(Res);
+  }
+}
+
 } // namespace Interpreter
 } // namespace SSVM
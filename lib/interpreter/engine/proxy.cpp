@@ -1,28 +1,62 @@
 // SPDX-License-Identifier: Apache-2.0
 #include "interpreter/interpreter.h"
 
+#include <mutex>
+#include <unwind.h>
+
 namespace SSVM {
 namespace Interpreter {
 
-Interpreter *Interpreter::This = nullptr;
-std::jmp_buf *Interpreter::TrapJump = nullptr;
+thread_local Interpreter *Interpreter::This = nullptr;
+thread_local std::jmp_buf *Interpreter::TrapJump = nullptr;
 
 template <typename RetT, typename... ArgsT>
 struct Interpreter::ProxyHelper<Expect<RetT> (Interpreter::*)(
     Runtime::StoreManager &, ArgsT...) noexcept> {
   template <Expect<RetT> (Interpreter::*Func)(Runtime::StoreManager &,
                                               ArgsT...) noexcept>
-  static RetT proxy(ArgsT... Args) noexcept {
-    Interpreter::SignalDisabler Disabler;
-    if (auto Res = (This->*Func)(*This->CurrentStore, Args...);
-        unlikely(!Res)) {
-      siglongjmp(*TrapJump, uint8_t(Res.error()));
-    } else if constexpr (!std::is_void_v<RetT>) {
-      return *Res;
+  static RetT proxy(ArgsT... Args) {
+    {
+      Interpreter::SignalDisabler Disabler;
+      if (auto Res = (This->*Func)(*This->CurrentStore, Args...);
+          unlikely(!Res)) {
+        if (Res.error() != ErrCode::UncaughtException) {
+          siglongjmp(*TrapJump, uint8_t(Res.error()));
+        }
+      } else if constexpr (!std::is_void_v<RetT>) {
+        return *Res;
+      } else {
+        return;
+      }
     }
+    /// Unwind after the signal handlers are restored.
+    raiseException();
   }
 };
 
+namespace {
+/// Exception class of the unwinding of compiled functions, "SSVM\0WEH".
+constexpr const uint64_t kExceptionClass = UINT64_C(0x5353564d00574548);
+void cleanupException(_Unwind_Reason_Code, _Unwind_Exception *) noexcept {}
+/// The thrown exception is kept by the interpreter, so the unwinding one needs
+/// no payload.
+thread_local _Unwind_Exception UnwindException;
+/// Signal handlers are process wide. They stay installed while any thread runs
+/// compiled functions.
+std::mutex SignalMutex;
+uint32_t SignalThreads = 0;
+thread_local bool SignalEnabled = false;
+} // namespace
+
+void Interpreter::raiseException() {
+  UnwindException = {};
+  UnwindException.exception_class = kExceptionClass;
+  UnwindException.exception_cleanup = &cleanupException;
+  _Unwind_RaiseException(&UnwindException);
+  /// No landing pad found by unwind tables. Leave the compiled functions.
+  siglongjmp(*TrapJump, uint8_t(ErrCode::UncaughtException));
+}
+
 #if defined(__clang_major__) && __clang_major__ >= 10
 #pragma clang diagnostic push
 #pragma clang diagnostic ignored "-Wc99-designator"
@@ -54,6 +88,11 @@ AST::Module::IntrinsicsTable intrinsics = {
     ENTRY(kTableInit, tableInit),
     ENTRY(kElemDrop, elemDrop),
     ENTRY(kRefFunc, refFunc),
+    ENTRY(kThrow, throwException),
+    ENTRY(kRethrow, rethrowException),
+    ENTRY(kCatch, catchException),
+    ENTRY(kMemAtomicNotify, memAtomicNotify),
+    ENTRY(kMemAtomicWait, memAtomicWait),
 #undef ENTRY
 };
 }
@@ -79,7 +118,18 @@ void Interpreter::signalHandler(int Signal, siginfo_t *Siginfo,
   siglongjmp(*This->TrapJump, Status);
 }
 
+void Interpreter::hostTrap(const uint8_t Code) noexcept {
+  siglongjmp(*TrapJump, Code);
+}
+
 void Interpreter::signalEnable() noexcept {
+  if (std::exchange(SignalEnabled, true)) {
+    return;
+  }
+  std::unique_lock Lock(SignalMutex);
+  if (SignalThreads++ != 0) {
+    return;
+  }
   struct sigaction Action {};
   Action.sa_sigaction = &signalHandler;
   Action.sa_flags = SA_SIGINFO;
@@ -88,6 +138,13 @@ void Interpreter::signalEnable() noexcept {
 }
 
 void Interpreter::signalDisable() noexcept {
+  if (!std::exchange(SignalEnabled, false)) {
+    return;
+  }
+  std::unique_lock Lock(SignalMutex);
+  if (--SignalThreads != 0) {
+    return;
+  }
   std::signal(SIGFPE, SIG_DFL);
   std::signal(SIGSEGV, SIG_DFL);
 }
@@ -100,12 +157,11 @@ Expect<void> Interpreter::trap(Runtime::StoreManager &StoreMgr,
 Expect<void> Interpreter::call(Runtime::StoreManager &StoreMgr,
                                const uint32_t FuncIndex, const ValVariant *Args,
                                ValVariant *Rets) noexcept {
-  const auto *ModInst = *StoreMgr.getModule(StackMgr.getModuleAddr());
-  const uint32_t FuncAddr = *ModInst->getFuncAddr(FuncIndex);
-  const auto *FuncInst = *StoreMgr.getFunction(FuncAddr);
+  const uint32_t FuncAddr = FrameCache.ModInst->unsafeGetFuncAddr(FuncIndex);
+  const auto *FuncInst = StoreMgr.unsafeGetFunction(FuncAddr);
   const auto &FuncType = FuncInst->getFuncType();
-  const unsigned ParamsSize = FuncType.Params.size();
-  const unsigned ReturnsSize = FuncType.Returns.size();
+  const unsigned ParamsSize = FuncType.getParamTypes().size();
+  const unsigned ReturnsSize = FuncType.getReturnTypes().size();
 
   for (unsigned I = 0; I < ParamsSize; ++I) {
     StackMgr.push(Args[I]);
@@ -147,16 +203,16 @@ Expect<void> Interpreter::callIndirect(Runtime::StoreManager &StoreMgr,
   }
   const auto FuncAddr = retrieveFuncIdx(Ref);
 
-  const auto *ModInst = *StoreMgr.getModule(StackMgr.getModuleAddr());
-  const auto *TargetFuncType = *ModInst->getFuncType(FuncTypeIndex);
-  const auto *FuncInst = *StoreMgr.getFunction(FuncAddr);
+  const auto *TargetFuncType =
+      &FrameCache.ModInst->unsafeGetFuncType(FuncTypeIndex);
+  const auto *FuncInst = StoreMgr.unsafeGetFunction(FuncAddr);
   const auto &FuncType = FuncInst->getFuncType();
-  if (unlikely(*TargetFuncType != FuncType)) {
+  if (unlikely(TargetFuncType->getTypeId() != FuncType.getTypeId())) {
     return Unexpect(ErrCode::IndirectCallTypeMismatch);
   }
 
-  const unsigned ParamsSize = FuncType.Params.size();
-  const unsigned ReturnsSize = FuncType.Returns.size();
+  const unsigned ParamsSize = FuncType.getParamTypes().size();
+  const unsigned ReturnsSize = FuncType.getReturnTypes().size();
 
   for (unsigned I = 0; I < ParamsSize; ++I) {
     StackMgr.push(Args[I]);
@@ -247,6 +303,28 @@ Expect<void> Interpreter::dataDrop(Runtime::StoreManager &StoreMgr,
   return {};
 }
 
+Expect<uint32_t> Interpreter::memAtomicNotify(Runtime::StoreManager &StoreMgr,
+                                              const uint32_t Addr,
+                                              const uint32_t Offset,
+                                              const uint32_t Count) noexcept {
+  auto &MemInst = *getMemInstByIdx(StoreMgr, 0);
+  return MemInst.atomicNotify(Addr, Offset, Count);
+}
+
+Expect<uint32_t> Interpreter::memAtomicWait(Runtime::StoreManager &StoreMgr,
+                                            const uint32_t Addr,
+                                            const uint32_t Offset,
+                                            const uint64_t Expected,
+                                            const int64_t Timeout,
+                                            const uint32_t BitWidth) noexcept {
+  auto &MemInst = *getMemInstByIdx(StoreMgr, 0);
+  if (BitWidth == 64) {
+    return MemInst.atomicWait<uint64_t>(Addr, Offset, Expected, Timeout);
+  }
+  return MemInst.atomicWait<uint32_t>(Addr, Offset,
+                                      static_cast<uint32_t>(Expected), Timeout);
+}
+
 Expect<RefVariant> Interpreter::tableGet(Runtime::StoreManager &StoreMgr,
                                          const uint32_t TableIndex,
                                          const uint32_t Idx) noexcept {
@@ -346,10 +424,54 @@ Expect<void> Interpreter::elemDrop(Runtime::StoreManager &StoreMgr,
 
 Expect<RefVariant> Interpreter::refFunc(Runtime::StoreManager &StoreMgr,
                                         const uint32_t FuncIndex) noexcept {
-  const auto *ModInst = *StoreMgr.getModule(StackMgr.getModuleAddr());
-  const uint32_t FuncAddr = *ModInst->getFuncAddr(FuncIndex);
+  const uint32_t FuncAddr = FrameCache.ModInst->unsafeGetFuncAddr(FuncIndex);
   return genFuncRef(FuncAddr);
 }
 
+Expect<void> Interpreter::throwException(Runtime::StoreManager &StoreMgr,
+                                         const uint32_t TagIndex,
+                                         const ValVariant *Args) noexcept {
+  const uint32_t TagAddr = FrameCache.ModInst->unsafeGetTagAddr(TagIndex);
+  const auto &TagType = StoreMgr.unsafeGetTag(TagAddr)->getTagType();
+  const size_t ArgsN = TagType.getParamTypes().size();
+  Thrown.emplace(
+      Exception{TagAddr, std::vector<ValVariant>(Args, Args + ArgsN)});
+  return Unexpect(ErrCode::UncaughtException);
+}
+
+Expect<void>
+Interpreter::rethrowException(Runtime::StoreManager &StoreMgr,
+                              const ValVariant *Payload) noexcept {
+  /// Null payload keeps unwinding the exception no handler caught.
+  for (auto It = CompiledCaught.rbegin(); It != CompiledCaught.rend(); ++It) {
+    if (It->first == Payload) {
+      Thrown.emplace(It->second);
+      break;
+    }
+  }
+  assert(Thrown);
+  return Unexpect(ErrCode::UncaughtException);
+}
+
+Expect<uint32_t> Interpreter::catchException(Runtime::StoreManager &StoreMgr,
+                                             const uint32_t TagIndex,
+                                             ValVariant *Payload) noexcept {
+  /// Tag index of UINT32_MAX catches all exceptions without the payload.
+  if (TagIndex != UINT32_MAX) {
+    if (FrameCache.ModInst->unsafeGetTagAddr(TagIndex) != Thrown->TagAddr) {
+      return UINT32_MAX;
+    }
+    std::copy(Thrown->Values.begin(), Thrown->Values.end(), Payload);
+  }
+  /// The native stack grows downward, so handlers below the buffer have left.
+  while (!CompiledCaught.empty() && CompiledCaught.back().first <= Payload) {
+    CompiledCaught.pop_back();
+  }
+  const uint32_t TagAddr = Thrown->TagAddr;
+  CompiledCaught.emplace_back(Payload, std::move(*Thrown));
+  Thrown.reset();
+  return TagAddr;
+}
+
 } // namespace Interpreter
-} // namespace SSVM
\ No newline at end of file
+} // namespace SSVM
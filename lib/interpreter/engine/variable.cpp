@@ -29,15 +29,13 @@ Expect<void> Interpreter::runLocalTeeOp(const uint32_t Idx) {
 
 Expect<void> Interpreter::runGlobalGetOp(Runtime::StoreManager &StoreMgr,
                                          const uint32_t Idx) {
-  auto *GlobInst = getGlobInstByIdx(StoreMgr, Idx);
-  StackMgr.push(GlobInst->getValue());
+  StackMgr.push(getGlobValByIdx(StoreMgr, Idx));
   return {};
 }
 
 Expect<void> Interpreter::runGlobalSetOp(Runtime::StoreManager &StoreMgr,
                                          const uint32_t Idx) {
-  auto *GlobInst = getGlobInstByIdx(StoreMgr, Idx);
-  GlobInst->getValue() = StackMgr.pop();
+  getGlobValByIdx(StoreMgr, Idx) = StackMgr.pop();
   return {};
 }
 
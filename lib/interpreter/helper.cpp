@@ -36,8 +36,8 @@ Interpreter::enterFunction(Runtime::StoreManager &StoreMgr,
     }
 
     /// Run host function.
-    const size_t ArgsN = FuncType.Params.size();
-    const size_t RetsN = FuncType.Returns.size();
+    const size_t ArgsN = FuncType.getParamTypes().size();
+    const size_t RetsN = FuncType.getReturnTypes().size();
     Span<ValVariant> Args = StackMgr.getTopSpan(ArgsN);
     std::vector<ValVariant> Rets(RetsN);
     auto Ret = HostFunc.run(MemoryInst, std::move(Args), Rets);
@@ -65,23 +65,23 @@ Interpreter::enterFunction(Runtime::StoreManager &StoreMgr,
   } else if (Func.isCompiledFunction()) {
     auto Wrapper = Func.getFuncType().getSymbol();
     /// Compiled function case: Push frame with locals and args.
-    const size_t ArgsN = FuncType.Params.size();
-    const size_t RetsN = FuncType.Returns.size();
-
-    StackMgr.pushFrame(Func.getModuleAddr(), /// Module address
-                       ArgsN,                /// No Arguments in stack
-                       RetsN                 /// Returns num
-    );
+    const size_t ArgsN = FuncType.getParamTypes().size();
+    const size_t RetsN = FuncType.getReturnTypes().size();
+
+    if (auto Res = StackMgr.pushFrame(Func.getModuleAddr(), /// Module address
+                                      ArgsN, /// No Arguments in stack
+                                      RetsN, /// Returns num
+                                      RetsN  /// Returns pushed over arguments
+                                      );
+        unlikely(!Res)) {
+      return Unexpect(Res);
+    }
+    updateFrameCache(StoreMgr);
 
     Span<ValVariant> Args = StackMgr.getTopSpan(ArgsN);
     std::vector<ValVariant> Rets(RetsN);
 
-    {
-      CurrentStore = &StoreMgr;
-      const auto &ModInst = **StoreMgr.getModule(Func.getModuleAddr());
-      ExecutionContext.Memory = ModInst.MemoryPtr;
-      ExecutionContext.Globals = ModInst.GlobalsPtr.data();
-    }
+    CurrentStore = &StoreMgr;
 
     sigjmp_buf JumpBuffer;
     auto OldTrapJump = std::exchange(TrapJump, &JumpBuffer);
@@ -89,33 +89,62 @@ Interpreter::enterFunction(Runtime::StoreManager &StoreMgr,
     const int Status = sigsetjmp(*TrapJump, true);
     if (Status == 0) {
       SignalEnabler Enabler;
-      Wrapper(&ExecutionContext, Func.getSymbol().get(), Args.data(),
-              Rets.data());
+      auto &ExecCtx = StoreMgr.unsafeGetModule(Func.getModuleAddr())->ExecCtx;
+      try {
+        Wrapper(&ExecCtx, Func.getSymbol().get(), Args.data(), Rets.data());
+      } catch (...) {
+        /// The thrown exception is kept in Thrown and handled below.
+      }
     }
 
     TrapJump = std::move(OldTrapJump);
 
     if (Status != 0) {
+      /// Trapped without leaving the signal enabler.
+      signalDisable();
       ErrCode Code = static_cast<ErrCode>(Status);
-      if (Code != ErrCode::Terminated) {
+      if (Code == ErrCode::UncaughtException) {
+        /// Raised without unwind tables. Pass the exception to the caller.
+        StackMgr.unwindFrame();
+        updateFrameCache(StoreMgr);
+      } else if (Code != ErrCode::Terminated) {
         LOG(ERROR) << Code;
       }
       return Unexpect(Code);
     }
+    if (Thrown) {
+      /// Exception unwound out of the compiled functions.
+      StackMgr.unwindFrame();
+      updateFrameCache(StoreMgr);
+      return Unexpect(ErrCode::UncaughtException);
+    }
 
     for (uint32_t I = 0; I < Rets.size(); ++I) {
       StackMgr.push(Rets[I]);
     }
 
     StackMgr.popFrame();
+    updateFrameCache(StoreMgr);
     /// For compiled function case, the continuation will be the next.
     return From + 1;
   } else {
     /// Native function case: Push frame with locals and args.
-    StackMgr.pushFrame(Func.getModuleAddr(),   /// Module address
-                       FuncType.Params.size(), /// Arguments num
-                       FuncType.Returns.size() /// Returns num
-    );
+    uint32_t LocalNum = 0;
+    for (auto &Def : Func.getLocals()) {
+      LocalNum += Def.first;
+    }
+    const uint64_t ExtraNum = uint64_t(LocalNum) + Func.getMaxStackHeight();
+    const size_t ArgsN = FuncType.getParamTypes().size();
+    const size_t RetsN = FuncType.getReturnTypes().size();
+    if (auto Res = StackMgr.pushFrame(Func.getModuleAddr(), /// Module address
+                                      ArgsN,   /// Arguments num
+                                      RetsN,   /// Returns num
+                                      ExtraNum /// Locals and operands
+                                      );
+        unlikely(!Res)) {
+      return Unexpect(Res);
+    }
+    updateFrameCache(StoreMgr);
 
     /// Push local variables to stack.
     for (auto &Def : Func.getLocals()) {
@@ -125,7 +154,10 @@ Interpreter::enterFunction(Runtime::StoreManager &StoreMgr,
     }
 
     /// Enter function block []->[returns] with label{none}.
-    StackMgr.pushLabel(0, FuncType.Returns.size(), From);
+    if (auto Res = StackMgr.pushLabel(0, RetsN, From);
+        unlikely(!Res)) {
+      return Unexpect(Res);
+    }
     /// For native function case, the continuation will be the start of
     /// function body.
     return Func.getInstrs().begin();
@@ -140,10 +172,10 @@ Interpreter::getBlockArity(Runtime::StoreManager &StoreMgr,
     Arity = (std::get<ValType>(BType) == ValType::None) ? 0 : 1;
   } else {
     /// Get function type at index x.
-    const auto *ModInst = *StoreMgr.getModule(StackMgr.getModuleAddr());
-    const auto *FuncType = *ModInst->getFuncType(std::get<uint32_t>(BType));
-    Locals = FuncType->Params.size();
-    Arity = FuncType->Returns.size();
+    const auto *FuncType =
+        &FrameCache.ModInst->unsafeGetFuncType(std::get<uint32_t>(BType));
+    Locals = FuncType->getParamTypes().size();
+    Arity = FuncType->getReturnTypes().size();
   }
   return {Locals, Arity};
 }
@@ -163,7 +195,11 @@ Expect<void> Interpreter::branchToLabel(Runtime::StoreManager &StoreMgr,
     auto BlockSig = getBlockArity(StoreMgr, (*ContIt)->getBlockType());
 
     /// Create Label{ loop-instruction } and push.
-    StackMgr.pushLabel(BlockSig.first, BlockSig.first, PC, *ContIt);
+    if (auto Res = StackMgr.pushLabel(BlockSig.first, BlockSig.first, PC,
+                                      *ContIt);
+        unlikely(!Res)) {
+      return Unexpect(Res);
+    }
 
     /// Move PC to loop start.
     PC = *ContIt;
@@ -171,108 +207,142 @@ Expect<void> Interpreter::branchToLabel(Runtime::StoreManager &StoreMgr,
   return {};
 }
 
+Expect<void> Interpreter::unwindException(Runtime::StoreManager &StoreMgr,
+                                          AST::InstrView::iterator &PC) {
+  while (StackMgr.getFrameLabelCount() > 0) {
+    /// Search the handlers from the innermost label of the top frame.
+    const uint32_t Base =
+        StackMgr.getLabelCount() - StackMgr.getFrameLabelCount();
+    uint32_t Idx = StackMgr.getLabelCount();
+    while (Idx-- > Base) {
+      const auto &L = StackMgr.getLabelWithCount(StackMgr.getLabelCount() - 1 -
+                                                 Idx);
+      if (!L.Try) {
+        continue;
+      }
+      const auto TryIt = *L.Try;
+      const auto &EndInstr = *(TryIt + TryIt->getJumpEnd());
+      if (EndInstr.getOpCode() == OpCode::Delegate) {
+        /// Continue searching from the target label of delegate-instruction.
+        if (EndInstr.getTargetIndex() + 1 > Idx - Base) {
+          break;
+        }
+        Idx -= EndInstr.getTargetIndex();
+        continue;
+      }
+      for (const uint32_t Off : TryIt->getLabelList()) {
+        const auto &CatchInstr = *(TryIt + Off);
+        if (CatchInstr.getOpCode() == OpCode::Catch &&
+            FrameCache.ModInst->unsafeGetTagAddr(
+                CatchInstr.getTargetIndex()) != Thrown->TagAddr) {
+          continue;
+        }
+        /// Enter the catch clause with the label of try-instruction.
+        StackMgr.unwindToTryLabel(StackMgr.getLabelCount() - 1 - Idx);
+        if (CatchInstr.getOpCode() == OpCode::Catch) {
+          for (const auto &Val : Thrown->Values) {
+            StackMgr.push(Val);
+          }
+        }
+        while (!Caught.empty() && Caught.back().first >= Idx) {
+          Caught.pop_back();
+        }
+        Caught.emplace_back(Idx, std::move(*Thrown));
+        Thrown.reset();
+        PC = TryIt + Off;
+        return {};
+      }
+    }
+    /// No handler in this frame. Pass the exception to the caller.
+    StackMgr.unwindFrame();
+    updateFrameCache(StoreMgr);
+  }
+  return Unexpect(ErrCode::UncaughtException);
+}
+
 Runtime::Instance::TableInstance *
 Interpreter::getTabInstByIdx(Runtime::StoreManager &StoreMgr,
                              const uint32_t Idx) {
   /// When top frame is dummy frame, cannot find instance.
-  if (StackMgr.isTopDummyFrame()) {
-    return nullptr;
-  }
-  const auto *ModInst = *StoreMgr.getModule(StackMgr.getModuleAddr());
-  uint32_t TabAddr;
-  if (auto Res = ModInst->getTableAddr(Idx)) {
-    TabAddr = *Res;
-  } else {
-    return nullptr;
-  }
-  if (auto Res = StoreMgr.getTable(TabAddr)) {
-    return *Res;
-  } else {
+  if (unlikely(FrameCache.ModInst == nullptr)) {
     return nullptr;
   }
+  return StoreMgr.unsafeGetTable(FrameCache.ModInst->unsafeGetTableAddr(Idx));
 }
 
 Runtime::Instance::MemoryInstance *
 Interpreter::getMemInstByIdx(Runtime::StoreManager &StoreMgr,
                              const uint32_t Idx) {
   /// When top frame is dummy frame, cannot find instance.
-  if (StackMgr.isTopDummyFrame()) {
+  if (unlikely(FrameCache.ModInst == nullptr)) {
     return nullptr;
   }
-  const auto *ModInst = *StoreMgr.getModule(StackMgr.getModuleAddr());
-  uint32_t MemAddr;
-  if (auto Res = ModInst->getMemAddr(Idx)) {
-    MemAddr = *Res;
-  } else {
-    return nullptr;
-  }
-  if (auto Res = StoreMgr.getMemory(MemAddr)) {
-    return *Res;
-  } else {
-    return nullptr;
+  if (likely(Idx == 0)) {
+    return FrameCache.MemInst;
   }
+  return StoreMgr.unsafeGetMemory(FrameCache.ModInst->unsafeGetMemAddr(Idx));
 }
 
 Runtime::Instance::GlobalInstance *
 Interpreter::getGlobInstByIdx(Runtime::StoreManager &StoreMgr,
                               const uint32_t Idx) {
   /// When top frame is dummy frame, cannot find instance.
-  if (StackMgr.isTopDummyFrame()) {
-    return nullptr;
-  }
-  const auto *ModInst = *StoreMgr.getModule(StackMgr.getModuleAddr());
-  uint32_t GlobAddr;
-  if (auto Res = ModInst->getGlobalAddr(Idx)) {
-    GlobAddr = *Res;
-  } else {
+  if (unlikely(FrameCache.ModInst == nullptr)) {
     return nullptr;
   }
-  if (auto Res = StoreMgr.getGlobal(GlobAddr)) {
-    return *Res;
-  } else {
-    return nullptr;
+  return StoreMgr.unsafeGetGlobal(FrameCache.ModInst->unsafeGetGlobalAddr(Idx));
+}
+
+ValVariant &Interpreter::getGlobValByIdx(Runtime::StoreManager &StoreMgr,
+                                         const uint32_t Idx) {
+  if (likely(FrameCache.Globals != nullptr)) {
+    return *FrameCache.Globals[Idx];
   }
+  /// Initializing globals before the execution context is prepared.
+  return getGlobInstByIdx(StoreMgr, Idx)->getValue();
 }
 
 Runtime::Instance::ElementInstance *
 Interpreter::getElemInstByIdx(Runtime::StoreManager &StoreMgr,
                               const uint32_t Idx) {
   /// When top frame is dummy frame, cannot find instance.
-  if (StackMgr.isTopDummyFrame()) {
-    return nullptr;
-  }
-  const auto *ModInst = *StoreMgr.getModule(StackMgr.getModuleAddr());
-  uint32_t ElemAddr;
-  if (auto Res = ModInst->getElemAddr(Idx)) {
-    ElemAddr = *Res;
-  } else {
-    return nullptr;
-  }
-  if (auto Res = StoreMgr.getElement(ElemAddr)) {
-    return *Res;
-  } else {
+  if (unlikely(FrameCache.ModInst == nullptr)) {
     return nullptr;
   }
+  return StoreMgr.unsafeGetElement(FrameCache.ModInst->unsafeGetElemAddr(Idx));
 }
 
 Runtime::Instance::DataInstance *
 Interpreter::getDataInstByIdx(Runtime::StoreManager &StoreMgr,
                               const uint32_t Idx) {
   /// When top frame is dummy frame, cannot find instance.
-  if (StackMgr.isTopDummyFrame()) {
+  if (unlikely(FrameCache.ModInst == nullptr)) {
     return nullptr;
   }
-  const auto *ModInst = *StoreMgr.getModule(StackMgr.getModuleAddr());
-  uint32_t DataAddr;
-  if (auto Res = ModInst->getDataAddr(Idx)) {
-    DataAddr = *Res;
+  return StoreMgr.unsafeGetData(FrameCache.ModInst->unsafeGetDataAddr(Idx));
+}
+
+void Interpreter::updateFrameCache(Runtime::StoreManager &StoreMgr) {
+  if (StackMgr.isTopDummyFrame()) {
+    resetFrameCache();
+    return;
+  }
+  const uint32_t ModAddr = StackMgr.getModuleAddr();
+  if (ModAddr == FrameCache.ModAddr) {
+    return;
+  }
+  const auto *ModInst = StoreMgr.unsafeGetModule(ModAddr);
+  FrameCache.ModAddr = ModAddr;
+  FrameCache.ModInst = ModInst;
+  if (ModInst->getMemNum() > 0) {
+    FrameCache.MemInst = StoreMgr.unsafeGetMemory(ModInst->unsafeGetMemAddr(0));
   } else {
-    return nullptr;
+    FrameCache.MemInst = nullptr;
   }
-  if (auto Res = StoreMgr.getData(DataAddr)) {
-    return *Res;
+  if (ModInst->GlobalsPtr.size() == ModInst->getGlobalNum()) {
+    FrameCache.Globals = ModInst->GlobalsPtr.data();
   } else {
-    return nullptr;
+    FrameCache.Globals = nullptr;
   }
 }
 
@@ -27,29 +27,49 @@ Interpreter::instantiate(Runtime::StoreManager &StoreMgr,
       }
       Offset = retrieveValue<uint32_t>(StackMgr.pop());
 
-      /// Check boundary unless ReferenceTypes or BulkMemoryOperations proposal
-      /// enabled.
-      if (!Conf.hasProposal(Proposal::ReferenceTypes) &&
-          !Conf.hasProposal(Proposal::BulkMemoryOperations)) {
-        /// Memory index should be 0. Checked in validation phase.
-        auto *MemInst = getMemInstByIdx(StoreMgr, DataSeg.getIdx());
-        /// Check data fits.
-        if (!MemInst->checkAccessBound(Offset, DataSeg.getData().size())) {
-          LOG(ERROR) << ErrCode::DataSegDoesNotFit;
-          LOG(ERROR) << ErrInfo::InfoAST(DataSeg.NodeAttr);
-          return Unexpect(ErrCode::DataSegDoesNotFit);
-        }
+      /// Check data fits.
+      if (auto Res = checkDataSegBound(StoreMgr, DataSeg.getIdx(), Offset,
+                                       DataSeg.getData().size());
+          !Res) {
+        LOG(ERROR) << ErrInfo::InfoAST(DataSeg.NodeAttr);
+        return Unexpect(Res);
       }
     }
 
     /// Insert data instance to store manager.
-    uint32_t NewDataInstAddr;
-    if (InsMode == InstantiateMode::Instantiate) {
-      NewDataInstAddr = StoreMgr.pushData(Offset, DataSeg.getData());
-    } else {
-      NewDataInstAddr = StoreMgr.importData(Offset, DataSeg.getData());
-    }
-    ModInst.addDataAddr(NewDataInstAddr);
+    ModInst.addDataAddr(insertData(StoreMgr, Offset, DataSeg.getData()));
+  }
+  return {};
+}
+
+/// Insert data instance. See "include/interpreter/interpreter.h".
+uint32_t Interpreter::insertData(Runtime::StoreManager &StoreMgr,
+                                 const uint32_t Offset,
+                                 Span<const Byte> Data) {
+  if (InsMode == InstantiateMode::Instantiate) {
+    return StoreMgr.pushData(Offset, Data);
+  } else {
+    return StoreMgr.importData(Offset, Data);
+  }
+}
+
+/// Check bound of active data segment. See
+/// "include/interpreter/interpreter.h".
+Expect<void> Interpreter::checkDataSegBound(Runtime::StoreManager &StoreMgr,
+                                            const uint32_t MemIdx,
+                                            const uint32_t Offset,
+                                            const uint32_t Size) {
+  /// Check boundary unless ReferenceTypes or BulkMemoryOperations proposal
+  /// enabled.
+  if (Conf.hasProposal(Proposal::ReferenceTypes) ||
+      Conf.hasProposal(Proposal::BulkMemoryOperations)) {
+    return {};
+  }
+  /// Memory index should be 0. Checked in validation phase.
+  auto *MemInst = getMemInstByIdx(StoreMgr, MemIdx);
+  if (!MemInst->checkAccessBound(Offset, Size)) {
+    LOG(ERROR) << ErrCode::DataSegDoesNotFit;
+    return Unexpect(ErrCode::DataSegDoesNotFit);
   }
   return {};
 }
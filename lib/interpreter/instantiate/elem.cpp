@@ -38,31 +38,50 @@ Interpreter::instantiate(Runtime::StoreManager &StoreMgr,
       }
       Offset = retrieveValue<uint32_t>(StackMgr.pop());
 
-      /// Check boundary unless ReferenceTypes or BulkMemoryOperations proposal
-      /// enabled.
-      if (!Conf.hasProposal(Proposal::ReferenceTypes) &&
-          !Conf.hasProposal(Proposal::BulkMemoryOperations)) {
-        /// Table index should be 0. Checked in validation phase.
-        auto *TabInst = getTabInstByIdx(StoreMgr, ElemSeg.getIdx());
-        /// Check elements fits.
-        if (!TabInst->checkAccessBound(Offset, InitVals.size())) {
-          LOG(ERROR) << ErrCode::ElemSegDoesNotFit;
-          LOG(ERROR) << ErrInfo::InfoAST(ElemSeg.NodeAttr);
-          return Unexpect(ErrCode::ElemSegDoesNotFit);
-        }
+      /// Check elements fits.
+      if (auto Res = checkElemSegBound(StoreMgr, ElemSeg.getIdx(), Offset,
+                                       InitVals.size());
+          !Res) {
+        LOG(ERROR) << ErrInfo::InfoAST(ElemSeg.NodeAttr);
+        return Unexpect(Res);
       }
     }
 
     /// Insert element instance to store manager.
-    uint32_t NewElemInstAddr;
-    if (InsMode == InstantiateMode::Instantiate) {
-      NewElemInstAddr =
-          StoreMgr.pushElement(Offset, ElemSeg.getRefType(), InitVals);
-    } else {
-      NewElemInstAddr =
-          StoreMgr.importElement(Offset, ElemSeg.getRefType(), InitVals);
-    }
-    ModInst.addElemAddr(NewElemInstAddr);
+    ModInst.addElemAddr(
+        insertElement(StoreMgr, Offset, ElemSeg.getRefType(), InitVals));
+  }
+  return {};
+}
+
+/// Insert element instance. See "include/interpreter/interpreter.h".
+uint32_t Interpreter::insertElement(Runtime::StoreManager &StoreMgr,
+                                    const uint32_t Offset, const RefType Type,
+                                    Span<const RefVariant> Refs) {
+  if (InsMode == InstantiateMode::Instantiate) {
+    return StoreMgr.pushElement(Offset, Type, Refs);
+  } else {
+    return StoreMgr.importElement(Offset, Type, Refs);
+  }
+}
+
+/// Check bound of active element segment. See
+/// "include/interpreter/interpreter.h".
+Expect<void> Interpreter::checkElemSegBound(Runtime::StoreManager &StoreMgr,
+                                            const uint32_t TableIdx,
+                                            const uint32_t Offset,
+                                            const uint32_t Size) {
+  /// Check boundary unless ReferenceTypes or BulkMemoryOperations proposal
+  /// enabled.
+  if (Conf.hasProposal(Proposal::ReferenceTypes) ||
+      Conf.hasProposal(Proposal::BulkMemoryOperations)) {
+    return {};
+  }
+  /// Table index should be 0. Checked in validation phase.
+  auto *TabInst = getTabInstByIdx(StoreMgr, TableIdx);
+  if (!TabInst->checkAccessBound(Offset, Size)) {
+    LOG(ERROR) << ErrCode::ElemSegDoesNotFit;
+    return Unexpect(ErrCode::ElemSegDoesNotFit);
   }
   return {};
 }
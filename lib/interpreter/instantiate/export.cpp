@@ -18,31 +18,37 @@ Interpreter::instantiate(Runtime::StoreManager &StoreMgr,
                          const AST::ExportSection &ExportSec) {
   /// Iterate and istantiate export descriptions.
   for (const auto &ExpDesc : ExportSec.getContent()) {
-    /// Get data from export description.
-    const auto ExtType = ExpDesc.getExternalType();
-    std::string_view ExtName = ExpDesc.getExternalName();
-    const uint32_t ExtIdx = ExpDesc.getExternalIndex();
-
     /// Add the name of instances module.
-    switch (ExtType) {
-    case ExternalType::Function:
-      ModInst.exportFunction(ExtName, ExtIdx);
-      break;
-    case ExternalType::Global:
-      ModInst.exportGlobal(ExtName, ExtIdx);
-      break;
-    case ExternalType::Memory:
-      ModInst.exportMemory(ExtName, ExtIdx);
-      break;
-    case ExternalType::Table:
-      ModInst.exportTable(ExtName, ExtIdx);
-      break;
-    default:
-      break;
-    }
+    addExport(ModInst, ExpDesc.getExternalType(), ExpDesc.getExternalName(),
+              ExpDesc.getExternalIndex());
   }
   return {};
 }
 
+/// Add export name. See "include/interpreter/interpreter.h".
+void Interpreter::addExport(Runtime::Instance::ModuleInstance &ModInst,
+                            const ExternalType Type, std::string_view Name,
+                            const uint32_t Idx) {
+  switch (Type) {
+  case ExternalType::Function:
+    ModInst.exportFunction(Name, Idx);
+    break;
+  case ExternalType::Global:
+    ModInst.exportGlobal(Name, Idx);
+    break;
+  case ExternalType::Memory:
+    ModInst.exportMemory(Name, Idx);
+    break;
+  case ExternalType::Table:
+    ModInst.exportTable(Name, Idx);
+    break;
+  case ExternalType::Tag:
+    ModInst.exportTag(Name, Idx);
+    break;
+  default:
+    break;
+  }
+}
+
 } // namespace Interpreter
 } // namespace SSVM
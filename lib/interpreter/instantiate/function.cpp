@@ -19,31 +19,38 @@ Expect<void> Interpreter::instantiate(
   /// Iterate through code segments to make function instances.
   for (uint32_t I = 0; I < CodeSegs.size(); ++I) {
     /// Insert function instance to store manager.
-    uint32_t NewFuncInstAddr;
     auto *FuncType = *ModInst.getFuncType(TypeIdxs[I]);
-    if (InsMode == InstantiateMode::Instantiate) {
-      if (auto Symbol = CodeSegs[I].getSymbol()) {
-        NewFuncInstAddr =
-            StoreMgr.pushFunction(ModInst.Addr, *FuncType, std::move(Symbol));
-      } else {
-        NewFuncInstAddr = StoreMgr.pushFunction(ModInst.Addr, *FuncType,
-                                                CodeSegs[I].getLocals(),
-                                                CodeSegs[I].getInstrs());
-      }
-    } else {
-      if (auto Symbol = CodeSegs[I].getSymbol()) {
-        NewFuncInstAddr =
-            StoreMgr.importFunction(ModInst.Addr, *FuncType, std::move(Symbol));
-      } else {
-        NewFuncInstAddr = StoreMgr.importFunction(ModInst.Addr, *FuncType,
-                                                  CodeSegs[I].getLocals(),
-                                                  CodeSegs[I].getInstrs());
-      }
-    }
-    ModInst.addFuncAddr(NewFuncInstAddr);
+    ModInst.addFuncAddr(insertFunction(StoreMgr, ModInst.Addr, *FuncType,
+                                       CodeSegs[I].getBody(),
+                                       CodeSegs[I].getMaxStackHeight(),
+                                       CodeSegs[I].getSymbol()));
   }
   return {};
 }
 
+/// Insert function instance. See "include/interpreter/interpreter.h".
+uint32_t
+Interpreter::insertFunction(Runtime::StoreManager &StoreMgr,
+                            const uint32_t ModAddr,
+                            const Runtime::Instance::FType &Type,
+                            std::shared_ptr<const AST::FunctionBody> Body,
+                            const uint32_t MaxStackHeight,
+                            Loader::Symbol<void> Symbol) {
+  /// Compiled functions are preferred over the function bodies.
+  if (InsMode == InstantiateMode::Instantiate) {
+    if (Symbol) {
+      return StoreMgr.pushFunction(ModAddr, Type, std::move(Symbol));
+    }
+    return StoreMgr.pushFunction(ModAddr, Type, std::move(Body),
+                                 MaxStackHeight);
+  } else {
+    if (Symbol) {
+      return StoreMgr.importFunction(ModAddr, Type, std::move(Symbol));
+    }
+    return StoreMgr.importFunction(ModAddr, Type, std::move(Body),
+                                   MaxStackHeight);
+  }
+}
+
 } // namespace Interpreter
 } // namespace SSVM
@@ -14,17 +14,15 @@ Interpreter::instantiate(Runtime::StoreManager &StoreMgr,
                          const AST::GlobalSection &GlobSec) {
   /// A frame with temp. module is pushed into stack outside.
   /// Instantiate and initialize globals.
+  ModInst.GlobalsBlock =
+      std::make_unique<ValVariant[]>(GlobSec.getContent().size());
+  ValVariant *Storage = ModInst.GlobalsBlock.get();
   for (const auto &GlobSeg : GlobSec.getContent()) {
     /// Insert global instance to store manager.
     const auto &GlobType = GlobSeg.getGlobalType();
-    uint32_t NewGlobInstAddr;
-    if (InsMode == InstantiateMode::Instantiate) {
-      NewGlobInstAddr = StoreMgr.pushGlobal(GlobType.getValueType(),
-                                            GlobType.getValueMutation());
-    } else {
-      NewGlobInstAddr = StoreMgr.importGlobal(GlobType.getValueType(),
-                                              GlobType.getValueMutation());
-    }
+    const uint32_t NewGlobInstAddr =
+        insertGlobal(StoreMgr, *Storage++, GlobType.getValueType(),
+                     GlobType.getValueMutation(), uint32_t(0));
     ModInst.addGlobalAddr(NewGlobInstAddr);
 
     /// Run initialize expression.
@@ -40,5 +38,16 @@ Interpreter::instantiate(Runtime::StoreManager &StoreMgr,
   return {};
 }
 
+/// Insert global instance. See "include/interpreter/interpreter.h".
+uint32_t Interpreter::insertGlobal(Runtime::StoreManager &StoreMgr,
+                                   ValVariant &Storage, const ValType Type,
+                                   const ValMut Mut, const ValVariant Val) {
+  if (InsMode == InstantiateMode::Instantiate) {
+    return StoreMgr.pushGlobal(Storage, Type, Mut, Val);
+  } else {
+    return StoreMgr.importGlobal(Storage, Type, Mut, Val);
+  }
+}
+
 } // namespace Interpreter
 } // namespace SSVM
@@ -9,6 +9,7 @@
 #include "runtime/instance/memory.h"
 #include "runtime/instance/module.h"
 #include "runtime/instance/table.h"
+#include "runtime/instance/tag.h"
 
 namespace SSVM {
 namespace Interpreter {
@@ -33,6 +34,7 @@ Expect<uint32_t> getImportAddr(std::string_view Name,
   const auto &TabList = ModInst.getTableExports();
   const auto &MemList = ModInst.getMemExports();
   const auto &GlobList = ModInst.getGlobalExports();
+  const auto &TagList = ModInst.getTagExports();
 
   switch (ExtType) {
   case ExternalType::Function:
@@ -55,6 +57,11 @@ Expect<uint32_t> getImportAddr(std::string_view Name,
       return GlobList.find(Name)->second;
     }
     break;
+  case ExternalType::Tag:
+    if (TagList.find(Name) != TagList.cend()) {
+      return TagList.find(Name)->second;
+    }
+    break;
   default:
     LOG(ERROR) << ErrCode::UnknownImport;
     return Unexpect(ErrCode::UnknownImport);
@@ -81,6 +88,11 @@ Expect<uint32_t> getImportAddr(std::string_view Name,
     LOG(ERROR) << ErrInfo::InfoMismatch(ExtType, ExternalType::Global);
     return Unexpect(ErrCode::IncompatibleImportType);
   }
+  if (TagList.find(Name) != TagList.cend()) {
+    LOG(ERROR) << ErrCode::IncompatibleImportType;
+    LOG(ERROR) << ErrInfo::InfoMismatch(ExtType, ExternalType::Tag);
+    return Unexpect(ErrCode::IncompatibleImportType);
+  }
 
   LOG(ERROR) << ErrCode::UnknownImport;
   return Unexpect(ErrCode::UnknownImport);
@@ -91,7 +103,8 @@ Expect<uint32_t> getImportAddr(std::string_view Name,
 Expect<void>
 Interpreter::instantiate(Runtime::StoreManager &StoreMgr,
                          Runtime::Instance::ModuleInstance &ModInst,
-                         const AST::ImportSection &ImportSec) {
+                         const AST::ImportSection &ImportSec,
+                         const bool GuardPages) {
   /// Iterate and instantiate import descriptions.
   for (const auto &ImpDesc : ImportSec.getContent()) {
     /// Get data from import description and find import module.
@@ -125,12 +138,12 @@ Interpreter::instantiate(Runtime::StoreManager &StoreMgr,
       const auto *TargetInst = *StoreMgr.getFunction(TargetAddr);
       const auto &TargetType = TargetInst->getFuncType();
       const auto *FuncType = *ModInst.getFuncType(TypeIdx);
-      if (TargetType.Params != FuncType->Params ||
-          TargetType.Returns != FuncType->Returns) {
+      if (TargetType.getTypeId() != FuncType->getTypeId()) {
         LOG(ERROR) << ErrCode::IncompatibleImportType;
-        LOG(ERROR) << ErrInfo::InfoMismatch(FuncType->Params, FuncType->Returns,
-                                            TargetType.Params,
-                                            TargetType.Returns);
+        LOG(ERROR) << ErrInfo::InfoMismatch(FuncType->getParamTypes(),
+                                            FuncType->getReturnTypes(),
+                                            TargetType.getParamTypes(),
+                                            TargetType.getReturnTypes());
         LOG(ERROR) << ErrInfo::InfoLinking(ModName, ExtName, ExtType);
         LOG(ERROR) << ErrInfo::InfoAST(ImpDesc.NodeAttr);
         return Unexpect(ErrCode::IncompatibleImportType);
@@ -171,7 +184,8 @@ Interpreter::instantiate(Runtime::StoreManager &StoreMgr,
       const auto &MemLim = MemType.getLimit();
       if (!isLimitMatched(TargetInst->getHasMax(), TargetInst->getMin(),
                           TargetInst->getMax(), MemLim.hasMax(),
-                          MemLim.getMin(), MemLim.getMax())) {
+                          MemLim.getMin(), MemLim.getMax()) ||
+          TargetInst->isShared() != MemLim.isShared()) {
         LOG(ERROR) << ErrCode::IncompatibleImportType;
         LOG(ERROR) << ErrInfo::InfoMismatch(
             MemLim.hasMax(), MemLim.getMin(), MemLim.getMax(),
@@ -181,6 +195,13 @@ Interpreter::instantiate(Runtime::StoreManager &StoreMgr,
         LOG(ERROR) << ErrInfo::InfoAST(ImpDesc.NodeAttr);
         return Unexpect(ErrCode::IncompatibleImportType);
       }
+      if (GuardPages && !TargetInst->hasGuardPages()) {
+        LOG(ERROR) << ErrCode::IncompatibleImportType;
+        LOG(ERROR) << "Compiled code needs guard pages after the memory";
+        LOG(ERROR) << ErrInfo::InfoLinking(ModName, ExtName, ExtType);
+        LOG(ERROR) << ErrInfo::InfoAST(ImpDesc.NodeAttr);
+        return Unexpect(ErrCode::IncompatibleImportType);
+      }
       /// Set the matched memory address to module instance.
       ModInst.importMemory(TargetAddr);
       break;
@@ -204,6 +225,27 @@ Interpreter::instantiate(Runtime::StoreManager &StoreMgr,
       ModInst.importGlobal(TargetAddr);
       break;
     }
+    case ExternalType::Tag: {
+      /// Get tag type index. External type checked in validation.
+      uint32_t TypeIdx = ImpDesc.getExternalTagTypeIdx();
+      /// Import matching.
+      const auto *TargetInst = *StoreMgr.getTag(TargetAddr);
+      const auto &TargetType = TargetInst->getTagType();
+      const auto *TagType = *ModInst.getFuncType(TypeIdx);
+      if (TargetType.getTypeId() != TagType->getTypeId()) {
+        LOG(ERROR) << ErrCode::IncompatibleImportType;
+        LOG(ERROR) << ErrInfo::InfoMismatch(TagType->getParamTypes(),
+                                            TagType->getReturnTypes(),
+                                            TargetType.getParamTypes(),
+                                            TargetType.getReturnTypes());
+        LOG(ERROR) << ErrInfo::InfoLinking(ModName, ExtName, ExtType);
+        LOG(ERROR) << ErrInfo::InfoAST(ImpDesc.NodeAttr);
+        return Unexpect(ErrCode::IncompatibleImportType);
+      }
+      /// Set the matched tag address to module instance.
+      ModInst.importTag(TargetAddr);
+      break;
+    }
     default:
       break;
     }
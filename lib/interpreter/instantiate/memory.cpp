@@ -11,22 +11,28 @@ namespace Interpreter {
 Expect<void>
 Interpreter::instantiate(Runtime::StoreManager &StoreMgr,
                          Runtime::Instance::ModuleInstance &ModInst,
-                         const AST::MemorySection &MemSec) {
+                         const AST::MemorySection &MemSec,
+                         const bool GuardPages) {
   /// Iterate and istantiate memory types.
   for (const auto &MemType : MemSec.getContent()) {
     /// Insert memory instance to store manager.
-    uint32_t NewMemInstAddr;
-    if (InsMode == InstantiateMode::Instantiate) {
-      NewMemInstAddr =
-          StoreMgr.pushMemory(MemType.getLimit(), Conf.getMaxMemoryPage());
-    } else {
-      NewMemInstAddr =
-          StoreMgr.importMemory(MemType.getLimit(), Conf.getMaxMemoryPage());
-    }
-    ModInst.addMemAddr(NewMemInstAddr);
+    ModInst.addMemAddr(insertMemory(StoreMgr, MemType.getLimit(), GuardPages));
   }
   return {};
 }
 
+/// Insert memory instance. See "include/interpreter/interpreter.h".
+uint32_t Interpreter::insertMemory(Runtime::StoreManager &StoreMgr,
+                                   const AST::Limit &Lim,
+                                   const bool GuardPages) {
+  if (InsMode == InstantiateMode::Instantiate) {
+    return StoreMgr.pushMemory(Lim, Conf.getMaxMemoryPage(), GuardPages,
+                               Conf.getMemoryReservePage());
+  } else {
+    return StoreMgr.importMemory(Lim, Conf.getMaxMemoryPage(), GuardPages,
+                                 Conf.getMemoryReservePage());
+  }
+}
+
 } // namespace Interpreter
 } // namespace SSVM
@@ -13,8 +13,7 @@ Expect<void> Interpreter::instantiate(Runtime::StoreManager &StoreMgr,
                                       const AST::Module &Mod,
                                       std::string_view Name) {
   /// Reset store manager and stack manager.
-  StoreMgr.reset();
-  StackMgr.reset();
+  resetInstantiation(StoreMgr);
 
   /// Check is module name duplicated.
   if (auto Res = StoreMgr.findModule(Name)) {
@@ -35,13 +34,14 @@ Expect<void> Interpreter::instantiate(Runtime::StoreManager &StoreMgr,
   /// Instantiate Function Types in Module Instance. (TypeSec)
   for (auto &FuncType : Mod.getTypeSection().getContent()) {
     /// Copy param and return lists to module instance.
-    ModInst->addFuncType(FuncType.getParamTypes(), FuncType.getReturnTypes(),
-                         FuncType.getSymbol());
+    ModInst->addFuncType(FuncType);
   }
 
   /// Instantiate ImportSection and do import matching. (ImportSec)
   const AST::ImportSection &ImportSec = Mod.getImportSection();
-  if (auto Res = instantiate(StoreMgr, *ModInst, ImportSec); !Res) {
+  if (auto Res =
+          instantiate(StoreMgr, *ModInst, ImportSec, Mod.needsGuardPages());
+      !Res) {
     LOG(ERROR) << ErrInfo::InfoAST(ImportSec.NodeAttr);
     LOG(ERROR) << ErrInfo::InfoAST(Mod.NodeAttr);
     return Unexpect(Res);
@@ -66,12 +66,22 @@ Expect<void> Interpreter::instantiate(Runtime::StoreManager &StoreMgr,
 
   /// Instantiate MemorySection (MemorySec)
   const AST::MemorySection &MemSec = Mod.getMemorySection();
-  if (auto Res = instantiate(StoreMgr, *ModInst, MemSec); !Res) {
+  if (auto Res = instantiate(StoreMgr, *ModInst, MemSec,
+                             !Mod.hasExplicitBoundsChecks());
+      !Res) {
     LOG(ERROR) << ErrInfo::InfoAST(MemSec.NodeAttr);
     LOG(ERROR) << ErrInfo::InfoAST(Mod.NodeAttr);
     return Unexpect(Res);
   }
 
+  /// Instantiate TagSection (TagSec)
+  const AST::TagSection &TagSec = Mod.getTagSection();
+  if (auto Res = instantiate(StoreMgr, *ModInst, TagSec); !Res) {
+    LOG(ERROR) << ErrInfo::InfoAST(TagSec.NodeAttr);
+    LOG(ERROR) << ErrInfo::InfoAST(Mod.NodeAttr);
+    return Unexpect(Res);
+  }
+
   /// Add a temp module to Store with only imported globals for initialization.
   uint32_t TmpModInstAddr = StoreMgr.pushModule("");
   auto *TmpModInst = *StoreMgr.getModule(TmpModInstAddr);
@@ -83,7 +93,10 @@ Expect<void> Interpreter::instantiate(Runtime::StoreManager &StoreMgr,
   }
 
   /// Push a new frame {TmpModInst:{globaddrs}, locals:none}
-  StackMgr.pushFrame(TmpModInstAddr, 0, 0);
+  if (auto Res = StackMgr.pushFrame(TmpModInstAddr, 0, 0); unlikely(!Res)) {
+    return Unexpect(Res);
+  }
+  updateFrameCache(StoreMgr);
 
   /// Instantiate GlobalSection (GlobalSec)
   const AST::GlobalSection &GlobSec = Mod.getGlobalSection();
@@ -95,6 +108,7 @@ Expect<void> Interpreter::instantiate(Runtime::StoreManager &StoreMgr,
 
   /// Pop frame with temp. module.
   StackMgr.popFrame();
+  resetFrameCache();
 
   /// Pop the added temp. module.
   StoreMgr.popModule();
@@ -108,7 +122,10 @@ Expect<void> Interpreter::instantiate(Runtime::StoreManager &StoreMgr,
   }
 
   /// Push a new frame {ModInst, locals:none}
-  StackMgr.pushFrame(ModInst->Addr, 0, 0);
+  if (auto Res = StackMgr.pushFrame(ModInst->Addr, 0, 0); unlikely(!Res)) {
+    return Unexpect(Res);
+  }
+  updateFrameCache(StoreMgr);
 
   /// Instantiate ElementSection (ElemSec)
   const AST::ElementSection &ElemSec = Mod.getElementSection();
@@ -141,42 +158,13 @@ Expect<void> Interpreter::instantiate(Runtime::StoreManager &StoreMgr,
   }
 
   /// Prepare pointers for compiled functions
-  ModInst->MemoryPtr =
-      ModInst->getMemAddr(0)
-          .and_then([&StoreMgr](uint32_t MemAddr) {
-            return StoreMgr.getMemory(MemAddr);
-          })
-          .map([](const Runtime::Instance::MemoryInstance *MemInst) {
-            return MemInst->getDataPtr();
-          })
-          .value_or(nullptr);
-
-  ModInst->GlobalsPtr.reserve(ModInst->getGlobalNum());
-  for (size_t I = 0; I < ModInst->getGlobalNum(); ++I) {
-    ModInst->GlobalsPtr.push_back(
-        &(*StoreMgr.getGlobal(*ModInst->getGlobalAddr(I)))->getValue());
-  }
+  prepareExecutionContext(StoreMgr, *ModInst);
 
   /// Instantiate StartSection (StartSec)
   const AST::StartSection &StartSec = Mod.getStartSection();
   if (StartSec.getContent()) {
-    /// Get the module instance from ID.
-    ModInst->setStartIdx(*StartSec.getContent());
-
-    /// Get function instance.
-    const uint32_t Addr = *ModInst->getStartAddr();
-    const auto *FuncInst = *StoreMgr.getFunction(Addr);
-
-    /// Execute instruction: call start.func
-    auto Instrs = FuncInst->getInstrs();
-    AST::InstrView::iterator StartIt;
-    if (auto Res = enterFunction(StoreMgr, *FuncInst, Instrs.end() - 1)) {
-      StartIt = *Res;
-    } else {
-      LOG(ERROR) << ErrInfo::InfoAST(Mod.NodeAttr);
-      return Unexpect(Res);
-    }
-    if (auto Res = execute(StoreMgr, StartIt, Instrs.end()); unlikely(!Res)) {
+    if (auto Res = runStartFunction(StoreMgr, *ModInst, *StartSec.getContent());
+        !Res) {
       LOG(ERROR) << ErrInfo::InfoAST(Mod.NodeAttr);
       return Unexpect(Res);
     }
@@ -184,9 +172,121 @@ Expect<void> Interpreter::instantiate(Runtime::StoreManager &StoreMgr,
 
   /// Pop Frame.
   StackMgr.popFrame();
+  resetFrameCache();
+
+  return {};
+}
+
+/// Reset the states for instantiation. See
+/// "include/interpreter/interpreter.h".
+void Interpreter::resetInstantiation(Runtime::StoreManager &StoreMgr) {
+  StoreMgr.reset();
+  StackMgr.reset();
+  Thrown.reset();
+  Caught.clear();
+  CompiledCaught.clear();
+  resetFrameCache();
+}
+
+/// Run the start function. See "include/interpreter/interpreter.h".
+Expect<void>
+Interpreter::runStartFunction(Runtime::StoreManager &StoreMgr,
+                              Runtime::Instance::ModuleInstance &ModInst,
+                              const uint32_t StartIdx) {
+  /// Get the module instance from ID.
+  ModInst.setStartIdx(StartIdx);
+
+  /// Get function instance.
+  const uint32_t Addr = *ModInst.getStartAddr();
+  const auto *FuncInst = *StoreMgr.getFunction(Addr);
 
+  /// Resolve the global values prepared for the module frame.
+  resetFrameCache();
+  updateFrameCache(StoreMgr);
+
+  /// Execute instruction: call start.func
+  auto Instrs = FuncInst->getInstrs();
+  AST::InstrView::iterator StartIt;
+  if (auto Res = enterFunction(StoreMgr, *FuncInst, Instrs.end() - 1)) {
+    StartIt = *Res;
+  } else {
+    if (Res.error() == ErrCode::UncaughtException) {
+      LOG(ERROR) << ErrCode::UncaughtException;
+    }
+    return Unexpect(Res);
+  }
+  if (auto Res = execute(StoreMgr, StartIt, Instrs.end()); unlikely(!Res)) {
+    if (Res.error() == ErrCode::UncaughtException) {
+      LOG(ERROR) << ErrCode::UncaughtException;
+    }
+    return Unexpect(Res);
+  }
   return {};
 }
 
+/// Prepare the execution context of module. See "include/interpreter/interpreter.h".
+void Interpreter::prepareExecutionContext(
+    Runtime::StoreManager &StoreMgr,
+    Runtime::Instance::ModuleInstance &ModInst) {
+  ModInst.MemoryPtr = nullptr;
+  ModInst.MemoryPagesPtr = nullptr;
+  if (ModInst.getMemNum() > 0) {
+    const auto *MemInst = StoreMgr.unsafeGetMemory(ModInst.unsafeGetMemAddr(0));
+    ModInst.MemoryPtr = MemInst->getDataPtrAddr();
+    ModInst.MemoryPagesPtr = MemInst->getDataPageSizeAddr();
+  }
+
+  ModInst.GlobalsPtr.reserve(ModInst.getGlobalNum());
+  for (uint32_t I = 0; I < ModInst.getGlobalNum(); ++I) {
+    ModInst.GlobalsPtr.push_back(
+        &StoreMgr.unsafeGetGlobal(ModInst.unsafeGetGlobalAddr(I))->getValue());
+  }
+
+  /// Canonical type ids for the type checks of `call_indirect`.
+  ModInst.FuncTypeIds.reserve(ModInst.getFuncTypeNum());
+  for (uint32_t I = 0; I < ModInst.getFuncTypeNum(); ++I) {
+    ModInst.FuncTypeIds.push_back(ModInst.unsafeGetFuncType(I).getTypeId());
+  }
+
+  ModInst.TablesPtr.reserve(ModInst.getTableNum());
+  for (uint32_t I = 0; I < ModInst.getTableNum(); ++I) {
+    ModInst.TablesPtr.push_back(
+        StoreMgr.unsafeGetTable(ModInst.unsafeGetTableAddr(I))
+            ->getCompiledTable());
+  }
+
+  /// Direct calls into the native thunks of imported host functions.
+  auto *MemInst = ModInst.getMemNum() > 0 ? StoreMgr.unsafeGetMemory(
+                                                ModInst.unsafeGetMemAddr(0))
+                                          : nullptr;
+  ModInst.HostCalls.assign(ModInst.getFuncImportNum(), {});
+  for (uint32_t I = 0; I < ModInst.getFuncImportNum(); ++I) {
+    const auto *FuncInst =
+        StoreMgr.unsafeGetFunction(ModInst.unsafeGetFuncAddr(I));
+    if (!FuncInst->isHostFunction()) {
+      continue;
+    }
+    auto &HostFunc = FuncInst->getHostFunc();
+    if (void *Thunk = HostFunc.getThunk()) {
+      ModInst.HostCalls[I] = {Thunk, &HostFunc, MemInst, Stat, &hostTrap,
+                              &signalDisable, &signalEnable};
+    }
+  }
+
+  auto &ExecCtx = ModInst.ExecCtx;
+  ExecCtx.Memory = ModInst.MemoryPtr;
+  ExecCtx.Globals = ModInst.GlobalsPtr.data();
+  ExecCtx.FuncTypeIds = ModInst.FuncTypeIds.data();
+  ExecCtx.Tables = ModInst.TablesPtr.data();
+  ExecCtx.MemoryPages = ModInst.MemoryPagesPtr;
+  ExecCtx.GlobalsBlock = ModInst.GlobalsBlock.get();
+  ExecCtx.HostCalls = ModInst.HostCalls.data();
+  if (Stat) {
+    ExecCtx.InstrCount = &Stat->getInstrCountRef();
+    ExecCtx.CostTable = Stat->getCostTable().data();
+    ExecCtx.Gas = &Stat->getTotalCostRef();
+  }
+}
+
 } // namespace Interpreter
 } // namespace SSVM
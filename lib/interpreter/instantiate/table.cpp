@@ -15,18 +15,21 @@ Interpreter::instantiate(Runtime::StoreManager &StoreMgr,
   /// Iterate and instantiate table types.
   for (const auto &TabType : TabSec.getContent()) {
     /// Insert table instance to store manager.
-    uint32_t NewTabInstAddr;
-    if (InsMode == InstantiateMode::Instantiate) {
-      NewTabInstAddr =
-          StoreMgr.pushTable(TabType.getReferenceType(), TabType.getLimit());
-    } else {
-      NewTabInstAddr =
-          StoreMgr.importTable(TabType.getReferenceType(), TabType.getLimit());
-    }
-    ModInst.addTableAddr(NewTabInstAddr);
+    ModInst.addTableAddr(insertTable(StoreMgr, TabType.getReferenceType(),
+                                     TabType.getLimit()));
   }
   return {};
 }
 
+/// Insert table instance. See "include/interpreter/interpreter.h".
+uint32_t Interpreter::insertTable(Runtime::StoreManager &StoreMgr,
+                                  const RefType Type, const AST::Limit &Lim) {
+  if (InsMode == InstantiateMode::Instantiate) {
+    return StoreMgr.pushTable(Type, Lim);
+  } else {
+    return StoreMgr.importTable(Type, Lim);
+  }
+}
+
 } // namespace Interpreter
 } // namespace SSVM
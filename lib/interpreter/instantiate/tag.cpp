@@ -0,0 +1,34 @@
+// SPDX-License-Identifier: Apache-2.0
+#include "runtime/instance/tag.h"
+#include "ast/section.h"
+#include "interpreter/interpreter.h"
+#include "runtime/instance/module.h"
+
+namespace SSVM {
+namespace Interpreter {
+
+/// Instantiate tag instance. See "include/interpreter/interpreter.h".
+Expect<void>
+Interpreter::instantiate(Runtime::StoreManager &StoreMgr,
+                         Runtime::Instance::ModuleInstance &ModInst,
+                         const AST::TagSection &TagSec) {
+  /// Iterate and instantiate tag types.
+  for (const auto &TypeIdx : TagSec.getContent()) {
+    /// Insert tag instance to store manager.
+    ModInst.addTagAddr(insertTag(StoreMgr, **ModInst.getFuncType(TypeIdx)));
+  }
+  return {};
+}
+
+/// Insert tag instance. See "include/interpreter/interpreter.h".
+uint32_t Interpreter::insertTag(Runtime::StoreManager &StoreMgr,
+                                const Runtime::Instance::FType &Type) {
+  if (InsMode == InstantiateMode::Instantiate) {
+    return StoreMgr.pushTag(Type);
+  } else {
+    return StoreMgr.importTag(Type);
+  }
+}
+
+} // namespace Interpreter
+} // namespace SSVM
@@ -0,0 +1,323 @@
+// SPDX-License-Identifier: Apache-2.0
+#include "runtime/modtemplate.h"
+#include "ast/module.h"
+#include "ast/section.h"
+#include "common/log.h"
+#include "interpreter/interpreter.h"
+#include "runtime/instance/module.h"
+
+namespace SSVM {
+namespace Interpreter {
+
+namespace {
+/// Evaluate a validated constant expression without running the engine.
+/// Imported globals used by `global.get` are immutable, so their values are
+/// fixed once the imports are resolved.
+Runtime::ModuleTemplate::InitValue
+evalConstExpr(Runtime::StoreManager &StoreMgr,
+              const Runtime::Instance::ModuleInstance &ModInst,
+              AST::InstrView Instrs) {
+  Runtime::ModuleTemplate::InitValue Init{uint32_t(0), std::nullopt};
+  for (const auto &Instr : Instrs) {
+    switch (Instr.getOpCode()) {
+    case OpCode::I32__const:
+    case OpCode::I64__const:
+    case OpCode::F32__const:
+    case OpCode::F64__const:
+    case OpCode::V128__const:
+      Init = {Instr.getNum(), std::nullopt};
+      break;
+    case OpCode::Global__get: {
+      const uint32_t Addr = *ModInst.getGlobalAddr(Instr.getTargetIndex());
+      Init = {(*StoreMgr.getGlobal(Addr))->getValue(), std::nullopt};
+      break;
+    }
+    case OpCode::Ref__null:
+      Init = {genNullRef(Instr.getReferenceType()), std::nullopt};
+      break;
+    case OpCode::Ref__func:
+      Init = {uint32_t(0), Instr.getTargetIndex()};
+      break;
+    default:
+      break;
+    }
+  }
+  return Init;
+}
+
+/// Resolve the evaluated value against the new module instance.
+ValVariant resolveInit(const Runtime::Instance::ModuleInstance &ModInst,
+                       const Runtime::ModuleTemplate::InitValue &Init) {
+  if (Init.FuncIdx) {
+    return genFuncRef(*ModInst.getFuncAddr(*Init.FuncIdx));
+  }
+  return Init.Value;
+}
+} // namespace
+
+/// Prepare module template. See "include/interpreter/interpreter.h".
+Expect<Runtime::ModuleTemplate>
+Interpreter::prepareModule(Runtime::StoreManager &StoreMgr,
+                           const AST::Module &Mod) {
+  Runtime::ModuleTemplate Tmpl;
+
+  /// Copy function types. (TypeSec)
+  Runtime::Instance::ModuleInstance Linked("");
+  for (auto &FuncType : Mod.getTypeSection().getContent()) {
+    Tmpl.FuncTypes.emplace_back(FuncType);
+    Linked.addFuncType(FuncType);
+  }
+
+  /// Resolve and match imports once. (ImportSec)
+  const AST::ImportSection &ImportSec = Mod.getImportSection();
+  if (auto Res =
+          instantiate(StoreMgr, Linked, ImportSec, Mod.needsGuardPages());
+      !Res) {
+    LOG(ERROR) << ErrInfo::InfoAST(ImportSec.NodeAttr);
+    LOG(ERROR) << ErrInfo::InfoAST(Mod.NodeAttr);
+    return Unexpect(Res);
+  }
+  for (uint32_t I = 0; I < Linked.getFuncImportNum(); ++I) {
+    Tmpl.ImpFuncAddrs.push_back(*Linked.getFuncAddr(I));
+  }
+  for (uint32_t I = 0; I < Linked.getTableImportNum(); ++I) {
+    Tmpl.ImpTableAddrs.push_back(*Linked.getTableAddr(I));
+  }
+  for (uint32_t I = 0; I < Linked.getMemImportNum(); ++I) {
+    Tmpl.ImpMemAddrs.push_back(*Linked.getMemAddr(I));
+  }
+  for (uint32_t I = 0; I < Linked.getGlobalImportNum(); ++I) {
+    Tmpl.ImpGlobalAddrs.push_back(*Linked.getGlobalAddr(I));
+  }
+  for (uint32_t I = 0; I < Linked.getTagImportNum(); ++I) {
+    Tmpl.ImpTagAddrs.push_back(*Linked.getTagAddr(I));
+  }
+
+  /// Collect function bodies. (FunctionSec, CodeSec)
+  const auto TypeIdxs = Mod.getFunctionSection().getContent();
+  const auto CodeSegs = Mod.getCodeSection().getContent();
+  for (uint32_t I = 0; I < CodeSegs.size(); ++I) {
+    Tmpl.Functions.push_back({TypeIdxs[I], CodeSegs[I].getBody(),
+                              CodeSegs[I].getMaxStackHeight(),
+                              CodeSegs[I].getSymbol()});
+  }
+
+  /// Collect tables, memories, and tags. (TableSec, MemorySec, TagSec)
+  for (const auto &TabType : Mod.getTableSection().getContent()) {
+    Tmpl.Tables.push_back({TabType.getReferenceType(), TabType.getLimit()});
+  }
+  for (const auto &MemType : Mod.getMemorySection().getContent()) {
+    Tmpl.Memories.push_back(MemType.getLimit());
+  }
+  for (const auto &TypeIdx : Mod.getTagSection().getContent()) {
+    Tmpl.Tags.push_back(TypeIdx);
+  }
+  Tmpl.GuardPages = !Mod.hasExplicitBoundsChecks();
+
+  /// Evaluate global initializers. (GlobalSec)
+  for (const auto &GlobSeg : Mod.getGlobalSection().getContent()) {
+    const auto &GlobType = GlobSeg.getGlobalType();
+    Tmpl.Globals.push_back({GlobType.getValueType(),
+                            GlobType.getValueMutation(),
+                            evalConstExpr(StoreMgr, Linked,
+                                          GlobSeg.getInstrs())});
+  }
+
+  /// Evaluate element offsets and initializers. (ElemSec)
+  for (const auto &ElemSeg : Mod.getElementSection().getContent()) {
+    Runtime::ModuleTemplate::Element Elem{ElemSeg.getMode(),
+                                          ElemSeg.getRefType(),
+                                          ElemSeg.getIdx(),
+                                          0,
+                                          {}};
+    if (ElemSeg.getMode() == AST::ElementSegment::ElemMode::Active) {
+      Elem.Offset = retrieveValue<uint32_t>(
+          evalConstExpr(StoreMgr, Linked, ElemSeg.getInstrs()).Value);
+    }
+    Elem.Inits.reserve(ElemSeg.getInitExprs().size());
+    for (const auto &Expr : ElemSeg.getInitExprs()) {
+      Elem.Inits.push_back(evalConstExpr(StoreMgr, Linked, Expr.getInstrs()));
+    }
+    Tmpl.Elements.push_back(std::move(Elem));
+  }
+
+  /// Evaluate data offsets. (DataSec)
+  for (const auto &DataSeg : Mod.getDataSection().getContent()) {
+    Runtime::ModuleTemplate::Data Data{DataSeg.getMode(), DataSeg.getIdx(), 0,
+                                       {}};
+    if (DataSeg.getMode() == AST::DataSegment::DataMode::Active) {
+      Data.Offset = retrieveValue<uint32_t>(
+          evalConstExpr(StoreMgr, Linked, DataSeg.getInstrs()).Value);
+    }
+    Data.Bytes.assign(DataSeg.getData().begin(), DataSeg.getData().end());
+    Tmpl.Datas.push_back(std::move(Data));
+  }
+
+  /// Collect exports and start function. (ExportSec, StartSec)
+  for (const auto &ExpDesc : Mod.getExportSection().getContent()) {
+    Tmpl.Exports.push_back({ExpDesc.getExternalType(),
+                            std::string(ExpDesc.getExternalName()),
+                            ExpDesc.getExternalIndex()});
+  }
+  if (Mod.getStartSection().getContent()) {
+    Tmpl.StartIdx = *Mod.getStartSection().getContent();
+  }
+
+  return Tmpl;
+}
+
+/// Instantiate module from template. See "include/interpreter/interpreter.h".
+Expect<void>
+Interpreter::instantiateModule(Runtime::StoreManager &StoreMgr,
+                               const Runtime::ModuleTemplate &Tmpl) {
+  InsMode = InstantiateMode::Instantiate;
+
+  /// Reset store manager and stack manager.
+  resetInstantiation(StoreMgr);
+
+  const uint32_t ModInstAddr = StoreMgr.pushModule("");
+  auto *ModInst = *StoreMgr.getModule(ModInstAddr);
+
+  /// Copy function types and the resolved imports.
+  for (const auto &FuncType : Tmpl.FuncTypes) {
+    ModInst->addFuncType(FuncType);
+  }
+  for (const uint32_t Addr : Tmpl.ImpFuncAddrs) {
+    ModInst->importFunction(Addr);
+  }
+  for (const uint32_t Addr : Tmpl.ImpTableAddrs) {
+    ModInst->importTable(Addr);
+  }
+  for (const uint32_t Addr : Tmpl.ImpMemAddrs) {
+    ModInst->importMemory(Addr);
+  }
+  for (const uint32_t Addr : Tmpl.ImpGlobalAddrs) {
+    ModInst->importGlobal(Addr);
+  }
+  for (const uint32_t Addr : Tmpl.ImpTagAddrs) {
+    ModInst->importTag(Addr);
+  }
+
+  /// Allocate functions, tables, memories, tags, and globals.
+  for (const auto &Func : Tmpl.Functions) {
+    ModInst->addFuncAddr(insertFunction(StoreMgr, ModInst->Addr,
+                                        **ModInst->getFuncType(Func.TypeIdx),
+                                        Func.Body, Func.MaxStackHeight,
+                                        Func.Symbol));
+  }
+  for (const auto &Tab : Tmpl.Tables) {
+    ModInst->addTableAddr(insertTable(StoreMgr, Tab.Type, Tab.Lim));
+  }
+  for (const auto &Lim : Tmpl.Memories) {
+    ModInst->addMemAddr(insertMemory(StoreMgr, Lim, Tmpl.GuardPages));
+  }
+  for (const uint32_t TypeIdx : Tmpl.Tags) {
+    ModInst->addTagAddr(insertTag(StoreMgr, **ModInst->getFuncType(TypeIdx)));
+  }
+  ModInst->GlobalsBlock = std::make_unique<ValVariant[]>(Tmpl.Globals.size());
+  for (uint32_t I = 0; I < Tmpl.Globals.size(); ++I) {
+    const auto &Glob = Tmpl.Globals[I];
+    ModInst->addGlobalAddr(insertGlobal(StoreMgr, ModInst->GlobalsBlock[I],
+                                        Glob.Type, Glob.Mut,
+                                        resolveInit(*ModInst, Glob.Init)));
+  }
+
+  /// Add exports.
+  for (const auto &Exp : Tmpl.Exports) {
+    addExport(*ModInst, Exp.Type, Exp.Name, Exp.Idx);
+  }
+
+  /// Push a new frame {ModInst, locals:none}
+  if (auto Res = StackMgr.pushFrame(ModInst->Addr, 0, 0); unlikely(!Res)) {
+    return Unexpect(Res);
+  }
+  updateFrameCache(StoreMgr);
+
+  /// Create element instances. Active and declarative segments are dropped
+  /// right after table initialization, so only passive ones keep references.
+  std::vector<RefVariant> Refs;
+  for (const auto &Elem : Tmpl.Elements) {
+    if (Elem.Mode == AST::ElementSegment::ElemMode::Active) {
+      if (auto Res = checkElemSegBound(StoreMgr, Elem.TableIdx, Elem.Offset,
+                                       Elem.Inits.size());
+          !Res) {
+        LOG(ERROR) << ErrInfo::InfoAST(ASTNodeAttr::Seg_Element);
+        return Unexpect(Res);
+      }
+    }
+    Refs.clear();
+    if (Elem.Mode == AST::ElementSegment::ElemMode::Passive) {
+      for (const auto &Init : Elem.Inits) {
+        Refs.push_back(retrieveValue<uint64_t>(resolveInit(*ModInst, Init)));
+      }
+    }
+    ModInst->addElemAddr(insertElement(StoreMgr, Elem.Offset, Elem.Type, Refs));
+  }
+
+  /// Create data instances. Active segments are copied from the template.
+  for (const auto &Data : Tmpl.Datas) {
+    if (Data.Mode == AST::DataSegment::DataMode::Active) {
+      if (auto Res = checkDataSegBound(StoreMgr, Data.MemoryIdx, Data.Offset,
+                                       Data.Bytes.size());
+          !Res) {
+        LOG(ERROR) << ErrInfo::InfoAST(ASTNodeAttr::Seg_Data);
+        return Unexpect(Res);
+      }
+    }
+    if (Data.Mode == AST::DataSegment::DataMode::Passive) {
+      ModInst->addDataAddr(insertData(StoreMgr, Data.Offset, Data.Bytes));
+    } else {
+      ModInst->addDataAddr(insertData(StoreMgr, Data.Offset, {}));
+    }
+  }
+
+  /// Initialize tables.
+  for (const auto &Elem : Tmpl.Elements) {
+    if (Elem.Mode != AST::ElementSegment::ElemMode::Active) {
+      continue;
+    }
+    Refs.clear();
+    for (const auto &Init : Elem.Inits) {
+      Refs.push_back(retrieveValue<uint64_t>(resolveInit(*ModInst, Init)));
+    }
+    auto *TabInst = getTabInstByIdx(StoreMgr, Elem.TableIdx);
+    if (auto Res = TabInst->setRefs(Refs, Elem.Offset, 0, Refs.size()); !Res) {
+      LOG(ERROR) << ErrInfo::InfoAST(ASTNodeAttr::Seg_Element);
+      return Unexpect(Res);
+    }
+  }
+
+  /// Initialize memories.
+  for (const auto &Data : Tmpl.Datas) {
+    if (Data.Mode != AST::DataSegment::DataMode::Active) {
+      continue;
+    }
+    auto *MemInst = getMemInstByIdx(StoreMgr, Data.MemoryIdx);
+    if (auto Res = MemInst->setBytes(Data.Bytes, Data.Offset, 0,
+                                     Data.Bytes.size());
+        !Res) {
+      LOG(ERROR) << ErrInfo::InfoAST(ASTNodeAttr::Seg_Data);
+      return Unexpect(Res);
+    }
+  }
+
+  /// Prepare pointers for compiled functions
+  prepareExecutionContext(StoreMgr, *ModInst);
+
+  /// Run the start function.
+  if (Tmpl.StartIdx) {
+    if (auto Res = runStartFunction(StoreMgr, *ModInst, *Tmpl.StartIdx);
+        !Res) {
+      return Unexpect(Res);
+    }
+  }
+
+  /// Pop Frame.
+  StackMgr.popFrame();
+  resetFrameCache();
+
+  return {};
+}
+
+} // namespace Interpreter
+} // namespace SSVM
@@ -80,23 +80,25 @@ Interpreter::invoke(Runtime::StoreManager &StoreMgr, const uint32_t FuncAddr,
 
   /// Check parameter and function type.
   const auto &FuncType = FuncInst->getFuncType();
-  if (FuncType.Params.size() > Params.size()) {
+  if (FuncType.getParamTypes().size() > Params.size()) {
     std::vector<ValType> GotParams;
     for (size_t I = 0; I < Params.size(); ++I) {
-      GotParams.push_back(FuncType.Params[I]);
+      GotParams.push_back(FuncType.getParamTypes()[I]);
     }
     LOG(ERROR) << ErrCode::FuncSigMismatch;
-    LOG(ERROR) << ErrInfo::InfoMismatch(FuncType.Params, FuncType.Returns,
-                                        GotParams, FuncType.Returns);
+    LOG(ERROR) << ErrInfo::InfoMismatch(FuncType.getParamTypes(),
+                                        FuncType.getReturnTypes(), GotParams,
+                                        FuncType.getReturnTypes());
     return Unexpect(ErrCode::FuncSigMismatch);
-  } else if (FuncType.Params.size() < Params.size()) {
-    std::vector<ValType> GotParams = FuncType.Params;
-    for (size_t I = FuncType.Params.size(); I < Params.size(); ++I) {
+  } else if (FuncType.getParamTypes().size() < Params.size()) {
+    std::vector<ValType> GotParams = FuncType.getParamTypes();
+    for (size_t I = FuncType.getParamTypes().size(); I < Params.size(); ++I) {
       GotParams.push_back(ValType::I32);
     }
     LOG(ERROR) << ErrCode::FuncSigMismatch;
-    LOG(ERROR) << ErrInfo::InfoMismatch(FuncType.Params, FuncType.Returns,
-                                        GotParams, FuncType.Returns);
+    LOG(ERROR) << ErrInfo::InfoMismatch(FuncType.getParamTypes(),
+                                        FuncType.getReturnTypes(), GotParams,
+                                        FuncType.getReturnTypes());
     return Unexpect(ErrCode::FuncSigMismatch);
   }
 
@@ -107,7 +109,7 @@ Interpreter::invoke(Runtime::StoreManager &StoreMgr, const uint32_t FuncAddr,
 
   /// Get return values.
   std::vector<ValVariant> Returns;
-  for (uint32_t I = 0; I < FuncType.Returns.size(); ++I) {
+  for (uint32_t I = 0; I < FuncType.getReturnTypes().size(); ++I) {
     Returns.emplace_back(StackMgr.pop());
   }
   std::reverse(Returns.begin(), Returns.end());
@@ -1,7 +1,51 @@
 // SPDX-License-Identifier: Apache-2.0
 #include "loader/ldmgr.h"
+#include "common/hash.h"
 #include "common/log.h"
 
+#include <string>
+
+namespace {
+
+/// Check whether the host CPU supports the feature named as in LLVM. Must
+/// cover the features recorded by the AOT compiler for code variants.
+bool hostHasFeature(std::string_view Name) noexcept {
+  using namespace std::literals;
+#if defined(__x86_64__)
+  __builtin_cpu_init();
+  const std::pair<std::string_view, bool> Features[] = {
+      {"sse3"sv, __builtin_cpu_supports("sse3")},
+      {"ssse3"sv, __builtin_cpu_supports("ssse3")},
+      {"sse4.1"sv, __builtin_cpu_supports("sse4.1")},
+      {"sse4.2"sv, __builtin_cpu_supports("sse4.2")},
+      {"popcnt"sv, __builtin_cpu_supports("popcnt")},
+      {"avx"sv, __builtin_cpu_supports("avx")},
+      {"avx2"sv, __builtin_cpu_supports("avx2")},
+      {"bmi"sv, __builtin_cpu_supports("bmi")},
+      {"bmi2"sv, __builtin_cpu_supports("bmi2")},
+      {"fma"sv, __builtin_cpu_supports("fma")},
+      {"avx512f"sv, __builtin_cpu_supports("avx512f")},
+      {"avx512bw"sv, __builtin_cpu_supports("avx512bw")},
+      {"avx512cd"sv, __builtin_cpu_supports("avx512cd")},
+      {"avx512dq"sv, __builtin_cpu_supports("avx512dq")},
+      {"avx512vl"sv, __builtin_cpu_supports("avx512vl")},
+      {"avx512vnni"sv, __builtin_cpu_supports("avx512vnni")},
+  };
+  for (const auto &[FeatureName, Supported] : Features) {
+    if (FeatureName == Name) {
+      return Supported;
+    }
+  }
+#elif defined(__aarch64__)
+  if (Name == "neon"sv) {
+    return true;
+  }
+#endif
+  return false;
+}
+
+} // namespace
+
 namespace SSVM {
 
 /// Set path to loadable manager. See "include/loader/ldmgr.h".
@@ -25,6 +69,22 @@ Expect<std::vector<Byte>> LDMgr::getWasm() {
   return std::vector<Byte>(Code.get(), Code.get() + *Size);
 }
 
+Expect<std::optional<Span<const Byte>>> LDMgr::getMetadata() {
+  const auto Size = getSymbol<uint32_t>("wasm.meta.size");
+  const auto Hash = getSymbol<uint64_t>("wasm.meta.hash");
+  const auto Meta = getSymbol<uint8_t>("wasm.meta");
+  if (!Size || !Hash || !Meta) {
+    return std::nullopt;
+  }
+  Span<const Byte> Data(Meta.get(), *Size);
+  if (hashBytes(Data) != *Hash) {
+    LOG(ERROR) << "metadata hash mismatched";
+    LOG(ERROR) << ErrCode::InvalidGrammar;
+    return Unexpect(ErrCode::InvalidGrammar);
+  }
+  return Data;
+}
+
 Expect<uint32_t> LDMgr::getVersion() {
   const auto Version = getSymbol<uint32_t>("version");
   if (!Version) {
@@ -34,4 +94,32 @@ Expect<uint32_t> LDMgr::getVersion() {
   return *Version;
 }
 
+Expect<std::optional<uint32_t>> LDMgr::getVariant() {
+  const auto Variants = getSymbol<uint32_t>("variants");
+  if (!Variants) {
+    return std::nullopt;
+  }
+  /// Variants are ordered from the baseline to the most capable target.
+  for (uint32_t I = *Variants; I-- > 0;) {
+    const auto Features =
+        getSymbol<const char>(("features." + std::to_string(I)).c_str());
+    if (!Features) {
+      LOG(ERROR) << ErrCode::InvalidGrammar;
+      return Unexpect(ErrCode::InvalidGrammar);
+    }
+    bool Supported = true;
+    std::string_view List(Features.get());
+    while (Supported && !List.empty()) {
+      const auto Pos = std::min(List.find(','), List.size());
+      Supported = hostHasFeature(List.substr(0, Pos));
+      List.remove_prefix(std::min(Pos + 1, List.size()));
+    }
+    if (Supported) {
+      return I;
+    }
+  }
+  LOG(ERROR) << "no code variant is supported by the host CPU";
+  return Unexpect(ErrCode::InvalidVersion);
+}
+
 } // namespace SSVM
@@ -3,7 +3,9 @@
 #include "aot/version.h"
 #include "common/filesystem.h"
 #include "common/log.h"
+#include "loader/perfmap.h"
 
+#include <algorithm>
 #include <string_view>
 
 namespace SSVM {
@@ -61,7 +63,20 @@ Loader::parseModule(const std::filesystem::path &FilePath) {
     }
 
     std::unique_ptr<AST::Module> Mod;
-    if (auto Code = LMgr.getWasm()) {
+    if (auto Meta = LMgr.getMetadata(); !Meta) {
+      LOG(ERROR) << ErrInfo::InfoFile(FilePath);
+      return Unexpect(Meta);
+    } else if (*Meta) {
+      /// The metadata carries no instructions and was validated before
+      /// compilation, so neither decoding nor validation is repeated.
+      if (auto Res = parseModule(**Meta)) {
+        Mod = std::move(*Res);
+        Mod->setValidated();
+      } else {
+        LOG(ERROR) << ErrInfo::InfoFile(FilePath);
+        return Unexpect(Res);
+      }
+    } else if (auto Code = LMgr.getWasm()) {
       if (auto Res = parseModule(*Code)) {
         Mod = std::move(*Res);
       } else {
@@ -72,12 +87,24 @@ Loader::parseModule(const std::filesystem::path &FilePath) {
       LOG(ERROR) << ErrInfo::InfoFile(FilePath);
       return Unexpect(Code);
     }
-    if (auto Res = Mod->loadCompiled(LMgr)) {
-      return Mod;
-    } else {
+    if (auto Res = Mod->loadCompiled(LMgr); !Res) {
       LOG(ERROR) << ErrInfo::InfoFile(FilePath);
       return Unexpect(Res);
     }
+    if (Mod->isValidated()) {
+      /// Function bodies in metadata cannot be interpreted.
+      for (const auto &CodeSeg : Mod->getCodeSection().getContent()) {
+        if (!CodeSeg.getSymbol()) {
+          LOG(ERROR) << ErrCode::InvalidGrammar;
+          LOG(ERROR) << ErrInfo::InfoFile(FilePath);
+          return Unexpect(ErrCode::InvalidGrammar);
+        }
+      }
+    }
+    if (Conf.hasPerfMap() || Conf.hasJitDump()) {
+      writeProfilerRecords(*Mod);
+    }
+    return Mod;
   } else {
     auto Mod = std::make_unique<AST::Module>();
     if (auto Res = FSMgr.setPath(FilePath); !Res) {
@@ -107,5 +134,58 @@ Loader::parseModule(Span<const uint8_t> Code) {
   }
 }
 
+/// Write profiler records. See "include/loader/loader.h".
+void Loader::writeProfilerRecords(const AST::Module &Mod) {
+  std::unordered_map<uint32_t, std::string> Names;
+  if (auto Meta = LMgr.getMetadata(); Meta && *Meta) {
+    Names = readFunctionNames(**Meta);
+  } else if (auto Code = LMgr.getWasm()) {
+    Names = readFunctionNames(*Code);
+  }
+  uint32_t ImpFuncNum = 0;
+  for (const auto &ImpDesc : Mod.getImportSection().getContent()) {
+    if (ImpDesc.getExternalType() == ExternalType::Function) {
+      ++ImpFuncNum;
+    }
+  }
+
+  std::vector<CodeRecord> Records;
+  const auto &CodeSegs = Mod.getCodeSection().getContent();
+  for (uint32_t I = 0; I < CodeSegs.size(); ++I) {
+    if (const auto &Symbol = CodeSegs[I].getSymbol()) {
+      const uint32_t FuncIdx = ImpFuncNum + I;
+      auto It = Names.find(FuncIdx);
+      Records.push_back(
+          {Symbol.get(), 0,
+           It != Names.end()
+               ? std::move(It->second)
+               : "wasm-function[" + std::to_string(FuncIdx) + "]"});
+    }
+  }
+
+  /// A function extends to the next one, or to the end of the code segment.
+  std::sort(Records.begin(), Records.end(),
+            [](const CodeRecord &LHS, const CodeRecord &RHS) {
+              return LHS.Address < RHS.Address;
+            });
+  for (size_t I = 0; I < Records.size(); ++I) {
+    const auto *Begin = static_cast<const uint8_t *>(Records[I].Address);
+    const auto *End = static_cast<const uint8_t *>(
+        LMgr.getCodeEnd(Records[I].Address));
+    if (I + 1 < Records.size() && End) {
+      End = std::min(End,
+                     static_cast<const uint8_t *>(Records[I + 1].Address));
+    }
+    Records[I].Size = End ? static_cast<uint64_t>(End - Begin) : 0;
+  }
+
+  if (Conf.hasPerfMap()) {
+    writePerfMap(Records);
+  }
+  if (Conf.hasJitDump()) {
+    writeJitDump(Records);
+  }
+}
+
 } // namespace Loader
 } // namespace SSVM
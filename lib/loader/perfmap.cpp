@@ -0,0 +1,284 @@
+// SPDX-License-Identifier: Apache-2.0
+#include "loader/perfmap.h"
+#include "common/defines.h"
+#include "common/log.h"
+
+#include <cinttypes>
+#include <cstdio>
+#include <cstdlib>
+#include <mutex>
+#include <string_view>
+
+#if SSVM_OS_LINUX
+#include <elf.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <time.h>
+#include <unistd.h>
+#endif
+
+namespace {
+
+using namespace SSVM;
+
+/// Read an unsigned LEB128 32-bit integer, and fail past the end of data.
+bool readU32(Span<const Byte> Data, size_t &Pos, uint32_t &Value) noexcept {
+  Value = 0;
+  for (uint32_t Shift = 0; Shift < 35; Shift += 7) {
+    if (Pos >= Data.size()) {
+      return false;
+    }
+    const Byte B = Data[Pos++];
+    Value |= static_cast<uint32_t>(B & 0x7FU) << Shift;
+    if ((B & 0x80U) == 0) {
+      return true;
+    }
+  }
+  return false;
+}
+
+/// Read a length-prefixed name, and fail past the end of data.
+bool readName(Span<const Byte> Data, size_t &Pos,
+              std::string_view &Name) noexcept {
+  uint32_t Size;
+  if (!readU32(Data, Pos, Size) || Size > Data.size() - Pos) {
+    return false;
+  }
+  Name = std::string_view(reinterpret_cast<const char *>(Data.data() + Pos),
+                          Size);
+  Pos += Size;
+  return true;
+}
+
+/// Read the function name map of the name section content.
+void readNameSection(Span<const Byte> Data,
+                     std::unordered_map<uint32_t, std::string> &Names) {
+  size_t Pos = 0;
+  while (Pos < Data.size()) {
+    const Byte Id = Data[Pos++];
+    uint32_t Size;
+    if (!readU32(Data, Pos, Size) || Size > Data.size() - Pos) {
+      return;
+    }
+    if (Id == 0x01U) {
+      const auto Sub = Data.subspan(Pos, Size);
+      size_t SubPos = 0;
+      uint32_t Count;
+      if (!readU32(Sub, SubPos, Count)) {
+        return;
+      }
+      for (uint32_t I = 0; I < Count; ++I) {
+        uint32_t Idx;
+        std::string_view Name;
+        if (!readU32(Sub, SubPos, Idx) || !readName(Sub, SubPos, Name)) {
+          return;
+        }
+        Names.emplace(Idx, Name);
+      }
+    }
+    Pos += Size;
+  }
+}
+
+#if SSVM_OS_LINUX
+std::mutex Mutex;
+
+#if defined(__x86_64__)
+static inline constexpr const uint32_t kElfMachine = EM_X86_64;
+#elif defined(__aarch64__)
+static inline constexpr const uint32_t kElfMachine = EM_AARCH64;
+#else
+static inline constexpr const uint32_t kElfMachine = EM_NONE;
+#endif
+
+/// Records of the jitdump format, see the jitdump specification of linux
+/// perf tools.
+static inline constexpr const uint32_t kJitDumpMagic = 0x4A695444U;
+static inline constexpr const uint32_t kJitDumpVersion = 1;
+static inline constexpr const uint32_t kJitCodeLoad = 0;
+
+struct JitDumpHeader {
+  uint32_t Magic;
+  uint32_t Version;
+  uint32_t TotalSize;
+  uint32_t ElfMach;
+  uint32_t Pad1;
+  uint32_t Pid;
+  uint64_t Timestamp;
+  uint64_t Flags;
+};
+
+struct JitCodeLoadRecord {
+  uint32_t Id;
+  uint32_t TotalSize;
+  uint64_t Timestamp;
+  uint32_t Pid;
+  uint32_t Tid;
+  uint64_t Vma;
+  uint64_t CodeAddr;
+  uint64_t CodeSize;
+  uint64_t CodeIndex;
+};
+
+/// Timestamp in the clock of `perf record -k mono`.
+uint64_t getTimestamp() noexcept {
+  struct timespec Time;
+  ::clock_gettime(CLOCK_MONOTONIC, &Time);
+  return static_cast<uint64_t>(Time.tv_sec) * UINT64_C(1000000000) +
+         static_cast<uint64_t>(Time.tv_nsec);
+}
+
+/// Opened jitdump file of this process.
+class JitDumpFile {
+public:
+  JitDumpFile() noexcept {
+    const char *Dir = std::getenv("JITDUMPDIR");
+    const std::string Path = std::string(Dir ? Dir : ".") + "/jit-" +
+                             std::to_string(::getpid()) + ".dump";
+    Fd = ::open(Path.c_str(), O_CREAT | O_TRUNC | O_RDWR | O_CLOEXEC, 0666);
+    if (Fd < 0) {
+      LOG(ERROR) << "jitdump creation failed: " << Path;
+      return;
+    }
+    /// perf finds the file by the executable mapping of it.
+    PageSize = static_cast<size_t>(::sysconf(_SC_PAGESIZE));
+    Marker = ::mmap(nullptr, PageSize, PROT_READ | PROT_EXEC, MAP_PRIVATE, Fd,
+                    0);
+    if (Marker == MAP_FAILED) {
+      Marker = nullptr;
+      LOG(ERROR) << "jitdump mapping failed: " << Path;
+      ::close(Fd);
+      Fd = -1;
+      return;
+    }
+    const JitDumpHeader Header{kJitDumpMagic,
+                               kJitDumpVersion,
+                               sizeof(JitDumpHeader),
+                               kElfMachine,
+                               0,
+                               static_cast<uint32_t>(::getpid()),
+                               getTimestamp(),
+                               0};
+    write(&Header, sizeof(Header));
+  }
+  JitDumpFile(const JitDumpFile &) = delete;
+  JitDumpFile &operator=(const JitDumpFile &) = delete;
+  ~JitDumpFile() noexcept {
+    if (Marker) {
+      ::munmap(Marker, PageSize);
+    }
+    if (Fd >= 0) {
+      ::close(Fd);
+    }
+  }
+
+  void writeCodeLoad(const SSVM::Loader::CodeRecord &Record) noexcept {
+    if (Fd < 0) {
+      return;
+    }
+    const auto Addr = reinterpret_cast<uintptr_t>(Record.Address);
+    const JitCodeLoadRecord Load{
+        kJitCodeLoad,
+        static_cast<uint32_t>(sizeof(JitCodeLoadRecord) + Record.Name.size() +
+                              1 + Record.Size),
+        getTimestamp(),
+        static_cast<uint32_t>(::getpid()),
+        static_cast<uint32_t>(::syscall(SYS_gettid)),
+        Addr,
+        Addr,
+        Record.Size,
+        CodeIndex++};
+    write(&Load, sizeof(Load));
+    write(Record.Name.c_str(), Record.Name.size() + 1);
+    write(Record.Address, Record.Size);
+  }
+
+private:
+  void write(const void *Data, size_t Size) noexcept {
+    const auto *Ptr = static_cast<const uint8_t *>(Data);
+    while (Size > 0) {
+      const auto Written = ::write(Fd, Ptr, Size);
+      if (Written <= 0) {
+        return;
+      }
+      Ptr += Written;
+      Size -= static_cast<size_t>(Written);
+    }
+  }
+
+  int Fd = -1;
+  void *Marker = nullptr;
+  size_t PageSize = 0;
+  uint64_t CodeIndex = 0;
+};
+#endif
+
+} // namespace
+
+namespace SSVM {
+namespace Loader {
+
+/// Read names from name section. See "include/loader/perfmap.h".
+std::unordered_map<uint32_t, std::string>
+readFunctionNames(Span<const Byte> Wasm) {
+  using namespace std::literals::string_view_literals;
+  std::unordered_map<uint32_t, std::string> Names;
+  /// Skip magic and version.
+  size_t Pos = 8;
+  while (Pos < Wasm.size()) {
+    const Byte Id = Wasm[Pos++];
+    uint32_t Size;
+    if (!readU32(Wasm, Pos, Size) || Size > Wasm.size() - Pos) {
+      break;
+    }
+    if (Id == 0x00U) {
+      const auto Content = Wasm.subspan(Pos, Size);
+      size_t NamePos = 0;
+      std::string_view Name;
+      if (readName(Content, NamePos, Name) && Name == "name"sv) {
+        readNameSection(Content.subspan(NamePos), Names);
+      }
+    }
+    Pos += Size;
+  }
+  return Names;
+}
+
+/// Write perf map. See "include/loader/perfmap.h".
+void writePerfMap(Span<const CodeRecord> Records) {
+#if SSVM_OS_LINUX
+  std::unique_lock Lock(Mutex);
+  const std::string Path =
+      "/tmp/perf-" + std::to_string(::getpid()) + ".map";
+  std::FILE *File = std::fopen(Path.c_str(), "a");
+  if (!File) {
+    LOG(ERROR) << "perf map creation failed: " << Path;
+    return;
+  }
+  for (const auto &Record : Records) {
+    std::fprintf(File, "%" PRIxPTR " %" PRIx64 " %s\n",
+                 reinterpret_cast<uintptr_t>(Record.Address), Record.Size,
+                 Record.Name.c_str());
+  }
+  std::fclose(File);
+#else
+  static_cast<void>(Records);
+#endif
+}
+
+/// Write jitdump. See "include/loader/perfmap.h".
+void writeJitDump(Span<const CodeRecord> Records) {
+#if SSVM_OS_LINUX
+  std::unique_lock Lock(Mutex);
+  static JitDumpFile File;
+  for (const auto &Record : Records) {
+    File.writeCodeLoad(Record);
+  }
+#else
+  static_cast<void>(Records);
+#endif
+}
+
+} // namespace Loader
+} // namespace SSVM
@@ -11,11 +11,107 @@
 #error Unsupported os!
 #endif
 
+#if SSVM_OS_LINUX
+#include <algorithm>
+#include <cstring>
+#include <elf.h>
+#include <fcntl.h>
+#include <link.h>
+#include <optional>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <vector>
+
+/// Registration of unwind tables to the unwinder of the runtime.
+extern "C" void __register_frame(const void *);
+extern "C" void __deregister_frame(const void *);
+#endif
+
+namespace {
+
+#if SSVM_OS_LINUX
+#if defined(__x86_64__)
+static inline constexpr const bool kCanMap = true;
+static inline constexpr const uint16_t kMachine = EM_X86_64;
+static inline constexpr const uint32_t kRelocAbs64 = R_X86_64_64;
+static inline constexpr const uint32_t kRelocGlobDat = R_X86_64_GLOB_DAT;
+static inline constexpr const uint32_t kRelocJumpSlot = R_X86_64_JUMP_SLOT;
+static inline constexpr const uint32_t kRelocRelative = R_X86_64_RELATIVE;
+#elif defined(__aarch64__)
+static inline constexpr const bool kCanMap = true;
+static inline constexpr const uint16_t kMachine = EM_AARCH64;
+static inline constexpr const uint32_t kRelocAbs64 = R_AARCH64_ABS64;
+static inline constexpr const uint32_t kRelocGlobDat = R_AARCH64_GLOB_DAT;
+static inline constexpr const uint32_t kRelocJumpSlot = R_AARCH64_JUMP_SLOT;
+static inline constexpr const uint32_t kRelocRelative = R_AARCH64_RELATIVE;
+#else
+static inline constexpr const bool kCanMap = false;
+static inline constexpr const uint16_t kMachine = EM_NONE;
+static inline constexpr const uint32_t kRelocAbs64 = 0;
+static inline constexpr const uint32_t kRelocGlobDat = 0;
+static inline constexpr const uint32_t kRelocJumpSlot = 0;
+static inline constexpr const uint32_t kRelocRelative = 0;
+#endif
+
+/// Read-only view of a whole file.
+class FileView {
+public:
+  FileView(const std::filesystem::path &Path) noexcept {
+    const int Fd = ::open(Path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (Fd < 0) {
+      return;
+    }
+    struct stat Stat;
+    if (::fstat(Fd, &Stat) == 0 && Stat.st_size > 0) {
+      void *Ptr = ::mmap(nullptr, static_cast<size_t>(Stat.st_size), PROT_READ,
+                         MAP_PRIVATE, Fd, 0);
+      if (Ptr != MAP_FAILED) {
+        Data = static_cast<const uint8_t *>(Ptr);
+        Size = static_cast<size_t>(Stat.st_size);
+      }
+    }
+    ::close(Fd);
+  }
+  FileView(const FileView &) = delete;
+  FileView &operator=(const FileView &) = delete;
+  ~FileView() noexcept {
+    if (Data) {
+      ::munmap(const_cast<uint8_t *>(Data), Size);
+    }
+  }
+
+  /// Get the object at offset, or nullptr if N of them do not fit in file.
+  template <typename T>
+  const T *at(const uint64_t Offset, const uint64_t N = 1) const noexcept {
+    if (Offset > Size || N > (Size - Offset) / sizeof(T)) {
+      return nullptr;
+    }
+    return reinterpret_cast<const T *>(Data + Offset);
+  }
+
+  const uint8_t *Data = nullptr;
+  size_t Size = 0;
+};
+
+int toProtection(const uint32_t Flags) noexcept {
+  return ((Flags & PF_R) ? PROT_READ : 0) | ((Flags & PF_W) ? PROT_WRITE : 0) |
+         ((Flags & PF_X) ? PROT_EXEC : 0);
+}
+#endif
+
+} // namespace
+
 namespace SSVM {
 namespace Loader {
 
 /// Open so file. See "include/loader/shared_library.h".
 Expect<void> SharedLibrary::load(const std::filesystem::path &Path) noexcept {
+#if SSVM_OS_LINUX
+  if (map(Path)) {
+    return {};
+  }
+#endif
 #if SSVM_OS_WINDOWS
   Handle = boost::winapi::load_library_ex(Path.c_str(), 0, 0);
 #else
@@ -28,6 +124,19 @@ Expect<void> SharedLibrary::load(const std::filesystem::path &Path) noexcept {
 }
 
 void SharedLibrary::unload() noexcept {
+#if SSVM_OS_LINUX
+  if (Image) {
+    if (EhFrame) {
+      __deregister_frame(EhFrame);
+      EhFrame = nullptr;
+    }
+    ::munmap(Image, ImageSize);
+    Image = nullptr;
+    ImageSize = 0;
+    Exports.clear();
+    CodeRanges.clear();
+  }
+#endif
   if (Handle) {
 #if SSVM_OS_WINDOWS
     boost::winapi::FreeLibrary(Handle);
@@ -39,6 +148,14 @@ void SharedLibrary::unload() noexcept {
 }
 
 void *SharedLibrary::getSymbolAddr(const char *Name) const noexcept {
+#if SSVM_OS_LINUX
+  if (Image) {
+    if (auto It = Exports.find(Name); It != Exports.end()) {
+      return It->second;
+    }
+    return nullptr;
+  }
+#endif
   if (!Handle) {
     return nullptr;
   }
@@ -49,5 +166,304 @@ void *SharedLibrary::getSymbolAddr(const char *Name) const noexcept {
 #endif
 }
 
+const void *SharedLibrary::getCodeEnd(const void *Addr) const noexcept {
+#if SSVM_OS_LINUX
+  const auto *Ptr = static_cast<const uint8_t *>(Addr);
+  if (Image) {
+    for (const auto &[Begin, End] : CodeRanges) {
+      if (Begin <= Ptr && Ptr < End) {
+        return End;
+      }
+    }
+    return nullptr;
+  }
+  /// Libraries loaded by the dynamic loader are found in its link map.
+  std::pair<const uint8_t *, const void *> Query(Ptr, nullptr);
+  ::dl_iterate_phdr(
+      [](struct dl_phdr_info *Info, size_t, void *Data) -> int {
+        auto &[Ptr, End] =
+            *static_cast<std::pair<const uint8_t *, const void *> *>(Data);
+        for (uint32_t I = 0; I < Info->dlpi_phnum; ++I) {
+          const auto &Phdr = Info->dlpi_phdr[I];
+          if (Phdr.p_type != PT_LOAD || !(Phdr.p_flags & PF_X)) {
+            continue;
+          }
+          const auto *Begin =
+              reinterpret_cast<const uint8_t *>(Info->dlpi_addr + Phdr.p_vaddr);
+          if (Begin <= Ptr && Ptr < Begin + Phdr.p_memsz) {
+            End = Begin + Phdr.p_memsz;
+            return 1;
+          }
+        }
+        return 0;
+      },
+      &Query);
+  return Query.second;
+#else
+  static_cast<void>(Addr);
+  return nullptr;
+#endif
+}
+
+#if SSVM_OS_LINUX
+/// Map ELF image. See "include/loader/shared_library.h".
+Expect<void> SharedLibrary::map(const std::filesystem::path &Path) noexcept {
+  if constexpr (!kCanMap) {
+    return Unexpect(ErrCode::InvalidPath);
+  }
+  FileView File(Path);
+  const auto *Ehdr = File.at<Elf64_Ehdr>(0);
+  if (!Ehdr || std::memcmp(Ehdr->e_ident, ELFMAG, SELFMAG) != 0 ||
+      Ehdr->e_ident[EI_CLASS] != ELFCLASS64 ||
+      Ehdr->e_ident[EI_DATA] != ELFDATA2LSB || Ehdr->e_type != ET_DYN ||
+      Ehdr->e_machine != kMachine) {
+    return Unexpect(ErrCode::InvalidPath);
+  }
+  const auto *Phdrs = File.at<Elf64_Phdr>(Ehdr->e_phoff, Ehdr->e_phnum);
+  const auto *Shdrs = File.at<Elf64_Shdr>(Ehdr->e_shoff, Ehdr->e_shnum);
+  if (!Phdrs || !Shdrs) {
+    return Unexpect(ErrCode::InvalidPath);
+  }
+
+  /// Check segments and find the extent of the image.
+  const uint64_t PageSize = static_cast<uint64_t>(::sysconf(_SC_PAGESIZE));
+  uint64_t End = 0;
+  for (uint32_t I = 0; I < Ehdr->e_phnum; ++I) {
+    const auto &Phdr = Phdrs[I];
+    switch (Phdr.p_type) {
+    case PT_LOAD:
+      if (!File.at<uint8_t>(Phdr.p_offset, Phdr.p_filesz) ||
+          Phdr.p_filesz > Phdr.p_memsz ||
+          Phdr.p_vaddr + Phdr.p_memsz < Phdr.p_vaddr) {
+        return Unexpect(ErrCode::InvalidPath);
+      }
+      End = std::max(End, Phdr.p_vaddr + Phdr.p_memsz);
+      break;
+    case PT_TLS:
+      /// Thread local storage needs the dynamic loader.
+      return Unexpect(ErrCode::InvalidPath);
+    case PT_DYNAMIC: {
+      const auto *Dyns =
+          File.at<Elf64_Dyn>(Phdr.p_offset, Phdr.p_filesz / sizeof(Elf64_Dyn));
+      if (!Dyns) {
+        return Unexpect(ErrCode::InvalidPath);
+      }
+      for (uint64_t J = 0; J < Phdr.p_filesz / sizeof(Elf64_Dyn); ++J) {
+        const auto Tag = Dyns[J].d_tag;
+        /// Constructors and text relocations are not supported.
+        if (Tag == DT_INIT || Tag == DT_FINI || Tag == DT_TEXTREL ||
+            ((Tag == DT_PREINIT_ARRAYSZ || Tag == DT_INIT_ARRAYSZ ||
+              Tag == DT_FINI_ARRAYSZ) &&
+             Dyns[J].d_un.d_val != 0)) {
+          return Unexpect(ErrCode::InvalidPath);
+        }
+      }
+      break;
+    }
+    default:
+      break;
+    }
+  }
+  const uint64_t Size = (End + PageSize - 1) & ~(PageSize - 1);
+  if (Size == 0) {
+    return Unexpect(ErrCode::InvalidPath);
+  }
+
+  /// Find the dynamic symbol table.
+  const Elf64_Sym *Syms = nullptr;
+  uint64_t SymNum = 0;
+  const char *StrTab = nullptr;
+  uint64_t StrSize = 0;
+  for (uint32_t I = 0; I < Ehdr->e_shnum; ++I) {
+    const auto &Shdr = Shdrs[I];
+    if (Shdr.sh_type != SHT_DYNSYM || Shdr.sh_link >= Ehdr->e_shnum) {
+      continue;
+    }
+    const auto &StrShdr = Shdrs[Shdr.sh_link];
+    SymNum = Shdr.sh_size / sizeof(Elf64_Sym);
+    Syms = File.at<Elf64_Sym>(Shdr.sh_offset, SymNum);
+    StrTab = File.at<char>(StrShdr.sh_offset, StrShdr.sh_size);
+    StrSize = StrShdr.sh_size;
+  }
+  if (!Syms || !StrTab || StrSize == 0 || StrTab[StrSize - 1] != '\0') {
+    return Unexpect(ErrCode::InvalidPath);
+  }
+
+  void *Ptr = ::mmap(nullptr, Size, PROT_READ | PROT_WRITE,
+                     MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+  if (Ptr == MAP_FAILED) {
+    return Unexpect(ErrCode::InvalidPath);
+  }
+  uint8_t *Base = static_cast<uint8_t *>(Ptr);
+  auto Fail = [&]() {
+    ::munmap(Base, Size);
+    Exports.clear();
+    return Unexpect(ErrCode::InvalidPath);
+  };
+  for (uint32_t I = 0; I < Ehdr->e_phnum; ++I) {
+    if (Phdrs[I].p_type == PT_LOAD) {
+      std::memcpy(Base + Phdrs[I].p_vaddr, File.Data + Phdrs[I].p_offset,
+                  Phdrs[I].p_filesz);
+    }
+  }
+
+  /// Resolve symbols. Imports, such as the intrinsics table, come from the
+  /// running process.
+  auto Resolve = [&](const uint64_t Index) -> std::optional<uint64_t> {
+    if (Index >= SymNum || Syms[Index].st_name >= StrSize) {
+      return std::nullopt;
+    }
+    const auto &Sym = Syms[Index];
+    if (Sym.st_shndx == SHN_ABS) {
+      return Sym.st_value;
+    }
+    if (Sym.st_shndx != SHN_UNDEF) {
+      return reinterpret_cast<uint64_t>(Base + Sym.st_value);
+    }
+    if (void *Addr = ::dlsym(RTLD_DEFAULT, StrTab + Sym.st_name)) {
+      return reinterpret_cast<uint64_t>(Addr);
+    }
+    if (ELF64_ST_BIND(Sym.st_info) == STB_WEAK) {
+      return UINT64_C(0);
+    }
+    return std::nullopt;
+  };
+  for (uint64_t I = 1; I < SymNum; ++I) {
+    const auto &Sym = Syms[I];
+    const auto Bind = ELF64_ST_BIND(Sym.st_info);
+    if (Sym.st_shndx != SHN_UNDEF && Sym.st_shndx != SHN_ABS &&
+        Sym.st_name < StrSize &&
+        (Bind == STB_GLOBAL || Bind == STB_WEAK)) {
+      if (Sym.st_value >= Size) {
+        return Fail();
+      }
+      Exports.emplace(StrTab + Sym.st_name, Base + Sym.st_value);
+    }
+  }
+
+  /// Apply relocations.
+  for (uint32_t I = 0; I < Ehdr->e_shnum; ++I) {
+    const auto &Shdr = Shdrs[I];
+    if (Shdr.sh_type == SHT_REL) {
+      return Fail();
+    }
+    if (Shdr.sh_type != SHT_RELA) {
+      continue;
+    }
+    const uint64_t RelaNum = Shdr.sh_size / sizeof(Elf64_Rela);
+    const auto *Relas = File.at<Elf64_Rela>(Shdr.sh_offset, RelaNum);
+    if (!Relas) {
+      return Fail();
+    }
+    for (uint64_t J = 0; J < RelaNum; ++J) {
+      const auto &Rela = Relas[J];
+      if (Rela.r_offset > Size - sizeof(uint64_t)) {
+        return Fail();
+      }
+      const uint32_t Type = ELF64_R_TYPE(Rela.r_info);
+      uint64_t Value;
+      if (Type == kRelocRelative) {
+        Value = reinterpret_cast<uint64_t>(Base) + Rela.r_addend;
+      } else if (Type == kRelocAbs64 || Type == kRelocGlobDat ||
+                 Type == kRelocJumpSlot) {
+        const auto Sym = Resolve(ELF64_R_SYM(Rela.r_info));
+        if (!Sym) {
+          return Fail();
+        }
+        Value = *Sym + Rela.r_addend;
+      } else {
+        return Fail();
+      }
+      std::memcpy(Base + Rela.r_offset, &Value, sizeof(Value));
+    }
+  }
+
+  /// Find the unwind tables. The unwinder only finds the ones of libraries in
+  /// the link map, so tables of the mapped image are registered directly,
+  /// which needs a zero terminator after them.
+  const uint8_t *Frame = nullptr;
+  if (const auto *ShStrShdr = Ehdr->e_shstrndx < Ehdr->e_shnum
+                                  ? &Shdrs[Ehdr->e_shstrndx]
+                                  : nullptr) {
+    const auto *ShStrTab =
+        File.at<char>(ShStrShdr->sh_offset, ShStrShdr->sh_size);
+    for (uint32_t I = 0; ShStrTab && I < Ehdr->e_shnum; ++I) {
+      const auto &Shdr = Shdrs[I];
+      if (!(Shdr.sh_flags & SHF_ALLOC) || Shdr.sh_name >= ShStrShdr->sh_size ||
+          ::strncmp(ShStrTab + Shdr.sh_name, ".eh_frame",
+                    ShStrShdr->sh_size - Shdr.sh_name) != 0) {
+        continue;
+      }
+      const uint64_t TermBegin = Shdr.sh_addr + Shdr.sh_size;
+      const uint64_t TermEnd = TermBegin + sizeof(uint32_t);
+      if (Shdr.sh_addr > TermBegin || TermBegin > TermEnd || TermEnd > Size) {
+        return Fail();
+      }
+      for (uint32_t J = 0; J < Ehdr->e_shnum; ++J) {
+        const auto &Other = Shdrs[J];
+        if ((Other.sh_flags & SHF_ALLOC) && Other.sh_size > 0 &&
+            Other.sh_addr < TermEnd &&
+            TermBegin < Other.sh_addr + Other.sh_size) {
+          return Fail();
+        }
+      }
+      std::memset(Base + TermBegin, 0, sizeof(uint32_t));
+      Frame = Base + Shdr.sh_addr;
+    }
+  }
+
+  /// Protect pages with the union of the segments on them.
+  std::vector<int> Protections(Size / PageSize, PROT_NONE);
+  std::vector<std::pair<const uint8_t *, const uint8_t *>> Code;
+  for (uint32_t I = 0; I < Ehdr->e_phnum; ++I) {
+    const auto &Phdr = Phdrs[I];
+    if (Phdr.p_type == PT_LOAD && Phdr.p_memsz > 0) {
+      const uint64_t First = Phdr.p_vaddr / PageSize;
+      const uint64_t Last = (Phdr.p_vaddr + Phdr.p_memsz - 1) / PageSize;
+      for (uint64_t Page = First; Page <= Last; ++Page) {
+        Protections[Page] |= toProtection(Phdr.p_flags);
+      }
+      if (Phdr.p_flags & PF_X) {
+        Code.emplace_back(Base + Phdr.p_vaddr,
+                          Base + Phdr.p_vaddr + Phdr.p_memsz);
+      }
+    }
+  }
+  for (uint32_t I = 0; I < Ehdr->e_phnum; ++I) {
+    const auto &Phdr = Phdrs[I];
+    if (Phdr.p_type == PT_GNU_RELRO) {
+      /// Only whole pages become read-only, like the dynamic loader does.
+      const uint64_t First = Phdr.p_vaddr / PageSize;
+      const uint64_t Last = (Phdr.p_vaddr + Phdr.p_memsz) / PageSize;
+      for (uint64_t Page = First; Page < Last && Page < Protections.size();
+           ++Page) {
+        Protections[Page] &= ~PROT_WRITE;
+      }
+    }
+  }
+  for (uint64_t Page = 0; Page < Protections.size();) {
+    uint64_t Next = Page + 1;
+    while (Next < Protections.size() &&
+           Protections[Next] == Protections[Page]) {
+      ++Next;
+    }
+    if (::mprotect(Base + Page * PageSize, (Next - Page) * PageSize,
+                   Protections[Page]) != 0) {
+      return Fail();
+    }
+    Page = Next;
+  }
+
+  if (Frame) {
+    __register_frame(Frame);
+  }
+  Image = Base;
+  ImageSize = Size;
+  CodeRanges = std::move(Code);
+  EhFrame = Frame;
+  return {};
+}
+#endif
+
 } // namespace Loader
 } // namespace SSVM
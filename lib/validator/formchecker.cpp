@@ -14,6 +14,7 @@ namespace Validator {
 
 void FormChecker::reset(bool CleanGlobal) {
   ValStack.clear();
+  MaxHeight = 0;
   CtrlStack.clear();
   Locals.clear();
   Returns.clear();
@@ -27,6 +28,7 @@ void FormChecker::reset(bool CleanGlobal) {
     Datas.clear();
     Elems.clear();
     Refs.clear();
+    Tags.clear();
     NumImportFuncs = 0;
     NumImportGlobals = 0;
   }
@@ -97,6 +99,8 @@ void FormChecker::addElem(const AST::ElementSegment &Elem) {
 
 void FormChecker::addRef(const uint32_t FuncIdx) { Refs.emplace(FuncIdx); }
 
+void FormChecker::addTag(const uint32_t TypeIdx) { Tags.emplace_back(TypeIdx); }
+
 void FormChecker::addLocal(const ValType &V) {
   Locals.push_back(ASTToVType(V));
 }
@@ -206,6 +210,17 @@ Expect<void> FormChecker::checkInstr(const AST::Instruction &Instr) {
     return CtrlStack.size() - 1 - N;
   };
 
+  /// Helper lambda for checking tag index and return the parameter types.
+  auto checkTagIdx = [this](uint32_t N) -> Expect<Span<const VType>> {
+    if (Tags.size() <= N) {
+      LOG(ERROR) << ErrCode::InvalidTagIdx;
+      LOG(ERROR) << ErrInfo::InfoForbidIndex(ErrInfo::IndexCategory::Tag, N,
+                                             Tags.size());
+      return Unexpect(ErrCode::InvalidTagIdx);
+    }
+    return Types[Tags[N]].first;
+  };
+
   /// Helper lambda for checking memory index and perform transformation.
   auto checkMemAndTrans = [this](uint32_t N, Span<const VType> Take,
                                  Span<const VType> Put) -> Expect<void> {
@@ -239,6 +254,28 @@ Expect<void> FormChecker::checkInstr(const AST::Instruction &Instr) {
     return StackTrans(Take, Put);
   };
 
+  /// Helper lambda for checking the natural alignment of atomic memory
+  /// instructions and perform transformation.
+  auto checkAtomicAlignAndTrans =
+      [this, &Instr](uint32_t N, Span<const VType> Take,
+                     Span<const VType> Put) -> Expect<void> {
+    if (Mems.size() == 0) {
+      LOG(ERROR) << ErrCode::InvalidMemoryIdx;
+      LOG(ERROR) << ErrInfo::InfoForbidIndex(ErrInfo::IndexCategory::Memory, 0,
+                                             Mems.size());
+      return Unexpect(ErrCode::InvalidMemoryIdx);
+    }
+    if (Instr.getMemoryAlign() > 31 ||
+        (1UL << Instr.getMemoryAlign()) != (N >> 3UL)) {
+      /// 2 ^ align needs to == N / 8
+      LOG(ERROR) << ErrCode::InvalidAlignment;
+      LOG(ERROR) << ErrInfo::InfoMismatch(static_cast<uint8_t>(N >> 3),
+                                          Instr.getMemoryAlign());
+      return Unexpect(ErrCode::InvalidAlignment);
+    }
+    return StackTrans(Take, Put);
+  };
+
   /// Helper lambda for checking vtypes matching.
   auto checkTypesMatching = [this](Span<const VType> Exp,
                                    Span<const VType> Got) -> Expect<void> {
@@ -285,7 +322,8 @@ Expect<void> FormChecker::checkInstr(const AST::Instruction &Instr) {
     }
     [[fallthrough]];
   case OpCode::Block:
-  case OpCode::Loop: {
+  case OpCode::Loop:
+  case OpCode::Try: {
     /// Get blocktype [t1*] -> [t2*]
     std::vector<VType> Buffer;
     Span<const VType> T1, T2;
@@ -325,6 +363,61 @@ Expect<void> FormChecker::checkInstr(const AST::Instruction &Instr) {
     }
     return {};
 
+  case OpCode::Catch: {
+    /// The catch clause starts with the parameters of the tag.
+    Span<const VType> Params;
+    if (auto Res = checkTagIdx(Instr.getTargetIndex())) {
+      Params = *Res;
+    } else {
+      return Unexpect(Res);
+    }
+    if (auto Res = popCtrl()) {
+      pushCtrl(Params, (*Res).EndTypes, Instr.getOpCode());
+    } else {
+      return Unexpect(Res);
+    }
+    return {};
+  }
+  case OpCode::Catch_all:
+    if (auto Res = popCtrl()) {
+      pushCtrl({}, (*Res).EndTypes, Instr.getOpCode());
+    } else {
+      return Unexpect(Res);
+    }
+    return {};
+  case OpCode::Delegate:
+    if (auto Res = popCtrl()) {
+      /// The delegate label is relative to the enclosing block of the try.
+      if (auto D = checkCtrlStackDepth(Instr.getTargetIndex()); !D) {
+        return Unexpect(D);
+      }
+      pushTypes((*Res).EndTypes);
+    } else {
+      return Unexpect(Res);
+    }
+    return {};
+  case OpCode::Throw:
+    if (auto Res = checkTagIdx(Instr.getTargetIndex())) {
+      if (auto Check = popTypes(*Res); !Check) {
+        return Unexpect(Check);
+      }
+    } else {
+      return Unexpect(Res);
+    }
+    return unreachable();
+  case OpCode::Rethrow:
+    if (auto D = checkCtrlStackDepth(Instr.getTargetIndex())) {
+      /// The rethrow label must refer to a catch clause.
+      if (CtrlStack[*D].Code != OpCode::Catch &&
+          CtrlStack[*D].Code != OpCode::Catch_all) {
+        LOG(ERROR) << ErrCode::InvalidLabelIdx;
+        return Unexpect(ErrCode::InvalidLabelIdx);
+      }
+    } else {
+      return Unexpect(D);
+    }
+    return unreachable();
+
   case OpCode::Br:
     if (auto D = checkCtrlStackDepth(Instr.getTargetIndex())) {
       /// D is the last D element of control stack.
@@ -707,6 +800,147 @@ Expect<void> FormChecker::checkInstr(const AST::Instruction &Instr) {
     }
     return {};
 
+  /// Atomic Memory Instructions.
+  case OpCode::Memory__atomic__notify:
+    return checkAtomicAlignAndTrans(32, std::array{VType::I32, VType::I32},
+                                    std::array{VType::I32});
+  case OpCode::Memory__atomic__wait32:
+    return checkAtomicAlignAndTrans(
+        32, std::array{VType::I32, VType::I32, VType::I64},
+        std::array{VType::I32});
+  case OpCode::Memory__atomic__wait64:
+    return checkAtomicAlignAndTrans(
+        64, std::array{VType::I32, VType::I64, VType::I64},
+        std::array{VType::I32});
+  case OpCode::Atomic__fence:
+    return {};
+  case OpCode::I32__atomic__load:
+    return checkAtomicAlignAndTrans(32, std::array{VType::I32},
+                                    std::array{VType::I32});
+  case OpCode::I64__atomic__load:
+    return checkAtomicAlignAndTrans(64, std::array{VType::I32},
+                                    std::array{VType::I64});
+  case OpCode::I32__atomic__load8_u:
+    return checkAtomicAlignAndTrans(8, std::array{VType::I32},
+                                    std::array{VType::I32});
+  case OpCode::I32__atomic__load16_u:
+    return checkAtomicAlignAndTrans(16, std::array{VType::I32},
+                                    std::array{VType::I32});
+  case OpCode::I64__atomic__load8_u:
+    return checkAtomicAlignAndTrans(8, std::array{VType::I32},
+                                    std::array{VType::I64});
+  case OpCode::I64__atomic__load16_u:
+    return checkAtomicAlignAndTrans(16, std::array{VType::I32},
+                                    std::array{VType::I64});
+  case OpCode::I64__atomic__load32_u:
+    return checkAtomicAlignAndTrans(32, std::array{VType::I32},
+                                    std::array{VType::I64});
+  case OpCode::I32__atomic__store:
+    return checkAtomicAlignAndTrans(32, std::array{VType::I32, VType::I32},
+                                    {});
+  case OpCode::I64__atomic__store:
+    return checkAtomicAlignAndTrans(64, std::array{VType::I32, VType::I64},
+                                    {});
+  case OpCode::I32__atomic__store8:
+    return checkAtomicAlignAndTrans(8, std::array{VType::I32, VType::I32},
+                                    {});
+  case OpCode::I32__atomic__store16:
+    return checkAtomicAlignAndTrans(16, std::array{VType::I32, VType::I32},
+                                    {});
+  case OpCode::I64__atomic__store8:
+    return checkAtomicAlignAndTrans(8, std::array{VType::I32, VType::I64},
+                                    {});
+  case OpCode::I64__atomic__store16:
+    return checkAtomicAlignAndTrans(16, std::array{VType::I32, VType::I64},
+                                    {});
+  case OpCode::I64__atomic__store32:
+    return checkAtomicAlignAndTrans(32, std::array{VType::I32, VType::I64},
+                                    {});
+  case OpCode::I32__atomic__rmw__add:
+  case OpCode::I32__atomic__rmw__sub:
+  case OpCode::I32__atomic__rmw__and:
+  case OpCode::I32__atomic__rmw__or:
+  case OpCode::I32__atomic__rmw__xor:
+  case OpCode::I32__atomic__rmw__xchg:
+    return checkAtomicAlignAndTrans(32, std::array{VType::I32, VType::I32},
+                                    std::array{VType::I32});
+  case OpCode::I64__atomic__rmw__add:
+  case OpCode::I64__atomic__rmw__sub:
+  case OpCode::I64__atomic__rmw__and:
+  case OpCode::I64__atomic__rmw__or:
+  case OpCode::I64__atomic__rmw__xor:
+  case OpCode::I64__atomic__rmw__xchg:
+    return checkAtomicAlignAndTrans(64, std::array{VType::I32, VType::I64},
+                                    std::array{VType::I64});
+  case OpCode::I32__atomic__rmw8__add_u:
+  case OpCode::I32__atomic__rmw8__sub_u:
+  case OpCode::I32__atomic__rmw8__and_u:
+  case OpCode::I32__atomic__rmw8__or_u:
+  case OpCode::I32__atomic__rmw8__xor_u:
+  case OpCode::I32__atomic__rmw8__xchg_u:
+    return checkAtomicAlignAndTrans(8, std::array{VType::I32, VType::I32},
+                                    std::array{VType::I32});
+  case OpCode::I32__atomic__rmw16__add_u:
+  case OpCode::I32__atomic__rmw16__sub_u:
+  case OpCode::I32__atomic__rmw16__and_u:
+  case OpCode::I32__atomic__rmw16__or_u:
+  case OpCode::I32__atomic__rmw16__xor_u:
+  case OpCode::I32__atomic__rmw16__xchg_u:
+    return checkAtomicAlignAndTrans(16, std::array{VType::I32, VType::I32},
+                                    std::array{VType::I32});
+  case OpCode::I64__atomic__rmw8__add_u:
+  case OpCode::I64__atomic__rmw8__sub_u:
+  case OpCode::I64__atomic__rmw8__and_u:
+  case OpCode::I64__atomic__rmw8__or_u:
+  case OpCode::I64__atomic__rmw8__xor_u:
+  case OpCode::I64__atomic__rmw8__xchg_u:
+    return checkAtomicAlignAndTrans(8, std::array{VType::I32, VType::I64},
+                                    std::array{VType::I64});
+  case OpCode::I64__atomic__rmw16__add_u:
+  case OpCode::I64__atomic__rmw16__sub_u:
+  case OpCode::I64__atomic__rmw16__and_u:
+  case OpCode::I64__atomic__rmw16__or_u:
+  case OpCode::I64__atomic__rmw16__xor_u:
+  case OpCode::I64__atomic__rmw16__xchg_u:
+    return checkAtomicAlignAndTrans(16, std::array{VType::I32, VType::I64},
+                                    std::array{VType::I64});
+  case OpCode::I64__atomic__rmw32__add_u:
+  case OpCode::I64__atomic__rmw32__sub_u:
+  case OpCode::I64__atomic__rmw32__and_u:
+  case OpCode::I64__atomic__rmw32__or_u:
+  case OpCode::I64__atomic__rmw32__xor_u:
+  case OpCode::I64__atomic__rmw32__xchg_u:
+    return checkAtomicAlignAndTrans(32, std::array{VType::I32, VType::I64},
+                                    std::array{VType::I64});
+  case OpCode::I32__atomic__rmw__cmpxchg:
+    return checkAtomicAlignAndTrans(
+        32, std::array{VType::I32, VType::I32, VType::I32},
+        std::array{VType::I32});
+  case OpCode::I64__atomic__rmw__cmpxchg:
+    return checkAtomicAlignAndTrans(
+        64, std::array{VType::I32, VType::I64, VType::I64},
+        std::array{VType::I64});
+  case OpCode::I32__atomic__rmw8__cmpxchg_u:
+    return checkAtomicAlignAndTrans(
+        8, std::array{VType::I32, VType::I32, VType::I32},
+        std::array{VType::I32});
+  case OpCode::I32__atomic__rmw16__cmpxchg_u:
+    return checkAtomicAlignAndTrans(
+        16, std::array{VType::I32, VType::I32, VType::I32},
+        std::array{VType::I32});
+  case OpCode::I64__atomic__rmw8__cmpxchg_u:
+    return checkAtomicAlignAndTrans(
+        8, std::array{VType::I32, VType::I64, VType::I64},
+        std::array{VType::I64});
+  case OpCode::I64__atomic__rmw16__cmpxchg_u:
+    return checkAtomicAlignAndTrans(
+        16, std::array{VType::I32, VType::I64, VType::I64},
+        std::array{VType::I64});
+  case OpCode::I64__atomic__rmw32__cmpxchg_u:
+    return checkAtomicAlignAndTrans(
+        32, std::array{VType::I32, VType::I64, VType::I64},
+        std::array{VType::I64});
+
   /// Const Instructions.
   case OpCode::I32__const:
     return StackTrans({}, std::array{VType::I32});
@@ -1035,8 +1269,13 @@ Expect<void> FormChecker::checkInstr(const AST::Instruction &Instr) {
   case OpCode::I64x2__trunc_sat_f64x2_u:
   case OpCode::F64x2__convert_i64x2_s:
   case OpCode::F64x2__convert_i64x2_u:
+  case OpCode::I32x4__relaxed_trunc_f32x4_s:
+  case OpCode::I32x4__relaxed_trunc_f32x4_u:
+  case OpCode::I32x4__relaxed_trunc_f64x2_s_zero:
+  case OpCode::I32x4__relaxed_trunc_f64x2_u_zero:
     return StackTrans(std::array{VType::V128}, std::array{VType::V128});
   case OpCode::I8x16__swizzle:
+  case OpCode::I8x16__relaxed_swizzle:
   case OpCode::I8x16__eq:
   case OpCode::I8x16__ne:
   case OpCode::I8x16__lt_s:
@@ -1138,6 +1377,12 @@ Expect<void> FormChecker::checkInstr(const AST::Instruction &Instr) {
   case OpCode::F64x2__pmax:
   case OpCode::I8x16__mul:
   case OpCode::I32x4__dot_i16x8_s:
+  case OpCode::F32x4__relaxed_min:
+  case OpCode::F32x4__relaxed_max:
+  case OpCode::F64x2__relaxed_min:
+  case OpCode::F64x2__relaxed_max:
+  case OpCode::I16x8__relaxed_q15mulr_s:
+  case OpCode::I16x8__relaxed_dot_i8x16_i7x16_s:
     return StackTrans(std::array{VType::V128, VType::V128},
                       std::array{VType::V128});
   case OpCode::V128__bitselect:
@@ -1145,6 +1390,15 @@ Expect<void> FormChecker::checkInstr(const AST::Instruction &Instr) {
   case OpCode::F32x4__qfms:
   case OpCode::F64x2__qfma:
   case OpCode::F64x2__qfms:
+  case OpCode::F32x4__relaxed_madd:
+  case OpCode::F32x4__relaxed_nmadd:
+  case OpCode::F64x2__relaxed_madd:
+  case OpCode::F64x2__relaxed_nmadd:
+  case OpCode::I8x16__relaxed_laneselect:
+  case OpCode::I16x8__relaxed_laneselect:
+  case OpCode::I32x4__relaxed_laneselect:
+  case OpCode::I64x2__relaxed_laneselect:
+  case OpCode::I32x4__relaxed_dot_i8x16_i7x16_add_s:
     return StackTrans(std::array{VType::V128, VType::V128, VType::V128},
                       std::array{VType::V128});
   case OpCode::I8x16__any_true:
@@ -1179,7 +1433,10 @@ Expect<void> FormChecker::checkInstr(const AST::Instruction &Instr) {
   }
 }
 
-void FormChecker::pushType(VType V) { ValStack.emplace_back(V); }
+void FormChecker::pushType(VType V) {
+  ValStack.emplace_back(V);
+  MaxHeight = std::max(MaxHeight, static_cast<uint32_t>(ValStack.size()));
+}
 
 void FormChecker::pushTypes(Span<const VType> Input) {
   for (auto Val : Input) {
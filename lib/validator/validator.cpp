@@ -10,8 +10,11 @@ namespace SSVM {
 namespace Validator {
 
 /// Validate Module. See "include/validator/validator.h".
-Expect<void> Validator::validate(const AST::Module &Mod) {
+Expect<void> Validator::validate(AST::Module &Mod) {
   /// https://webassembly.github.io/spec/core/valid/modules.html
+  if (Mod.isValidated()) {
+    return {};
+  }
   Checker.reset(true);
 
   /// Register type definitions into FormChecker.
@@ -47,6 +50,13 @@ Expect<void> Validator::validate(const AST::Module &Mod) {
     return Unexpect(Res);
   }
 
+  /// Validate tag section and register tags into FormChecker.
+  if (auto Res = validate(Mod.getTagSection()); !Res) {
+    LOG(ERROR) << ErrInfo::InfoAST(Mod.getTagSection().NodeAttr);
+    LOG(ERROR) << ErrInfo::InfoAST(Mod.NodeAttr);
+    return Unexpect(Res);
+  }
+
   /// Validate global section and register globals into FormChecker.
   if (auto Res = validate(Mod.getGlobalSection()); !Res) {
     LOG(ERROR) << ErrInfo::InfoAST(Mod.getGlobalSection().NodeAttr);
@@ -196,7 +206,7 @@ Expect<void> Validator::validate(const AST::ElementSegment &ElemSeg) {
 }
 
 /// Validate Code segment. See "include/validator/validator.h".
-Expect<void> Validator::validate(const AST::CodeSegment &CodeSeg,
+Expect<void> Validator::validate(AST::CodeSegment &CodeSeg,
                                  const uint32_t TypeIdx) {
   /// Reset stack in FormChecker.
   Checker.reset();
@@ -217,6 +227,7 @@ Expect<void> Validator::validate(const AST::CodeSegment &CodeSeg,
     LOG(ERROR) << ErrInfo::InfoAST(ASTNodeAttr::Expression);
     return Unexpect(Res);
   }
+  CodeSeg.setMaxStackHeight(Checker.getMaxHeight());
   return {};
 }
 
@@ -285,6 +296,15 @@ Expect<void> Validator::validate(const AST::ImportDesc &ImpDesc) {
     /// Global type always is valid.
     Checker.addGlobal(ImpDesc.getExternalGlobalType(), true);
     return {};
+  case ExternalType::Tag: {
+    const auto TId = ImpDesc.getExternalTagTypeIdx();
+    /// Tag type must be valid.
+    if (auto Res = validateTagType(TId); !Res) {
+      return Unexpect(Res);
+    }
+    Checker.addTag(TId);
+    return {};
+  }
   default:
     break;
   }
@@ -328,6 +348,14 @@ Expect<void> Validator::validate(const AST::ExportDesc &ExpDesc) {
       return Unexpect(ErrCode::InvalidGlobalIdx);
     }
     return {};
+  case ExternalType::Tag:
+    if (Id >= Checker.getTags().size()) {
+      LOG(ERROR) << ErrCode::InvalidTagIdx;
+      LOG(ERROR) << ErrInfo::InfoForbidIndex(ErrInfo::IndexCategory::Tag, Id,
+                                             Checker.getTags().size());
+      return Unexpect(ErrCode::InvalidTagIdx);
+    }
+    return {};
   default:
     break;
   }
@@ -416,8 +444,8 @@ Expect<void> Validator::validate(const AST::ElementSection &ElemSec) {
 }
 
 /// Validate Code section. See "include/validator/validator.h".
-Expect<void> Validator::validate(const AST::CodeSection &CodeSec) {
-  const auto &CodeVec = CodeSec.getContent();
+Expect<void> Validator::validate(AST::CodeSection &CodeSec) {
+  auto &CodeVec = CodeSec.getContent();
   const auto &FuncVec = Checker.getFunctions();
 
   /// Validate function body.
@@ -561,5 +589,34 @@ Expect<void> Validator::validateConstExpr(AST::InstrView Instrs,
   return Checker.validate(Instrs, Returns);
 }
 
+/// Validate Tag section. See "include/validator/validator.h".
+Expect<void> Validator::validate(const AST::TagSection &TagSec) {
+  for (auto &TId : TagSec.getContent()) {
+    if (auto Res = validateTagType(TId); !Res) {
+      return Unexpect(Res);
+    }
+    Checker.addTag(TId);
+  }
+  return {};
+}
+
+/// Validate tag type. See "include/validator/validator.h".
+Expect<void> Validator::validateTagType(const uint32_t TypeIdx) {
+  const auto &TypeVec = Checker.getTypes();
+  /// Function type index must exist in context.
+  if (TypeIdx >= TypeVec.size()) {
+    LOG(ERROR) << ErrCode::InvalidFuncTypeIdx;
+    LOG(ERROR) << ErrInfo::InfoForbidIndex(ErrInfo::IndexCategory::FunctionType,
+                                           TypeIdx, TypeVec.size());
+    return Unexpect(ErrCode::InvalidFuncTypeIdx);
+  }
+  /// Exception tags have no results.
+  if (!TypeVec[TypeIdx].second.empty()) {
+    LOG(ERROR) << ErrCode::TypeCheckFailed;
+    return Unexpect(ErrCode::TypeCheckFailed);
+  }
+  return {};
+}
+
 } // namespace Validator
 } // namespace SSVM
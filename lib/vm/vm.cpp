@@ -3,6 +3,9 @@
 #include "common/log.h"
 #include "host/ssvm_process/processmodule.h"
 #include "host/wasi/wasimodule.h"
+#include "host/wasi_threads/threadsmodule.h"
+
+#include <array>
 
 namespace SSVM {
 namespace VM {
@@ -20,6 +23,8 @@ VM::VM(const Configure &Conf, Runtime::StoreManager &S)
   initVM();
 }
 
+VM::~VM() noexcept { joinThreads(); }
+
 void VM::initVM() {
   /// Create import modules from configuration.
   if (Conf.hasHostRegistration(HostRegistration::Wasi)) {
@@ -34,6 +39,129 @@ void VM::initVM() {
     InterpreterEngine.registerModule(StoreRef, *ProcMod.get());
     ImpObjs.insert({HostRegistration::SSVM_Process, std::move(ProcMod)});
   }
+  if (Conf.hasHostRegistration(HostRegistration::WasiThreads)) {
+    auto ThreadsMod = std::make_unique<Host::WasiThreadsModule>();
+    ThreadsMod->getEnv().setRunner(
+        [this](uint32_t Tid, uint32_t StartArg,
+               std::promise<bool> &Ready) -> Expect<void> {
+          return runThread(Tid, StartArg, Ready);
+        });
+    InterpreterEngine.registerModule(StoreRef, *ThreadsMod.get());
+    ImpObjs.insert({HostRegistration::WasiThreads, std::move(ThreadsMod)});
+  }
+}
+
+Expect<void> VM::runThread(const uint32_t Tid, const uint32_t StartArg,
+                           std::promise<bool> &Ready) {
+  /// Spawned threads have interpreters and stores of their own.
+  Runtime::StoreManager ThreadStore;
+  Interpreter::Interpreter ThreadEngine(Conf);
+  uint32_t StartAddr;
+  if (auto Res = instantiateThread(ThreadEngine, ThreadStore)) {
+    StartAddr = *Res;
+    Ready.set_value(true);
+  } else {
+    Ready.set_value(false);
+    return Unexpect(Res);
+  }
+
+  const std::array<ValVariant, 2> Params = {Tid, StartArg};
+  if (auto Res = ThreadEngine.invoke(ThreadStore, StartAddr, Params); !Res) {
+    if (Res.error() != ErrCode::Terminated) {
+      LOG(ERROR) << ErrInfo::InfoExecuting("", "wasi_thread_start");
+    }
+    return Unexpect(Res);
+  }
+  return {};
+}
+
+Expect<uint32_t> VM::instantiateThread(Interpreter::Interpreter &ThreadEngine,
+                                       Runtime::StoreManager &ThreadStore) {
+  /// The memory of all threads is the imported shared one.
+  if (!Mod->getMemorySection().getContent().empty()) {
+    LOG(ERROR) << ErrCode::ExpectSharedMemory;
+    LOG(ERROR) << "Spawned threads need the module to import its memory";
+    return Unexpect(ErrCode::ExpectSharedMemory);
+  }
+
+  /// Host modules are registered again, and their instances are shared.
+  for (const auto &ImpObj : ImpObjs) {
+    if (auto Res = ThreadEngine.registerModule(ThreadStore, *ImpObj.second);
+        !Res) {
+      return Unexpect(Res);
+    }
+  }
+
+  /// Other imports are shared with the instances of the VM store. Functions
+  /// of Wasm modules and tables refer to the VM store by addresses, so they
+  /// can not be shared.
+  std::map<std::string_view, Runtime::Instance::ModuleInstance *> Shared;
+  for (const auto &ImpDesc : Mod->getImportSection().getContent()) {
+    const auto ModName = ImpDesc.getModuleName();
+    const auto ExtName = ImpDesc.getExternalName();
+    auto It = Shared.find(ModName);
+    if (It == Shared.end()) {
+      if (ThreadStore.findModule(ModName)) {
+        continue;
+      }
+      const uint32_t Addr = ThreadStore.importModule(ModName);
+      It = Shared.emplace(ModName, *ThreadStore.getModule(Addr)).first;
+    }
+    auto *ThreadModInst = It->second;
+    auto *ModInst = *StoreRef.findModule(ModName);
+    switch (ImpDesc.getExternalType()) {
+    case ExternalType::Function: {
+      auto Exp = ModInst->getFuncExports();
+      auto *FuncInst = *StoreRef.getFunction(Exp.find(ExtName)->second);
+      if (!FuncInst->isHostFunction()) {
+        break;
+      }
+      ThreadModInst->addFuncAddr(ThreadStore.importHostFunction(*FuncInst));
+      ThreadModInst->exportFunction(ExtName, ThreadModInst->getFuncNum() - 1);
+      continue;
+    }
+    case ExternalType::Memory: {
+      auto Exp = ModInst->getMemExports();
+      auto *MemInst = *StoreRef.getMemory(Exp.find(ExtName)->second);
+      ThreadModInst->addMemAddr(ThreadStore.importHostMemory(*MemInst));
+      ThreadModInst->exportMemory(ExtName, ThreadModInst->getMemNum() - 1);
+      continue;
+    }
+    case ExternalType::Global: {
+      auto Exp = ModInst->getGlobalExports();
+      auto *GlobInst = *StoreRef.getGlobal(Exp.find(ExtName)->second);
+      ThreadModInst->addGlobalAddr(ThreadStore.importHostGlobal(*GlobInst));
+      ThreadModInst->exportGlobal(ExtName, ThreadModInst->getGlobalNum() - 1);
+      continue;
+    }
+    case ExternalType::Tag: {
+      auto Exp = ModInst->getTagExports();
+      auto *TagInst = *StoreRef.getTag(Exp.find(ExtName)->second);
+      ThreadModInst->addTagAddr(ThreadStore.importHostTag(*TagInst));
+      ThreadModInst->exportTag(ExtName, ThreadModInst->getTagNum() - 1);
+      continue;
+    }
+    default:
+      break;
+    }
+    LOG(ERROR) << ErrCode::UnknownImport;
+    LOG(ERROR) << "Spawned threads can not share this import";
+    LOG(ERROR) << ErrInfo::InfoLinking(ModName, ExtName,
+                                       ImpDesc.getExternalType());
+    return Unexpect(ErrCode::UnknownImport);
+  }
+
+  if (auto Res = ThreadEngine.instantiateModule(ThreadStore, *Mod); !Res) {
+    return Unexpect(Res);
+  }
+  const auto FuncExp = ThreadStore.getFuncExports();
+  const auto FuncIter = FuncExp.find("wasi_thread_start");
+  if (FuncIter == FuncExp.cend()) {
+    LOG(ERROR) << ErrCode::FuncNotFound;
+    LOG(ERROR) << ErrInfo::InfoExecuting("", "wasi_thread_start");
+    return Unexpect(ErrCode::FuncNotFound);
+  }
+  return FuncIter->second;
 }
 
 Expect<void> VM::registerModule(std::string_view Name,
@@ -74,8 +202,7 @@ Expect<void> VM::registerModule(const Runtime::ImportObject &Obj) {
   return InterpreterEngine.registerModule(StoreRef, Obj);
 }
 
-Expect<void> VM::registerModule(std::string_view Name,
-                                const AST::Module &Module) {
+Expect<void> VM::registerModule(std::string_view Name, AST::Module &Module) {
   if (Stage == VMStage::Instantiated) {
     /// When registering module, instantiated module in store will be reset.
     /// Therefore the instantiation should restart.
@@ -120,7 +247,7 @@ Expect<std::vector<ValVariant>> VM::runWasmFile(Span<const Byte> Code,
   }
 }
 
-Expect<std::vector<ValVariant>> VM::runWasmFile(const AST::Module &Module,
+Expect<std::vector<ValVariant>> VM::runWasmFile(AST::Module &Module,
                                                 std::string_view Func,
                                                 Span<const ValVariant> Params) {
   if (Stage == VMStage::Instantiated) {
@@ -255,7 +382,18 @@ Expect<std::vector<ValVariant>> VM::execute(std::string_view Mod,
   }
 }
 
+void VM::joinThreads() noexcept {
+  if (auto It = ImpObjs.find(HostRegistration::WasiThreads);
+      It != ImpObjs.end()) {
+    static_cast<Host::WasiThreadsModule *>(It->second.get())
+        ->getEnv()
+        .joinAll();
+  }
+}
+
 void VM::cleanup() {
+  /// Spawned threads run on the instances in store.
+  joinThreads();
   Mod.reset();
   StoreRef.reset();
   Stat.clear();
@@ -0,0 +1,456 @@
+// SPDX-License-Identifier: Apache-2.0
+//===-- ssvm/test/aot/AOTcompilerTest.cpp - AOT compiler option tests -----===//
+//
+// Part of the SSVM Project.
+//
+//===----------------------------------------------------------------------===//
+///
+/// \file
+/// This file contents tests of the AOT compiler options which change how the
+/// code is emitted, but must not change how it runs.
+///
+//===----------------------------------------------------------------------===//
+
+#include "aot/compiler.h"
+#include "common/configure.h"
+#include "common/filesystem.h"
+#include "common/log.h"
+#include "loader/ldmgr.h"
+#include "loader/loader.h"
+#include "validator/validator.h"
+#include "vm/vm.h"
+
+#include "gtest/gtest.h"
+
+#include <algorithm>
+#include <fstream>
+#include <iterator>
+#include <map>
+#include <optional>
+#include <regex>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace {
+
+using namespace std::literals;
+
+/// (module
+///   (type $t (func (param i32) (result i32)))
+///   (table 2 funcref)
+///   (memory 1)
+///   (global (mut i32) (i32.const 0))
+///   (elem (i32.const 0) $sq $dbl)
+///   (func $sq (type $t) local.get 0 local.get 0 i32.mul)
+///   (func $dbl (type $t) local.get 0 local.get 0 i32.add)
+///   (func $acc (param i32) global.get 0 local.get 0 i32.add global.set 0)
+///   (func (export "f") (type $t)
+///     i32.const 0 local.get 0 call $sq i32.store
+///     local.get 0 call $dbl call $acc
+///     local.get 0 i32.const 0 call_indirect (type $t)
+///     i32.const 0 i32.load i32.add
+///     global.get 0 i32.add))
+std::vector<SSVM::Byte> PartitionWasm = {
+    0x00, 0x61, 0x73, 0x6D, 0x01, 0x00, 0x00, 0x00, 0x01, 0x0A, 0x02, 0x60,
+    0x01, 0x7F, 0x01, 0x7F, 0x60, 0x01, 0x7F, 0x00, 0x03, 0x05, 0x04, 0x00,
+    0x00, 0x01, 0x00, 0x04, 0x04, 0x01, 0x70, 0x00, 0x02, 0x05, 0x03, 0x01,
+    0x00, 0x01, 0x06, 0x06, 0x01, 0x7F, 0x01, 0x41, 0x00, 0x0B, 0x07, 0x05,
+    0x01, 0x01, 0x66, 0x00, 0x03, 0x09, 0x08, 0x01, 0x00, 0x41, 0x00, 0x0B,
+    0x02, 0x00, 0x01, 0x0A, 0x3D, 0x04, 0x07, 0x00, 0x20, 0x00, 0x20, 0x00,
+    0x6C, 0x0B, 0x07, 0x00, 0x20, 0x00, 0x20, 0x00, 0x6A, 0x0B, 0x09, 0x00,
+    0x23, 0x00, 0x20, 0x00, 0x6A, 0x24, 0x00, 0x0B, 0x21, 0x00, 0x41, 0x00,
+    0x20, 0x00, 0x10, 0x00, 0x36, 0x02, 0x00, 0x20, 0x00, 0x10, 0x01, 0x10,
+    0x02, 0x20, 0x00, 0x41, 0x00, 0x11, 0x00, 0x00, 0x41, 0x00, 0x28, 0x02,
+    0x00, 0x6A, 0x23, 0x00, 0x6A, 0x0B};
+
+/// The module above with four nops at the beginning of $sq, which moves the
+/// bodies of all the following functions.
+std::vector<SSVM::Byte> GrownWasm = {
+    0x00, 0x61, 0x73, 0x6D, 0x01, 0x00, 0x00, 0x00, 0x01, 0x0A, 0x02, 0x60,
+    0x01, 0x7F, 0x01, 0x7F, 0x60, 0x01, 0x7F, 0x00, 0x03, 0x05, 0x04, 0x00,
+    0x00, 0x01, 0x00, 0x04, 0x04, 0x01, 0x70, 0x00, 0x02, 0x05, 0x03, 0x01,
+    0x00, 0x01, 0x06, 0x06, 0x01, 0x7F, 0x01, 0x41, 0x00, 0x0B, 0x07, 0x05,
+    0x01, 0x01, 0x66, 0x00, 0x03, 0x09, 0x08, 0x01, 0x00, 0x41, 0x00, 0x0B,
+    0x02, 0x00, 0x01, 0x0A, 0x41, 0x04, 0x0B, 0x00, 0x01, 0x01, 0x01, 0x01,
+    0x20, 0x00, 0x20, 0x00, 0x6C, 0x0B, 0x07, 0x00, 0x20, 0x00, 0x20, 0x00,
+    0x6A, 0x0B, 0x09, 0x00, 0x23, 0x00, 0x20, 0x00, 0x6A, 0x24, 0x00, 0x0B,
+    0x21, 0x00, 0x41, 0x00, 0x20, 0x00, 0x10, 0x00, 0x36, 0x02, 0x00, 0x20,
+    0x00, 0x10, 0x01, 0x10, 0x02, 0x20, 0x00, 0x41, 0x00, 0x11, 0x00, 0x00,
+    0x41, 0x00, 0x28, 0x02, 0x00, 0x6A, 0x23, 0x00, 0x6A, 0x0B};
+
+SSVM::Configure Conf;
+
+SSVM::Expect<void> compile(SSVM::AOT::Compiler &Compiler,
+                           const std::vector<SSVM::Byte> &Data,
+                           const std::filesystem::path &Path) {
+  SSVM::Loader::Loader Loader(Conf);
+  SSVM::Validator::Validator Validator(Conf);
+  auto Module = Loader.parseModule(Data);
+  if (!Module) {
+    return SSVM::Unexpect(Module);
+  }
+  if (auto Res = Validator.validate(**Module); !Res) {
+    return SSVM::Unexpect(Res);
+  }
+  return Compiler.compile(Data, **Module, Path);
+}
+
+/// Call the exported function `f` twice, so the results also cover the state
+/// kept in the memory and the global between calls.
+std::vector<uint32_t> run(const std::filesystem::path &Path, uint32_t Arg) {
+  std::vector<uint32_t> Results;
+  SSVM::VM::VM VM(Conf);
+  if (!VM.loadWasm(Path) || !VM.validate() || !VM.instantiate()) {
+    return Results;
+  }
+  for (int I = 0; I < 2; ++I) {
+    std::vector<SSVM::ValVariant> Params = {Arg};
+    if (auto Res = VM.execute("f", Params)) {
+      Results.push_back(std::get<uint32_t>((*Res)[0]));
+    }
+  }
+  return Results;
+}
+
+TEST(CompilerTest, Partition__SameAsSingleThread) {
+  SSVM::AOT::Compiler Single;
+  ASSERT_TRUE(compile(Single, PartitionWasm, "partition-j1.so"sv));
+  const auto Expected = run("partition-j1.so"sv, 3);
+  ASSERT_EQ(Expected, (std::vector<uint32_t>{24, 30}));
+
+  /// More partitions than functions leave some partitions empty.
+  for (uint32_t Threads : {2U, 4U, 8U}) {
+    SSVM::AOT::Compiler Partitioned;
+    Partitioned.setThreads(Threads);
+    const std::string Path = "partition-j" + std::to_string(Threads) + ".so";
+    ASSERT_TRUE(compile(Partitioned, PartitionWasm, Path));
+    EXPECT_EQ(run(Path, 3), Expected) << "threads: " << Threads;
+  }
+}
+
+/// Cached objects with their modification times.
+std::map<std::filesystem::path, std::filesystem::file_time_type>
+listCache(const std::filesystem::path &Dir) {
+  std::map<std::filesystem::path, std::filesystem::file_time_type> Objects;
+  for (const auto &Entry : std::filesystem::directory_iterator(Dir)) {
+    if (Entry.path().extension() == ".o"sv) {
+      Objects.emplace(Entry.path(), Entry.last_write_time());
+    }
+  }
+  return Objects;
+}
+
+TEST(CompilerTest, Cache__HitMissAndInvalidation) {
+  const auto Dir = std::filesystem::temp_directory_path() / "ssvm-aot-cache"sv;
+  std::error_code EC;
+  std::filesystem::remove_all(Dir, EC);
+  auto Compile = [&Dir](const std::vector<SSVM::Byte> &Data,
+                        SSVM::AOT::Compiler::OptimizationLevel Level) {
+    SSVM::AOT::Compiler Compiler;
+    Compiler.setOptimizationLevel(Level);
+    Compiler.setCacheDirectory(Dir);
+    Compiler.setCachePartitions(4);
+    return compile(Compiler, Data, "cache.so"sv);
+  };
+  const auto O2 = SSVM::AOT::Compiler::OptimizationLevel::O2;
+
+  /// A cold cache is filled by the first compilation.
+  ASSERT_TRUE(Compile(PartitionWasm, O2));
+  EXPECT_EQ(run("cache.so"sv, 3), (std::vector<uint32_t>{24, 30}));
+  const auto Cold = listCache(Dir);
+  ASSERT_FALSE(Cold.empty());
+
+  /// Compiling again reuses every object without publishing it again.
+  ASSERT_TRUE(Compile(PartitionWasm, O2));
+  EXPECT_EQ(run("cache.so"sv, 3), (std::vector<uint32_t>{24, 30}));
+  EXPECT_EQ(listCache(Dir), Cold);
+
+  /// Changing one function misses the cache for its partition only.
+  auto Changed = PartitionWasm;
+  const std::vector<SSVM::Byte> Dbl = {0x20, 0x00, 0x20, 0x00, 0x6A, 0x0B};
+  auto It = std::search(Changed.begin(), Changed.end(), Dbl.begin(), Dbl.end());
+  ASSERT_NE(It, Changed.end());
+  It[4] = 0x6C;
+  ASSERT_TRUE(Compile(Changed, O2));
+  EXPECT_EQ(run("cache.so"sv, 3), (std::vector<uint32_t>{27, 36}));
+  const auto Warm = listCache(Dir);
+  EXPECT_GT(Warm.size(), Cold.size());
+  for (const auto &Object : Cold) {
+    EXPECT_EQ(Warm.count(Object.first), 1U);
+  }
+
+  /// Other compile options invalidate the whole cache.
+  const auto O1 = SSVM::AOT::Compiler::OptimizationLevel::O1;
+  ASSERT_TRUE(Compile(PartitionWasm, O1));
+  EXPECT_EQ(run("cache.so"sv, 3), (std::vector<uint32_t>{24, 30}));
+  EXPECT_GE(listCache(Dir).size(), Warm.size() + Cold.size());
+
+  /// An object which can not be read is compiled again.
+  for (const auto &Object : Cold) {
+    std::filesystem::remove(Object.first);
+    std::filesystem::create_directory(Object.first);
+  }
+  ASSERT_TRUE(Compile(PartitionWasm, O2));
+  EXPECT_EQ(run("cache.so"sv, 3), (std::vector<uint32_t>{24, 30}));
+
+  std::filesystem::remove_all(Dir, EC);
+}
+
+/// Lines of the debug metadata in the textual IR matching the pattern.
+std::vector<uint32_t> readDebugLines(const std::filesystem::path &Path,
+                                     const std::regex &Pattern) {
+  std::ifstream File(Path);
+  std::stringstream Buffer;
+  Buffer << File.rdbuf();
+  const std::string IR = Buffer.str();
+  std::vector<uint32_t> Lines;
+  for (std::sregex_iterator It(IR.begin(), IR.end(), Pattern), End; It != End;
+       ++It) {
+    Lines.push_back(std::stoul((*It)[1].str()));
+  }
+  return Lines;
+}
+
+TEST(CompilerTest, DebugInfo__FunctionRelativeLines) {
+  SSVM::AOT::Compiler Compiler;
+  Compiler.setOptimizationLevel(SSVM::AOT::Compiler::OptimizationLevel::O0);
+  Compiler.setDumpIR();
+  ASSERT_TRUE(compile(Compiler, PartitionWasm, "debuginfo.so"sv));
+
+  /// Every function starts at line 1 of the "wasm" file.
+  const auto Functions = readDebugLines(
+      "wasm.ll"sv, std::regex(R"(!DISubprogram\(.*?[(, ]line: (\d+))"));
+  ASSERT_EQ(Functions.size(), 4U);
+  for (const auto Line : Functions) {
+    EXPECT_EQ(Line, 1U);
+  }
+
+  /// Instructions are counted from the first one of their function, so no
+  /// line reaches the offsets of the code section, which starts after 60
+  /// bytes of the binary.
+  const auto Locations = readDebugLines(
+      "wasm.ll"sv, std::regex(R"(!DILocation\(line: (\d+))"));
+  ASSERT_FALSE(Locations.empty());
+  for (const auto Line : Locations) {
+    EXPECT_GE(Line, 1U);
+    EXPECT_LE(Line, 34U);
+  }
+}
+
+TEST(CompilerTest, DebugInfo__CacheKeyKeepsMovedFunctions) {
+  const auto Dir =
+      std::filesystem::temp_directory_path() / "ssvm-aot-debug-cache"sv;
+  std::error_code EC;
+  std::filesystem::remove_all(Dir, EC);
+  auto Compile = [&Dir](const std::vector<SSVM::Byte> &Data) {
+    SSVM::AOT::Compiler Compiler;
+    Compiler.setCacheDirectory(Dir);
+    Compiler.setCachePartitions(4);
+    return compile(Compiler, Data, "debug-cache.so"sv);
+  };
+
+  ASSERT_TRUE(Compile(PartitionWasm));
+  const auto Cold = listCache(Dir);
+  ASSERT_FALSE(Cold.empty());
+
+  /// Only the partition of the grown function misses the cache, although the
+  /// other functions are moved in the binary.
+  ASSERT_TRUE(Compile(GrownWasm));
+  EXPECT_EQ(run("debug-cache.so"sv, 3), (std::vector<uint32_t>{24, 30}));
+  const auto Warm = listCache(Dir);
+  EXPECT_GT(Warm.size(), Cold.size());
+  EXPECT_LT(Warm.size() - Cold.size(), Cold.size());
+
+  std::filesystem::remove_all(Dir, EC);
+}
+
+TEST(CompilerTest, Metadata__NoWasmBinary) {
+  SSVM::AOT::Compiler Compiler;
+  ASSERT_TRUE(compile(Compiler, PartitionWasm, "metadata.so"sv));
+  {
+    /// Only the metadata is embedded, not a second copy of the Wasm binary.
+    SSVM::LDMgr Mgr;
+    ASSERT_TRUE(Mgr.setPath("metadata.so"sv));
+    EXPECT_FALSE(Mgr.getSymbol<uint8_t>("wasm.code"));
+    auto Meta = Mgr.getMetadata();
+    ASSERT_TRUE(Meta && *Meta);
+    EXPECT_LT((*Meta)->size(), PartitionWasm.size());
+  }
+  EXPECT_EQ(run("metadata.so"sv, 3), (std::vector<uint32_t>{24, 30}));
+}
+
+/// (module
+///   (func (export "f") (param f32 f32 f32) (result f32)
+///     (f32.add (f32.mul (local.get 0) (local.get 1)) (local.get 2))))
+std::vector<SSVM::Byte> MulAddWasm = {
+    0x00, 0x61, 0x73, 0x6D, 0x01, 0x00, 0x00, 0x00, 0x01, 0x08, 0x01, 0x60,
+    0x03, 0x7D, 0x7D, 0x7D, 0x01, 0x7D, 0x03, 0x02, 0x01, 0x00, 0x07, 0x05,
+    0x01, 0x01, 0x66, 0x00, 0x00, 0x0A, 0x0C, 0x01, 0x0A, 0x00, 0x20, 0x00,
+    0x20, 0x01, 0x94, 0x20, 0x02, 0x92, 0x0B};
+
+TEST(CompilerTest, RelaxedFP__NoContraction) {
+  /// The product rounds to 1 + 2^-11, so the sum is 0 unless the multiply
+  /// and the add are fused, which keeps the 2^-24 of the exact product.
+  const float A = 0x1.001p0f;
+  const float C = -0x1.002p0f;
+  std::vector<std::vector<std::string>> CPUs = {{}};
+#if defined(__x86_64__)
+  CPUs.push_back({"x86-64"s, "haswell"s});
+#endif
+  for (const auto &CPU : CPUs) {
+    SSVM::AOT::Compiler Compiler;
+    Compiler.setRelaxedFP();
+    if (!CPU.empty()) {
+      Compiler.setTargetCPUs(CPU);
+    }
+    ASSERT_TRUE(compile(Compiler, MulAddWasm, "relaxed-fp.so"sv));
+    SSVM::VM::VM VM(Conf);
+    ASSERT_TRUE(VM.loadWasm("relaxed-fp.so"sv));
+    ASSERT_TRUE(VM.validate());
+    ASSERT_TRUE(VM.instantiate());
+    std::vector<SSVM::ValVariant> Params = {A, A, C};
+    auto Res = VM.execute("f", Params);
+    ASSERT_TRUE(Res);
+    EXPECT_EQ(std::get<float>((*Res)[0]), 0.0f) << "variants: " << CPU.size();
+  }
+}
+
+/// (module (table (export "tab") 1 funcref))
+std::vector<SSVM::Byte> TableLibWasm = {
+    0x00, 0x61, 0x73, 0x6D, 0x01, 0x00, 0x00, 0x00, 0x04, 0x04, 0x01, 0x70,
+    0x00, 0x01, 0x07, 0x07, 0x01, 0x03, 0x74, 0x61, 0x62, 0x01, 0x00};
+
+/// (module
+///   (type $t (func (result i32)))
+///   (import "lib" "tab" (table 1 funcref))
+///   (func $f (type $t) i32.const 1)
+///   (elem (i32.const 0) $f)
+///   (func (export "call") (type $t) i32.const 0 call_indirect (type $t)))
+std::vector<SSVM::Byte> TableFillWasm = {
+    0x00, 0x61, 0x73, 0x6D, 0x01, 0x00, 0x00, 0x00, 0x01, 0x05, 0x01, 0x60,
+    0x00, 0x01, 0x7F, 0x02, 0x0D, 0x01, 0x03, 0x6C, 0x69, 0x62, 0x03, 0x74,
+    0x61, 0x62, 0x01, 0x70, 0x00, 0x01, 0x03, 0x03, 0x02, 0x00, 0x00, 0x07,
+    0x08, 0x01, 0x04, 0x63, 0x61, 0x6C, 0x6C, 0x00, 0x01, 0x09, 0x07, 0x01,
+    0x00, 0x41, 0x00, 0x0B, 0x01, 0x00, 0x0A, 0x0E, 0x02, 0x04, 0x00, 0x41,
+    0x01, 0x0B, 0x07, 0x00, 0x41, 0x00, 0x11, 0x00, 0x00, 0x0B};
+
+/// The module above without the element segment, and $f returns 2.
+std::vector<SSVM::Byte> TableKeepWasm = {
+    0x00, 0x61, 0x73, 0x6D, 0x01, 0x00, 0x00, 0x00, 0x01, 0x05, 0x01, 0x60,
+    0x00, 0x01, 0x7F, 0x02, 0x0D, 0x01, 0x03, 0x6C, 0x69, 0x62, 0x03, 0x74,
+    0x61, 0x62, 0x01, 0x70, 0x00, 0x01, 0x03, 0x03, 0x02, 0x00, 0x00, 0x07,
+    0x08, 0x01, 0x04, 0x63, 0x61, 0x6C, 0x6C, 0x00, 0x01, 0x0A, 0x0E, 0x02,
+    0x04, 0x00, 0x41, 0x02, 0x0B, 0x07, 0x00, 0x41, 0x00, 0x11, 0x00, 0x00,
+    0x0B};
+
+TEST(CompilerTest, Table__ResetRegisteredTable) {
+  SSVM::AOT::Compiler Compiler;
+  ASSERT_TRUE(compile(Compiler, TableFillWasm, "table-fill.so"sv));
+  ASSERT_TRUE(compile(Compiler, TableKeepWasm, "table-keep.so"sv));
+  SSVM::VM::VM VM(Conf);
+  ASSERT_TRUE(VM.registerModule("lib"sv, TableLibWasm));
+  auto Call =
+      [&VM](const std::filesystem::path &Path) -> std::optional<uint32_t> {
+    if (!VM.loadWasm(Path) || !VM.validate() || !VM.instantiate()) {
+      return std::nullopt;
+    }
+    if (auto Res = VM.execute("call")) {
+      return std::get<uint32_t>((*Res)[0]);
+    }
+    return std::nullopt;
+  };
+  EXPECT_EQ(Call("table-fill.so"sv), 1U);
+  /// The registered table keeps the reference, but the code it resolved to
+  /// was dropped. The reference is resolved again by the runtime to the
+  /// function now at its address.
+  EXPECT_EQ(Call("table-keep.so"sv), 2U);
+}
+
+TEST(CompilerTest, Variant__Partitioned) {
+  const auto Dir =
+      std::filesystem::temp_directory_path() / "ssvm-aot-variant-cache"sv;
+  std::error_code EC;
+  std::filesystem::remove_all(Dir, EC);
+  /// Both variants emit the same local symbols, which must still link when
+  /// they are externalized by splitting.
+  for (bool Cache : {false, true}) {
+    SSVM::AOT::Compiler Compiler;
+    Compiler.setTargetCPUs({"generic"s, "generic"s});
+    Compiler.setThreads(4);
+    if (Cache) {
+      Compiler.setCacheDirectory(Dir);
+    }
+    ASSERT_TRUE(compile(Compiler, PartitionWasm, "variant-split.so"sv));
+    EXPECT_EQ(run("variant-split.so"sv, 3), (std::vector<uint32_t>{24, 30}));
+  }
+  std::filesystem::remove_all(Dir, EC);
+}
+
+#if defined(__x86_64__)
+/// Copy the library with every occurrence of a feature name replaced by a name
+/// of the same length the loader does not know.
+void renameFeature(const std::filesystem::path &From,
+                   const std::filesystem::path &To, std::string_view Feature,
+                   std::string_view Unknown) {
+  std::ifstream In(From, std::ios::binary);
+  std::string Content((std::istreambuf_iterator<char>(In)),
+                      std::istreambuf_iterator<char>());
+  for (auto Pos = Content.find(Feature); Pos != std::string::npos;
+       Pos = Content.find(Feature, Pos)) {
+    Content.replace(Pos, Unknown.size(), Unknown);
+  }
+  std::ofstream Out(To, std::ios::binary);
+  Out << Content;
+}
+
+std::optional<uint32_t> selectVariant(const std::filesystem::path &Path) {
+  SSVM::LDMgr Mgr;
+  if (!Mgr.setPath(Path)) {
+    return std::nullopt;
+  }
+  if (auto Variant = Mgr.getVariant(); Variant && *Variant) {
+    return **Variant;
+  }
+  return std::nullopt;
+}
+
+TEST(CompilerTest, Variant__Selection) {
+  SSVM::AOT::Compiler Compiler;
+  Compiler.setTargetCPUs({"x86-64"s, "nehalem"s});
+  ASSERT_TRUE(compile(Compiler, PartitionWasm, "variant.so"sv));
+
+  /// The last variant the host supports is selected.
+  EXPECT_EQ(selectVariant("variant.so"sv), 1U);
+  EXPECT_EQ(run("variant.so"sv, 3), (std::vector<uint32_t>{24, 30}));
+
+  /// A variant requiring an unknown feature is skipped.
+  renameFeature("variant.so"sv, "variant-unknown.so"sv, "popcnt"sv,
+                "xpopcn"sv);
+  EXPECT_EQ(selectVariant("variant-unknown.so"sv), 0U);
+  EXPECT_EQ(run("variant-unknown.so"sv, 3), (std::vector<uint32_t>{24, 30}));
+}
+
+TEST(CompilerTest, Variant__Unsupported) {
+  SSVM::AOT::Compiler Compiler;
+  Compiler.setTargetCPUs({"nehalem"s});
+  ASSERT_TRUE(compile(Compiler, PartitionWasm, "variant-one.so"sv));
+  renameFeature("variant-one.so"sv, "variant-none.so"sv, "popcnt"sv,
+                "xpopcn"sv);
+
+  /// Without a supported variant the library is rejected.
+  SSVM::Loader::Loader Loader(Conf);
+  auto Module = Loader.parseModule(
+      std::filesystem::path(std::filesystem::u8path("variant-none.so"sv)));
+  ASSERT_FALSE(Module);
+  EXPECT_EQ(Module.error(), SSVM::ErrCode::InvalidVersion);
+}
+#endif
+
+} // namespace
+
+GTEST_API_ int main(int argc, char **argv) {
+  SSVM::Log::setErrorLoggingLevel();
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
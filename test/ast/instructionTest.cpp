@@ -409,4 +409,57 @@ TEST(InstructionTest, LoadConstInstruction) {
   EXPECT_TRUE(Ins5.loadBinary(Mgr, Conf) && Mgr.getRemainSize() == 0);
 }
 
+TEST(InstructionTest, LoadRelaxedSIMDInstruction) {
+  /// 9. Test relaxed SIMD instructions.
+  ///
+  ///   1.  Load relaxed SIMD instructions from 0xFD 0x100 to 0xFD 0x113.
+  ///   2.  Load the non-standard SIMD instruction at 0xFD 0x100 without the
+  ///       relaxed SIMD proposal.
+  ///   3.  Load invalid 0xFD 0x113 without the relaxed SIMD proposal.
+  ///   4.  Load relaxed SIMD instructions without the SIMD proposal.
+  SSVM::Configure RelaxedConf(SSVM::Proposal::SIMD,
+                              SSVM::Proposal::RelaxedSIMD);
+  for (uint8_t I = 0; I < 0x14U; ++I) {
+    Mgr.clearBuffer();
+    std::vector<unsigned char> Vec1 = {
+        0xFDU, static_cast<unsigned char>(0x80U | I), 0x02U, /// Relaxed SIMD.
+        0x0BU /// Expression End.
+    };
+    Mgr.setCode(Vec1);
+    SSVM::AST::Expression Exp1;
+    ASSERT_TRUE(Exp1.loadBinary(Mgr, RelaxedConf) && Mgr.getRemainSize() == 0);
+    EXPECT_EQ(Exp1.getInstrs()[0].getOpCode(),
+              static_cast<SSVM::OpCode>(
+                  static_cast<uint16_t>(SSVM::OpCode::I8x16__relaxed_swizzle) +
+                  I));
+  }
+
+  SSVM::Configure SIMDConf(SSVM::Proposal::SIMD);
+  Mgr.clearBuffer();
+  std::vector<unsigned char> Vec2 = {
+      0xFDU, 0x80U, 0x02U, /// I64x2 trunc_sat_f64x2_s.
+      0x0BU                /// Expression End.
+  };
+  Mgr.setCode(Vec2);
+  SSVM::AST::Expression Exp2;
+  ASSERT_TRUE(Exp2.loadBinary(Mgr, SIMDConf) && Mgr.getRemainSize() == 0);
+  EXPECT_EQ(Exp2.getInstrs()[0].getOpCode(),
+            SSVM::OpCode::I64x2__trunc_sat_f64x2_s);
+
+  Mgr.clearBuffer();
+  std::vector<unsigned char> Vec3 = {
+      0xFDU, 0x93U, 0x02U, /// I32x4 relaxed_dot_i8x16_i7x16_add_s.
+      0x0BU                /// Expression End.
+  };
+  Mgr.setCode(Vec3);
+  SSVM::AST::Expression Exp3;
+  EXPECT_FALSE(Exp3.loadBinary(Mgr, SIMDConf));
+
+  SSVM::Configure NoSIMDConf(SSVM::Proposal::RelaxedSIMD);
+  Mgr.clearBuffer();
+  Mgr.setCode(Vec3);
+  SSVM::AST::Expression Exp4;
+  EXPECT_FALSE(Exp4.loadBinary(Mgr, NoSIMDConf));
+}
+
 } // namespace
@@ -93,8 +93,11 @@ TEST(SegmentTest, LoadCodeSegment) {
   ///   3.  Load code segment of empty locals and expression with only End
   ///       operation.
   ///   4.  Load code segment with expression and local lists.
+  ///   5.  Copied code segment shares the function body.
   Mgr.clearBuffer();
   SSVM::AST::CodeSegment Seg1;
+  EXPECT_EQ(Seg1.getBody(), nullptr);
+  EXPECT_TRUE(Seg1.getInstrs().empty());
   EXPECT_FALSE(Seg1.loadBinary(Mgr, Conf));
 
   Mgr.clearBuffer();
@@ -128,6 +131,12 @@ TEST(SegmentTest, LoadCodeSegment) {
   Mgr.setCode(Vec4);
   SSVM::AST::CodeSegment Seg4;
   EXPECT_TRUE(Seg4.loadBinary(Mgr, Conf) && Mgr.getRemainSize() == 0);
+  EXPECT_EQ(Seg4.getLocals().size(), 4U);
+  EXPECT_EQ(Seg4.getInstrs().size(), 4U);
+
+  SSVM::AST::CodeSegment Seg5(Seg4);
+  EXPECT_EQ(Seg5.getBody(), Seg4.getBody());
+  EXPECT_EQ(Seg5.getInstrs().data(), Seg4.getInstrs().data());
 }
 
 TEST(SegmentTest, LoadDataSegment) {
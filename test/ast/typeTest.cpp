@@ -134,6 +134,40 @@ TEST(TypeTest, LoadFunctionType) {
   EXPECT_TRUE(Fun6.loadBinary(Mgr, Conf) && Mgr.getRemainSize() == 0);
 }
 
+TEST(TypeTest, FunctionTypeId) {
+  /// 3. Test canonical ids of function types.
+  ///
+  ///   1.  Load void parameter and result function type.
+  ///   2.  Load the same function type twice.
+  ///   3.  Load function type with swapped parameter and result.
+  Mgr.clearBuffer();
+  std::vector<unsigned char> Vec1 = {0x60U, 0x00U, 0x00U};
+  Mgr.setCode(Vec1);
+  SSVM::AST::FunctionType Fun1;
+  EXPECT_TRUE(Fun1.loadBinary(Mgr, Conf));
+  EXPECT_EQ(Fun1.getTypeId(), SSVM::kEmptyFuncTypeId);
+
+  Mgr.clearBuffer();
+  std::vector<unsigned char> Vec2 = {0x60U, 0x01U, 0x7FU, 0x01U, 0x7EU};
+  Mgr.setCode(Vec2);
+  SSVM::AST::FunctionType Fun2;
+  EXPECT_TRUE(Fun2.loadBinary(Mgr, Conf));
+  Mgr.clearBuffer();
+  Mgr.setCode(Vec2);
+  SSVM::AST::FunctionType Fun3;
+  EXPECT_TRUE(Fun3.loadBinary(Mgr, Conf));
+  EXPECT_EQ(Fun2.getTypeId(), Fun3.getTypeId());
+  EXPECT_TRUE(Fun2 == Fun3);
+
+  Mgr.clearBuffer();
+  std::vector<unsigned char> Vec4 = {0x60U, 0x01U, 0x7EU, 0x01U, 0x7FU};
+  Mgr.setCode(Vec4);
+  SSVM::AST::FunctionType Fun4;
+  EXPECT_TRUE(Fun4.loadBinary(Mgr, Conf));
+  EXPECT_NE(Fun2.getTypeId(), Fun4.getTypeId());
+  EXPECT_NE(Fun1.getTypeId(), Fun4.getTypeId());
+}
+
 TEST(TypeTest, LoadMemoryType) {
   /// 1. Test load memory type, which is limit.
   ///
@@ -0,0 +1,99 @@
+// SPDX-License-Identifier: Apache-2.0
+#include "host/wasi_threads/threadsfunc.h"
+#include "host/wasi_threads/threadsmodule.h"
+#include "gtest/gtest.h"
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <vector>
+
+namespace {
+SSVM::Runtime::Instance::MemoryInstance makeMemory(bool Shared) {
+  return SSVM::Runtime::Instance::MemoryInstance(
+      SSVM::AST::Limit(1, 1, Shared));
+}
+} // namespace
+
+TEST(WasiThreadsTest, Spawn__NeedSharedMemory) {
+  SSVM::Host::WasiThreadsModule Mod;
+  auto &Env = Mod.getEnv();
+  std::atomic<uint32_t> Runs = 0;
+  Env.setRunner([&Runs](uint32_t, uint32_t, std::promise<bool> &Ready)
+                    -> SSVM::Expect<void> {
+    ++Runs;
+    Ready.set_value(true);
+    return {};
+  });
+  SSVM::Host::WasiThreadSpawn Spawn(Env);
+  auto Unshared = makeMemory(false);
+  auto Res = Spawn.body(nullptr, 0);
+  ASSERT_TRUE(Res);
+  EXPECT_EQ(*Res, -1);
+  Res = Spawn.body(&Unshared, 0);
+  ASSERT_TRUE(Res);
+  EXPECT_EQ(*Res, -1);
+  Env.joinAll();
+  EXPECT_EQ(Runs, 0U);
+}
+
+TEST(WasiThreadsTest, Spawn__NoRunner) {
+  SSVM::Host::WasiThreadsModule Mod;
+  SSVM::Host::WasiThreadSpawn Spawn(Mod.getEnv());
+  auto Shared = makeMemory(true);
+  auto Res = Spawn.body(&Shared, 0);
+  ASSERT_TRUE(Res);
+  EXPECT_EQ(*Res, -1);
+}
+
+TEST(WasiThreadsTest, Spawn__Threads) {
+  SSVM::Host::WasiThreadsModule Mod;
+  auto &Env = Mod.getEnv();
+  std::mutex Mutex;
+  std::vector<std::pair<uint32_t, uint32_t>> Started;
+  Env.setRunner([&](uint32_t Tid, uint32_t StartArg,
+                    std::promise<bool> &Ready) -> SSVM::Expect<void> {
+    Ready.set_value(true);
+    std::unique_lock Lock(Mutex);
+    Started.emplace_back(Tid, StartArg);
+    return {};
+  });
+  SSVM::Host::WasiThreadSpawn Spawn(Env);
+  auto Shared = makeMemory(true);
+  auto Res = Spawn.body(&Shared, 42);
+  ASSERT_TRUE(Res);
+  EXPECT_EQ(*Res, 1);
+  Res = Spawn.body(&Shared, 43);
+  ASSERT_TRUE(Res);
+  EXPECT_EQ(*Res, 2);
+  Env.joinAll();
+  std::sort(Started.begin(), Started.end());
+  EXPECT_EQ(Started, (std::vector<std::pair<uint32_t, uint32_t>>{
+                         {1, 42}, {2, 43}}));
+}
+
+TEST(WasiThreadsTest, Spawn__SetupFailed) {
+  SSVM::Host::WasiThreadsModule Mod;
+  auto &Env = Mod.getEnv();
+  SSVM::Host::WasiThreadSpawn Spawn(Env);
+  auto Shared = makeMemory(true);
+  Env.setRunner([](uint32_t, uint32_t, std::promise<bool> &Ready)
+                    -> SSVM::Expect<void> {
+    Ready.set_value(false);
+    return SSVM::Unexpect(SSVM::ErrCode::ExecutionFailed);
+  });
+  auto Res = Spawn.body(&Shared, 0);
+  ASSERT_TRUE(Res);
+  EXPECT_EQ(*Res, -1);
+  /// A runner returning without setting up the thread also fails the spawn.
+  Env.setRunner([](uint32_t, uint32_t, std::promise<bool> &)
+                    -> SSVM::Expect<void> { return {}; });
+  Res = Spawn.body(&Shared, 0);
+  ASSERT_TRUE(Res);
+  EXPECT_EQ(*Res, -1);
+  Env.joinAll();
+}
+
+GTEST_API_ int main(int argc, char **argv) {
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,450 @@
+// SPDX-License-Identifier: Apache-2.0
+//===-- ssvm/test/interpreter/ExecutionTest.cpp - execution tests ---------===//
+//
+// Part of the SSVM Project.
+//
+//===----------------------------------------------------------------------===//
+///
+/// \file
+/// This file contents tests of executing hand-assembled modules in the
+/// interpreter.
+///
+//===----------------------------------------------------------------------===//
+
+#include "common/configure.h"
+#include "common/log.h"
+#include "vm/vm.h"
+
+#include "gtest/gtest.h"
+
+#include <string_view>
+#include <vector>
+
+namespace {
+
+/// (module
+///   (global (mut i32) (i32.const 0))
+///   (func $init i32.const 10 global.set 0)
+///   (func $inc (block global.get 0 i32.const 1 i32.add global.set 0))
+///   (func (export "f") (param i32) (result i32)
+///     (loop call $inc local.get 0 i32.const 1 i32.sub local.tee 0 br_if 0)
+///     global.get 0)
+///   (start $init))
+std::vector<SSVM::Byte> FrameWasm = {
+    0x00, 0x61, 0x73, 0x6D, 0x01, 0x00, 0x00, 0x00, 0x01, 0x09, 0x02, 0x60,
+    0x00, 0x00, 0x60, 0x01, 0x7F, 0x01, 0x7F, 0x03, 0x04, 0x03, 0x00, 0x00,
+    0x01, 0x06, 0x06, 0x01, 0x7F, 0x01, 0x41, 0x00, 0x0B, 0x07, 0x05, 0x01,
+    0x01, 0x66, 0x00, 0x02, 0x08, 0x01, 0x00, 0x0A, 0x28, 0x03, 0x06, 0x00,
+    0x41, 0x0A, 0x24, 0x00, 0x0B, 0x0C, 0x00, 0x02, 0x40, 0x23, 0x00, 0x41,
+    0x01, 0x6A, 0x24, 0x00, 0x0B, 0x0B, 0x12, 0x00, 0x03, 0x40, 0x10, 0x01,
+    0x20, 0x00, 0x41, 0x01, 0x6B, 0x22, 0x00, 0x0D, 0x00, 0x0B, 0x23, 0x00,
+    0x0B};
+
+/// (module
+///   (global (mut i32) (i32.const 0))
+///   (func (export "inc")
+///     (block global.get 0 i32.const 1 i32.add global.set 0))
+///   (func (export "get") (result i32) global.get 0))
+std::vector<SSVM::Byte> LibWasm = {
+    0x00, 0x61, 0x73, 0x6D, 0x01, 0x00, 0x00, 0x00, 0x01, 0x08, 0x02, 0x60,
+    0x00, 0x00, 0x60, 0x00, 0x01, 0x7F, 0x03, 0x03, 0x02, 0x00, 0x01, 0x06,
+    0x06, 0x01, 0x7F, 0x01, 0x41, 0x00, 0x0B, 0x07, 0x0D, 0x02, 0x03, 0x69,
+    0x6E, 0x63, 0x00, 0x00, 0x03, 0x67, 0x65, 0x74, 0x00, 0x01, 0x0A, 0x13,
+    0x02, 0x0C, 0x00, 0x02, 0x40, 0x23, 0x00, 0x41, 0x01, 0x6A, 0x24, 0x00,
+    0x0B, 0x0B, 0x04, 0x00, 0x23, 0x00, 0x0B};
+
+/// (module
+///   (import "lib" "inc" (func $inc))
+///   (global (mut i32) (i32.const 100))
+///   (func (export "f") (result i32) call $inc call $inc global.get 0))
+std::vector<SSVM::Byte> MainWasm = {
+    0x00, 0x61, 0x73, 0x6D, 0x01, 0x00, 0x00, 0x00, 0x01, 0x08, 0x02, 0x60,
+    0x00, 0x00, 0x60, 0x00, 0x01, 0x7F, 0x02, 0x0B, 0x01, 0x03, 0x6C, 0x69,
+    0x62, 0x03, 0x69, 0x6E, 0x63, 0x00, 0x00, 0x03, 0x02, 0x01, 0x01, 0x06,
+    0x07, 0x01, 0x7F, 0x01, 0x41, 0xE4, 0x00, 0x0B, 0x07, 0x05, 0x01, 0x01,
+    0x66, 0x00, 0x01, 0x0A, 0x0A, 0x01, 0x08, 0x00, 0x10, 0x00, 0x10, 0x00,
+    0x23, 0x00, 0x0B};
+
+/// (module
+///   (type $e (func (param i32)))
+///   (type $t (func (param i32) (result i32)))
+///   (tag $e (type $e))
+///   (func $throw (type $e) local.get 0 throw $e)
+///   (func (export "catch") (type $t)
+///     (try (result i32) (do local.get 0 call $throw i32.const 0)
+///       (catch $e i32.const 100 i32.add)))
+///   (func (export "catch_all") (type $t)
+///     (try (result i32) (do local.get 0 call $throw i32.const 0)
+///       (catch_all i32.const 7)))
+///   (func (export "rethrow") (type $t)
+///     (try (result i32)
+///       (do (try (result i32) (do local.get 0 call $throw i32.const 0)
+///             (catch $e drop (block (result i32) rethrow 1))))
+///       (catch $e i32.const 1000 i32.add)))
+///   (func (export "delegate") (type $t)
+///     (try (result i32)
+///       (do (try (result i32)
+///             (do (try (result i32) (do local.get 0 call $throw i32.const 0)
+///                   (delegate 1)))
+///             (catch_all i32.const 1)))
+///       (catch $e i32.const 2000 i32.add)))
+///   (func (export "delegate0") (type $t)
+///     ;; Same as "delegate" with (delegate 0).
+///     ...)
+///   (func (export "uncaught") (type $t) local.get 0 call $throw i32.const 0))
+std::vector<SSVM::Byte> ExceptionWasm = {
+    0x00, 0x61, 0x73, 0x6D, 0x01, 0x00, 0x00, 0x00, 0x01, 0x0A, 0x02, 0x60,
+    0x01, 0x7F, 0x00, 0x60, 0x01, 0x7F, 0x01, 0x7F, 0x03, 0x08, 0x07, 0x00,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0D, 0x03, 0x01, 0x00, 0x00, 0x07,
+    0x41, 0x06, 0x05, 0x63, 0x61, 0x74, 0x63, 0x68, 0x00, 0x01, 0x09, 0x63,
+    0x61, 0x74, 0x63, 0x68, 0x5F, 0x61, 0x6C, 0x6C, 0x00, 0x02, 0x07, 0x72,
+    0x65, 0x74, 0x68, 0x72, 0x6F, 0x77, 0x00, 0x03, 0x08, 0x64, 0x65, 0x6C,
+    0x65, 0x67, 0x61, 0x74, 0x65, 0x00, 0x04, 0x09, 0x64, 0x65, 0x6C, 0x65,
+    0x67, 0x61, 0x74, 0x65, 0x30, 0x00, 0x05, 0x08, 0x75, 0x6E, 0x63, 0x61,
+    0x75, 0x67, 0x68, 0x74, 0x00, 0x06, 0x0A, 0x87, 0x01, 0x07, 0x06, 0x00,
+    0x20, 0x00, 0x08, 0x00, 0x0B, 0x11, 0x00, 0x06, 0x7F, 0x20, 0x00, 0x10,
+    0x00, 0x41, 0x00, 0x07, 0x00, 0x41, 0xE4, 0x00, 0x6A, 0x0B, 0x0B, 0x0E,
+    0x00, 0x06, 0x7F, 0x20, 0x00, 0x10, 0x00, 0x41, 0x00, 0x19, 0x41, 0x07,
+    0x0B, 0x0B, 0x1C, 0x00, 0x06, 0x7F, 0x06, 0x7F, 0x20, 0x00, 0x10, 0x00,
+    0x41, 0x00, 0x07, 0x00, 0x1A, 0x02, 0x7F, 0x09, 0x01, 0x0B, 0x0B, 0x07,
+    0x00, 0x41, 0xE8, 0x07, 0x6A, 0x0B, 0x0B, 0x1B, 0x00, 0x06, 0x7F, 0x06,
+    0x7F, 0x06, 0x7F, 0x20, 0x00, 0x10, 0x00, 0x41, 0x00, 0x18, 0x01, 0x19,
+    0x41, 0x01, 0x0B, 0x07, 0x00, 0x41, 0xD0, 0x0F, 0x6A, 0x0B, 0x0B, 0x1B,
+    0x00, 0x06, 0x7F, 0x06, 0x7F, 0x06, 0x7F, 0x20, 0x00, 0x10, 0x00, 0x41,
+    0x00, 0x18, 0x00, 0x19, 0x41, 0x01, 0x0B, 0x07, 0x00, 0x41, 0xD0, 0x0F,
+    0x6A, 0x0B, 0x0B, 0x08, 0x00, 0x20, 0x00, 0x10, 0x00, 0x41, 0x00, 0x0B};
+
+/// (module
+///   (type $t1 (func (param v128) (result v128)))
+///   (type $t2 (func (param v128 v128) (result v128)))
+///   (type $t3 (func (param v128 v128 v128) (result v128)))
+///   (func (export "madd32") (type $t3)
+///     local.get 0 local.get 1 local.get 2 f32x4.relaxed_madd)
+///   (func (export "nmadd32") (type $t3) ... f32x4.relaxed_nmadd)
+///   (func (export "madd64") (type $t3) ... f64x2.relaxed_madd)
+///   (func (export "nmadd64") (type $t3) ... f64x2.relaxed_nmadd)
+///   (func (export "swizzle") (type $t2)
+///     local.get 0 local.get 1 i8x16.relaxed_swizzle)
+///   (func (export "laneselect") (type $t3) ... i8x16.relaxed_laneselect)
+///   (func (export "dot") (type $t2) ... i16x8.relaxed_dot_i8x16_i7x16_s)
+///   (func (export "dot_add") (type $t3)
+///     ... i32x4.relaxed_dot_i8x16_i7x16_add_s))
+std::vector<SSVM::Byte> RelaxedWasm = {
+    0x00, 0x61, 0x73, 0x6D, 0x01, 0x00, 0x00, 0x00, 0x01, 0x13, 0x03, 0x60,
+    0x01, 0x7B, 0x01, 0x7B, 0x60, 0x02, 0x7B, 0x7B, 0x01, 0x7B, 0x60, 0x03,
+    0x7B, 0x7B, 0x7B, 0x01, 0x7B, 0x03, 0x09, 0x08, 0x02, 0x02, 0x02, 0x02,
+    0x01, 0x02, 0x01, 0x02, 0x07, 0x4E, 0x08, 0x06, 0x6D, 0x61, 0x64, 0x64,
+    0x33, 0x32, 0x00, 0x00, 0x07, 0x6E, 0x6D, 0x61, 0x64, 0x64, 0x33, 0x32,
+    0x00, 0x01, 0x06, 0x6D, 0x61, 0x64, 0x64, 0x36, 0x34, 0x00, 0x02, 0x07,
+    0x6E, 0x6D, 0x61, 0x64, 0x64, 0x36, 0x34, 0x00, 0x03, 0x07, 0x73, 0x77,
+    0x69, 0x7A, 0x7A, 0x6C, 0x65, 0x00, 0x04, 0x0A, 0x6C, 0x61, 0x6E, 0x65,
+    0x73, 0x65, 0x6C, 0x65, 0x63, 0x74, 0x00, 0x05, 0x03, 0x64, 0x6F, 0x74,
+    0x00, 0x06, 0x07, 0x64, 0x6F, 0x74, 0x5F, 0x61, 0x64, 0x64, 0x00, 0x07,
+    0x0A, 0x5D, 0x08, 0x0B, 0x00, 0x20, 0x00, 0x20, 0x01, 0x20, 0x02, 0xFD,
+    0x85, 0x02, 0x0B, 0x0B, 0x00, 0x20, 0x00, 0x20, 0x01, 0x20, 0x02, 0xFD,
+    0x86, 0x02, 0x0B, 0x0B, 0x00, 0x20, 0x00, 0x20, 0x01, 0x20, 0x02, 0xFD,
+    0x87, 0x02, 0x0B, 0x0B, 0x00, 0x20, 0x00, 0x20, 0x01, 0x20, 0x02, 0xFD,
+    0x88, 0x02, 0x0B, 0x09, 0x00, 0x20, 0x00, 0x20, 0x01, 0xFD, 0x80, 0x02,
+    0x0B, 0x0B, 0x00, 0x20, 0x00, 0x20, 0x01, 0x20, 0x02, 0xFD, 0x89, 0x02,
+    0x0B, 0x09, 0x00, 0x20, 0x00, 0x20, 0x01, 0xFD, 0x92, 0x02, 0x0B, 0x0B,
+    0x00, 0x20, 0x00, 0x20, 0x01, 0x20, 0x02, 0xFD, 0x93, 0x02, 0x0B};
+
+TEST(ExecutionTest, FrameCache__StartAndLoop) {
+  SSVM::Configure Conf;
+  SSVM::VM::VM VM(Conf);
+  ASSERT_TRUE(VM.loadWasm(FrameWasm));
+  ASSERT_TRUE(VM.validate());
+  ASSERT_TRUE(VM.instantiate());
+  std::vector<SSVM::ValVariant> Params = {uint32_t(5)};
+  auto Res = VM.execute("f", Params);
+  ASSERT_TRUE(Res);
+  EXPECT_EQ(std::get<uint32_t>((*Res)[0]), 15U);
+}
+
+TEST(ExecutionTest, FrameCache__CrossModule) {
+  SSVM::Configure Conf;
+  SSVM::VM::VM VM(Conf);
+  ASSERT_TRUE(VM.registerModule("lib", LibWasm));
+  ASSERT_TRUE(VM.loadWasm(MainWasm));
+  ASSERT_TRUE(VM.validate());
+  ASSERT_TRUE(VM.instantiate());
+  /// The imported function updates the globals of its own module.
+  auto Res = VM.execute("f");
+  ASSERT_TRUE(Res);
+  EXPECT_EQ(std::get<uint32_t>((*Res)[0]), 100U);
+  Res = VM.execute("lib", "get");
+  ASSERT_TRUE(Res);
+  EXPECT_EQ(std::get<uint32_t>((*Res)[0]), 2U);
+}
+
+TEST(ExecutionTest, ExceptionHandling__Handlers) {
+  SSVM::Configure Conf;
+  Conf.addProposal(SSVM::Proposal::ExceptionHandling);
+  SSVM::VM::VM VM(Conf);
+  ASSERT_TRUE(VM.loadWasm(ExceptionWasm));
+  ASSERT_TRUE(VM.validate());
+  ASSERT_TRUE(VM.instantiate());
+  auto Call = [&VM](std::string_view Name) -> SSVM::Expect<uint32_t> {
+    std::vector<SSVM::ValVariant> Params = {uint32_t(5)};
+    if (auto Res = VM.execute(Name, Params)) {
+      return std::get<uint32_t>((*Res)[0]);
+    } else {
+      return SSVM::Unexpect(Res);
+    }
+  };
+  /// The payload of the tag is pushed for catch, but not for catch_all.
+  EXPECT_EQ(Call("catch"), 105U);
+  EXPECT_EQ(Call("catch_all"), 7U);
+  /// The rethrown exception keeps its payload, and the label skips the block.
+  EXPECT_EQ(Call("rethrow"), 1005U);
+  /// Delegate skips the handlers of the try blocks inside its label.
+  EXPECT_EQ(Call("delegate"), 2005U);
+  EXPECT_EQ(Call("delegate0"), 1U);
+  auto Res = Call("uncaught");
+  ASSERT_FALSE(Res);
+  EXPECT_EQ(Res.error(), SSVM::ErrCode::UncaughtException);
+  /// The interpreter is still usable after an uncaught exception.
+  EXPECT_EQ(Call("catch"), 105U);
+}
+
+/// Run the exported function of the relaxed SIMD module on vector arguments.
+template <typename RetT, typename... ArgsT>
+RetT runRelaxed(SSVM::VM::VM &VM, std::string_view Name, ArgsT... Args) {
+  std::vector<SSVM::ValVariant> Params = {
+      reinterpret_cast<SSVM::uint128_t>(Args)...};
+  auto Res = VM.execute(Name, Params);
+  EXPECT_TRUE(Res) << Name;
+  return Res ? reinterpret_cast<RetT>(std::get<SSVM::uint128_t>((*Res)[0]))
+             : RetT{};
+}
+
+TEST(ExecutionTest, RelaxedSIMD__Results) {
+  using namespace SSVM;
+  Configure Conf;
+  Conf.addProposal(Proposal::SIMD);
+  Conf.addProposal(Proposal::RelaxedSIMD);
+  VM::VM VM(Conf);
+  ASSERT_TRUE(VM.loadWasm(RelaxedWasm));
+  ASSERT_TRUE(VM.validate());
+  ASSERT_TRUE(VM.instantiate());
+
+  /// The first lanes are only exact when the multiply-add is fused, which
+  /// the interpreter always does.
+  auto F32 = runRelaxed<floatx4_t>(VM, "madd32", floatx4_t{0x1.001p0f, 2, 3, 4},
+                                   floatx4_t{0x1.001p0f, 6, 7, 8},
+                                   floatx4_t{-1, 1, 1, 1});
+  EXPECT_EQ(F32[0], 0x1.0008p-11f);
+  EXPECT_EQ(F32[1], 13.0f);
+  EXPECT_EQ(F32[2], 22.0f);
+  EXPECT_EQ(F32[3], 33.0f);
+  F32 = runRelaxed<floatx4_t>(VM, "nmadd32", floatx4_t{0x1.001p0f, 2, 3, 4},
+                              floatx4_t{0x1.001p0f, 6, 7, 8},
+                              floatx4_t{1, 1, 1, 1});
+  EXPECT_EQ(F32[0], -0x1.0008p-11f);
+  EXPECT_EQ(F32[1], -11.0f);
+  EXPECT_EQ(F32[2], -20.0f);
+  EXPECT_EQ(F32[3], -31.0f);
+  auto F64 = runRelaxed<doublex2_t>(VM, "madd64", doublex2_t{0x1.00000004p0, 2},
+                                    doublex2_t{0x1.00000004p0, 3},
+                                    doublex2_t{-1, 1});
+  EXPECT_EQ(F64[0], 0x1.00000002p-29);
+  EXPECT_EQ(F64[1], 7.0);
+  F64 = runRelaxed<doublex2_t>(VM, "nmadd64", doublex2_t{0x1.00000004p0, 2},
+                               doublex2_t{0x1.00000004p0, 3},
+                               doublex2_t{1, 1});
+  EXPECT_EQ(F64[0], -0x1.00000002p-29);
+  EXPECT_EQ(F64[1], -5.0);
+
+  /// Out of range indices select zero, as the strict swizzle.
+  const auto Swizzled = runRelaxed<uint8x16_t>(
+      VM, "swizzle",
+      uint8x16_t{0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19,
+                 0x1A, 0x1B, 0x1C, 0x1D, 0x1E, 0x1F},
+      uint8x16_t{0, 15, 16, 255, 0x80, 1, 2, 3, 17, 31, 0x7F, 4, 5, 6, 7, 8});
+  const uint8x16_t SwizzleExpected = {0x10, 0x1F, 0,    0,    0,    0x11,
+                                      0x12, 0x13, 0,    0,    0,    0x14,
+                                      0x15, 0x16, 0x17, 0x18};
+  for (uint32_t I = 0; I < 16; ++I) {
+    EXPECT_EQ(Swizzled[I], SwizzleExpected[I]) << "lane " << I;
+  }
+
+  /// Masks with mixed bits select bitwise, as the strict bitselect.
+  const uint8x16_t Mask = {0xFF, 0x00, 0x0F, 0xF0, 0xFF, 0x00, 0x0F, 0xF0,
+                           0xFF, 0x00, 0x0F, 0xF0, 0xFF, 0x00, 0x0F, 0xF0};
+  const auto Selected = runRelaxed<uint8x16_t>(
+      VM, "laneselect",
+      uint8x16_t{0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+                 0x12, 0x12, 0x12, 0x12, 0x12, 0x12},
+      uint8x16_t{0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34,
+                 0x34, 0x34, 0x34, 0x34, 0x34, 0x34},
+      Mask);
+  const uint8x16_t SelectExpected = {0x12, 0x34, 0x32, 0x14};
+  for (uint32_t I = 0; I < 16; ++I) {
+    EXPECT_EQ(Selected[I], SelectExpected[I % 4]) << "lane " << I;
+  }
+
+  /// The second operand is signed also when it is out of the 7-bit range.
+  const auto Dot = runRelaxed<int16x8_t>(
+      VM, "dot",
+      int8x16_t{-128, -128, 1, 2, 3, 4, 127, 127, -1, -1, 5, 0, 1, 1, 10,
+                -10},
+      int8x16_t{127, 127, 5, 6, 7, 8, 127, 127, 127, 1, 3, 0, -1, -1, 1, 1});
+  const int16x8_t DotExpected = {-32512, 17, 53, 32258, -128, 15, -2, 0};
+  for (uint32_t I = 0; I < 8; ++I) {
+    EXPECT_EQ(Dot[I], DotExpected[I]) << "lane " << I;
+  }
+  const auto DotAdd = runRelaxed<int32x4_t>(
+      VM, "dot_add",
+      int8x16_t{1, 2, 3, 4, -128, -128, -128, -128, 0, 0, 0, 0, 1, 1, 1, 1},
+      int8x16_t{1, 1, 1, 1, 127, 127, 127, 127, 9, 9, 9, 9, 2, 2, 2, 2},
+      int32x4_t{100, 0, -5, 7});
+  const int32x4_t DotAddExpected = {110, -65024, -5, 15};
+  for (uint32_t I = 0; I < 4; ++I) {
+    EXPECT_EQ(DotAdd[I], DotAddExpected[I]) << "lane " << I;
+  }
+}
+
+/// (module (memory (export "mem") 1 1 shared))
+std::vector<SSVM::Byte> ThreadsEnvWasm = {
+    0x00, 0x61, 0x73, 0x6D, 0x01, 0x00, 0x00, 0x00, 0x05, 0x04, 0x01, 0x03,
+    0x01, 0x01, 0x07, 0x07, 0x01, 0x03, 0x6D, 0x65, 0x6D, 0x02, 0x00};
+
+/// (module
+///   (import "wasi" "thread-spawn" (func $spawn (param i32) (result i32)))
+///   (import "env" "mem" (memory 1 1 shared))
+///   (global $g (mut i32) (i32.const 0))
+///   (func (export "wasi_thread_start") (param $tid i32) (param $arg i32)
+///     (i32.atomic.store (i32.const 8) (i32.add (global.get $g)
+///                                              (local.get $arg)))
+///     (i32.atomic.store (i32.const 4) (i32.const 1))
+///     (drop (memory.atomic.notify (i32.const 4) (i32.const 1))))
+///   (func (export "run") (result i32)
+///     (global.set $g (i32.const 7))
+///     (drop (call $spawn (i32.const 42)))
+///     (block (loop
+///       (br_if 1 (i32.atomic.load (i32.const 4)))
+///       (drop (memory.atomic.wait32 (i32.const 4) (i32.const 0)
+///                                   (i64.const -1)))
+///       (br 0)))
+///     (i32.add (i32.atomic.load (i32.const 8))
+///              (i32.mul (global.get $g) (i32.const 1000)))))
+std::vector<SSVM::Byte> ThreadsMainWasm = {
+    0x00, 0x61, 0x73, 0x6D, 0x01, 0x00, 0x00, 0x00, 0x01, 0x0F, 0x03, 0x60,
+    0x01, 0x7F, 0x01, 0x7F, 0x60, 0x02, 0x7F, 0x7F, 0x00, 0x60, 0x00, 0x01,
+    0x7F, 0x02, 0x21, 0x02, 0x04, 0x77, 0x61, 0x73, 0x69, 0x0C, 0x74, 0x68,
+    0x72, 0x65, 0x61, 0x64, 0x2D, 0x73, 0x70, 0x61, 0x77, 0x6E, 0x00, 0x00,
+    0x03, 0x65, 0x6E, 0x76, 0x03, 0x6D, 0x65, 0x6D, 0x02, 0x03, 0x01, 0x01,
+    0x03, 0x03, 0x02, 0x01, 0x02, 0x06, 0x06, 0x01, 0x7F, 0x01, 0x41, 0x00,
+    0x0B, 0x07, 0x1B, 0x02, 0x11, 0x77, 0x61, 0x73, 0x69, 0x5F, 0x74, 0x68,
+    0x72, 0x65, 0x61, 0x64, 0x5F, 0x73, 0x74, 0x61, 0x72, 0x74, 0x00, 0x01,
+    0x03, 0x72, 0x75, 0x6E, 0x00, 0x02, 0x0A, 0x54, 0x02, 0x1E, 0x00, 0x41,
+    0x08, 0x23, 0x00, 0x20, 0x01, 0x6A, 0xFE, 0x17, 0x02, 0x00, 0x41, 0x04,
+    0x41, 0x01, 0xFE, 0x17, 0x02, 0x00, 0x41, 0x04, 0x41, 0x01, 0xFE, 0x00,
+    0x02, 0x00, 0x1A, 0x0B, 0x33, 0x00, 0x41, 0x07, 0x24, 0x00, 0x41, 0x2A,
+    0x10, 0x00, 0x1A, 0x02, 0x40, 0x03, 0x40, 0x41, 0x04, 0xFE, 0x10, 0x02,
+    0x00, 0x0D, 0x01, 0x41, 0x04, 0x41, 0x00, 0x42, 0x7F, 0xFE, 0x01, 0x02,
+    0x00, 0x1A, 0x0C, 0x00, 0x0B, 0x0B, 0x41, 0x08, 0xFE, 0x10, 0x02, 0x00,
+    0x23, 0x00, 0x41, 0xE8, 0x07, 0x6C, 0x6A, 0x0B};
+
+/// (module
+///   (import "wasi" "thread-spawn" (func $spawn (param i32) (result i32)))
+///   (memory 1 1 shared)
+///   (func (export "run") (result i32) (call $spawn (i32.const 0))))
+std::vector<SSVM::Byte> ThreadsOwnMemoryWasm = {
+    0x00, 0x61, 0x73, 0x6D, 0x01, 0x00, 0x00, 0x00, 0x01, 0x0A, 0x02, 0x60,
+    0x01, 0x7F, 0x01, 0x7F, 0x60, 0x00, 0x01, 0x7F, 0x02, 0x15, 0x01, 0x04,
+    0x77, 0x61, 0x73, 0x69, 0x0C, 0x74, 0x68, 0x72, 0x65, 0x61, 0x64, 0x2D,
+    0x73, 0x70, 0x61, 0x77, 0x6E, 0x00, 0x00, 0x03, 0x02, 0x01, 0x01, 0x05,
+    0x04, 0x01, 0x03, 0x01, 0x01, 0x07, 0x07, 0x01, 0x03, 0x72, 0x75, 0x6E,
+    0x00, 0x01, 0x0A, 0x08, 0x01, 0x06, 0x00, 0x41, 0x00, 0x10, 0x00, 0x0B};
+
+TEST(ExecutionTest, Threads__SpawnedInstance) {
+  SSVM::Configure Conf;
+  Conf.addProposal(SSVM::Proposal::Threads);
+  Conf.addHostRegistration(SSVM::HostRegistration::WasiThreads);
+  SSVM::VM::VM VM(Conf);
+  ASSERT_TRUE(VM.registerModule("env", ThreadsEnvWasm));
+  ASSERT_TRUE(VM.loadWasm(ThreadsMainWasm));
+  ASSERT_TRUE(VM.validate());
+  ASSERT_TRUE(VM.instantiate());
+  /// The spawned thread shares the memory, but has globals of its own.
+  auto Res = VM.execute("run");
+  ASSERT_TRUE(Res);
+  EXPECT_EQ(std::get<uint32_t>((*Res)[0]), 7042U);
+  VM.cleanup();
+}
+
+TEST(ExecutionTest, Threads__SpawnWithOwnMemory) {
+  SSVM::Configure Conf;
+  Conf.addProposal(SSVM::Proposal::Threads);
+  Conf.addHostRegistration(SSVM::HostRegistration::WasiThreads);
+  SSVM::VM::VM VM(Conf);
+  ASSERT_TRUE(VM.loadWasm(ThreadsOwnMemoryWasm));
+  ASSERT_TRUE(VM.validate());
+  ASSERT_TRUE(VM.instantiate());
+  /// Threads can not be spawned when each would define its own memory.
+  auto Res = VM.execute("run");
+  ASSERT_TRUE(Res);
+  EXPECT_EQ(std::get<uint32_t>((*Res)[0]), UINT32_C(-1));
+  VM.cleanup();
+}
+
+/// (module
+///   (import "wasi" "thread-spawn" (func $spawn (param i32) (result i32)))
+///   (import "wasi_snapshot_preview1" "sched_yield" (func $yield
+///     (result i32)))
+///   (import "env" "mem" (memory 1 1 shared))
+///   (func (export "wasi_thread_start") (param $tid i32) (param $arg i32)
+///     (drop (memory.atomic.wait32 (i32.const 0) (i32.const 0)
+///                                 (i64.const 50000000)))
+///     (drop (call $yield))
+///     (i32.atomic.store (i32.const 4) (i32.const 1)))
+///   (func (export "run") (result i32) (call $spawn (i32.const 0))))
+std::vector<SSVM::Byte> ThreadsLateWasm = {
+    0x00, 0x61, 0x73, 0x6D, 0x01, 0x00, 0x00, 0x00, 0x01, 0x0F, 0x03, 0x60,
+    0x01, 0x7F, 0x01, 0x7F, 0x60, 0x02, 0x7F, 0x7F, 0x00, 0x60, 0x00, 0x01,
+    0x7F, 0x02, 0x46, 0x03, 0x04, 0x77, 0x61, 0x73, 0x69, 0x0C, 0x74, 0x68,
+    0x72, 0x65, 0x61, 0x64, 0x2D, 0x73, 0x70, 0x61, 0x77, 0x6E, 0x00, 0x00,
+    0x16, 0x77, 0x61, 0x73, 0x69, 0x5F, 0x73, 0x6E, 0x61, 0x70, 0x73, 0x68,
+    0x6F, 0x74, 0x5F, 0x70, 0x72, 0x65, 0x76, 0x69, 0x65, 0x77, 0x31, 0x0B,
+    0x73, 0x63, 0x68, 0x65, 0x64, 0x5F, 0x79, 0x69, 0x65, 0x6C, 0x64, 0x00,
+    0x02, 0x03, 0x65, 0x6E, 0x76, 0x03, 0x6D, 0x65, 0x6D, 0x02, 0x03, 0x01,
+    0x01, 0x03, 0x03, 0x02, 0x01, 0x02, 0x07, 0x1B, 0x02, 0x11, 0x77, 0x61,
+    0x73, 0x69, 0x5F, 0x74, 0x68, 0x72, 0x65, 0x61, 0x64, 0x5F, 0x73, 0x74,
+    0x61, 0x72, 0x74, 0x00, 0x02, 0x03, 0x72, 0x75, 0x6E, 0x00, 0x03, 0x0A,
+    0x24, 0x02, 0x1B, 0x00, 0x41, 0x00, 0x41, 0x00, 0x42, 0x80, 0xE1, 0xEB,
+    0x17, 0xFE, 0x01, 0x02, 0x00, 0x1A, 0x10, 0x01, 0x1A, 0x41, 0x04, 0x41,
+    0x01, 0xFE, 0x17, 0x02, 0x00, 0x0B, 0x06, 0x00, 0x41, 0x00, 0x10, 0x00,
+    0x0B};
+
+TEST(ExecutionTest, Threads__JoinOnDestruction) {
+  SSVM::Configure Conf;
+  Conf.addProposal(SSVM::Proposal::Threads);
+  Conf.addHostRegistration(SSVM::HostRegistration::Wasi);
+  Conf.addHostRegistration(SSVM::HostRegistration::WasiThreads);
+  SSVM::Runtime::StoreManager Store;
+  {
+    SSVM::VM::VM VM(Conf, Store);
+    ASSERT_TRUE(VM.registerModule("env", ThreadsEnvWasm));
+    ASSERT_TRUE(VM.loadWasm(ThreadsLateWasm));
+    ASSERT_TRUE(VM.validate());
+    ASSERT_TRUE(VM.instantiate());
+    auto Res = VM.execute("run");
+    ASSERT_TRUE(Res);
+    EXPECT_EQ(std::get<uint32_t>((*Res)[0]), 1U);
+  }
+  /// The thread still calls the WASI module after run returns, so the VM
+  /// waits for it before destroying the host modules.
+  auto Mod = Store.findModule("env");
+  ASSERT_TRUE(Mod);
+  auto *Mem = *Store.getMemory((*Mod)->getMemExports().find("mem")->second);
+  EXPECT_EQ(Mem->getDataPtr()[4], 1U);
+}
+
+} // namespace
+
+GTEST_API_ int main(int argc, char **argv) {
+  SSVM::Log::setErrorLoggingLevel();
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
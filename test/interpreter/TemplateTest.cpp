@@ -0,0 +1,72 @@
+// SPDX-License-Identifier: Apache-2.0
+//===-- ssvm/test/interpreter/TemplateTest.cpp - module template tests ----===//
+//
+// Part of the SSVM Project.
+//
+//===----------------------------------------------------------------------===//
+///
+/// \file
+/// This file contents tests of instantiating modules from module templates.
+///
+//===----------------------------------------------------------------------===//
+
+#include "interpreter/interpreter.h"
+#include "loader/loader.h"
+#include "validator/validator.h"
+
+#include "gtest/gtest.h"
+
+namespace {
+
+/// (module
+///   (memory 1)
+///   (global (mut i32) (i32.const 40))
+///   (data (i32.const 0) "\02")
+///   (func (export "f") (result i32)
+///     global.get 0 i32.const 0 i32.load8_u i32.add
+///     global.get 0 i32.const 1 i32.add global.set 0))
+std::vector<SSVM::Byte> Wasm = {
+    0x00, 0x61, 0x73, 0x6D, 0x01, 0x00, 0x00, 0x00, 0x01, 0x05, 0x01, 0x60,
+    0x00, 0x01, 0x7F, 0x03, 0x02, 0x01, 0x00, 0x05, 0x03, 0x01, 0x00, 0x01,
+    0x06, 0x06, 0x01, 0x7F, 0x01, 0x41, 0x28, 0x0B, 0x07, 0x05, 0x01, 0x01,
+    0x66, 0x00, 0x00, 0x0A, 0x13, 0x01, 0x11, 0x00, 0x23, 0x00, 0x41, 0x00,
+    0x2D, 0x00, 0x00, 0x6A, 0x23, 0x00, 0x41, 0x01, 0x6A, 0x24, 0x00, 0x0B,
+    0x0B, 0x07, 0x01, 0x00, 0x41, 0x00, 0x0B, 0x01, 0x02};
+
+TEST(TemplateTest, Instantiate__Repeated) {
+  SSVM::Configure Conf;
+  SSVM::Loader::Loader Loader(Conf);
+  SSVM::Validator::Validator Validator(Conf);
+  SSVM::Interpreter::Interpreter Interpreter(Conf);
+  SSVM::Runtime::StoreManager StoreMgr;
+
+  auto Mod = Loader.parseModule(Wasm);
+  ASSERT_TRUE(Mod);
+  ASSERT_TRUE(Validator.validate(**Mod));
+  auto Tmpl = Interpreter.prepareModule(StoreMgr, **Mod);
+  ASSERT_TRUE(Tmpl);
+  /// The template does not depend on the AST after preparation.
+  Mod->reset();
+
+  for (int I = 0; I < 3; ++I) {
+    ASSERT_TRUE(Interpreter.instantiateModule(StoreMgr, *Tmpl));
+    const auto Exports = StoreMgr.getFuncExports();
+    ASSERT_EQ(Exports.count("f"), 1U);
+    const uint32_t FuncAddr = Exports.find("f")->second;
+
+    auto Res = Interpreter.invoke(StoreMgr, FuncAddr, {});
+    ASSERT_TRUE(Res);
+    EXPECT_EQ(std::get<uint32_t>((*Res)[0]), 42U);
+    Res = Interpreter.invoke(StoreMgr, FuncAddr, {});
+    ASSERT_TRUE(Res);
+    EXPECT_EQ(std::get<uint32_t>((*Res)[0]), 43U);
+  }
+}
+
+} // namespace
+
+GTEST_API_ int main(int argc, char **argv) {
+  SSVM::Log::setErrorLoggingLevel();
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,103 @@
+// SPDX-License-Identifier: Apache-2.0
+//===-- ssvm/test/loader/perfmapTest.cpp - perf map unit tests ------------===//
+//
+// Part of the SSVM Project.
+//
+//===----------------------------------------------------------------------===//
+///
+/// \file
+/// This file contents unit tests of function names and perf map records.
+///
+//===----------------------------------------------------------------------===//
+
+#include "loader/perfmap.h"
+#include "gtest/gtest.h"
+
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <unistd.h>
+#include <vector>
+
+namespace {
+
+/// Wasm header and a name section with a module name and function names of
+/// index 1 and 3.
+std::vector<SSVM::Byte> NameSectionWasm = {
+    0x00U, 0x61U, 0x73U, 0x6DU, 0x01U, 0x00U, 0x00U, 0x00U, 0x00U, 0x16U,
+    0x04U, 'n',   'a',   'm',   'e',   0x00U, 0x02U, 0x01U, 'm',   0x01U,
+    0x0BU, 0x02U, 0x01U, 0x03U, 'f',   'o',   'o',   0x03U, 0x03U, 'b',
+    'a',   'r'};
+
+TEST(PerfMapTest, ReadFunctionNames) {
+  /// 1. Test reading names.
+  auto Names = SSVM::Loader::readFunctionNames(NameSectionWasm);
+  ASSERT_EQ(Names.size(), 2U);
+  EXPECT_EQ(Names[1], "foo");
+  EXPECT_EQ(Names[3], "bar");
+
+  /// 2. Test truncated name section is ignored.
+  auto Truncated = NameSectionWasm;
+  Truncated.resize(Truncated.size() - 2);
+  Names = SSVM::Loader::readFunctionNames(Truncated);
+  EXPECT_EQ(Names.size(), 0U);
+
+  /// 3. Test binary without name section.
+  Names = SSVM::Loader::readFunctionNames(
+      SSVM::Span<const SSVM::Byte>(NameSectionWasm.data(), 8));
+  EXPECT_EQ(Names.size(), 0U);
+}
+
+TEST(PerfMapTest, WritePerfMap) {
+  const std::string Path = "/tmp/perf-" + std::to_string(::getpid()) + ".map";
+  ::unlink(Path.c_str());
+  const std::vector<SSVM::Loader::CodeRecord> Records = {
+      {reinterpret_cast<const void *>(0x1000), 0x20, "foo"},
+      {reinterpret_cast<const void *>(0x1020), 0x10, "wasm-function[3]"}};
+  SSVM::Loader::writePerfMap(Records);
+
+  std::ifstream File(Path);
+  std::string Line;
+  ASSERT_TRUE(std::getline(File, Line));
+  EXPECT_EQ(Line, "1000 20 foo");
+  ASSERT_TRUE(std::getline(File, Line));
+  EXPECT_EQ(Line, "1020 10 wasm-function[3]");
+  EXPECT_FALSE(std::getline(File, Line));
+  ::unlink(Path.c_str());
+}
+
+TEST(PerfMapTest, WriteJitDump) {
+  ::setenv("JITDUMPDIR", "/tmp", 1);
+  const std::string Path = "/tmp/jit-" + std::to_string(::getpid()) + ".dump";
+  const uint8_t Code[4] = {0x01U, 0x02U, 0x03U, 0x04U};
+  const std::vector<SSVM::Loader::CodeRecord> Records = {
+      {Code, sizeof(Code), "foo"}};
+  SSVM::Loader::writeJitDump(Records);
+
+  std::ifstream File(Path, std::ios::binary);
+  std::vector<char> Data((std::istreambuf_iterator<char>(File)),
+                         std::istreambuf_iterator<char>());
+  ::unlink(Path.c_str());
+  /// Header of 40 bytes, then the code load record of 56 bytes, the name, and
+  /// the code.
+  ASSERT_EQ(Data.size(), 40U + 56U + 4U + 4U);
+  uint32_t Magic, HeaderSize, RecordId, RecordSize;
+  std::memcpy(&Magic, Data.data(), 4);
+  std::memcpy(&HeaderSize, Data.data() + 8, 4);
+  std::memcpy(&RecordId, Data.data() + 40, 4);
+  std::memcpy(&RecordSize, Data.data() + 44, 4);
+  EXPECT_EQ(Magic, 0x4A695444U);
+  EXPECT_EQ(HeaderSize, 40U);
+  EXPECT_EQ(RecordId, 0U);
+  EXPECT_EQ(RecordSize, 56U + 4U + 4U);
+  EXPECT_STREQ(Data.data() + 96, "foo");
+  EXPECT_EQ(std::memcmp(Data.data() + 100, Code, sizeof(Code)), 0);
+}
+
+} // namespace
+
+GTEST_API_ int main(int argc, char **argv) {
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,67 @@
+// SPDX-License-Identifier: Apache-2.0
+//===-- ssvm/test/loader/sharedlibraryTest.cpp - shared library tests -----===//
+//
+// Part of the SSVM Project.
+//
+//===----------------------------------------------------------------------===//
+///
+/// \file
+/// This file contents unit tests of loading libraries by SharedLibrary.
+///
+//===----------------------------------------------------------------------===//
+
+#include "loader/shared_library.h"
+#include "gtest/gtest.h"
+
+#include <dlfcn.h>
+#include <memory>
+
+extern "C" {
+__attribute__((visibility("default"))) int ssvmTestImport = 1;
+}
+
+namespace {
+
+TEST(SharedLibraryTest, LoadAndRelocate) {
+  auto Library = std::make_shared<SSVM::Loader::SharedLibrary>();
+  ASSERT_TRUE(Library->load(SSVM_TEST_FIXTURE_PATH));
+
+  /// 1. Test data relocated against the library itself.
+  auto Value = Library->get<int>("fixtureValue");
+  auto Pointer = Library->get<int *>("fixturePointer");
+  ASSERT_TRUE(Value);
+  ASSERT_TRUE(Pointer);
+  EXPECT_EQ(*Pointer, Value.get());
+  EXPECT_EQ(*Value, 42);
+
+  /// 2. Test code reading the imported symbol of the host.
+  auto Get = Library->get<int()>("fixtureGet");
+  ASSERT_TRUE(Get);
+  EXPECT_EQ(Get(), 43);
+  *Value = 2;
+  EXPECT_EQ(Get(), 3);
+
+  /// 3. Test missing symbols.
+  EXPECT_FALSE(Library->get<int>("ssvmTestMissing"));
+
+#if defined(__linux__)
+  /// 4. Test the code range of a function.
+  const auto *Code = reinterpret_cast<const uint8_t *>(Get.get());
+  const auto *End = static_cast<const uint8_t *>(Library->getCodeEnd(Code));
+  ASSERT_NE(End, nullptr);
+  EXPECT_LT(Code, End);
+  EXPECT_EQ(Library->getCodeEnd(Value.get()), nullptr);
+#endif
+
+#if defined(__linux__) && (defined(__x86_64__) || defined(__aarch64__))
+  /// 5. Test the library is mapped without the dynamic loader.
+  EXPECT_EQ(::dlopen(SSVM_TEST_FIXTURE_PATH, RTLD_LAZY | RTLD_NOLOAD), nullptr);
+#endif
+}
+
+} // namespace
+
+GTEST_API_ int main(int argc, char **argv) {
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
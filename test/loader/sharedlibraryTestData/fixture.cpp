@@ -0,0 +1,21 @@
+// SPDX-License-Identifier: Apache-2.0
+//===-- ssvm/test/loader/sharedlibraryTestData/fixture.cpp - fixture -----===//
+//
+// Part of the SSVM Project.
+//
+//===----------------------------------------------------------------------===//
+///
+/// \file
+/// This file contents a self-contained library shaped like compiled modules:
+/// it imports a symbol of the host and relocates data pointers.
+///
+//===----------------------------------------------------------------------===//
+
+extern "C" {
+extern int ssvmTestImport;
+__attribute__((visibility("default"))) int fixtureValue = 42;
+__attribute__((visibility("default"))) int *fixturePointer = &fixtureValue;
+__attribute__((visibility("default"))) int fixtureGet() {
+  return ssvmTestImport + *fixturePointer;
+}
+}
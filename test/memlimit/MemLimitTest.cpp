@@ -1,9 +1,14 @@
 // SPDX-License-Identifier: Apache-2.0
 #include "common/configure.h"
 #include "runtime/instance/memory.h"
+#include "runtime/storemgr.h"
+#include "vm/vm.h"
 
 #include "gtest/gtest.h"
 
+#include <cerrno>
+#include <sys/mman.h>
+
 namespace {
 
 TEST(MemLimitTest, Limit__Pages) {
@@ -35,6 +40,164 @@ TEST(MemLimitTest, Limit__Pages) {
   ASSERT_TRUE(Inst5.growPage(127));
 }
 
+TEST(MemLimitTest, Limit__Reservation) {
+  using MemInst = SSVM::Runtime::Instance::MemoryInstance;
+  SSVM::Configure Conf;
+  Conf.setMaxMemoryPage(256);
+
+  /// Memories without guard pages only reserve the pages they can grow to.
+  SSVM::AST::Limit Lim1(1, 16);
+  MemInst Inst1(Lim1, Conf.getMaxMemoryPage(), false);
+  ASSERT_FALSE(Inst1.getDataPtr() == nullptr);
+  EXPECT_FALSE(Inst1.hasGuardPages());
+  uint8_t *DataPtr = Inst1.getDataPtr();
+  ASSERT_TRUE(Inst1.growPage(15));
+  EXPECT_EQ(Inst1.getDataPtr(), DataPtr);
+  ASSERT_FALSE(Inst1.growPage(1));
+  DataPtr[16 * MemInst::kPageSize - 1] = 1;
+  EXPECT_TRUE(Inst1.checkAccessBound(16 * MemInst::kPageSize - 1, 1));
+
+  SSVM::AST::Limit Lim2(0);
+  MemInst Inst2(Lim2, Conf.getMaxMemoryPage(), false);
+  ASSERT_FALSE(Inst2.getDataPtr() == nullptr);
+  ASSERT_FALSE(Inst2.growPage(257));
+  ASSERT_TRUE(Inst2.growPage(256));
+  Inst2.getDataPtr()[256 * MemInst::kPageSize - 1] = 1;
+
+  MemInst Inst3(Lim2, Conf.getMaxMemoryPage());
+  EXPECT_TRUE(Inst3.hasGuardPages());
+}
+
+TEST(MemLimitTest, Limit__MovingReservation) {
+  using MemInst = SSVM::Runtime::Instance::MemoryInstance;
+  SSVM::Configure Conf;
+  Conf.setMaxMemoryPage(256);
+  Conf.setMemoryReservePage(2);
+
+  /// Memories without guard pages and without a maximum only reserve a few
+  /// pages, and move when growing past them.
+  SSVM::AST::Limit Lim(1);
+  MemInst Inst(Lim, Conf.getMaxMemoryPage(), false,
+               Conf.getMemoryReservePage());
+  ASSERT_FALSE(Inst.getDataPtr() == nullptr);
+  uint8_t *const *DataPtrAddr = Inst.getDataPtrAddr();
+  Inst.getDataPtr()[0] = 1;
+  Inst.getDataPtr()[MemInst::kPageSize - 1] = 2;
+  ASSERT_TRUE(Inst.growPage(1));
+  Inst.getDataPtr()[2 * MemInst::kPageSize - 1] = 3;
+
+  ASSERT_TRUE(Inst.growPage(5));
+  EXPECT_EQ(Inst.getDataPageSize(), 7U);
+  EXPECT_EQ(*DataPtrAddr, Inst.getDataPtr());
+  EXPECT_EQ(Inst.getDataPtr()[0], 1);
+  EXPECT_EQ(Inst.getDataPtr()[MemInst::kPageSize - 1], 2);
+  EXPECT_EQ(Inst.getDataPtr()[2 * MemInst::kPageSize - 1], 3);
+  Inst.getDataPtr()[7 * MemInst::kPageSize - 1] = 4;
+
+  /// Growing is still capped by the page limit.
+  ASSERT_FALSE(Inst.growPage(250));
+  ASSERT_TRUE(Inst.growPage(249));
+  EXPECT_EQ(Inst.getDataPtr()[7 * MemInst::kPageSize - 1], 4);
+  Inst.getDataPtr()[256 * MemInst::kPageSize - 1] = 5;
+
+  /// Shared memories reserve every page at creation and never move.
+  SSVM::AST::Limit SharedLim(1, 16, true);
+  MemInst Shared(SharedLim, Conf.getMaxMemoryPage(), false,
+                 Conf.getMemoryReservePage());
+  uint8_t *const SharedPtr = Shared.getDataPtr();
+  ASSERT_TRUE(Shared.growPage(15));
+  EXPECT_EQ(Shared.getDataPtr(), SharedPtr);
+}
+
+TEST(MemLimitTest, Limit__Stack) {
+  /// (module (func (export "f") call 0))
+  std::vector<SSVM::Byte> Wasm = {
+      0x00, 0x61, 0x73, 0x6D, 0x01, 0x00, 0x00, 0x00, 0x01, 0x04, 0x01,
+      0x60, 0x00, 0x00, 0x03, 0x02, 0x01, 0x00, 0x07, 0x05, 0x01, 0x01,
+      0x66, 0x00, 0x00, 0x0A, 0x06, 0x01, 0x04, 0x00, 0x10, 0x00, 0x0B};
+  SSVM::Configure Conf;
+  Conf.setMaxStackSize(65536);
+  SSVM::VM::VM VM(Conf);
+
+  auto Res = VM.runWasmFile(Wasm, "f");
+  ASSERT_FALSE(Res);
+  EXPECT_EQ(Res.error(), SSVM::ErrCode::CallStackExhausted);
+
+  /// The stacks are reusable after exhaustion.
+  Res = VM.execute("f");
+  ASSERT_FALSE(Res);
+  EXPECT_EQ(Res.error(), SSVM::ErrCode::CallStackExhausted);
+}
+
+TEST(MemLimitTest, Limit__Operands) {
+  /// (module (func (export "f") (i32.const 0) * N (drop) * N))
+  const uint32_t N = 10000;
+  std::vector<SSVM::Byte> Body = {0x00};
+  for (uint32_t I = 0; I < N; ++I) {
+    Body.insert(Body.end(), {0x41, 0x00});
+  }
+  Body.insert(Body.end(), N, 0x1A);
+  Body.push_back(0x0B);
+  auto ULEB = [](std::vector<SSVM::Byte> &Vec, uint32_t Val) {
+    do {
+      Vec.push_back((Val & 0x7FU) | (Val > 0x7FU ? 0x80U : 0x00U));
+      Val >>= 7;
+    } while (Val > 0);
+  };
+  std::vector<SSVM::Byte> Code = {0x01};
+  ULEB(Code, Body.size());
+  Code.insert(Code.end(), Body.begin(), Body.end());
+  std::vector<SSVM::Byte> Wasm = {
+      0x00, 0x61, 0x73, 0x6D, 0x01, 0x00, 0x00, 0x00, 0x01, 0x04, 0x01,
+      0x60, 0x00, 0x00, 0x03, 0x02, 0x01, 0x00, 0x07, 0x05, 0x01, 0x01,
+      0x66, 0x00, 0x00, 0x0A};
+  ULEB(Wasm, Code.size());
+  Wasm.insert(Wasm.end(), Code.begin(), Code.end());
+
+  /// The operands of the function do not fit into the stack.
+  SSVM::Configure Conf;
+  Conf.setMaxStackSize(65536);
+  {
+    SSVM::VM::VM VM(Conf);
+    auto Res = VM.runWasmFile(Wasm, "f");
+    ASSERT_FALSE(Res);
+    EXPECT_EQ(Res.error(), SSVM::ErrCode::CallStackExhausted);
+  }
+
+  /// The same function runs with a larger stack.
+  Conf.setMaxStackSize(1048576);
+  SSVM::VM::VM VM(Conf);
+  EXPECT_TRUE(VM.runWasmFile(Wasm, "f"));
+}
+
+TEST(MemLimitTest, Limit__ReleasedOnReset) {
+  using MemInst = SSVM::Runtime::Instance::MemoryInstance;
+  /// Check if the page at the address is mapped.
+  auto IsMapped = [](uint8_t *Ptr) {
+    return msync(Ptr, MemInst::kPageSize, MS_ASYNC) == 0 || errno != ENOMEM;
+  };
+  SSVM::Runtime::StoreManager StoreMgr;
+  StoreMgr.importModule("reg");
+  const uint32_t RegMem = StoreMgr.importMemory(SSVM::AST::Limit(1, 1));
+
+  /// The instantiated memory reserves 1 GiB without guard pages.
+  StoreMgr.pushModule("");
+  const uint32_t Mem =
+      StoreMgr.pushMemory(SSVM::AST::Limit(2, 16384), 65536, false);
+  uint8_t *DataPtr = (*StoreMgr.getMemory(Mem))->getDataPtr();
+  ASSERT_NE(DataPtr, nullptr);
+  DataPtr[0] = 1;
+  uint8_t *const ReservedEnd = DataPtr + (16384 - 1) * MemInst::kPageSize;
+  EXPECT_TRUE(IsMapped(DataPtr));
+  EXPECT_TRUE(IsMapped(ReservedEnd));
+
+  /// The reservation is released at once, and registered memory is kept.
+  StoreMgr.reset();
+  EXPECT_FALSE(IsMapped(DataPtr));
+  EXPECT_FALSE(IsMapped(ReservedEnd));
+  EXPECT_TRUE(IsMapped((*StoreMgr.getMemory(RegMem))->getDataPtr()));
+}
+
 } // namespace
 
 GTEST_API_ int main(int argc, char **argv) {
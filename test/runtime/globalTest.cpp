@@ -0,0 +1,45 @@
+// SPDX-License-Identifier: Apache-2.0
+//===-- ssvm/test/runtime/globalTest.cpp - Global instance unit tests -----===//
+//
+// Part of the SSVM Project.
+//
+//===----------------------------------------------------------------------===//
+///
+/// \file
+/// This file contents unit tests of the value storage of global instances.
+///
+//===----------------------------------------------------------------------===//
+
+#include "runtime/instance/global.h"
+
+#include "gtest/gtest.h"
+
+namespace {
+
+using namespace SSVM;
+
+TEST(GlobalInstanceTest, Storage__Owned) {
+  Runtime::Instance::GlobalInstance Glob(ValType::I32, ValMut::Var,
+                                         uint32_t(1));
+  EXPECT_FALSE(Glob.isExternalStorage());
+  EXPECT_EQ(retrieveValue<uint32_t>(Glob.getValue()), 1U);
+  Glob.getValue() = uint32_t(2);
+  EXPECT_EQ(retrieveValue<uint32_t>(Glob.getValue()), 2U);
+}
+
+TEST(GlobalInstanceTest, Storage__Block) {
+  ValVariant Block[2] = {uint32_t(0), uint32_t(0)};
+  Runtime::Instance::GlobalInstance Glob(Block[1], ValType::I64, ValMut::Var,
+                                         uint64_t(3));
+  EXPECT_TRUE(Glob.isExternalStorage());
+  /// The value is the slot of the block, so both sides see every write.
+  EXPECT_EQ(&Glob.getValue(), &Block[1]);
+  EXPECT_EQ(retrieveValue<uint64_t>(Block[1]), 3U);
+  Block[1] = uint64_t(4);
+  EXPECT_EQ(retrieveValue<uint64_t>(Glob.getValue()), 4U);
+  Glob.getValue() = uint64_t(5);
+  EXPECT_EQ(retrieveValue<uint64_t>(Block[1]), 5U);
+  EXPECT_EQ(retrieveValue<uint32_t>(Block[0]), 0U);
+}
+
+} // namespace
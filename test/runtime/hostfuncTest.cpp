@@ -0,0 +1,119 @@
+// SPDX-License-Identifier: Apache-2.0
+//===-- ssvm/test/runtime/hostfuncTest.cpp - Host function unit tests -----===//
+//
+// Part of the SSVM Project.
+//
+//===----------------------------------------------------------------------===//
+///
+/// \file
+/// This file contents unit tests of the native thunks of host functions.
+///
+//===----------------------------------------------------------------------===//
+
+#include "runtime/hostfunc.h"
+
+#include "gtest/gtest.h"
+
+#include <string>
+#include <vector>
+
+namespace {
+
+using namespace SSVM;
+
+/// Events of the thunk in calling order.
+std::vector<std::string> Events;
+
+void recordTrap(const uint8_t Code) noexcept {
+  Events.push_back("trap " + std::to_string(Code));
+}
+void recordSignalDisable() noexcept { Events.push_back("disable"); }
+void recordSignalEnable() noexcept { Events.push_back("enable"); }
+
+class Add : public Runtime::HostFunction<Add> {
+public:
+  Add() : HostFunction(3) {}
+  Expect<uint32_t> body(Runtime::Instance::MemoryInstance *, uint32_t A,
+                        uint32_t B) {
+    Events.push_back("body");
+    return A + B;
+  }
+};
+
+class Fail : public Runtime::HostFunction<Fail> {
+public:
+  Expect<double> body(Runtime::Instance::MemoryInstance *, int64_t, float) {
+    Events.push_back("body");
+    return Unexpect(ErrCode::ExecutionFailed);
+  }
+};
+
+class Pair : public Runtime::HostFunction<Pair> {
+public:
+  Expect<std::tuple<uint32_t, uint32_t>>
+  body(Runtime::Instance::MemoryInstance *, uint32_t A) {
+    return std::tuple<uint32_t, uint32_t>(A, A);
+  }
+};
+
+class Ref : public Runtime::HostFunction<Ref> {
+public:
+  Expect<void> body(Runtime::Instance::MemoryInstance *, ExternRef) {
+    return {};
+  }
+};
+
+Runtime::Instance::HostCallEntry makeEntry(Runtime::HostFunctionBase &Func,
+                                           Statistics::Statistics *Stat) {
+  return {Func.getThunk(), &Func, nullptr, Stat, &recordTrap,
+          &recordSignalDisable, &recordSignalEnable};
+}
+
+TEST(HostFunctionTest, Thunk__NumTypesOnly) {
+  EXPECT_NE(Add().getThunk(), nullptr);
+  EXPECT_NE(Fail().getThunk(), nullptr);
+  /// Multiple results and references are not plain C values.
+  EXPECT_EQ(Pair().getThunk(), nullptr);
+  EXPECT_EQ(Ref().getThunk(), nullptr);
+}
+
+TEST(HostFunctionTest, Thunk__SignalHandlersRemoved) {
+  Add Func;
+  Statistics::Statistics Stat;
+  auto Entry = makeEntry(Func, &Stat);
+  using ThunkT = uint32_t (*)(Runtime::Instance::HostCallEntry *, uint32_t,
+                              uint32_t) noexcept;
+  Events.clear();
+  EXPECT_EQ(reinterpret_cast<ThunkT>(Entry.Thunk)(&Entry, 2, 3), 5U);
+  EXPECT_EQ(Events,
+            (std::vector<std::string>{"disable", "body", "enable"}));
+  EXPECT_EQ(Stat.getTotalCost(), 3U);
+}
+
+TEST(HostFunctionTest, Thunk__TrapOnExecutionFailed) {
+  Fail Func;
+  auto Entry = makeEntry(Func, nullptr);
+  using ThunkT = double (*)(Runtime::Instance::HostCallEntry *, int64_t,
+                            float) noexcept;
+  Events.clear();
+  reinterpret_cast<ThunkT>(Entry.Thunk)(&Entry, 1, 2.0f);
+  /// The trap jumps out before the handlers are restored.
+  const std::string Trap =
+      "trap " + std::to_string(uint8_t(ErrCode::ExecutionFailed));
+  EXPECT_EQ(Events,
+            (std::vector<std::string>{"disable", "body", Trap, "enable"}));
+}
+
+TEST(HostFunctionTest, Thunk__TrapOnCostLimit) {
+  Add Func;
+  Statistics::Statistics Stat(2);
+  auto Entry = makeEntry(Func, &Stat);
+  using ThunkT = uint32_t (*)(Runtime::Instance::HostCallEntry *, uint32_t,
+                              uint32_t) noexcept;
+  Events.clear();
+  reinterpret_cast<ThunkT>(Entry.Thunk)(&Entry, 2, 3);
+  EXPECT_EQ(Events.front(),
+            "trap " + std::to_string(uint8_t(ErrCode::CostLimitExceeded)));
+}
+
+} // namespace
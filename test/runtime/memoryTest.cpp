@@ -0,0 +1,97 @@
+// SPDX-License-Identifier: Apache-2.0
+//===-- ssvm/test/runtime/memoryTest.cpp - Memory instance unit tests -----===//
+//
+// Part of the SSVM Project.
+//
+//===----------------------------------------------------------------------===//
+///
+/// \file
+/// This file contents unit tests of the atomic waiting and notifying of
+/// memory instances.
+///
+//===----------------------------------------------------------------------===//
+
+#include "runtime/instance/memory.h"
+
+#include "gtest/gtest.h"
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+namespace {
+
+using namespace SSVM;
+using namespace std::literals;
+
+TEST(MemoryInstanceTest, Atomic__Unshared) {
+  Runtime::Instance::MemoryInstance Mem(AST::Limit(1, 1));
+  EXPECT_FALSE(Mem.isShared());
+  /// Nothing waits on an unshared memory, and waiting on it traps.
+  EXPECT_EQ(Mem.atomicNotify(0, 0, 1), 0U);
+  auto Res = Mem.atomicWait<uint32_t>(0, 0, 0, 0);
+  ASSERT_FALSE(Res);
+  EXPECT_EQ(Res.error(), ErrCode::ExpectSharedMemory);
+}
+
+TEST(MemoryInstanceTest, Atomic__Access) {
+  Runtime::Instance::MemoryInstance Mem(AST::Limit(1, 1, true));
+  EXPECT_TRUE(Mem.isShared());
+  auto Res = Mem.atomicWait<uint32_t>(2, 0, 0, 0);
+  ASSERT_FALSE(Res);
+  EXPECT_EQ(Res.error(), ErrCode::UnalignedAtomicAccess);
+  Res = Mem.atomicNotify(65536, 0, 1);
+  ASSERT_FALSE(Res);
+  EXPECT_EQ(Res.error(), ErrCode::MemoryOutOfBounds);
+  /// Return 1 when the value differs, and 2 when timed out.
+  EXPECT_EQ(Mem.atomicWait<uint32_t>(0, 8, 1, -1), 1U);
+  EXPECT_EQ(Mem.atomicWait<uint64_t>(0, 8, 0, 1000000), 2U);
+  EXPECT_EQ(Mem.atomicNotify(0, 8, 1), 0U);
+}
+
+TEST(MemoryInstanceTest, Atomic__NotifyCount) {
+  Runtime::Instance::MemoryInstance Mem(AST::Limit(1, 1, true));
+  std::atomic<uint32_t> Woken = 0;
+  std::vector<std::thread> Waiters;
+  for (uint32_t I = 0; I < 3; ++I) {
+    Waiters.emplace_back([&Mem, &Woken]() {
+      EXPECT_EQ(Mem.atomicWait<uint32_t>(16, 0, 0, -1), 0U);
+      ++Woken;
+    });
+  }
+  auto WaitWoken = [&Woken](uint32_t Count) {
+    const auto Deadline = std::chrono::steady_clock::now() + 10s;
+    while (Woken < Count && std::chrono::steady_clock::now() < Deadline) {
+      std::this_thread::sleep_for(1ms);
+    }
+    return Woken.load();
+  };
+
+  /// Each notification wakes at most Count waiters, and returns how many it
+  /// woke.
+  uint32_t Notified = 0;
+  const auto Deadline = std::chrono::steady_clock::now() + 10s;
+  while (Notified == 0 && std::chrono::steady_clock::now() < Deadline) {
+    auto Res = Mem.atomicNotify(16, 0, 1);
+    ASSERT_TRUE(Res);
+    EXPECT_LE(*Res, 1U);
+    Notified += *Res;
+  }
+  EXPECT_EQ(WaitWoken(1), 1U);
+  std::this_thread::sleep_for(10ms);
+  EXPECT_EQ(Woken, 1U);
+  while (Notified < 3 && std::chrono::steady_clock::now() < Deadline) {
+    auto Res = Mem.atomicNotify(16, 0, 8);
+    ASSERT_TRUE(Res);
+    Notified += *Res;
+  }
+  EXPECT_EQ(Notified, 3U);
+  EXPECT_EQ(WaitWoken(3), 3U);
+  for (auto &Waiter : Waiters) {
+    Waiter.join();
+  }
+  EXPECT_EQ(Mem.atomicNotify(16, 0, 8), 0U);
+}
+
+} // namespace
@@ -0,0 +1,182 @@
+// SPDX-License-Identifier: Apache-2.0
+//===-- ssvm/test/runtime/storemgrTest.cpp - Store manager unit tests -----===//
+//
+// Part of the SSVM Project.
+//
+//===----------------------------------------------------------------------===//
+///
+/// \file
+/// This file contents unit tests of the store manager.
+///
+//===----------------------------------------------------------------------===//
+
+#include "runtime/storemgr.h"
+
+#include "gtest/gtest.h"
+
+namespace {
+
+using namespace SSVM;
+
+TEST(StoreManagerTest, Reset__DropInstantiated) {
+  Runtime::StoreManager StoreMgr;
+  /// Registered instances.
+  const uint32_t RegMod = StoreMgr.importModule("reg");
+  const uint32_t RegGlob =
+      StoreMgr.importGlobal(ValType::I32, ValMut::Const, uint32_t(1));
+
+  /// Instantiated instances.
+  const uint32_t Mod = StoreMgr.pushModule("");
+  const uint32_t Glob =
+      StoreMgr.pushGlobal(ValType::I64, ValMut::Var, uint64_t(2));
+  EXPECT_EQ(Mod, RegMod + 1);
+  EXPECT_EQ(Glob, RegGlob + 1);
+  auto *OldGlob = *StoreMgr.getGlobal(Glob);
+
+  StoreMgr.reset();
+  EXPECT_FALSE(StoreMgr.getModule(Mod));
+  EXPECT_FALSE(StoreMgr.getGlobal(Glob));
+  ASSERT_TRUE(StoreMgr.getModule(RegMod));
+  EXPECT_EQ((*StoreMgr.getModule(RegMod))->getModuleName(), "reg");
+  ASSERT_TRUE(StoreMgr.getGlobal(RegGlob));
+  EXPECT_EQ(retrieveValue<uint32_t>((*StoreMgr.getGlobal(RegGlob))->getValue()),
+            1U);
+
+  /// The dropped slot is reused by the next instantiation.
+  EXPECT_EQ(StoreMgr.pushGlobal(ValType::F32, ValMut::Const, 3.0f), Glob);
+  auto *NewGlob = *StoreMgr.getGlobal(Glob);
+  EXPECT_EQ(NewGlob, OldGlob);
+  EXPECT_EQ(NewGlob->getValType(), ValType::F32);
+  EXPECT_EQ(retrieveValue<float>(NewGlob->getValue()), 3.0f);
+}
+
+TEST(StoreManagerTest, Reset__AcrossChunks) {
+  Runtime::StoreManager StoreMgr;
+  StoreMgr.importModule("reg");
+  for (uint32_t Round = 0; Round < 3; ++Round) {
+    std::vector<Runtime::Instance::GlobalInstance *> Globs;
+    for (uint32_t I = 0; I < 200; ++I) {
+      const uint32_t Addr = StoreMgr.pushGlobal(ValType::I32, ValMut::Var, I);
+      EXPECT_EQ(Addr, I);
+      Globs.push_back(StoreMgr.unsafeGetGlobal(Addr));
+    }
+    /// Instances never move while more are inserted.
+    for (uint32_t I = 0; I < 200; ++I) {
+      EXPECT_EQ(*StoreMgr.getGlobal(I), Globs[I]);
+      EXPECT_EQ(retrieveValue<uint32_t>(Globs[I]->getValue()), I);
+    }
+    StoreMgr.reset();
+    EXPECT_FALSE(StoreMgr.getGlobal(0));
+    EXPECT_TRUE(StoreMgr.getModule(0));
+  }
+}
+
+TEST(StoreManagerTest, Reset__Registered) {
+  Runtime::StoreManager StoreMgr;
+  StoreMgr.importModule("reg");
+  StoreMgr.importMemory(AST::Limit(1));
+  StoreMgr.pushModule("");
+  StoreMgr.pushMemory(AST::Limit(1));
+
+  StoreMgr.reset(true);
+  EXPECT_FALSE(StoreMgr.getModule(0));
+  EXPECT_FALSE(StoreMgr.getMemory(0));
+  EXPECT_FALSE(StoreMgr.findModule("reg"));
+
+  /// Store is usable after the full reset.
+  EXPECT_EQ(StoreMgr.pushModule(""), 0U);
+  EXPECT_EQ(StoreMgr.pushMemory(AST::Limit(2)), 0U);
+  EXPECT_EQ((*StoreMgr.getMemory(0))->getDataPageSize(), 2U);
+}
+
+TEST(StoreManagerTest, Reset__RegisteredTableEntries) {
+  Runtime::StoreManager StoreMgr;
+  const Runtime::Instance::FType Type;
+  StoreMgr.importModule("reg");
+  const uint32_t Tab = StoreMgr.importTable(RefType::FuncRef, AST::Limit(2));
+  auto *TabInst = *StoreMgr.getTable(Tab);
+  const uint32_t RegFunc = StoreMgr.importFunction(
+      0, Type, std::shared_ptr<const AST::FunctionBody>(), 0);
+
+  /// The instantiated module fills the registered table.
+  const uint32_t Mod = StoreMgr.pushModule("");
+  const uint32_t Func = StoreMgr.pushFunction(
+      Mod, Type, std::shared_ptr<const AST::FunctionBody>(), 0);
+  ASSERT_TRUE(TabInst->setRefAddr(0, genFuncRef(RegFunc)));
+  ASSERT_TRUE(TabInst->setRefAddr(1, genFuncRef(Func)));
+  EXPECT_EQ(TabInst->getCompiledTable()->Entries[1].TypeId, Type.getTypeId());
+
+  /// Only the entry of the dropped function is cleared.
+  StoreMgr.reset();
+  EXPECT_EQ(TabInst->getCompiledTable()->Entries[0].TypeId, Type.getTypeId());
+  EXPECT_EQ(TabInst->getCompiledTable()->Entries[1].TypeId, UINT32_MAX);
+
+  /// The entry stays cleared when the slot is reused by the next module.
+  const uint32_t NewMod = StoreMgr.pushModule("");
+  EXPECT_EQ(StoreMgr.pushFunction(
+                NewMod, Type, std::shared_ptr<const AST::FunctionBody>(), 0),
+            Func);
+  EXPECT_EQ(TabInst->getCompiledTable()->Entries[1].TypeId, UINT32_MAX);
+  ASSERT_TRUE(TabInst->setRefAddr(1, genFuncRef(Func)));
+  EXPECT_EQ(TabInst->getCompiledTable()->Entries[1].TypeId, Type.getTypeId());
+}
+
+TEST(StoreManagerTest, PopModule) {
+  Runtime::StoreManager StoreMgr;
+  const uint32_t Mod = StoreMgr.pushModule("");
+  const uint32_t TmpMod = StoreMgr.pushModule("tmp");
+  StoreMgr.popModule();
+  EXPECT_TRUE(StoreMgr.getModule(Mod));
+  EXPECT_FALSE(StoreMgr.getModule(TmpMod));
+  EXPECT_EQ(StoreMgr.pushModule("next"), TmpMod);
+  EXPECT_EQ((*StoreMgr.getModule(TmpMod))->getModuleName(), "next");
+  EXPECT_EQ((*StoreMgr.getActiveModule())->Addr, TmpMod);
+}
+
+TEST(StoreManagerTest, HostTable__Resolver) {
+  Runtime::Instance::TableInstance Tab(RefType::FuncRef, AST::Limit(1));
+  const Runtime::Instance::FType Type;
+  {
+    Runtime::StoreManager StoreMgr;
+    StoreMgr.importHostTable(Tab);
+    const uint32_t Mod = StoreMgr.pushModule("");
+    const uint32_t Func = StoreMgr.pushFunction(
+        Mod, Type, std::shared_ptr<const AST::FunctionBody>(), 0);
+    ASSERT_TRUE(Tab.setRefAddr(0, genFuncRef(Func)));
+    EXPECT_EQ(Tab.getCompiledTable()->Entries[0].TypeId, Type.getTypeId());
+  }
+  /// The destroyed store no longer resolves references of the host table.
+  ASSERT_TRUE(Tab.setRefAddr(0, genFuncRef(0)));
+  EXPECT_EQ(Tab.getCompiledTable()->Entries[0].TypeId, UINT32_MAX);
+}
+
+TEST(StoreManagerTest, HostTable__ResolverOwner) {
+  Runtime::Instance::TableInstance Tab(RefType::FuncRef, AST::Limit(1));
+  const Runtime::Instance::FType Type;
+  auto StoreA = std::make_unique<Runtime::StoreManager>();
+  StoreA->importHostTable(Tab);
+
+  /// The table is registered again in another store.
+  Runtime::StoreManager StoreB;
+  StoreB.importHostTable(Tab);
+  const uint32_t Mod = StoreB.pushModule("");
+  const uint32_t Func = StoreB.pushFunction(
+      Mod, Type, std::shared_ptr<const AST::FunctionBody>(), 0);
+
+  /// Destroying the first store keeps the resolver of the second one.
+  StoreA.reset();
+  ASSERT_TRUE(Tab.setRefAddr(0, genFuncRef(Func)));
+  EXPECT_EQ(Tab.getCompiledTable()->Entries[0].TypeId, Type.getTypeId());
+
+  /// Resetting the registered instances drops it.
+  StoreB.reset(true);
+  ASSERT_TRUE(Tab.setRefAddr(0, genFuncRef(0)));
+  EXPECT_EQ(Tab.getCompiledTable()->Entries[0].TypeId, UINT32_MAX);
+}
+
+} // namespace
+
+GTEST_API_ int main(int argc, char **argv) {
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,261 @@
+// SPDX-License-Identifier: Apache-2.0
+//===-- ssvm/test/validator/ValidatorTest.cpp - Validator unit tests ------===//
+//
+// Part of the SSVM Project.
+//
+//===----------------------------------------------------------------------===//
+///
+/// \file
+/// This file contents unit tests of validating hand-assembled modules.
+///
+//===----------------------------------------------------------------------===//
+
+#include "common/configure.h"
+#include "common/log.h"
+#include "loader/loader.h"
+#include "validator/validator.h"
+
+#include "gtest/gtest.h"
+
+#include <vector>
+
+namespace {
+
+using namespace SSVM;
+
+/// Load and validate the module, and return the error of the first failed
+/// phase.
+Expect<void> check(const Configure &Conf, const std::vector<Byte> &Data) {
+  Loader::Loader Loader(Conf);
+  Validator::Validator Validator(Conf);
+  auto Module = Loader.parseModule(Data);
+  if (!Module) {
+    return Unexpect(Module);
+  }
+  return Validator.validate(**Module);
+}
+
+/// (module
+///   (type $e (func (param i32)))
+///   (tag (type $e))
+///   (func (type $e) (try (do rethrow 0))))
+std::vector<SSVM::Byte> RethrowTryWasm = {
+    0x00, 0x61, 0x73, 0x6D, 0x01, 0x00, 0x00, 0x00, 0x01, 0x0A, 0x02, 0x60,
+    0x01, 0x7F, 0x00, 0x60, 0x01, 0x7F, 0x01, 0x7F, 0x03, 0x02, 0x01, 0x00,
+    0x0D, 0x03, 0x01, 0x00, 0x00, 0x0A, 0x09, 0x01, 0x07, 0x00, 0x06, 0x40,
+    0x09, 0x00, 0x0B, 0x0B};
+
+/// (module
+///   (type $e (func (param i32)))
+///   (tag (type $e))
+///   (func (type $e) (try (do) (delegate 1))))
+std::vector<SSVM::Byte> DelegateDepthWasm = {
+    0x00, 0x61, 0x73, 0x6D, 0x01, 0x00, 0x00, 0x00, 0x01, 0x0A, 0x02, 0x60,
+    0x01, 0x7F, 0x00, 0x60, 0x01, 0x7F, 0x01, 0x7F, 0x03, 0x02, 0x01, 0x00,
+    0x0D, 0x03, 0x01, 0x00, 0x00, 0x0A, 0x08, 0x01, 0x06, 0x00, 0x06, 0x40,
+    0x18, 0x01, 0x0B};
+
+/// (module
+///   (type $e (func (param i32)))
+///   (tag (type $e))
+///   (func (type $e) local.get 0 throw 1))
+std::vector<SSVM::Byte> ThrowTagWasm = {
+    0x00, 0x61, 0x73, 0x6D, 0x01, 0x00, 0x00, 0x00, 0x01, 0x0A, 0x02, 0x60,
+    0x01, 0x7F, 0x00, 0x60, 0x01, 0x7F, 0x01, 0x7F, 0x03, 0x02, 0x01, 0x00,
+    0x0D, 0x03, 0x01, 0x00, 0x00, 0x0A, 0x08, 0x01, 0x06, 0x00, 0x20, 0x00,
+    0x08, 0x01, 0x0B};
+
+/// (module
+///   (type $e (func (param i32)))
+///   (tag (type $e))
+///   (func (type $e) (try (do) (catch 1))))
+std::vector<SSVM::Byte> CatchTagWasm = {
+    0x00, 0x61, 0x73, 0x6D, 0x01, 0x00, 0x00, 0x00, 0x01, 0x0A, 0x02, 0x60,
+    0x01, 0x7F, 0x00, 0x60, 0x01, 0x7F, 0x01, 0x7F, 0x03, 0x02, 0x01, 0x00,
+    0x0D, 0x03, 0x01, 0x00, 0x00, 0x0A, 0x09, 0x01, 0x07, 0x00, 0x06, 0x40,
+    0x07, 0x01, 0x0B, 0x0B};
+
+/// (module
+///   (type $t1 (func (param v128) (result v128)))
+///   (type $t2 (func (param v128 v128) (result v128)))
+///   (type $t3 (func (param v128 v128 v128) (result v128)))
+///   ;; One function for each relaxed SIMD instruction, from 0xFD 0x100 to
+///   ;; 0xFD 0x113, taking its operands from the parameters.
+///   (func (type $t2) local.get 0 local.get 1 i8x16.relaxed_swizzle)
+///   (func (type $t1) local.get 0 i32x4.relaxed_trunc_f32x4_s)
+///   ...
+///   (func (type $t3)
+///     local.get 0 local.get 1 local.get 2
+///     i32x4.relaxed_dot_i8x16_i7x16_add_s))
+std::vector<SSVM::Byte> RelaxedSIMDWasm = {
+    0x00, 0x61, 0x73, 0x6D, 0x01, 0x00, 0x00, 0x00, 0x01, 0x13, 0x03, 0x60,
+    0x01, 0x7B, 0x01, 0x7B, 0x60, 0x02, 0x7B, 0x7B, 0x01, 0x7B, 0x60, 0x03,
+    0x7B, 0x7B, 0x7B, 0x01, 0x7B, 0x03, 0x15, 0x14, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x02, 0x0A, 0xD3, 0x01, 0x14, 0x09, 0x00, 0x20, 0x00,
+    0x20, 0x01, 0xFD, 0x80, 0x02, 0x0B, 0x07, 0x00, 0x20, 0x00, 0xFD, 0x81,
+    0x02, 0x0B, 0x07, 0x00, 0x20, 0x00, 0xFD, 0x82, 0x02, 0x0B, 0x07, 0x00,
+    0x20, 0x00, 0xFD, 0x83, 0x02, 0x0B, 0x07, 0x00, 0x20, 0x00, 0xFD, 0x84,
+    0x02, 0x0B, 0x0B, 0x00, 0x20, 0x00, 0x20, 0x01, 0x20, 0x02, 0xFD, 0x85,
+    0x02, 0x0B, 0x0B, 0x00, 0x20, 0x00, 0x20, 0x01, 0x20, 0x02, 0xFD, 0x86,
+    0x02, 0x0B, 0x0B, 0x00, 0x20, 0x00, 0x20, 0x01, 0x20, 0x02, 0xFD, 0x87,
+    0x02, 0x0B, 0x0B, 0x00, 0x20, 0x00, 0x20, 0x01, 0x20, 0x02, 0xFD, 0x88,
+    0x02, 0x0B, 0x0B, 0x00, 0x20, 0x00, 0x20, 0x01, 0x20, 0x02, 0xFD, 0x89,
+    0x02, 0x0B, 0x0B, 0x00, 0x20, 0x00, 0x20, 0x01, 0x20, 0x02, 0xFD, 0x8A,
+    0x02, 0x0B, 0x0B, 0x00, 0x20, 0x00, 0x20, 0x01, 0x20, 0x02, 0xFD, 0x8B,
+    0x02, 0x0B, 0x0B, 0x00, 0x20, 0x00, 0x20, 0x01, 0x20, 0x02, 0xFD, 0x8C,
+    0x02, 0x0B, 0x09, 0x00, 0x20, 0x00, 0x20, 0x01, 0xFD, 0x8D, 0x02, 0x0B,
+    0x09, 0x00, 0x20, 0x00, 0x20, 0x01, 0xFD, 0x8E, 0x02, 0x0B, 0x09, 0x00,
+    0x20, 0x00, 0x20, 0x01, 0xFD, 0x8F, 0x02, 0x0B, 0x09, 0x00, 0x20, 0x00,
+    0x20, 0x01, 0xFD, 0x90, 0x02, 0x0B, 0x09, 0x00, 0x20, 0x00, 0x20, 0x01,
+    0xFD, 0x91, 0x02, 0x0B, 0x09, 0x00, 0x20, 0x00, 0x20, 0x01, 0xFD, 0x92,
+    0x02, 0x0B, 0x0B, 0x00, 0x20, 0x00, 0x20, 0x01, 0x20, 0x02, 0xFD, 0x93,
+    0x02, 0x0B};
+
+/// (module
+///   (type $t1 (func (param v128) (result v128)))
+///   (type $t2 (func (param v128 v128) (result v128)))
+///   (type $t3 (func (param v128 v128 v128) (result v128)))
+///   (func (type $t2) local.get 0 local.get 1 f32x4.relaxed_madd))
+std::vector<SSVM::Byte> MAddArityWasm = {
+    0x00, 0x61, 0x73, 0x6D, 0x01, 0x00, 0x00, 0x00, 0x01, 0x13, 0x03, 0x60,
+    0x01, 0x7B, 0x01, 0x7B, 0x60, 0x02, 0x7B, 0x7B, 0x01, 0x7B, 0x60, 0x03,
+    0x7B, 0x7B, 0x7B, 0x01, 0x7B, 0x03, 0x02, 0x01, 0x01, 0x0A, 0x0B, 0x01,
+    0x09, 0x00, 0x20, 0x00, 0x20, 0x01, 0xFD, 0x85, 0x02, 0x0B};
+
+/// (module (memory 1 2 shared))
+std::vector<SSVM::Byte> SharedMemoryWasm = {
+    0x00, 0x61, 0x73, 0x6D, 0x01, 0x00, 0x00, 0x00, 0x05, 0x04, 0x01, 0x03,
+    0x01, 0x02};
+
+/// (module (memory 1 shared)), which has no maximum.
+std::vector<SSVM::Byte> SharedNoMaxWasm = {
+    0x00, 0x61, 0x73, 0x6D, 0x01, 0x00, 0x00, 0x00, 0x05, 0x03, 0x01, 0x02,
+    0x01};
+
+/// (module (table 1 2 shared funcref)), which is not a valid table.
+std::vector<SSVM::Byte> SharedTableWasm = {
+    0x00, 0x61, 0x73, 0x6D, 0x01, 0x00, 0x00, 0x00, 0x04, 0x05, 0x01, 0x70,
+    0x03, 0x01, 0x02};
+
+/// (module
+///   (memory 1 1 shared)
+///   (func (drop (i32.atomic.load align=2 (i32.const 0)))))
+std::vector<SSVM::Byte> AtomicAlignWasm = {
+    0x00, 0x61, 0x73, 0x6D, 0x01, 0x00, 0x00, 0x00, 0x01, 0x04, 0x01, 0x60,
+    0x00, 0x00, 0x03, 0x02, 0x01, 0x00, 0x05, 0x04, 0x01, 0x03, 0x01, 0x01,
+    0x0A, 0x0B, 0x01, 0x09, 0x00, 0x41, 0x00, 0xFE, 0x10, 0x01, 0x00, 0x1A,
+    0x0B};
+
+TEST(ValidatorTest, ExceptionHandling__NeedProposal) {
+  Configure Conf;
+  auto Res = check(Conf, CatchTagWasm);
+  ASSERT_FALSE(Res);
+  EXPECT_EQ(Res.error(), ErrCode::InvalidGrammar);
+}
+
+TEST(ValidatorTest, ExceptionHandling__RethrowOutsideCatch) {
+  Configure Conf;
+  Conf.addProposal(Proposal::ExceptionHandling);
+  auto Res = check(Conf, RethrowTryWasm);
+  ASSERT_FALSE(Res);
+  EXPECT_EQ(Res.error(), ErrCode::InvalidLabelIdx);
+}
+
+TEST(ValidatorTest, ExceptionHandling__DelegateDepth) {
+  Configure Conf;
+  Conf.addProposal(Proposal::ExceptionHandling);
+  /// The label of delegate is counted from the block enclosing the try.
+  auto Res = check(Conf, DelegateDepthWasm);
+  ASSERT_FALSE(Res);
+  EXPECT_EQ(Res.error(), ErrCode::InvalidLabelIdx);
+  auto Valid = DelegateDepthWasm;
+  Valid[Valid.size() - 2] = 0x00;
+  EXPECT_TRUE(check(Conf, Valid));
+}
+
+TEST(ValidatorTest, ExceptionHandling__UnknownTag) {
+  Configure Conf;
+  Conf.addProposal(Proposal::ExceptionHandling);
+  auto Res = check(Conf, ThrowTagWasm);
+  ASSERT_FALSE(Res);
+  EXPECT_EQ(Res.error(), ErrCode::InvalidTagIdx);
+  Res = check(Conf, CatchTagWasm);
+  ASSERT_FALSE(Res);
+  EXPECT_EQ(Res.error(), ErrCode::InvalidTagIdx);
+}
+
+TEST(ValidatorTest, RelaxedSIMD__OperandTypes) {
+  Configure Conf;
+  Conf.addProposal(Proposal::SIMD);
+  Conf.addProposal(Proposal::RelaxedSIMD);
+  EXPECT_TRUE(check(Conf, RelaxedSIMDWasm));
+  auto Res = check(Conf, MAddArityWasm);
+  ASSERT_FALSE(Res);
+  EXPECT_EQ(Res.error(), ErrCode::TypeCheckFailed);
+}
+
+TEST(ValidatorTest, RelaxedSIMD__NeedProposal) {
+  Configure Conf;
+  Conf.addProposal(Proposal::SIMD);
+  /// Without relaxed SIMD, only the first encodings are the non-standard
+  /// SIMD instructions.
+  auto Res = check(Conf, RelaxedSIMDWasm);
+  ASSERT_FALSE(Res);
+  EXPECT_EQ(Res.error(), ErrCode::InvalidGrammar);
+}
+
+TEST(ValidatorTest, StackHeight__RecordedInModule) {
+  Configure Conf;
+  Conf.addProposal(Proposal::SIMD);
+  Conf.addProposal(Proposal::RelaxedSIMD);
+  Loader::Loader Loader(Conf);
+  Validator::Validator Validator(Conf);
+  auto Module = Loader.parseModule(RelaxedSIMDWasm);
+  ASSERT_TRUE(Module);
+  const AST::Module Copy = **Module;
+  ASSERT_TRUE(Validator.validate(**Module));
+  const auto &Segs = (*Module)->getCodeSection().getContent();
+  EXPECT_EQ(Segs[0].getMaxStackHeight(), 2U);
+  EXPECT_EQ(Segs[5].getMaxStackHeight(), 3U);
+  /// The copy shares the function bodies, but not the recorded heights.
+  const auto CopySegs = Copy.getCodeSection().getContent();
+  EXPECT_EQ(CopySegs[5].getBody(), Segs[5].getBody());
+  EXPECT_EQ(CopySegs[5].getMaxStackHeight(), 0U);
+}
+
+TEST(ValidatorTest, Threads__SharedMemory) {
+  Configure Conf;
+  auto Res = check(Conf, SharedMemoryWasm);
+  ASSERT_FALSE(Res);
+  EXPECT_EQ(Res.error(), ErrCode::InvalidGrammar);
+  Conf.addProposal(Proposal::Threads);
+  EXPECT_TRUE(check(Conf, SharedMemoryWasm));
+  /// Shared memories need a maximum, and tables can not be shared.
+  Res = check(Conf, SharedNoMaxWasm);
+  ASSERT_FALSE(Res);
+  EXPECT_EQ(Res.error(), ErrCode::InvalidGrammar);
+  Res = check(Conf, SharedTableWasm);
+  ASSERT_FALSE(Res);
+  EXPECT_EQ(Res.error(), ErrCode::InvalidGrammar);
+}
+
+TEST(ValidatorTest, Threads__AtomicAlignment) {
+  Configure Conf;
+  Conf.addProposal(Proposal::Threads);
+  /// Atomic accesses must be naturally aligned.
+  auto Res = check(Conf, AtomicAlignWasm);
+  ASSERT_FALSE(Res);
+  EXPECT_EQ(Res.error(), ErrCode::InvalidAlignment);
+  auto Valid = AtomicAlignWasm;
+  Valid[Valid.size() - 4] = 0x02;
+  EXPECT_TRUE(check(Conf, Valid));
+}
+
+} // namespace
+
+GTEST_API_ int main(int argc, char **argv) {
+  SSVM::Log::setErrorLoggingLevel();
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
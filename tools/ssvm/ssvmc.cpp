@@ -29,11 +29,61 @@ int main(int Argc, const char *Argv[]) {
   PO::Option<PO::Toggle> GasMeasuring(PO::Description(
       "Generate code for counting gas burned during execution."sv));
 
+  PO::Option<PO::Toggle> RelaxedFP(PO::Description(
+      "Generate ordinary floating-point code instead of constrained code. "
+      "Operations are not fused or reordered, but constant folds may keep "
+      "the payload of signaling NaNs."sv));
+
+  PO::Option<int> Jobs(
+      PO::Description("Number of threads to optimize and generate code."sv),
+      PO::MetaVar("N"sv), PO::DefaultValue<int>(1));
+
+  PO::Option<std::string> CacheDir(
+      PO::Description("Reuse object code of unchanged functions from the "
+                      "cache in DIR."sv),
+      PO::MetaVar("DIR"sv));
+
+  PO::Option<int> CachePartitions(
+      PO::Description("Split the code into at least N partitions when the "
+                      "cache is enabled. More partitions recompile less after "
+                      "a change, but block inlining between them and make "
+                      "the code slower and larger."sv),
+      PO::MetaVar("N"sv), PO::DefaultValue<int>(16));
+
+  PO::Option<std::string> TargetCPUs(
+      PO::Description("Comma separated target CPUs, from the baseline to the "
+                      "most capable. The loader runs the code of the last one "
+                      "supported by the host. Default to the host CPU."sv),
+      PO::MetaVar("CPUS"sv));
+
+  PO::Option<std::string> BoundsChecks(
+      PO::Description("Memory bounds checking, \"guard\" to rely on guard "
+                      "pages, or \"explicit\" to compare and branch so "
+                      "memories need no large reservation. Default to "
+                      "guard."sv),
+      PO::MetaVar("MODE"sv));
+
+  PO::Option<std::string> Remarks(
+      PO::Description("Write optimization remarks in YAML to FILE, with "
+                      "functions named after wasm function names and "
+                      "indices."sv),
+      PO::MetaVar("FILE"sv));
+
+  PO::Option<PO::Toggle> TimePasses(PO::Description(
+      "Report the time spent in each compilation stage and optimization "
+      "pass."sv));
+
   PO::Option<PO::Toggle> BulkMemoryOperations(
       PO::Description("Enable Bulk-memory operations"sv));
   PO::Option<PO::Toggle> ReferenceTypes(
       PO::Description("Enable Reference types (externref)"sv));
   PO::Option<PO::Toggle> SIMD(PO::Description("Enable SIMD"sv));
+  PO::Option<PO::Toggle> RelaxedSIMD(
+      PO::Description("Enable Relaxed SIMD, which implies SIMD"sv));
+  PO::Option<PO::Toggle> ExceptionHandling(
+      PO::Description("Enable Exception handling"sv));
+  PO::Option<PO::Toggle> Threads(
+      PO::Description("Enable Threads (shared memories and atomics)"sv));
   PO::Option<PO::Toggle> All(PO::Description("Enable all features"sv));
 
   auto Parser = PO::ArgumentParser();
@@ -42,9 +92,21 @@ int main(int Argc, const char *Argv[]) {
            .add_option("dump"sv, DumpIR)
            .add_option("ic"sv, InstructionCounting)
            .add_option("gas"sv, GasMeasuring)
+           .add_option("relaxed-fp"sv, RelaxedFP)
+           .add_option("j"sv, Jobs)
+           .add_option("jobs"sv, Jobs)
+           .add_option("cache-dir"sv, CacheDir)
+           .add_option("cache-partitions"sv, CachePartitions)
+           .add_option("target-cpus"sv, TargetCPUs)
+           .add_option("bounds-checks"sv, BoundsChecks)
+           .add_option("remarks"sv, Remarks)
+           .add_option("time-passes"sv, TimePasses)
            .add_option("enable-bulk-memory"sv, BulkMemoryOperations)
            .add_option("enable-reference-types"sv, ReferenceTypes)
            .add_option("enable-simd"sv, SIMD)
+           .add_option("enable-relaxed-simd"sv, RelaxedSIMD)
+           .add_option("enable-exception-handling"sv, ExceptionHandling)
+           .add_option("enable-threads"sv, Threads)
            .add_option("enable-all"sv, All)
            .parse(Argc, Argv)) {
     return EXIT_FAILURE;
@@ -54,6 +116,12 @@ int main(int Argc, const char *Argv[]) {
     return EXIT_SUCCESS;
   }
 
+  if (const auto &Mode = BoundsChecks.value();
+      !Mode.empty() && Mode != "guard"sv && Mode != "explicit"sv) {
+    std::cout << "Unknown bounds checking mode: "sv << Mode << std::endl;
+    return EXIT_FAILURE;
+  }
+
   SSVM::Configure Conf;
   if (BulkMemoryOperations.value()) {
     Conf.addProposal(SSVM::Proposal::BulkMemoryOperations);
@@ -64,10 +132,23 @@ int main(int Argc, const char *Argv[]) {
   if (SIMD.value()) {
     Conf.addProposal(SSVM::Proposal::SIMD);
   }
+  if (RelaxedSIMD.value()) {
+    Conf.addProposal(SSVM::Proposal::SIMD);
+    Conf.addProposal(SSVM::Proposal::RelaxedSIMD);
+  }
+  if (ExceptionHandling.value()) {
+    Conf.addProposal(SSVM::Proposal::ExceptionHandling);
+  }
+  if (Threads.value()) {
+    Conf.addProposal(SSVM::Proposal::Threads);
+  }
   if (All.value()) {
     Conf.addProposal(SSVM::Proposal::BulkMemoryOperations);
     Conf.addProposal(SSVM::Proposal::ReferenceTypes);
     Conf.addProposal(SSVM::Proposal::SIMD);
+    Conf.addProposal(SSVM::Proposal::RelaxedSIMD);
+    Conf.addProposal(SSVM::Proposal::ExceptionHandling);
+    Conf.addProposal(SSVM::Proposal::Threads);
   }
 
   std::filesystem::path InputPath = std::filesystem::absolute(WasmName.value());
@@ -112,6 +193,39 @@ int main(int Argc, const char *Argv[]) {
     if (GasMeasuring.value()) {
       Compiler.setGasMeasuring();
     }
+    if (RelaxedFP.value()) {
+      Compiler.setRelaxedFP();
+    }
+    if (Jobs.value() > 1) {
+      Compiler.setThreads(Jobs.value());
+    }
+    if (!CacheDir.value().empty()) {
+      Compiler.setCacheDirectory(CacheDir.value());
+      if (CachePartitions.value() > 0) {
+        Compiler.setCachePartitions(CachePartitions.value());
+      }
+    }
+    if (!TargetCPUs.value().empty()) {
+      std::vector<std::string> CPUs;
+      std::string_view List = TargetCPUs.value();
+      while (!List.empty()) {
+        const auto Pos = std::min(List.find(','), List.size());
+        if (Pos > 0) {
+          CPUs.emplace_back(List.substr(0, Pos));
+        }
+        List.remove_prefix(std::min(Pos + 1, List.size()));
+      }
+      Compiler.setTargetCPUs(std::move(CPUs));
+    }
+    if (BoundsChecks.value() == "explicit"sv) {
+      Compiler.setBoundsChecks();
+    }
+    if (!Remarks.value().empty()) {
+      Compiler.setRemarksPath(std::filesystem::absolute(Remarks.value()));
+    }
+    if (TimePasses.value()) {
+      Compiler.setTimePasses();
+    }
     if (auto Res = Compiler.compile(Data, *Module, OutputPath); !Res) {
       const auto Err = static_cast<uint32_t>(Res.error());
       std::cout << "Compile failed. Error code:" << Err << std::endl;
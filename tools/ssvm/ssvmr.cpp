@@ -44,6 +44,12 @@ int main(int Argc, const char *Argv[]) {
   PO::Option<PO::Toggle> ReferenceTypes(
       PO::Description("Enable Reference types (externref)"sv));
   PO::Option<PO::Toggle> SIMD(PO::Description("Enable SIMD"sv));
+  PO::Option<PO::Toggle> RelaxedSIMD(
+      PO::Description("Enable Relaxed SIMD, which implies SIMD"sv));
+  PO::Option<PO::Toggle> ExceptionHandling(
+      PO::Description("Enable Exception handling"sv));
+  PO::Option<PO::Toggle> Threads(
+      PO::Description("Enable Threads (shared memories and atomics)"sv));
   PO::Option<PO::Toggle> All(PO::Description("Enable all features"sv));
 
   PO::List<int> MemLim(
@@ -51,6 +57,11 @@ int main(int Argc, const char *Argv[]) {
           "Limitation of pages(as size of 64 KiB) in every memory instance. Upper bound can be specified as --memory-page-limit `PAGE_COUNT`."sv),
       PO::MetaVar("PAGE_COUNT"sv));
 
+  PO::List<uint64_t> StackSize(
+      PO::Description(
+          "Size in KiB of the pre-reserved interpreter value stack. Label and frame stacks are sized proportionally. Can be specified as --stack-size `KIB`."sv),
+      PO::MetaVar("KIB"sv));
+
   PO::List<std::string> AllowCmd(
       PO::Description(
           "Allow commands called from ssvm_process host functions. Each command can be specified as --allow-command `COMMAND`."sv),
@@ -58,6 +69,11 @@ int main(int Argc, const char *Argv[]) {
   PO::Option<PO::Toggle> AllowCmdAll(PO::Description(
       "Allow all commands called from ssvm_process host functions."sv));
 
+  PO::Option<PO::Toggle> PerfMap(PO::Description(
+      "Write /tmp/perf-<pid>.map for perf to symbolize compiled wasm functions."sv));
+  PO::Option<PO::Toggle> JitDump(PO::Description(
+      "Write jit-<pid>.dump into JITDUMPDIR or the working directory for perf inject --jit."sv));
+
   auto Parser = PO::ArgumentParser();
   if (!Parser.add_option(SoName)
            .add_option(Args)
@@ -67,10 +83,16 @@ int main(int Argc, const char *Argv[]) {
            .add_option("enable-bulk-memory"sv, BulkMemoryOperations)
            .add_option("enable-reference-types"sv, ReferenceTypes)
            .add_option("enable-simd"sv, SIMD)
+           .add_option("enable-relaxed-simd"sv, RelaxedSIMD)
+           .add_option("enable-exception-handling"sv, ExceptionHandling)
+           .add_option("enable-threads"sv, Threads)
            .add_option("enable-all"sv, All)
            .add_option("memory-page-limit"sv, MemLim)
+           .add_option("stack-size"sv, StackSize)
            .add_option("allow-command"sv, AllowCmd)
            .add_option("allow-command-all"sv, AllowCmdAll)
+           .add_option("perf-map"sv, PerfMap)
+           .add_option("jitdump"sv, JitDump)
            .parse(Argc, Argv)) {
     return EXIT_FAILURE;
   }
@@ -89,17 +111,49 @@ int main(int Argc, const char *Argv[]) {
   if (SIMD.value()) {
     Conf.addProposal(SSVM::Proposal::SIMD);
   }
+  if (RelaxedSIMD.value()) {
+    Conf.addProposal(SSVM::Proposal::SIMD);
+    Conf.addProposal(SSVM::Proposal::RelaxedSIMD);
+  }
+  if (ExceptionHandling.value()) {
+    Conf.addProposal(SSVM::Proposal::ExceptionHandling);
+  }
+  if (Threads.value()) {
+    Conf.addProposal(SSVM::Proposal::Threads);
+  }
   if (All.value()) {
     Conf.addProposal(SSVM::Proposal::BulkMemoryOperations);
     Conf.addProposal(SSVM::Proposal::ReferenceTypes);
     Conf.addProposal(SSVM::Proposal::SIMD);
+    Conf.addProposal(SSVM::Proposal::RelaxedSIMD);
+    Conf.addProposal(SSVM::Proposal::ExceptionHandling);
+    Conf.addProposal(SSVM::Proposal::Threads);
   }
   if (MemLim.value().size() > 0) {
     Conf.setMaxMemoryPage(MemLim.value().back());
   }
+  if (StackSize.value().size() > 0) {
+    /// Negative values are parsed as wrapped around large sizes.
+    const uint64_t KiB = StackSize.value().back();
+    if (KiB == 0 || KiB > UINT32_MAX / 1024) {
+      std::cerr << "The stack size must be between 1 and "sv
+                << UINT32_MAX / 1024 << " KiB.\n"sv;
+      return EXIT_FAILURE;
+    }
+    Conf.setMaxStackSize(KiB * 1024);
+  }
+  if (PerfMap.value()) {
+    Conf.setPerfMap();
+  }
+  if (JitDump.value()) {
+    Conf.setJitDump();
+  }
 
   Conf.addHostRegistration(SSVM::HostRegistration::Wasi);
   Conf.addHostRegistration(SSVM::HostRegistration::SSVM_Process);
+  if (Conf.hasProposal(SSVM::Proposal::Threads)) {
+    Conf.addHostRegistration(SSVM::HostRegistration::WasiThreads);
+  }
   const auto InputPath = std::filesystem::absolute(SoName.value());
   SSVM::VM::VM VM(Conf);
 
@@ -166,9 +220,10 @@ int main(int Argc, const char *Argv[]) {
     }
 
     std::vector<SSVM::ValVariant> FuncArgs;
-    for (size_t I = 0;
-         I < FuncType.Params.size() && I + 1 < Args.value().size(); ++I) {
-      switch (FuncType.Params[I]) {
+    const auto &ParamTypes = FuncType.getParamTypes();
+    for (size_t I = 0; I < ParamTypes.size() && I + 1 < Args.value().size();
+         ++I) {
+      switch (ParamTypes[I]) {
       case SSVM::ValType::I32: {
         const uint32_t Value = std::stoll(Args.value()[I + 1]);
         FuncArgs.emplace_back(Value);
@@ -194,9 +249,8 @@ int main(int Argc, const char *Argv[]) {
         break;
       }
     }
-    if (FuncType.Params.size() + 1 < Args.value().size()) {
-      for (size_t I = FuncType.Params.size() + 1; I < Args.value().size();
-           ++I) {
+    if (ParamTypes.size() + 1 < Args.value().size()) {
+      for (size_t I = ParamTypes.size() + 1; I < Args.value().size(); ++I) {
         const uint64_t Value = std::stoll(Args.value()[I]);
         FuncArgs.emplace_back(Value);
       }
@@ -204,8 +258,8 @@ int main(int Argc, const char *Argv[]) {
 
     if (auto Result = VM.execute(FuncName, FuncArgs)) {
       /// Print results.
-      for (size_t I = 0; I < FuncType.Returns.size(); ++I) {
-        switch (FuncType.Returns[I]) {
+      for (size_t I = 0; I < FuncType.getReturnTypes().size(); ++I) {
+        switch (FuncType.getReturnTypes()[I]) {
         case SSVM::ValType::I32:
           std::cout << std::get<uint32_t>((*Result)[I]) << '\n';
           break;